@@ -0,0 +1,187 @@
+#!/bin/bash
+# bench.sh performance benchmark script $Revision: 1.1 $
+# Decompiles a set of test binaries with fixed switches, a few times each, and records the wall time, the time of
+# each phase (see -M), the peak resident set size, the objects and heap bytes allocated, and the procs and statements
+# decompiled per second. The medians are compared with a stored baseline; a metric regresses if it is worse by more
+# than the tolerance, and by more than three times the spread (median absolute deviation) of the runs.
+#
+# Call with [-r runs] [-t tolerance%] [-b baseline] [-s] [-l list file] [-a switches] [test binary...]
+# e.g. "./bench.sh"						compare the default set with bench.baseline (if there is one)
+# or   "./bench.sh -s"					save the results as the new baseline
+# or   "./bench.sh -r 9 test/sparc/banner"
+# or   "./bench.sh -a -pp"				compare pruned SSA with a baseline saved without it
+# The list file has one test binary (e.g. test/pentium/hello) per line; # starts a comment
+# The exit status is 1 if anything regressed (or failed), else 0
+#
+# 17 Oct 26 - Created
+# 17 Oct 26 - -a for switches to measure
+#
+
+RUNS=5
+TOLERANCE=10						# Percent
+BASELINE=bench.baseline
+SAVE=0
+LIST=""
+
+# The switches are fixed, so that runs can be compared: no log (its time varies with the disk), and -M for the
+# report that the metrics are taken from
+BENCHSW="-nL -M"
+EXTRASW=""							# -a: switches being measured
+
+# Phases shorter than this (in seconds) are too noisy to compare
+MINSECS=0.02
+
+while getopts "r:t:b:sl:a:" opt; do
+	case $opt in
+		r) RUNS=$OPTARG ;;
+		t) TOLERANCE=$OPTARG ;;
+		b) BASELINE=$OPTARG ;;
+		s) SAVE=1 ;;
+		l) LIST=$OPTARG ;;
+		a) EXTRASW="$EXTRASW $OPTARG" ;;
+		*) echo "usage: $0 [-r runs] [-t tolerance%] [-b baseline] [-s] [-l list file] [-a switches] [test binary...]"; exit 2 ;;
+	esac
+done
+shift $((OPTIND - 1))
+
+if [[ $# -gt 0 ]]; then
+	TESTS="$*"
+elif [[ -n "$LIST" ]]; then
+	TESTS=`sed -e "s/#.*//" $LIST`
+else
+	TESTS="test/pentium/hello test/pentium/fibo-O4 test/pentium/switch_gcc test/pentium/nestedswitch
+		test/pentium/banner test/pentium/encrypt test/pentium/suse_true
+		test/sparc/hello test/sparc/fibo-O4 test/sparc/switch_gcc test/sparc/banner test/sparc/daysofxmas
+		test/ppc/fibo test/ppc/switch test/ppc/banner"
+fi
+
+if [[ ! -x ./boomerang ]]; then
+	echo "no ./boomerang; make it first"
+	exit 2
+fi
+
+# Clean up
+rm -rf bench
+mkdir bench
+rm -f bench.res
+
+FAILED=0
+for t in $TESTS; do
+	name=`echo $t | sed -e "s/^test\///" -e "s/\//./g"`
+	mkdir bench/$name
+	echo -n "$t:"
+	for ((run = 1; run <= RUNS; run++)); do
+		rm -rf bench/out
+		start=`date +%s%N`
+		./boomerang -o bench/out $BENCHSW $EXTRASW $t > bench/$name/$run.txt 2>/dev/null
+		ret=$?
+		end=`date +%s%N`
+		if [[ ret -ne 0 ]] || ! grep -q "^procs: " bench/$name/$run.txt; then
+			echo " FAILED (exit status $ret)"
+			FAILED=1
+			continue 2
+		fi
+		echo -n " $run"
+		# One "metric value" line for each metric of this run
+		awk -v wall=$(( (end - start) / 1000 )) '
+			/^time and allocations per phase/ { inTable = 1; getline; next }
+			/^procs: /			{ inTable = 0; procs = $2 }
+			/^statements: /		{ stmts = $2 }
+			/^peak RSS: /		{ print "rssKB", $3 }
+			inTable && NF >= 6 && $NF ~ /^[0-9]+$/ {
+				# phase times secs heapBytes objects regionBytes; the name may have spaces
+				phase = $1
+				for (i = 2; i <= NF - 5; i++)
+					phase = phase "_" $i
+				print "secs." phase, $(NF-3)
+				heap += $(NF-2); objects += $(NF-1); region += $NF
+			}
+			END {
+				secs = wall / 1e6
+				print "wallSecs", secs
+				print "heapBytes", heap
+				print "objects", objects
+				print "regionBytes", region
+				print "procs", procs
+				print "statements", stmts
+				if (secs > 0) {
+					print "procsPerSec", procs / secs
+					print "stmtsPerSec", stmts / secs
+				}
+			}' bench/$name/$run.txt > bench/$name/$run.metrics
+	done
+	echo
+	# The median and the median absolute deviation of each metric over the runs
+	cat bench/$name/*.metrics | sort -k1,1 -k2,2g | awk -v name=$name '
+		function median(a, n) {
+			return (n % 2) ? a[(n + 1) / 2] : (a[n / 2] + a[n / 2 + 1]) / 2
+		}
+		function flush(   i, j, m, x, d) {
+			if (metric == "")
+				return
+			m = median(v, count)
+			for (i = 1; i <= count; i++) {
+				# Insertion sort of the deviations (v is already sorted)
+				x = (v[i] > m) ? v[i] - m : m - v[i]
+				for (j = i - 1; j >= 1 && d[j] > x; j--)
+					d[j + 1] = d[j]
+				d[j + 1] = x
+			}
+			printf "%s %s %.6g %.6g\n", name, metric, m, median(d, count)
+		}
+		$1 != metric { flush(); metric = $1; count = 0 }
+		{ v[++count] = $2 }
+		END { flush() }' >> bench.res
+done
+
+echo
+awk '$2 == "wallSecs" || $2 == "rssKB" || $2 == "stmtsPerSec" { printf "%-28s %-12s %12s (+- %s)\n", $1, $2, $3, $4 }' \
+	bench.res
+
+if [[ $SAVE -eq 1 ]]; then
+	cp bench.res $BASELINE
+	echo
+	echo "baseline saved to $BASELINE"
+	exit $FAILED
+fi
+
+if [[ ! -f $BASELINE ]]; then
+	echo
+	echo "no baseline ($BASELINE) to compare with; save one with -s"
+	exit $FAILED
+fi
+
+echo
+echo "=== Compared with $BASELINE (tolerance $TOLERANCE%) ==="
+# Higher is better for the rates, lower for everything else. The counts (objects, statements, etc) should not vary
+# between runs, so their spread is 0 and any change beyond the tolerance is reported
+awk -v tol=$TOLERANCE -v minsecs=$MINSECS '
+	FNR == NR { base[$1 " " $2] = $3; baseDev[$1 " " $2] = $4; next }
+	{
+		key = $1 " " $2
+		if (!(key in base))
+			next
+		b = base[key]; c = $3
+		if ($2 ~ /^secs\./ && b < minsecs && c < minsecs)
+			next
+		worse = ($2 ~ /PerSec$/) ? b - c : c - b
+		allowed = b * tol / 100
+		noise = 3 * (baseDev[key] + $4)
+		if (noise > allowed)
+			allowed = noise
+		change = (b != 0) ? (c - b) * 100 / b : 0
+		if (worse > allowed) {
+			printf "REGRESSION %-28s %-28s %12.6g -> %-12.6g (%+.1f%%)\n", $1, $2, b, c, change
+			regressions++
+		} else if (-worse > allowed)
+			printf "improved   %-28s %-28s %12.6g -> %-12.6g (%+.1f%%)\n", $1, $2, b, c, change
+	}
+	END {
+		if (regressions) {
+			print regressions " regression(s)"
+			exit 1
+		}
+		print "no regressions"
+	}' $BASELINE bench.res || FAILED=1
+
+exit $FAILED
@@ -10,6 +10,22 @@
  *
  * 28 Jan 05 - G. Krol: Separated -h output into sections and neatened
  * 02 Sep 06 - Mike: introduced USE_XML to make it easy to disable use of the expat library
+ * 17 Oct 26 - Added -I (intern expressions)
+ * 17 Oct 26 - Added -B (decoder benchmark)
+ * 17 Oct 26 - Added -j (parallel decompilation)
+ * 17 Oct 26 - -LD and -SD use a binary checkpoint; XML is still read by -LD (if enabled), and by the load command
+ * 17 Oct 26 - Added -M (bytes allocated per phase)
+ * 17 Oct 26 - Added -nL (no log); the log is flushed at exit and on a crash
+ * 17 Oct 26 - Added -gt (Chrome trace of the phases); -M reports the time of each phase too
+ * 17 Oct 26 - -M also reports the procs and statements decompiled, and the peak resident set size (for bench.sh)
+ * 17 Oct 26 - -S is a time budget: procs are cut back rather than the process stopped. Added -Sm, -St and -Sa
+ * 17 Oct 26 - Added -F (free procs once their code is written)
+ * 17 Oct 26 - -j also decodes on several threads
+ * 17 Oct 26 - -j help: instruction predecode is parallel; procs and CFGs are still built on one thread
+ * 17 Oct 26 - Added -Lc and -Ll (log categories and level); the log is flushed without locks on a crash
+ * 17 Oct 26 - Added -C (size of the decode cache); -M reports its hits and misses
+ * 17 Oct 26 - Added -pp (pruned SSA); -M reports the phi functions placed and avoided
+ * 17 Oct 26 - Added -ns (no splicing of switch arms)
 */
 
 #define VERSION "alpha 0.3.1 09/Sep/2006"
@@ -31,8 +47,10 @@
 #else
 #include <sys/stat.h>		// For mkdir
 #include <unistd.h>			// For unlink
-#include <signal.h>
+#include <sys/resource.h>	// For getrusage
+#include <fcntl.h>			// For open
 #endif
+#include <signal.h>
 #if defined(_MSC_VER) || defined(__MINGW32__)
 #include <windows.h>
 #endif
@@ -40,11 +58,17 @@
 #include "proc.h"
 #include "BinaryFile.h"
 #include "frontend.h"
+#include "decoder.h"
 #include "hllcode.h"
 #include "codegen/chllcode.h"
 //#include "transformer.h"
 #include "boomerang.h"
 #include "log.h"
+#include "checkpoint.h"
+#include "region.h"
+#include "phase.h"
+#include "budget.h"
+#include "decodecache.h"
 #if USE_XML
 #include "xmlprogparser.h"
 #endif
@@ -79,7 +103,9 @@ Boomerang::Boomerang() : logger(NULL), vFlag(false), printRtl(false),
 	loadBeforeDecompile(false), saveBeforeDecompile(false),
 	noProve(false), noChangeSignatures(false), conTypeAnalysis(false), dfaTypeAnalysis(true),
 	propMaxDepth(3), generateCallGraph(false), generateSymbols(false), noGlobals(false), assumeABI(false),
-	experimental(false), minsToStopAfter(0)
+	experimental(false), minsToStopAfter(0), decodeBenchPasses(0), numThreads(1), memStats(false),
+	noLog(false), logCategories(LCAT_ALL), logLevel(LL_DEBUG), traceFile(NULL), freeAfterCode(false),
+	decodeCacheBytes(64 * 1024 * 1024), prunedSSA(false), noSplice(false)
 {
 	progPath = "./";
 	outputPath = "./output/";
@@ -92,10 +118,86 @@ Log &Boomerang::log() {
 	return *logger;
 }
 
+/**
+ * Sets the logger, after writing what the old one holds.
+ */
+void Boomerang::setLogger(Log *l) {
+	if (logger)
+		logger->flush();
+	logger = l;
+}
+
+void Boomerang::flushLog() {
+	if (logger)
+		logger->flush();
+}
+
+// Write what the log holds at exit, or when a fatal signal stops the process (then stop as the signal would have)
+static void flushLogAtExit() {
+	Boomerang::get()->flushLog();
+}
+
+static void flushLogOnSignal(int sig) {
+	Boomerang::get()->flushLogOnSignal();
+	signal(sig, SIG_DFL);
+	raise(sig);
+}
+
+/**
+ * Writes what the logger holds from a signal handler: the thread that crashed may hold the logger's locks.
+ */
+void Boomerang::flushLogOnSignal() {
+	if (logger)
+		logger->flushOnSignal();
+}
+
+/**
+ * Sets the log categories from a comma separated list of their names (for -Lc).
+ * \return False if a name is not known.
+ */
+static bool parseLogCategories(const char* list, unsigned& cats) {
+	static const struct {const char* name; unsigned cat;} names[] = {
+		{"general", LCAT_GENERAL}, {"decode", LCAT_DECODE}, {"dataflow", LCAT_DATAFLOW}, {"types", LCAT_TYPES},
+		{"codegen", LCAT_CODEGEN}, {"all", LCAT_ALL}
+	};
+	cats = 0;
+	while (*list) {
+		size_t len = strcspn(list, ",");
+		unsigned i;
+		for (i=0; i < sizeof(names)/sizeof(names[0]); i++)
+			if (strlen(names[i].name) == len && strncmp(list, names[i].name, len) == 0)
+				break;
+		if (i == sizeof(names)/sizeof(names[0]))
+			return false;
+		cats |= names[i].cat;
+		list += len;
+		if (*list == ',') list++;
+	}
+	return true;
+}
+
 /**
  * Sets the outputfile to be the file "log" in the default output directory.
  */
-FileLogger::FileLogger() : out((Boomerang::get()->getOutputPath() + "log").c_str()) {
+FileLogger::FileLogger() : out((Boomerang::get()->getOutputPath() + "log").c_str()), buf(pending), os(&buf),
+		osFlags(os.flags()), fd(-1) {
+#if HAVE_THREADS
+	// Appending, so that what flushOnSignal writes goes after what out has written
+	fd = open((Boomerang::get()->getOutputPath() + "log").c_str(), O_WRONLY | O_APPEND);
+#endif
+	static bool hooked = false;
+	if (!hooked) {
+		hooked = true;
+		atexit(flushLogAtExit);
+		signal(SIGSEGV, flushLogOnSignal);
+		signal(SIGABRT, flushLogOnSignal);		// E.g. a failed assert
+		signal(SIGFPE, flushLogOnSignal);
+		signal(SIGILL, flushLogOnSignal);
+#ifdef SIGBUS
+		signal(SIGBUS, flushLogOnSignal);
+#endif
+	}
+	startWriter();
 }
 
 /**
@@ -154,16 +256,24 @@ void Boomerang::help() {
 	std::cout << "  -E <addr>        : Decode the procedure at addr, no callees\n";
 	std::cout << "                     Use -e and -E repeatedly for multiple entry points\n";
 	std::cout << "  -ic              : Decode through type 0 Indirect Calls\n";
-	std::cout << "  -S <min>         : Stop decompilation after specified number of minutes\n";
+	std::cout << "  -S <min>         : Time budget: after this many minutes, cut back the decompilation of the\n";
+	std::cout << "                     remaining procedures (stop at twice this)\n";
+	std::cout << "  -Sm <MB>         : Memory budget: cut back the remaining procedures once the heap is this big\n";
+	std::cout << "  -St <secs>       : Time budget per procedure\n";
+	std::cout << "  -Sa <MB>         : Budget of memory allocated per procedure\n";
 	std::cout << "  -t               : Trace (print address of) every instruction decoded\n";
 	std::cout << "  -Tc              : Use old constraint-based type analysis\n";
 	std::cout << "  -Td              : Use data-flow-based type analysis\n";
-#if USE_XML
-	std::cout << "  -LD              : Load before decompile (<program> becomes xml input file)\n";
-	std::cout << "  -SD              : Save before decompile\n";
-#endif
+	std::cout << "  -LD              : Load before decompile (<program> becomes the checkpoint saved by -SD)\n";
+	std::cout << "  -SD              : Save a checkpoint before decompile (output/<name>/<name>.ckpt)\n";
 	std::cout << "  -a               : Assume ABI compliance\n";
+	std::cout << "  -I               : Intern (hash cons) expressions used as dataflow keys\n";
+	std::cout << "  -j <threads>     : Decompile independent procedures, and predecode their instructions, on up to\n";
+	std::cout << "                     <threads> threads (procedures are still added to the CFG on one thread)\n";
+	std::cout << "  -C <MB>          : Keep up to <MB> megabytes of decoded instructions, to be reused when procedures\n";
+	std::cout << "                     are decoded again (default 64; 0 for none)\n";
 	std::cout << "  -W               : Windows specific decompilation mode (requires pdb information)\n";
+	std::cout << "  -pp              : Pruned SSA: only place phi functions where the location is live\n";
 //	std::cout << "  -pa              : only propagate if can propagate to all\n";
 	std::cout << "Output\n";
 	std::cout << "  -v               : Verbose\n";
@@ -174,11 +284,16 @@ void Boomerang::help() {
 	std::cout << "  -gd <dot file>   : Generate a dotty graph of the program's CFG and DFG\n";
 	std::cout << "  -gc              : Generate a call graph (callgraph.out and callgraph.dot)\n";
 	std::cout << "  -gs              : Generate a symbol file (symbols.h)\n";
+	std::cout << "  -gt <trace file> : Write the time and allocations of each phase as a Chrome trace (JSON)\n";
 	std::cout << "  -iw              : Write indirect call report to output/indirect.txt\n";
+	std::cout << "  -F               : Free the CFG and statements of each procedure once its code is written\n";
 	std::cout << "Misc.\n";
 	std::cout << "  -k               : Command mode, for available commands see -h cmd\n";
 	std::cout << "  -P <path>        : Path to Boomerang files, defaults to where you run\n";
 	std::cout << "                     Boomerang from\n";
+	std::cout << "  -B <passes>      : Benchmark the decoder: decode every code section <passes>\n";
+	std::cout << "                     times, report instructions per second, and exit\n";
+	std::cout << "  -M               : Report the time and allocations of each phase\n";
 	std::cout << "  -X               : activate eXperimental code; errors likely\n";
 	std::cout << "  --               : No effect (used for testing)\n";
 	std::cout << "Debug\n";
@@ -197,6 +312,11 @@ void Boomerang::help() {
 	std::cout << "  -nd              : No (reduced) dataflow analysis\n";
 	std::cout << "  -nD              : No decompilation (at all!)\n";
 	std::cout << "  -nl              : No creation of local variables\n";
+	std::cout << "  -nL              : No log (output/log stays empty)\n";
+	std::cout << "  -Lc <categories> : Only log these categories: a comma separated list of general, decode, dataflow,\n";
+	std::cout << "                     types, codegen or all (default all)\n";
+	std::cout << "  -Ll <level>      : Only log up to this level: 0 errors, 1 warnings, 2 information, 3 debug (whole\n";
+	std::cout << "                     procedures; default)\n";
 //	std::cout << "  -nm              : No decoding of the 'main' procedure\n";
 	std::cout << "  -ng              : No replacement of expressions with Globals\n";
 	std::cout << "  -nG              : No garbage collection\n";
@@ -206,6 +326,7 @@ void Boomerang::help() {
 	std::cout << "                     DriverMain)\n";
 	std::cout << "  -nr              : No removal of unneeded labels\n";
 	std::cout << "  -nR              : No removal of unused Returns\n";
+	std::cout << "  -ns              : No splicing of switch arms; decompile the proc again instead (slower)\n";
 	std::cout << "  -l <depth>       : Limit multi-propagations to expressions with depth <depth>\n";
 	std::cout << "  -p <num>         : Only do num propagations\n";
 	std::cout << "  -m <num>         : Max memory depth\n";
@@ -737,6 +858,15 @@ int Boomerang::commandLine(int argc, const char **argv)
 					generateSymbols=true;
 					stopBeforeDecompile=true;
 				}
+				else if (argv[i][2] == 't') {
+					if (++i == argc) {
+						usage();
+						return 1;
+					}
+					traceFile = argv[i];
+					Phase::active = true;
+					Region::counting = true;
+				}
 				break;
 			case 'o': {
 				outputPath = argv[++i];
@@ -750,6 +880,8 @@ int Boomerang::commandLine(int argc, const char **argv)
 					propOnlyToAll = true;
 					std::cerr << " * * Warning! -pa is not implemented yet!\n";
 				}
+				else if (argv[i][2] == 'p')
+					prunedSSA = true;
 				else {
 					if (++i == argc) {
 						usage();
@@ -793,6 +925,12 @@ int Boomerang::commandLine(int argc, const char **argv)
 					case 'g':
 						noGlobals = true;
 						break;
+					case 'L':
+						noLog = true;
+						break;
+					case 's':
+						noSplice = true;
+						break;
 					case 'G':
 #ifndef NO_GARBAGE_COLLECTOR
 						GC_disable();
@@ -903,21 +1041,37 @@ int Boomerang::commandLine(int argc, const char **argv)
 				break;
 			case 'L':
 				if (argv[i][2] == 'D')
-					#if USE_XML
 					loadBeforeDecompile = true;
-					#else
-					std::cerr << "LD command not enabled since compiled without USE_XML\n";
-					#endif
+				else if (argv[i][2] == 'c' || argv[i][2] == 'l') {
+					if (++i == argc) {
+						usage();
+						return 1;
+					}
+					if (argv[i-1][2] == 'l')
+						logLevel = atoi(argv[i]);
+					else if (!parseLogCategories(argv[i], logCategories)) {
+						std::cerr << "-Lc: unknown log category in " << argv[i] << "\n";
+						return 1;
+					}
+				}
 				break;
 			case 'S':
 				if (argv[i][2] == 'D')
-					#if USE_XML
 					saveBeforeDecompile = true;
-					#else
-					std::cerr << "SD command not enabled since compiled without USE_XML\n";
-					#endif
 				else {
-					sscanf(argv[++i], "%i", &minsToStopAfter);					
+					if (++i == argc) {
+						usage();
+						return 1;
+					}
+					double n = atof(argv[i]);
+					switch (argv[i-1][2]) {
+						case 'm': Budget::globalBytes = (size_t)(n * 1024 * 1024); break;
+						case 't': Budget::procSecs = n; break;
+						case 'a': Budget::procBytes = (size_t)(n * 1024 * 1024); break;
+						default:
+							minsToStopAfter = (int)n;
+							Budget::globalSecs = n * 60;
+					}
 				}
 				break;
 			case 'k':
@@ -931,6 +1085,45 @@ int Boomerang::commandLine(int argc, const char **argv)
 			case 'a':
 				assumeABI = true;
 				break;
+			case 'I':
+				Exp::interning = true;
+				break;
+			case 'j':
+				if (++i == argc) {
+					usage();
+					return 1;
+				}
+				sscanf(argv[i], "%i", &numThreads);
+#if !HAVE_THREADS
+				if (numThreads > 1)
+					std::cerr << "-j: parallel decompilation is not supported on this platform\n";
+				numThreads = 1;
+#endif
+				if (numThreads < 1)
+					numThreads = 1;
+				break;
+			case 'F':
+				freeAfterCode = true;
+				break;
+			case 'C':
+				if (++i == argc) {
+					usage();
+					return 1;
+				}
+				decodeCacheBytes = (size_t)(atof(argv[i]) * 1024 * 1024);
+				break;
+			case 'M':
+				memStats = true;
+				Phase::active = true;
+				Region::counting = true;
+				break;
+			case 'B':
+				if (++i == argc) {
+					usage();
+					return 1;
+				}
+				sscanf(argv[i], "%i", &decodeBenchPasses);
+				break;
 			case 'l':
 				if (++i == argc) {
 					usage();
@@ -948,6 +1141,9 @@ int Boomerang::commandLine(int argc, const char **argv)
 	if (kmd)
 		return cmdLine();
 
+	if (decodeBenchPasses)
+		return benchDecode(argv[argc-1], decodeBenchPasses);
+
 	return decompile(argv[argc-1]);	   
 }
 
@@ -1090,7 +1286,7 @@ DWORD WINAPI stopProcess(
     time_t start
 )
 {
-	int mins = Boomerang::get()->minsToStopAfter;
+	int mins = Boomerang::get()->minsToStopAfter * 2;
 	while(1) {
 		time_t now;
 		time(&now);
@@ -1124,46 +1320,53 @@ int Boomerang::decompile(const char *fname, const char *pname)
 	time_t start;
 	time(&start);
 
+	Budget::startGlobal();
 	if (minsToStopAfter) {
-		std::cout << "stopping decompile after " << minsToStopAfter << " minutes.\n";
+		std::cout << "cutting back the decompilation after " << minsToStopAfter << " minutes.\n";
+		// In case something that doesn't check the budget takes too long
 #if defined(_WIN32) 			// Includes MinGW
 		DWORD id;
 		CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)stopProcess, (LPVOID)start, 0, &id);
 #else
 		signal(SIGALRM, stopProcess);
-		alarm(minsToStopAfter * 60);
+		alarm(minsToStopAfter * 60 * 2);
 #endif
 	}
 
 //	std::cout << "setting up transformers...\n";
 //	ExpTransformer::loadAll();
 
-#if USE_XML
 	if (loadBeforeDecompile) {
 		std::cout << "loading persisted state...\n";
-		XMLProgParser *p = new XMLProgParser();
-		prog = p->parse(fname);
-	} else
+#if USE_XML
+		if (!Checkpoint::isCheckpoint(fname)) {
+			XMLProgParser *p = new XMLProgParser();
+			prog = p->parse(fname);
+		} else
 #endif
-	{
+		prog = Checkpoint::load(fname);
+		if (prog == NULL)
+			return 1;
+	} else {
+		Phase ph("decode");
 		prog = loadAndDecode(fname, pname);
 		if (prog == NULL)
 			return 1;
 	}
 
-#if USE_XML
 	if (saveBeforeDecompile) {
 		std::cout << "saving persistable state...\n";
-		XMLProgParser *p = new XMLProgParser();
-		p->persistToXML(prog);
+		Checkpoint::save(prog, prog->getRootCluster()->getOutPath("ckpt"));
 	}
-#endif
 
 	if (stopBeforeDecompile)
 		return 0;
 
 	std::cout << "decompiling...\n";
-	prog->decompile();
+	{
+		Phase ph("decompile");		// What the per proc phases don't count: global analyses, etc
+		prog->decompile();
+	}
 
 	if (dotFile)
 		prog->generateDotFile();
@@ -1179,10 +1382,30 @@ int Boomerang::decompile(const char *fname, const char *pname)
 			}
 	}
 
+	// Counted now, as -F frees the statements of each proc once its code is written
+	int procs = 0, stmts = 0, phisPlaced = 0, phisAvoided = 0;
+	if (memStats) {
+		PROGMAP::const_iterator it;
+		for (Proc *p = prog->getFirstProc(it); p; p = prog->getNextProc(it))
+			if (!p->isLib() && ((UserProc*)p)->isDecoded()) {
+				StatementList sl;
+				((UserProc*)p)->loadBody();
+				((UserProc*)p)->getStatements(sl);
+				procs++;
+				stmts += sl.size();
+				phisPlaced += ((UserProc*)p)->getDataFlow()->getPhisPlaced();
+				phisAvoided += ((UserProc*)p)->getDataFlow()->getPhisAvoided();
+			}
+	}
+
 	std::cout << "generating code...\n";
-	prog->generateCode();
+	{
+		Phase ph("code generation");
+		prog->generateCode();
+	}
 
 	std::cout << "output written to " << outputPath << prog->getRootCluster()->getName() << "\n";
+	Budget::report(std::cout);
 
 	if (Boomerang::get()->ofsIndCallReport)
 		ofsIndCallReport->close();
@@ -1199,6 +1422,76 @@ int Boomerang::decompile(const char *fname, const char *pname)
 		std::cout << mins << " mins ";
 	std::cout << secs << " sec" << (secs == 1 ? "" : "s") << ".\n";
 
+	if (memStats) {
+		Phase::report(std::cout);
+		std::cout << "procs: " << procs << "\n";
+		std::cout << "statements: " << stmts << "\n";
+		std::cout << "phi functions: " << phisPlaced << " placed, " << phisAvoided << " avoided (-pp)\n";
+		prog->getDecodeCache()->report(std::cout);
+#ifndef _WIN32
+		struct rusage ru;
+		if (getrusage(RUSAGE_SELF, &ru) == 0)
+			std::cout << "peak RSS: " << ru.ru_maxrss << " KB\n";		// As Linux reports it
+#endif
+	}
+	if (traceFile && Phase::writeTrace(traceFile))
+		std::cout << "trace written to " << traceFile << "\n";
+
+	return 0;
+}
+
+/**
+ * Measures the throughput of the instruction decoder. Every code section of the file is decoded linearly (without
+ * following control flow), \a passes times over, and the number of instructions decoded per second of CPU time is
+ * printed. Nothing is decompiled.
+ *
+ * \param fname The name of the file to load.
+ * \param passes The number of times to decode the code sections.
+ *
+ * \return Zero on success, nonzero on faillure.
+ */
+int Boomerang::benchDecode(const char *fname, int passes)
+{
+	Prog *prog = new Prog();
+	FrontEnd *fe = FrontEnd::Load(fname, prog);
+	if (fe == NULL) {
+		std::cerr << "failed.\n";
+		return 1;
+	}
+	prog->setFrontEnd(fe);
+	BinaryFile *pBF = fe->getBinaryFile();
+
+	unsigned numInsts = 0, numBytes = 0, numInvalid = 0;
+	clock_t start = clock();
+	for (int pass = 0; pass < passes; pass++) {
+		for (int i = 0; i < pBF->GetNumSections(); i++) {
+			PSectionInfo pSect = pBF->GetSectionInfo(i);
+			if (!pSect->bCode)
+				continue;
+			ADDRESS pc = pSect->uNativeAddr;
+			ADDRESS end = pc + pSect->uSectionSize;
+			while (pc < end) {
+				DecodeResult& inst = fe->decodeInstruction(pc);
+				int n = inst.numBytes;
+				if (!inst.valid || n <= 0) {
+					numInvalid++;
+					n = 1;				// Resynchronise one byte at a time
+				}
+				if (inst.rtl)
+					delete inst.rtl;
+				numInsts++;
+				numBytes += n;
+				pc += n;
+			}
+		}
+	}
+	double secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+	std::cout << "decoded " << std::dec << numInsts << " instructions (" << numBytes << " bytes, " << numInvalid <<
+		" invalid) in " << secs << " secs";
+	if (secs > 0)
+		std::cout << ": " << (int)(numInsts / secs) << " instructions/sec";
+	std::cout << "\n";
 	return 0;
 }
 
@@ -1234,6 +1527,7 @@ void Boomerang::logTail() {
 }
 
 void Boomerang::alert_decompile_debug_point(UserProc *p, const char *description) {
+	MutexLock ml(alertLock);
 	if (stopAtDebugPoints) {
 		std::cout << "decompiling " << p->getName() << ": " << description << "\n";
 		static char *stopAt = NULL;
@@ -7,11 +7,16 @@
  * $Revision: 1.9 $
  *
  * 03 Dec 02 - Trent: Created
+ * 17 Oct 26 - testSignatureDB
+ * 17 Oct 26 - testSignatureDB checks that the named types are saved in the database
  */
 
 #include <sstream>
+#include <fstream>
+#include <stdio.h>
 #include "CTest.h"
 #include "sigenum.h"
+#include "sigdb.h"
 
 /*==============================================================================
  * FUNCTION:        CTest::registerTests
@@ -26,10 +31,11 @@ suite->addTest(new CppUnit::TestCaller<CTest> ("testC", \
 void CTest::registerTests(CppUnit::TestSuite* suite) {
 
     MYTEST(testSignature);
+    MYTEST(testSignatureDB);
 }
 
 int CTest::countTestCases () const
-{ return 1; }   // ? What's this for?
+{ return 2; }   // ? What's this for?
 
 /*==============================================================================
  * FUNCTION:        CTest::setUp
@@ -75,3 +81,48 @@ void CTest::testSignature () {
     delete t;
 }
 
+
+/*==============================================================================
+ * FUNCTION:        CTest::testSignatureDB
+ * OVERVIEW:        Test building, reopening and looking up a precompiled signature database
+ * PARAMETERS:      <none>
+ * RETURNS:         <nothing>
+ *============================================================================*/
+void CTest::testSignatureDB () {
+    const char* hdr = "sigdbtest.h";
+    const char* db = "sigdbtest.sigdb";
+    std::ofstream ofs(hdr);
+    ofs << "/* A comment; with a semicolon */\n";
+    ofs << "typedef int sigdbtest_t;\n";
+    ofs << "struct sigdbtest_s { int a; char b; };\n";
+    ofs << "int puts(char *s);\n";
+    ofs << "sigdbtest_t strange(int x, ...);   // Another comment\n";
+    ofs.close();
+    std::vector<SignatureDB::Source> sources;
+    sources.push_back(SignatureDB::Source(hdr, hdr, CONV_C));
+
+    for (int pass = 0; pass < 2; pass++) {      // Pass 0 builds the database, pass 1 maps it
+        Type::clearNamedTypes();
+        SignatureDB sdb;
+        sdb.open(db, sources, PLAT_PENTIUM);
+        CPPUNIT_ASSERT_EQUAL(2, sdb.getNumSignatures());
+        CPPUNIT_ASSERT(Type::getNamedType("sigdbtest_t") == NULL);     // Building doesn't define them
+        sdb.readTypes();
+        CPPUNIT_ASSERT(Type::getNamedType("sigdbtest_t") != NULL);
+        CPPUNIT_ASSERT(Type::getNamedType("sigdbtest_t")->resolvesToInteger());
+        Type* st = Type::getNamedType("struct sigdbtest_s");
+        CPPUNIT_ASSERT(st != NULL && st->isCompound());
+        CPPUNIT_ASSERT_EQUAL(2, (int)((CompoundType*)st)->getNumTypes());
+        CPPUNIT_ASSERT(sdb.lookup("printf") == NULL);
+        Signature* sig = sdb.lookup("puts");
+        CPPUNIT_ASSERT(sig != NULL);
+        CPPUNIT_ASSERT_EQUAL(std::string("puts"), std::string(sig->getName()));
+        CPPUNIT_ASSERT_EQUAL(1, (int)sig->getNumParams());
+        sig = sdb.lookup("strange");
+        CPPUNIT_ASSERT(sig != NULL);
+        CPPUNIT_ASSERT(sig->hasEllipsis());
+        CPPUNIT_ASSERT_EQUAL(std::string(hdr), std::string(sig->getSigFile()));
+    }
+    remove(hdr);
+    remove(db);
+}
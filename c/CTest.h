@@ -20,5 +20,6 @@ class CTest : public CppUnit::TestCase {
     void tearDown ();
 
     void testSignature();
+    void testSignatureDB();
 };
 
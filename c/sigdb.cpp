@@ -0,0 +1,372 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   sigdb.cpp
+ * OVERVIEW:   Implementation of class SignatureDB, the precompiled library signature headers
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created
+ * 17 Oct 26 - The named types are stored parsed (as in a checkpoint); the temporary file's name has the process id
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <process.h>			// For _getpid
+#define getpid _getpid
+#else
+#include <unistd.h>				// For getpid
+#endif
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <map>
+#include "types.h"
+#include "BinaryFile.h"			// For mapFile
+#include "type.h"
+#include "checkpoint.h"			// For saveTypes, loadTypes
+#include "signature.h"
+#include "boomerang.h"
+#include "log.h"
+#include "ansi-c-parser.h"
+#include "sigdb.h"
+
+/*
+ * The database is the image of a file:
+ *	SigDBHeader
+ *	SigDBFile[numFiles]			One per header, in catalog order
+ *	SigDBSig[numSigs]			Sorted by name
+ *	text						The names and the declarations (not nul terminated). The type declarations of each
+ *								  header are together, in order, so that they can be parsed in one go. Then the
+ *								  named types that they define, already parsed (see Checkpoint::saveTypes)
+ * All offsets are from the start of the text. Integers are in host order; the magic number includes the size of an
+ * unsigned int, and a foreign or old database is just rebuilt.
+ */
+#define SIGDB_MAGIC		0x42445353		// "SSDB" on a little endian host
+#define SIGDB_VERSION	(0x200 | sizeof(unsigned))
+
+struct SigDBHeader {
+	unsigned	magic;
+	unsigned	version;
+	unsigned	plat;
+	unsigned	numFiles;
+	unsigned	numSigs;
+	unsigned	textSize;
+	unsigned	typesSaved;				// True if the named types are saved; else readTypes parses the declarations
+	unsigned	savedTypes;				// Offset and length of the saved named types
+	unsigned	savedTypesLen;
+};
+
+struct SigDBFile {
+	unsigned	name;					// Offset of the name as in the catalog (nul terminated)
+	unsigned	cc;
+	unsigned	mtime;					// Of the header, when the database was built
+	unsigned	size;
+	unsigned	types;					// Offset and length of the type declarations
+	unsigned	typesLen;
+};
+
+struct SigDBSig {
+	unsigned	name;					// Offset of the function name (nul terminated)
+	unsigned	decl;					// Offset and length of the declaration
+	unsigned	declLen;
+	unsigned	file;					// Index of the header
+};
+
+static const SigDBHeader* header(const char* image) { return (const SigDBHeader*)image; }
+static const SigDBFile* files(const char* image) { return (const SigDBFile*)(image + sizeof(SigDBHeader)); }
+static const SigDBSig* sigs(const char* image) {
+	return (const SigDBSig*)(files(image) + header(image)->numFiles);
+}
+static const char* text(const char* image) { return (const char*)(sigs(image) + header(image)->numSigs); }
+
+// Get the modification time and size of file path. Returns false if it does not exist
+static bool fileStamp(const char* path, unsigned& mtime, unsigned& size) {
+	struct stat st;
+	if (stat(path, &st) != 0)
+		return false;
+	mtime = (unsigned)st.st_mtime;
+	size = (unsigned)st.st_size;
+	return true;
+}
+
+// Split the text of a header into its top level declarations (each ending with a semicolon), with comments removed
+static void splitDecls(const std::string& s, std::vector<std::string>& decls) {
+	std::string cur;
+	int depth = 0;
+	for (size_t i = 0; i < s.size(); i++) {
+		if (s[i] == '/' && i+1 < s.size() && s[i+1] == '*') {
+			size_t e = s.find("*/", i+2);
+			if (e == std::string::npos) break;
+			i = e+1;
+			cur += ' ';
+			continue;
+		}
+		if (s[i] == '/' && i+1 < s.size() && s[i+1] == '/') {
+			size_t e = s.find('\n', i);
+			if (e == std::string::npos) break;
+			i = e;
+			cur += '\n';
+			continue;
+		}
+		cur += s[i];
+		if (s[i] == '{') depth++;
+		else if (s[i] == '}') depth--;
+		else if (s[i] == ';' && depth == 0) {
+			if (cur.find_first_not_of(" \t\r\n;") != std::string::npos)
+				decls.push_back(cur);
+			cur = "";
+		}
+	}
+	if (cur.find_first_not_of(" \t\r\n") != std::string::npos)
+		decls.push_back(cur);			// Probably a syntax error; the parser can complain about it
+}
+
+SignatureDB::SignatureDB() : image(NULL), size(0), mapped(false), plat(PLAT_GENERIC) {
+}
+
+SignatureDB::~SignatureDB() {
+	close();
+}
+
+void SignatureDB::close() {
+	if (mapped)
+		BinaryFile::unmapImage((char*)image, size);
+	image = NULL;
+	size = 0;
+	mapped = false;
+	buf.clear();
+}
+
+/*==============================================================================
+ * FUNCTION:		SignatureDB::open
+ * OVERVIEW:		Map the database at dbPath; if it is missing, or was not built from the given headers for this
+ *					  platform, or any of them has changed since, build it again first
+ * PARAMETERS:		dbPath: the file for the database
+ *					sources: the headers named in the catalog, in order
+ *					plat: the platform that the signatures are for
+ *============================================================================*/
+void SignatureDB::open(const char* dbPath, const std::vector<Source>& sources, platform plat) {
+	close();
+	this->sources = sources;
+	this->plat = plat;
+	image = BinaryFile::mapFile(dbPath, size);
+	mapped = image != NULL;
+	if (image && valid())
+		return;
+	close();
+	build(dbPath);
+	image = BinaryFile::mapFile(dbPath, size);
+	mapped = image != NULL;
+	if (image && valid())
+		return;
+	// Could not write it (e.g. a read only install); use the copy in buf
+	if (mapped)
+		BinaryFile::unmapImage((char*)image, size);
+	mapped = false;
+	image = &buf[0];
+	size = buf.size();
+}
+
+bool SignatureDB::valid() {
+	if (size < sizeof(SigDBHeader))
+		return false;
+	const SigDBHeader* h = header(image);
+	if (h->magic != SIGDB_MAGIC || h->version != SIGDB_VERSION || h->plat != (unsigned)plat ||
+			h->numFiles != sources.size())
+		return false;
+	if (size != sizeof(SigDBHeader) + h->numFiles * sizeof(SigDBFile) + h->numSigs * sizeof(SigDBSig) + h->textSize)
+		return false;
+	const SigDBFile* f = files(image);
+	const char* t = text(image);
+	for (unsigned i = 0; i < h->numFiles; i++) {
+		if (sources[i].name != t + f[i].name || f[i].cc != (unsigned)sources[i].cc)
+			return false;
+		unsigned mtime, sz;
+		if (!fileStamp(sources[i].path.c_str(), mtime, sz) || mtime != f[i].mtime || sz != f[i].size)
+			return false;
+	}
+	return true;
+}
+
+/*==============================================================================
+ * FUNCTION:		SignatureDB::build
+ * OVERVIEW:		Build the database in buf from the headers, and write it to dbPath if possible. Each declaration
+ *					  is parsed on its own, to find the function signatures and their names; the rest are type
+ *					  declarations
+ * PARAMETERS:		dbPath: the file for the database
+ *============================================================================*/
+void SignatureDB::build(const char* dbPath) {
+	if (VERBOSE)
+		LOG << "building the signature database " << dbPath << "\n";
+	std::string t;
+	std::vector<SigDBFile> f(sources.size());
+	std::map<std::string, SigDBSig> found;		// By name; a later declaration replaces an earlier one
+	for (unsigned i = 0; i < sources.size(); i++) {
+		std::ifstream ifs(sources[i].path.c_str(), std::ios::in | std::ios::binary);
+		if (!ifs.good()) {
+			std::cerr << "can't open `" << sources[i].path << "'\n";
+			exit(1);
+		}
+		std::stringstream ss;
+		ss << ifs.rdbuf();
+		std::vector<std::string> decls;
+		splitDecls(ss.str(), decls);
+
+		f[i].name = t.size();
+		t.append(sources[i].name.c_str(), sources[i].name.size() + 1);
+		f[i].cc = sources[i].cc;
+		fileStamp(sources[i].path.c_str(), f[i].mtime, f[i].size);
+		std::string types;
+		for (unsigned d = 0; d < decls.size(); d++) {
+			std::istringstream is(decls[d]);
+			AnsiCParser *p = new AnsiCParser(is, false);
+			p->yyparse(plat, sources[i].cc);
+			if (p->signatures.size() == 1 && p->symbols.empty() && p->refs.empty()) {
+				const char* nam = p->signatures.front()->getName();
+				SigDBSig& s = found[nam];
+				s.name = t.size();
+				t.append(nam, strlen(nam) + 1);
+				s.decl = t.size();
+				s.declLen = decls[d].size();
+				t += decls[d];
+				s.file = i;
+			} else
+				types += decls[d];
+			delete p;
+		}
+		f[i].types = t.size();
+		f[i].typesLen = types.size();
+		t += types;
+	}
+
+	// Parse the type declarations as readTypes would, to save the named types that they define. The named types are
+	// put back as they were afterwards: it is readTypes that defines them
+	std::map<std::string, Type*>& named = Type::getNamedTypes();
+	std::map<std::string, Type*> before = named;
+	for (unsigned i = 0; i < sources.size(); i++)
+		parseTypes(t.data() + f[i].types, f[i].typesLen, sources[i].cc);
+	std::map<std::string, Type*> defined;
+	for (std::map<std::string, Type*>::iterator it = named.begin(); it != named.end(); it++)
+		if (before.find(it->first) == before.end())
+			defined[it->first] = it->second;
+	named = before;
+	std::string saved;
+	bool typesSaved = Checkpoint::saveTypes(defined, saved);
+
+	SigDBHeader h;
+	h.magic = SIGDB_MAGIC;
+	h.version = SIGDB_VERSION;
+	h.plat = plat;
+	h.numFiles = f.size();
+	h.numSigs = found.size();
+	h.typesSaved = typesSaved;
+	h.savedTypes = t.size();
+	h.savedTypesLen = typesSaved ? saved.size() : 0;
+	if (typesSaved)
+		t += saved;
+	h.textSize = t.size();
+	buf.clear();
+	buf.insert(buf.end(), (const char*)&h, (const char*)(&h+1));
+	if (f.size())
+		buf.insert(buf.end(), (const char*)&f[0], (const char*)(&f[0] + f.size()));
+	for (std::map<std::string, SigDBSig>::iterator it = found.begin(); it != found.end(); it++)
+		buf.insert(buf.end(), (const char*)&it->second, (const char*)(&it->second+1));
+	buf.insert(buf.end(), t.begin(), t.end());
+
+	// Write to a temporary file and rename it, so that a concurrent run never maps half a database. The name has the
+	// process id, so that two runs building the database at once don't write the same file
+	std::ostringstream tmpName;
+	tmpName << dbPath << "." << getpid() << ".tmp";
+	std::string tmp = tmpName.str();
+	FILE* out = fopen(tmp.c_str(), "wb");
+	if (out == NULL)
+		return;
+	bool ok = fwrite(&buf[0], 1, buf.size(), out) == buf.size();
+	ok = fclose(out) == 0 && ok;
+#ifdef _WIN32
+	if (ok) remove(dbPath);			// rename() does not replace an existing file
+#endif
+	if (!ok || rename(tmp.c_str(), dbPath) != 0)
+		remove(tmp.c_str());
+}
+
+// Parse len bytes of type declarations at decls, with calling convention cc (which matters for typedefs of function
+// types). This defines the named types that they declare
+void SignatureDB::parseTypes(const char* decls, unsigned len, callconv cc) {
+	if (len == 0) return;
+	std::istringstream is(std::string(decls, len));
+	AnsiCParser *p = new AnsiCParser(is, false);
+	p->yyparse(plat, cc);
+	delete p;
+}
+
+/*==============================================================================
+ * FUNCTION:		SignatureDB::readTypes
+ * OVERVIEW:		Define the named types declared in the headers: load them as saved by build, or else parse the
+ *					  type declarations of each header
+ *============================================================================*/
+void SignatureDB::readTypes() {
+	const SigDBHeader* h = header(image);
+	const char* t = text(image);
+	std::map<std::string, Type*> types;
+	if (h->typesSaved && Checkpoint::loadTypes(t + h->savedTypes, h->savedTypesLen, types)) {
+		for (std::map<std::string, Type*>::iterator it = types.begin(); it != types.end(); it++)
+			Type::addNamedType(it->first.c_str(), it->second);
+		return;
+	}
+	const SigDBFile* f = files(image);
+	for (unsigned i = 0; i < h->numFiles; i++)
+		parseTypes(t + f[i].types, f[i].typesLen, sources[i].cc);
+}
+
+/*==============================================================================
+ * FUNCTION:		SignatureDB::lookup
+ * OVERVIEW:		Find the named function by binary search, and parse its declaration
+ * PARAMETERS:		name: the function's name
+ * RETURNS:			A new Signature, or NULL if name is not in the database
+ *============================================================================*/
+Signature* SignatureDB::lookup(const char* name) {
+	const SigDBSig* s = sigs(image);
+	const char* t = text(image);
+	int lo = 0, hi = header(image)->numSigs - 1;
+	while (lo <= hi) {
+		int mid = (lo + hi) / 2;
+		int c = strcmp(name, t + s[mid].name);
+		if (c < 0)
+			hi = mid - 1;
+		else if (c > 0)
+			lo = mid + 1;
+		else {
+			std::istringstream is(std::string(t + s[mid].decl, s[mid].declLen));
+			AnsiCParser *p = new AnsiCParser(is, false);
+			p->yyparse(plat, sources[s[mid].file].cc);
+			Signature* sig = NULL;
+			if (p->signatures.size()) {
+				sig = p->signatures.front();
+				sig->setSigFile(sources[s[mid].file].path.c_str());
+			}
+			delete p;
+			return sig;
+		}
+	}
+	return NULL;
+}
+
+int SignatureDB::getNumSignatures() {
+	return image ? header(image)->numSigs : 0;
+}
@@ -20,8 +20,12 @@
  * 22 May 03 - Mike: delete -> free() to keep valgrind happy
  * 16 Apr 04 - Mike: char[] replaced by ostringstreams
  * 18 Jan 06 - Gerard: several changes for prettier output, better logging of warnings and errors
+ * 17 Oct 26 - Lines in one reusable buffer; reset() for reuse with the next proc; thread safe progress count
+ * 17 Oct 26 - LOG statements are in the LCAT_CODEGEN log category
  */
 
+#define LOG_CATEGORY LCAT_CODEGEN		// The category of this file's LOG statements (see boomerang.h)
+
 #include <assert.h>
 #if defined(_MSC_VER) && _MSC_VER <= 1200
 #pragma warning(disable:4786)
@@ -42,6 +46,7 @@
 #include "type.h"
 #include "util.h"
 #include "log.h"
+#include "threads.h"
 #include <sstream>
 #include <cstring>
 #include <stdlib.h>
@@ -80,14 +85,12 @@ void CHLLCode::indent(std::ostringstream& str, int indLevel) {
  *
  * \todo This function is 800+ lines, and should possibly be split up.
  */
-static int progress = 0;
+static volatile int progress = 0;		// Shared by all threads; only for the progress characters
 void CHLLCode::appendExp(std::ostringstream& str, Exp *exp, PREC curPrec, bool uns /* = false */ ) {
 	if (exp == NULL) return;				// ?
 
-	if (++progress > 500) {
+	if (atomicIncrement(&progress) % 500 == 0)
 		std::cerr << 'g' << std::flush;
-		progress = 0;
-	}
 
 	OPER op = exp->getOper();
 
@@ -976,9 +979,13 @@ void CHLLCode::appendTypeIdent(std::ostringstream& str, Type *typ, const char *i
 	}	
 }
 
-/// Remove all generated code.
+/// Remove all generated code, ready for the next procedure. The buffer keeps its size.
 void CHLLCode::reset() {
+	text.clear();
 	lines.clear();
+	locals.clear();
+	usedLabels.clear();
+	HLLCode::reset();
 }
 
 /// Adds: while( \a cond) {
@@ -1144,18 +1151,14 @@ void CHLLCode::AddGoto(int indLevel, int ord) {
  * \param maxOrd UNUSED
  */
 void CHLLCode::RemoveUnusedLabels(int maxOrd) {
-	for (std::list<char *>::iterator it = lines.begin(); it != lines.end();) {
-		if ((*it)[0] == 'L' && strchr(*it, ':')) {
-			char *s = strdup(*it);
-			*strchr(s, ':') = 0;
-			int n = atoi(s+1);
-			if (usedLabels.find(n) == usedLabels.end()) {
-				it = lines.erase(it);
-				continue;
-			}
-		}
-		it++;
+	size_t n = 0;
+	for (size_t i = 0; i < lines.size(); i++) {
+		const char* s = line(i);
+		if (s[0] == 'L' && strchr(s, ':') && usedLabels.find(atoi(s+1)) == usedLabels.end())
+			continue;			// Unused label
+		lines[n++] = lines[i];
 	}
+	lines.resize(n);
 }
 
 /// Adds: continue;
@@ -1185,9 +1188,9 @@ void CHLLCode::AddLabel(int indLevel, int ord) {
 void CHLLCode::RemoveLabel(int ord) {
 	std::ostringstream s;
 	s << "L" << std::dec << ord << ":";
-	for (std::list<char*>::iterator it = lines.begin(); it != lines.end(); it++) {
-		if (!strcmp(*it, s.str().c_str())) {
-			lines.erase(it);
+	for (size_t i = 0; i < lines.size(); i++) {
+		if (!strcmp(line(i), s.str().c_str())) {
+			lines.erase(lines.begin() + i);
 			break;
 		}
 	}
@@ -1637,10 +1640,10 @@ void CHLLCode::AddGlobal(const char *name, Type *type, Exp *init) {
 
 /// Dump all generated code to \a os.
 void CHLLCode::print(std::ostream &os) {
-	for (std::list<char*>::iterator it = lines.begin(); it != lines.end(); it++) 
-		 os << *it << std::endl;
+	for (size_t i = 0; i < lines.size(); i++)
+		os << line(i) << '\n';
 	if (m_proc == NULL)
-		os << std::endl;
+		os << '\n';
 }
 
 /// Adds one line of comment to the code.
@@ -1657,6 +1660,8 @@ void CHLLCode::appendLine(const std::ostringstream& ostr) {
 }
 
 void CHLLCode::appendLine(const std::string& s) {
-	lines.push_back(strdup(s.c_str()));
+	lines.push_back(text.size());
+	text += s;
+	text += '\0';
 }
 
@@ -11,6 +11,7 @@
  * $Revision: 1.28 $	// 1.24.2.8
  *
  * 22 Nov 02 - Mike: Re-ordered initialisations to keep gcc quiet
+ * 17 Oct 26 - The lines are kept in one reusable buffer, instead of a list of strdup'ed strings
  */
 
 /*==============================================================================
@@ -25,6 +26,7 @@
 
 #include <string>
 #include <sstream>
+#include <vector>
 
 class BasicBlock;
 class Exp;
@@ -83,8 +85,11 @@ enum PREC {
 /// Outputs C code.
 class CHLLCode : public HLLCode {
 private:
-		/// The generated code.
-		std::list<char *> lines;
+		/// The generated code: the text of each line, followed by a null, and where each line starts in text. The
+		/// buffer is reused for the next procedure after reset()
+		std::string text;
+		std::vector<size_t> lines;
+		const char*	line(size_t i) {return text.data() + lines[i];}
 
 		void indent(std::ostringstream& str, int indLevel);
 		void appendExp(std::ostringstream& str, Exp *exp, PREC curPrec, bool uns = false);
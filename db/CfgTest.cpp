@@ -7,6 +7,11 @@
  * $Revision: 1.19 $	// 1.14.2.1
  *
  * 17 Jul 03 - Mike: Created
+ * 17 Oct 26 - Added testInterferences
+ * 17 Oct 26 - Added testUpdateDominators; the dominance frontiers are sorted vectors
+ * 17 Oct 26 - Added testPrunedPhi, testRenameDeep
+ * 17 Oct 26 - testInterferences has a use that is not subscripted
+ * 17 Oct 26 - testPrunedPhi places the unpruned phis in a fresh proc
  */
 
 #define FRONTIER_PENTIUM		"test/pentium/frontier"
@@ -22,6 +27,10 @@
 #include "prog.h"
 #include "dataflow.h"
 #include "pentiumfrontend.h"
+#include "rtl.h"
+#include "statement.h"
+#include "exp.h"
+#include "managed.h"
 
 /*==============================================================================
  * FUNCTION:		CfgTest::registerTests
@@ -33,10 +42,14 @@
 
 void CfgTest::registerTests(CppUnit::TestSuite* suite) {
 	// Oops - they were all for dataflow. Need some real Cfg tests!
+	MYTEST(testInterferences);
+	MYTEST(testUpdateDominators);
+	MYTEST(testPrunedPhi);
+	MYTEST(testRenameDeep);
 }
 
 int CfgTest::countTestCases () const
-{ return 2; }	// ? What's this for?
+{ return 4; }	// ? What's this for?
 
 /*==============================================================================
  * FUNCTION:		CfgTest::setUp
@@ -101,8 +114,8 @@ void CfgTest::testDominators () {
 	expected << std::hex << FRONTIER_THIRTEEN << " " << FRONTIER_FOUR << " " << FRONTIER_TWELVE << " " <<
 		FRONTIER_FIVE << " ";
 	int n5 = df->pbbToNode(bb);
-	std::set<int>::iterator ii;
-	std::set<int>& DFset = df->getDF(n5);
+	std::vector<int>::iterator ii;
+	std::vector<int>& DFset = df->getDF(n5);
 	for (ii=DFset.begin(); ii != DFset.end(); ii++)
 		actual << std::hex << (unsigned)df->nodeToBB(*ii)->getLowAddr() << " ";
 	CPPUNIT_ASSERT_EQUAL(expected.str(), actual.str());
@@ -161,8 +174,8 @@ void CfgTest::testSemiDominators () {
 	std::ostringstream expected, actual;
   //expected << std::hex << SEMI_M << " " << SEMI_B << " ";
 	expected << std::hex << SEMI_B << " " << SEMI_M << " ";
-	std::set<int>::iterator ii;
-	std::set<int>& DFset = df->getDF(nL);
+	std::vector<int>::iterator ii;
+	std::vector<int>& DFset = df->getDF(nL);
 	for (ii=DFset.begin(); ii != DFset.end(); ii++)
 		actual << std::hex << (unsigned)df->nodeToBB(*ii)->getLowAddr() << " ";
 	CPPUNIT_ASSERT_EQUAL(expected.str(), actual.str());
@@ -300,3 +313,254 @@ void CfgTest::testRenameVars () {
 
 	delete pFE;
 }
+
+/*==============================================================================
+ * FUNCTION:		CfgTest::testInterferences
+ * OVERVIEW:		Test the interference graph found by the liveness analysis
+ *============================================================================*/
+void CfgTest::testInterferences () {
+	Prog* prog = new Prog;
+	UserProc* proc = (UserProc*) prog->newProc("test", 0x1000);
+	Cfg* cfg = proc->getCFG();
+	// 1 r24 := 5
+	Assign* s1 = new Assign(Location::regOf(24), new Const(5));
+	s1->setNumber(1);
+	// 2 r24 := 6
+	Assign* s2 = new Assign(Location::regOf(24), new Const(6));
+	s2->setNumber(2);
+	std::list<Statement*> ls;
+	ls.push_back(s1);
+	ls.push_back(s2);
+	std::list<RTL*>* pRtls = new std::list<RTL*>;
+	pRtls->push_back(new RTL(0x1000, &ls));
+	PBB bb1 = cfg->newBB(pRtls, ONEWAY, 1);
+	// 3 r25 := r24{2}
+	Assign* s3 = new Assign(Location::regOf(25), new RefExp(Location::regOf(24), s2));
+	s3->setNumber(3);
+	// 4 r26 := r24{1} + r25{3} + r27 (r27 not subscripted, so not in the liveness)
+	Assign* s4 = new Assign(Location::regOf(26),
+		new Binary(opPlus,
+			new Binary(opPlus,
+				new RefExp(Location::regOf(24), s1),
+				new RefExp(Location::regOf(25), s3)),
+			Location::regOf(27)));
+	s4->setNumber(4);
+	ls.clear();
+	ls.push_back(s3);
+	ls.push_back(s4);
+	pRtls = new std::list<RTL*>;
+	pRtls->push_back(new RTL(0x1010, &ls));
+	PBB bb2 = cfg->newBB(pRtls, RET, 0);
+	cfg->addOutEdge(bb1, bb2);
+	cfg->setEntryBB(bb1);
+
+	ConnectionGraph ig;
+	cfg->findInterferences(ig);
+	// r24{1} is live across the definition of r24{2}, and the use of it
+	RefExp r24_1(Location::regOf(24), s1);
+	RefExp r24_2(Location::regOf(24), s2);
+	CPPUNIT_ASSERT(ig.isConnected(&r24_1, &r24_2));
+	CPPUNIT_ASSERT(ig.isConnected(&r24_2, &r24_1));
+	CPPUNIT_ASSERT_EQUAL(1, ig.count(&r24_1));
+	// r25{3} is live at the same time, but is not another version of r24
+	RefExp r25_3(Location::regOf(25), s3);
+	CPPUNIT_ASSERT_EQUAL(0, ig.count(&r25_3));
+	// The liveness at the top of the second BB
+	LocationSet expected;
+	expected.insert(&r24_1);
+	expected.insert(&r24_2);
+	CPPUNIT_ASSERT(expected == bb2->getLiveIn());
+	delete prog;
+}
+
+// A BB with one RTL (with no statements) at addr
+static PBB newTestBB(Cfg* cfg, ADDRESS addr, BBTYPE type, int numOutEdges) {
+	std::list<RTL*>* pRtls = new std::list<RTL*>;
+	pRtls->push_back(new RTL(addr));
+	return cfg->newBB(pRtls, type, numOutEdges);
+}
+
+// The immediate dominator and the dominance frontier of bb, by address
+static std::string domInfo(DataFlow* df, PBB bb) {
+	std::ostringstream ost;
+	int n = df->pbbToNode(bb);
+	ost << std::hex << bb->getLowAddr() << ": idom ";
+	if (df->getIdom(n) == -1)
+		ost << "none";
+	else
+		ost << df->nodeToBB(df->getIdom(n))->getLowAddr();
+	ost << " DF";
+	std::vector<int>& DFset = df->getDF(n);
+	for (std::vector<int>::iterator ii = DFset.begin(); ii != DFset.end(); ii++)
+		ost << " " << df->nodeToBB(*ii)->getLowAddr();
+	ost << "\n";
+	return ost.str();
+}
+
+static std::string domInfo(DataFlow* df, Cfg* cfg) {
+	std::string s;
+	BB_IT it;
+	for (PBB bb = cfg->getFirstBB(it); bb; bb = cfg->getNextBB(it))
+		s += domInfo(df, bb);
+	return s;
+}
+
+/*==============================================================================
+ * FUNCTION:		CfgTest::testUpdateDominators
+ * OVERVIEW:		Test that updating the dominators of a CFG that has gained BBs and edges gives the same as
+ *					  computing them again, and that an edge that changes a dominator is refused
+ *============================================================================*/
+void CfgTest::testUpdateDominators () {
+	Prog* prog = new Prog;
+	UserProc* proc = (UserProc*) prog->newProc("test", 0x1000);
+	Cfg* cfg = proc->getCFG();
+	// A diamond: 1000 -> 1010, 1020 -> 1030
+	PBB bb1 = newTestBB(cfg, 0x1000, TWOWAY, 2);
+	PBB bb2 = newTestBB(cfg, 0x1010, ONEWAY, 1);
+	PBB bb3 = newTestBB(cfg, 0x1020, ONEWAY, 1);
+	PBB bb4 = newTestBB(cfg, 0x1030, RET, 0);
+	cfg->addOutEdge(bb1, bb2);
+	cfg->addOutEdge(bb1, bb3);
+	cfg->addOutEdge(bb2, bb4);
+	cfg->addOutEdge(bb3, bb4);
+	cfg->setEntryBB(bb1);
+	DataFlow* df = proc->getDataFlow();
+	df->dominators(cfg);
+
+	// New code after 1020, that goes back to 1030
+	PBB bb5 = newTestBB(cfg, 0x1040, ONEWAY, 1);
+	cfg->addOutEdge(bb3, bb5);
+	cfg->addOutEdge(bb5, bb4);
+	CPPUNIT_ASSERT(df->updateDominators(cfg));
+	DataFlow fresh;
+	fresh.dominators(cfg);
+	std::string expected(
+		"1000: idom none DF\n"
+		"1010: idom 1000 DF 1030\n"
+		"1020: idom 1000 DF 1030\n"
+		"1030: idom 1000 DF\n"
+		"1040: idom 1020 DF 1030\n");
+	CPPUNIT_ASSERT_EQUAL(expected, domInfo(&fresh, cfg));
+	CPPUNIT_ASSERT_EQUAL(expected, domInfo(df, cfg));
+	CPPUNIT_ASSERT_EQUAL(fresh.pbbToNode(bb5), df->pbbToNode(bb5));
+
+	// 1040 is no longer dominated by 1020
+	cfg->addOutEdge(bb2, bb5);
+	CPPUNIT_ASSERT(!df->updateDominators(cfg));
+	df->dominators(cfg);
+	CPPUNIT_ASSERT_EQUAL(std::string("1040: idom 1000 DF 1030\n"), domInfo(df, bb5));
+	delete prog;
+}
+
+// Append s to the (only) RTL of bb
+static void addStmt(PBB bb, Statement* s) {
+	bb->getRTLs()->front()->appendStmt(s);
+}
+
+// A new proc of prog at addr, for testPrunedPhi: a diamond, addr -> addr+10, addr+20 -> addr+30. Both arms define r24,
+// r25 and tmp1; the join (returned in join) defines r25 again and returns
+static UserProc* newPhiTestProc(Prog* prog, const char* name, ADDRESS addr, PBB& join) {
+	UserProc* proc = (UserProc*) prog->newProc(name, addr);
+	Cfg* cfg = proc->getCFG();
+	PBB bb1 = newTestBB(cfg, addr, TWOWAY, 2);
+	PBB bb2 = newTestBB(cfg, addr + 0x10, ONEWAY, 1);
+	PBB bb3 = newTestBB(cfg, addr + 0x20, ONEWAY, 1);
+	PBB bb4 = newTestBB(cfg, addr + 0x30, RET, 0);
+	cfg->addOutEdge(bb1, bb2);
+	cfg->addOutEdge(bb1, bb3);
+	cfg->addOutEdge(bb2, bb4);
+	cfg->addOutEdge(bb3, bb4);
+	cfg->setEntryBB(bb1);
+	for (int i = 0; i < 2; i++) {
+		PBB bb = i ? bb3 : bb2;
+		addStmt(bb, new Assign(Location::regOf(24), new Const(i)));
+		addStmt(bb, new Assign(Location::regOf(25), new Const(i)));
+		addStmt(bb, new Assign(Location::tempOf(new Const("tmp1")), new Const(i)));
+	}
+	addStmt(bb4, new Assign(Location::regOf(25), new Const(5)));
+	addStmt(bb4, new ReturnStatement);
+	join = bb4;
+	return proc;
+}
+
+/*==============================================================================
+ * FUNCTION:		CfgTest::testPrunedPhi
+ * OVERVIEW:		Test that pruned SSA (-pp) only places phi functions where the location is live, counting the live
+ *					  ones at the return (which collects them), but not temporaries
+ *============================================================================*/
+void CfgTest::testPrunedPhi () {
+	Prog* prog = new Prog;
+	PBB bb4;
+	UserProc* proc = newPhiTestProc(prog, "test", 0x1000, bb4);
+	Cfg* cfg = proc->getCFG();
+	Exp* tmp1 = Location::tempOf(new Const("tmp1"));
+
+	bool save = Boomerang::get()->prunedSSA;
+	Boomerang::get()->prunedSSA = true;
+	DataFlow* df = proc->getDataFlow();
+	df->dominators(cfg);
+	df->placePhiFunctions(proc);
+	Boomerang::get()->prunedSSA = save;
+
+	int n4 = df->pbbToNode(bb4);
+	Exp* r24 = Location::regOf(24);
+	Exp* r25 = Location::regOf(25);
+	CPPUNIT_ASSERT_EQUAL(1, (int)df->getA_phi(r24).size());
+	CPPUNIT_ASSERT(df->getA_phi(r24).count(n4));
+	CPPUNIT_ASSERT(df->getA_phi(r25).empty());			// Defined again before the return
+	CPPUNIT_ASSERT(df->getA_phi(tmp1).empty());			// Temporaries are not collected
+	CPPUNIT_ASSERT_EQUAL(1, df->getPhisPlaced());
+	CPPUNIT_ASSERT_EQUAL(2, df->getPhisAvoided());
+
+	// Not pruned, all three get a phi. A fresh proc, as placing phis changes the proc
+	PBB join;
+	UserProc* proc2 = newPhiTestProc(prog, "test2", 0x2000, join);
+	DataFlow* full = proc2->getDataFlow();
+	full->dominators(proc2->getCFG());
+	full->placePhiFunctions(proc2);
+	CPPUNIT_ASSERT_EQUAL(3, full->getPhisPlaced());
+	CPPUNIT_ASSERT_EQUAL(0, full->getPhisAvoided());
+	CPPUNIT_ASSERT(full->getA_phi(r25).count(full->pbbToNode(join)));
+	delete prog;
+}
+
+/*==============================================================================
+ * FUNCTION:		CfgTest::testRenameDeep
+ * OVERVIEW:		Test renaming a dominator tree far too deep to walk recursively: each BB of a long chain uses the
+ *					  definition of the one before, and the return collects the last
+ *============================================================================*/
+void CfgTest::testRenameDeep () {
+	Prog* prog = new Prog;
+	UserProc* proc = (UserProc*) prog->newProc("test", 0x1000);
+	Cfg* cfg = proc->getCFG();
+	const int numBB = 50000;
+	std::vector<Assign*> incs;
+	PBB prev = NULL;
+	for (int i = 0; i < numBB; i++) {
+		PBB bb = newTestBB(cfg, 0x1000 + i * 16, i == numBB-1 ? RET : ONEWAY, i == numBB-1 ? 0 : 1);
+		// r24 := r24 + 1
+		Assign* as = new Assign(Location::regOf(24), new Binary(opPlus, Location::regOf(24), new Const(1)));
+		addStmt(bb, as);
+		incs.push_back(as);
+		if (prev)
+			cfg->addOutEdge(prev, bb);
+		else
+			cfg->setEntryBB(bb);
+		prev = bb;
+	}
+	ReturnStatement* ret = new ReturnStatement;
+	addStmt(prev, ret);
+
+	DataFlow* df = proc->getDataFlow();
+	df->dominators(cfg);
+	df->placePhiFunctions(proc);
+	CPPUNIT_ASSERT(df->renameBlockVars(proc, 0, true));
+
+	Exp* use = ((Binary*)incs[numBB-1]->getRight())->getSubExp1();
+	CPPUNIT_ASSERT(use->isSubscript());
+	CPPUNIT_ASSERT(((RefExp*)use)->getDef() == incs[numBB-2]);
+	Exp* last = ret->getCollector()->findDefFor(Location::regOf(24));
+	CPPUNIT_ASSERT(last && last->isSubscript());
+	CPPUNIT_ASSERT(((RefExp*)last)->getDef() == incs[numBB-1]);
+	delete prog;
+}
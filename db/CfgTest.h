@@ -24,5 +24,9 @@ class CfgTest : public CppUnit::TestCase {
 	void testPlacePhi ();
 	void testPlacePhi2();
 	void testRenameVars();
+	void testInterferences();
+	void testUpdateDominators();
+	void testPrunedPhi();
+	void testRenameDeep();
 };
 
@@ -12,11 +12,17 @@
  * 27 Apr 02 - Mike: Added testDecideType
  * 09 Dec 02 - Mike: Added test for fixSuccessor
  * 13 Dec 02 - Mike: Added test for killFill()
+ * 17 Oct 26 - Added test for interning
+ * 17 Oct 26 - Added test for location sets in a region
+ * 17 Oct 26 - testIntern: releasing the expressions of a proc
+ * 17 Oct 26 - testIntern: the definitions are on the heap, and the table is emptied at the end
  */
 
 #include "ExpTest.h"
 #include "statement.h"
 #include "visitor.h"
+#include "prog.h"
+#include "proc.h"
 #include <map>
 #include <sstream>		// Gcc >= 3.0 needed
 
@@ -62,6 +68,7 @@ MYTEST(testFixSuccessor);
 
 	MYTEST(testLess);
 	MYTEST(testMapOfExp);
+	MYTEST(testIntern);
 	MYTEST(testList);
 	MYTEST(testParen);
 	MYTEST(testFixSuccessor);
@@ -71,6 +78,7 @@ MYTEST(testFixSuccessor);
 	MYTEST(testTypeOf);
 	MYTEST(testSetConscripts);
 	MYTEST(testAddUsedLocs);
+	MYTEST(testRegionLocationSet);
 	MYTEST(testSubscriptVars);
 	MYTEST(testVisitors);
 }
@@ -869,6 +877,83 @@ void ExpTest::testMapOfExp() {
 	delete e;
 }
 
+/*==============================================================================
+ * FUNCTION:		ExpTest::testIntern
+ * OVERVIEW:		Test interning (hash consing), and copy on write of interned expressions
+ *============================================================================*/
+void ExpTest::testIntern() {
+	// m[r28 + 4]
+	Exp* e1 = Location::memOf(new Binary(opPlus, Location::regOf(28), new Const(4)));
+	Exp* e2 = e1->clone();
+	CPPUNIT_ASSERT(e1->hash() == e2->hash());
+	Exp* i1 = e1->intern();
+	Exp* i2 = e2->intern();
+	CPPUNIT_ASSERT(i1 == i2);							// Same canonical pointer
+	CPPUNIT_ASSERT(i1 != e1);							// The original is not modified
+	CPPUNIT_ASSERT(!e1->isInterned());
+	CPPUNIT_ASSERT(i1->isInterned());
+	CPPUNIT_ASSERT(i1->getSubExp1()->isInterned());		// Subexpressions are shared too
+	CPPUNIT_ASSERT(*i1 == *e1);
+	CPPUNIT_ASSERT_EQUAL(e1->hash(), i1->hash());
+
+	// Different subscripts intern differently, but hash the same (the hash ignores definitions)
+	Assign* s10 = new Assign;
+	Assign* s20 = new Assign;
+	Exp* r1 = (new RefExp(Location::regOf(24), s10))->intern();
+	Exp* r2 = (new RefExp(Location::regOf(24), s20))->intern();
+	CPPUNIT_ASSERT(r1 != r2);
+	CPPUNIT_ASSERT(r1->hash() == r2->hash());
+	CPPUNIT_ASSERT(r1->getSubExp1() == r2->getSubExp1());
+
+	// Copy on write: searchReplaceAll leaves the interned expression alone
+	bool change;
+	Exp* res = i1->searchReplaceAll(new Const(4), new Const(8), change);
+	CPPUNIT_ASSERT(change);
+	CPPUNIT_ASSERT(res != i1);
+	CPPUNIT_ASSERT(!res->isInterned());
+	std::ostringstream ost1, ost2;
+	ost1 << i1;
+	CPPUNIT_ASSERT_EQUAL(std::string("m[r28 + 4]"), ost1.str());
+	ost2 << res;
+	CPPUNIT_ASSERT_EQUAL(std::string("m[r28 + 8]"), ost2.str());
+	res = i1->searchReplaceAll(new Const(12), new Const(8), change);
+	CPPUNIT_ASSERT(!change);
+	CPPUNIT_ASSERT(res == i1);
+
+	// Interned keys in maps
+	std::map<Exp*, int, lessExpStar> m;
+	m[i1] = 1;
+	m[r1] = 2;
+	m[r2] = 3;
+	CPPUNIT_ASSERT_EQUAL(3, (int)m.size());
+	CPPUNIT_ASSERT_EQUAL(1, m[e2]);						// Uninterned lookup finds the interned key
+
+	// Releasing a proc drops what refers to its statements, and nothing else
+	Prog* prog = new Prog;
+	UserProc* proc = (UserProc*)prog->newProc("test", 0x1000);
+	Assign* s30 = new Assign(Location::regOf(25), new Const(1));
+	s30->setProc(proc);
+	Exp* r3 = (new RefExp(Location::regOf(24), s30))->intern();
+	Exp* m3 = Location::memOf(new Binary(opPlus, r3, new Const(4)))->intern();
+	int live = Exp::numInternedLive();
+	Exp::releaseInterned(proc);
+	CPPUNIT_ASSERT_EQUAL(live - 3, Exp::numInternedLive());		// r24{s30}, r24{s30} + 4 and the m[]
+	CPPUNIT_ASSERT(r3 != (new RefExp(Location::regOf(24), s30))->intern());
+	CPPUNIT_ASSERT(m3 != Location::memOf(new Binary(opPlus, r3, new Const(4)))->intern());
+	CPPUNIT_ASSERT(i1 == e1->intern());					// Not owned by any proc
+	Exp::releaseInterned(proc);
+	delete prog;
+
+	// Releasing everything empties the table; what was interned stays valid
+	Exp::releaseAllInterned();
+	CPPUNIT_ASSERT_EQUAL(0, Exp::numInternedLive());
+	CPPUNIT_ASSERT(i1 != e1->intern());
+	ost1.str("");
+	ost1 << i1;
+	CPPUNIT_ASSERT_EQUAL(std::string("m[r28 + 4]"), ost1.str());
+	Exp::releaseAllInterned();
+}
+
 /*==============================================================================
  * FUNCTION:		Exp::testList
  * OVERVIEW:		Test the opList creating and printing
@@ -1392,6 +1477,44 @@ void ExpTest::testSubscriptVars() {
 
 }
 
+/*==============================================================================
+ * FUNCTION:		ExpTest::testRegionLocationSet
+ * OVERVIEW:		Test a LocationSet allocated in a Region; copies of it must be on the heap
+ *============================================================================*/
+void ExpTest::testRegionLocationSet() {
+	Region r;
+	LocationSet* l = new LocationSet(&r);
+	Exp* e = Location::memOf(
+		new Binary(opMinus,
+			Location::regOf(28),
+			new Const(4)));
+	e->addUsedLocs(*l);
+	l->insert(Location::regOf(24));
+	CPPUNIT_ASSERT(r.getAllocated() > 0);
+	LocationSet copy(*l);
+	std::string expected = "r24,\tr28,\tm[r28 - 4]";
+	std::ostringstream ost1;
+	l->print(ost1);
+	CPPUNIT_ASSERT_EQUAL(expected, ost1.str());
+
+	// The copy is unaffected by releasing the region (the set in it is just abandoned)
+	r.release();
+	CPPUNIT_ASSERT(r.getAllocated() == 0);
+	copy.insert(Location::regOf(25));
+	expected = "r24,\tr25,\tr28,\tm[r28 - 4]";
+	std::ostringstream ost2;
+	copy.print(ost2);
+	CPPUNIT_ASSERT_EQUAL(expected, ost2.str());
+
+	// A large allocation, and reuse of the region
+	char* big = (char*)r.alloc(1000000);
+	big[999999] = 1;
+	LocationSet l2(&r);
+	l2.insert(Location::regOf(8));
+	CPPUNIT_ASSERT_EQUAL(1, (int)l2.size());
+	CPPUNIT_ASSERT(r.getAllocated() >= 1000000);
+}
+
 /*==============================================================================
  * FUNCTION:		ExpTest::testVisitors
  * OVERVIEW:		Test the FlagsFinder and BareMemofFinder visitors
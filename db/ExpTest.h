@@ -56,6 +56,7 @@ class ExpTest : public CppUnit::TestCase {
 
 	void testLess();
 	void testMapOfExp();
+	void testIntern();
 
 	void testList();
 	void testParen();
@@ -67,6 +68,7 @@ class ExpTest : public CppUnit::TestCase {
 	void testTypeOf();
 	void testSetConscripts();
 	void testAddUsedLocs();
+	void testRegionLocationSet();
 	void testSubscriptVars();
 	void testVisitors();
 };
@@ -7,6 +7,9 @@
  * $Revision: 1.7 $
  *
  * 13 May 02 - Mike: Created
+ * 17 Oct 26 - Added testInstantiate
+ * 17 Oct 26 - Added testOpcodeId
+ * 17 Oct 26 - Added testCache
  */
 
 #define SPARC_SSL		"frontend/machine/sparc/sparc.ssl"
@@ -15,6 +18,7 @@
 #include "sslparser.h"
 
 #include <sstream>
+#include <stdio.h>
 
 /*==============================================================================
  * FUNCTION:		ParserTest::registerTests
@@ -29,10 +33,13 @@ suite->addTest(new CppUnit::TestCaller<ParserTest> ("ParserTest", \
 void ParserTest::registerTests(CppUnit::TestSuite* suite) {
 	MYTEST(testRead);
 	MYTEST(testExp);
+	MYTEST(testInstantiate);
+	MYTEST(testOpcodeId);
+	MYTEST(testCache);
 }
 
 int ParserTest::countTestCases () const
-{ return 2; }	// ? What's this for?
+{ return 5; }	// ? What's this for?
 
 /*==============================================================================
  * FUNCTION:		ParserTest::setUp
@@ -83,3 +90,82 @@ void ParserTest::testExp () {
 	CPPUNIT_ASSERT_EQUAL ("   0 "+s, std::string(ost2.str()));
 }
 
+
+// Print a list of statements to a string, one per line
+static std::string printStmts(std::list<Statement*>* stmts) {
+	std::ostringstream ost;
+	for (std::list<Statement*>::iterator it = stmts->begin(); it != stmts->end(); it++) {
+		(*it)->print(ost);
+		ost << "\n";
+	}
+	return ost.str();
+}
+
+/*==============================================================================
+ * FUNCTION:		ParserTest::testInstantiate
+ * OVERVIEW:		Test that compiled templates (and the constant operand cache) instantiate exactly as the templates do
+ *============================================================================*/
+void ParserTest::testInstantiate () {
+	RTLInstDict d;
+	CPPUNIT_ASSERT(d.readSSLFile(SPARC_SSL));
+	std::string name("LDD");
+	TableEntry& entry = d.idict[name];
+	CPPUNIT_ASSERT(entry.compiled);
+	CPPUNIT_ASSERT(entry.hasSuccessor);
+
+	std::vector<Exp*> actuals;
+	actuals.push_back(new Const(0x1000));				// eaddr
+	actuals.push_back(Location::regOf(8));				// rd
+	std::string expected = printStmts(d.instantiateRTL(entry.rtl, 0x1000, entry.params, actuals));
+	CPPUNIT_ASSERT(expected.find("r9") != std::string::npos);		// succ(r8)
+	CPPUNIT_ASSERT_EQUAL(expected, printStmts(d.instantiateRTL(name, 0x1000, actuals)));
+	CPPUNIT_ASSERT_EQUAL(1, (int)entry.instCache.size());
+	// This one comes from the cache
+	CPPUNIT_ASSERT_EQUAL(expected, printStmts(d.instantiateRTL(name, 0x1004, actuals)));
+	CPPUNIT_ASSERT_EQUAL(1, (int)entry.instCache.size());
+
+	// Non constant actuals are instantiated the same way, but not cached
+	actuals[0] = new Binary(opPlus, Location::regOf(10), new Const(4));
+	expected = printStmts(d.instantiateRTL(entry.rtl, 0x1008, entry.params, actuals));
+	CPPUNIT_ASSERT_EQUAL(expected, printStmts(d.instantiateRTL(name, 0x1008, actuals)));
+	CPPUNIT_ASSERT_EQUAL(1, (int)entry.instCache.size());
+}
+
+/*==============================================================================
+ * FUNCTION:		ParserTest::testOpcodeId
+ * OVERVIEW:		Test mapping instruction names (as used by the decoders) to opcode ids
+ *============================================================================*/
+void ParserTest::testOpcodeId () {
+	RTLInstDict d;
+	CPPUNIT_ASSERT(d.readSSLFile(SPARC_SSL));
+	CPPUNIT_ASSERT_EQUAL(d.idict.size(), d.idTable.size());
+	const char* name = "l.dd";							// Case and dots are ignored
+	int id = d.getOpcodeId(name);
+	CPPUNIT_ASSERT(id >= 0);
+	CPPUNIT_ASSERT(&d.getEntry(id) == &d.idict["LDD"]);
+	// The second lookup is by address
+	CPPUNIT_ASSERT_EQUAL(id, d.getOpcodeId(name));
+	CPPUNIT_ASSERT_EQUAL(-1, d.getOpcodeId("NOSUCHINSTRUCTION"));
+}
+
+/*==============================================================================
+ * FUNCTION:		ParserTest::testCache
+ * OVERVIEW:		Test that a dictionary read back from the binary cache is the same as one parsed from the SSL file
+ *============================================================================*/
+void ParserTest::testCache () {
+	std::string cache = std::string(SPARC_SSL) + ".cache";
+	remove(cache.c_str());
+	RTLInstDict parsed;
+	CPPUNIT_ASSERT(parsed.readSSLFile(SPARC_SSL));		// Parses, and writes the cache
+	RTLInstDict cached;
+	CPPUNIT_ASSERT(cached.readCache(cache, SPARC_SSL));
+	cached.reset();
+	CPPUNIT_ASSERT(cached.readSSLFile(SPARC_SSL));		// From the cache
+	std::ostringstream expected, actual;
+	parsed.print(expected);
+	cached.print(actual);
+	CPPUNIT_ASSERT_EQUAL(expected.str(), actual.str());
+	CPPUNIT_ASSERT_EQUAL(parsed.getOpcodeId("ADD"), cached.getOpcodeId("ADD"));
+	CPPUNIT_ASSERT_EQUAL(parsed.DetRegMap.size(), cached.DetRegMap.size());
+	CPPUNIT_ASSERT_EQUAL(parsed.fastMap.size(), cached.fastMap.size());
+}
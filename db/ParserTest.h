@@ -20,5 +20,8 @@ class ParserTest : public CppUnit::TestCase {
 
 	void testRead ();
 	void testExp ();
+	void testInstantiate ();
+	void testOpcodeId ();
+	void testCache ();
 };
 
@@ -8,14 +8,21 @@
  *
  * 23 Apr 02 - Mike: Created
  * 10 Mar 03 - Mike: Mods to not use Prog::pBF (no longer public)
+ * 17 Oct 26 - testBudget
+ * 17 Oct 26 - testSpliceSwitch
  */
 
 #define HELLO_PENTIUM		"test/pentium/hello"
+#define SWITCH_PENTIUM		"test/pentium/switch_gcc"
+#define TESTFP_PENTIUM		"test/pentium/testfp"
 
 #include "ProcTest.h"
 #include "BinaryFile.h"
 #include "BinaryFileStub.h"
 #include "pentiumfrontend.h"
+#include "budget.h"
+#include "util.h"
+#include "boomerang.h"
 
 #include <sstream>
 #include <map>
@@ -33,10 +40,12 @@ suite->addTest(new CppUnit::TestCaller<ProcTest> ("testProc", \
 void ProcTest::registerTests(CppUnit::TestSuite* suite) {
 
 	MYTEST(testName);
+	MYTEST(testBudget);
+	MYTEST(testSpliceSwitch);
 }
 
 int ProcTest::countTestCases () const
-{ return 2; }	// ? What's this for?
+{ return 3; }	// ? What's this for?
 
 /*==============================================================================
  * FUNCTION:		ProcTest::setUp
@@ -95,3 +104,77 @@ void ProcTest::testName () {
 	// delete pFE;		// No! Deleting the prog deletes the pFE already (which deletes the BinaryFileFactory)
 }
 
+
+/*==============================================================================
+ * FUNCTION:		ProcTest::testBudget
+ * OVERVIEW:		Test cutting back a proc that is over its time budget
+ *============================================================================*/
+void ProcTest::testBudget () {
+	Prog* prog = new Prog();
+	std::string nm("budget");
+	UserProc* proc = new UserProc(prog, nm, 20000);
+	m_proc = proc;
+	CPPUNIT_ASSERT(!proc->overBudget());				// No budgets
+	CPPUNIT_ASSERT_EQUAL((int)Budget::FULL, proc->getDegraded());
+
+	Budget::startGlobal();
+	Budget::procSecs = 0.05;
+	CPPUNIT_ASSERT(!proc->overBudget());				// Starts the budget of proc
+	double start = wallClock();
+	while (wallClock() - start < 60000) ;
+	CPPUNIT_ASSERT(proc->overBudget());
+	CPPUNIT_ASSERT_EQUAL((int)Budget::FEWER_PASSES, proc->getDegraded());
+	while (wallClock() - start < 110000) ;
+	CPPUNIT_ASSERT(proc->overBudget());
+	CPPUNIT_ASSERT_EQUAL((int)Budget::NO_PROVER, proc->getDegraded());
+	Budget::procSecs = 0;
+
+	std::ostringstream ost;
+	CPPUNIT_ASSERT_EQUAL(1, Budget::report(ost));
+	CPPUNIT_ASSERT_EQUAL(std::string("1 procedure was cut back to meet the budgets:\n"
+		"  budget: fewer passes, no prover (over the procedure time)\n"), ost.str());
+}
+
+// Decompile fname, and return the code generated for it
+static std::string decompileProg(const char* fname) {
+	Prog* prog = Boomerang::get()->loadAndDecode(fname);
+	CPPUNIT_ASSERT(prog != NULL);
+	prog->decompile();
+	std::ostringstream ost;
+	prog->generateCode(ost);
+	delete prog;
+	return ost.str();
+}
+
+/*==============================================================================
+ * FUNCTION:		ProcTest::testSpliceSwitch
+ * OVERVIEW:		Test splicing the arms of switch statements into the CFG: the code has to be the same as when the
+ *					  proc is decompiled again from scratch (-ns). Procs with x87 stack code are always restarted
+ *============================================================================*/
+void ProcTest::testSpliceSwitch () {
+	m_proc = NULL;
+	Boomerang* boo = Boomerang::get();
+	bool saveLog = boo->noLog;
+	boo->noLog = true;
+
+	boo->noSplice = true;
+	std::string restarted = decompileProg(SWITCH_PENTIUM);
+	boo->noSplice = false;
+	std::string spliced = decompileProg(SWITCH_PENTIUM);
+	CPPUNIT_ASSERT(restarted.find("switch") != std::string::npos);
+	CPPUNIT_ASSERT_EQUAL(restarted, spliced);
+
+	// main of switch_gcc has no floating point code; main of testfp does
+	Prog* prog = boo->loadAndDecode(SWITCH_PENTIUM);
+	UserProc* proc = (UserProc*)prog->findProc("main");
+	CPPUNIT_ASSERT(proc != NULL);
+	CPPUNIT_ASSERT(prog->canDecodeFragment(proc));
+	delete prog;
+	prog = boo->loadAndDecode(TESTFP_PENTIUM);
+	proc = (UserProc*)prog->findProc("main");
+	CPPUNIT_ASSERT(proc != NULL);
+	CPPUNIT_ASSERT(!prog->canDecodeFragment(proc));
+	delete prog;
+
+	boo->noLog = saveLog;
+}
@@ -7,6 +7,8 @@
  * $Revision: 1.5 $
  *
  * 23 Apr 02 - Mike: Created
+ * 17 Oct 26 - testBudget
+ * 17 Oct 26 - testSpliceSwitch
  */
 
 #include <cppunit/TestCaller.h>
@@ -33,5 +35,7 @@ class ProcTest : public CppUnit::TestCase {
 	void tearDown ();
 
 	void testName ();
+	void testBudget ();
+	void testSpliceSwitch ();
 };
 
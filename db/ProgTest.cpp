@@ -8,6 +8,10 @@
  *
  * 18 Apr 02 - Mike: Created
  * 18 Jul 02 - Mike: Set up prog.pFE before calling readLibParams
+ * 17 Oct 26 - testGlobals
+ * 17 Oct 26 - testProcIndex
+ * 17 Oct 26 - testCheckpoint
+ * 17 Oct 26 - testCheckpointFromSSA
  */
 
 #define HELLO_PENTIUM		"test/pentium/hello"
@@ -15,6 +19,11 @@
 #include "ProgTest.h"
 #include "BinaryFile.h"
 #include "pentiumfrontend.h"
+#include "type.h"
+#include "proc.h"
+#include "cfg.h"
+#include "rtl.h"
+#include "checkpoint.h"
 #include <map>
 #include <sstream>
 
@@ -30,6 +39,10 @@ suite->addTest(new CppUnit::TestCaller<ProgTest> ("ProgTest", \
 
 void ProgTest::registerTests(CppUnit::TestSuite* suite) {
 	MYTEST(testName);
+	MYTEST(testGlobals);
+	MYTEST(testProcIndex);
+	MYTEST(testCheckpoint);
+	MYTEST(testCheckpointFromSSA);
 }
 
 int ProgTest::countTestCases () const
@@ -77,5 +90,155 @@ void ProgTest::testName () {
 	delete pFE;
 }
 
+/*==============================================================================
+ * FUNCTION:		ProgTest::testGlobals
+ * OVERVIEW:		Test finding globals by name, and by any address that they contain
+ *============================================================================*/
+void ProgTest::testGlobals () {
+	Prog* prog = new Prog();
+	Global* g1 = new Global(new IntegerType(32), 0x1000, "g1");
+	Global* arr = new Global(new ArrayType(new IntegerType(8), 10), 0x1004, "arr");
+	Global* big = new Global(new ArrayType(new IntegerType(32), 0x4000), 0x2000, "big");
+	Global* g2 = new Global(new IntegerType(16), 0x20000, "g2");
+	prog->addGlobal(g1);
+	prog->addGlobal(arr);
+	prog->addGlobal(big);
+	prog->addGlobal(g2);
+	prog->addGlobal(g1);			// Again: no effect
+
+	CPPUNIT_ASSERT(prog->getGlobal("g1") == g1);
+	CPPUNIT_ASSERT(prog->getGlobal("big") == big);
+	CPPUNIT_ASSERT(prog->getGlobal("g3") == NULL);
+	CPPUNIT_ASSERT_EQUAL((ADDRESS)0x20000, prog->getGlobalAddr("g2"));
+
+	CPPUNIT_ASSERT(prog->findGlobalContaining(0x1000) == g1);
+	CPPUNIT_ASSERT(prog->findGlobalContaining(0x1003) == g1);
+	CPPUNIT_ASSERT(prog->findGlobalContaining(0x1004) == arr);
+	CPPUNIT_ASSERT(prog->findGlobalContaining(0x100D) == arr);
+	CPPUNIT_ASSERT(prog->findGlobalContaining(0x100E) == NULL);
+	CPPUNIT_ASSERT(prog->findGlobalContaining(0x0FFF) == NULL);
+	// big is 64KB long, so is found far above its start
+	CPPUNIT_ASSERT(prog->findGlobalContaining(0x11FFF) == big);
+	CPPUNIT_ASSERT(prog->findGlobalContaining(0x12000) == NULL);
+	CPPUNIT_ASSERT(prog->findGlobalContaining(0x20001) == g2);
+	CPPUNIT_ASSERT(prog->findGlobalContaining(0x20002) == NULL);
+
+	// Growing g2 must be seen
+	prog->setGlobalType("g2", new ArrayType(new IntegerType(32), 4));
+	CPPUNIT_ASSERT(prog->findGlobalContaining(0x2000F) == g2);
+	delete prog;
+}
+
+/*==============================================================================
+ * FUNCTION:		ProgTest::testProcIndex
+ * OVERVIEW:		Test finding procs by index, by name (including after a rename), and by contained address
+ *============================================================================*/
+void ProgTest::testProcIndex () {
+	Prog* prog = new Prog();
+	UserProc* a = (UserProc*)prog->newProc("a", 0x1000);
+	UserProc* b = (UserProc*)prog->newProc("b", 0x2000);
+	UserProc* c = (UserProc*)prog->newProc("c", 0x3000);
+	CPPUNIT_ASSERT(prog->getProc(0) == a);
+	CPPUNIT_ASSERT(prog->getProc(2) == c);
+	CPPUNIT_ASSERT(prog->getProc(3) == NULL);
+	CPPUNIT_ASSERT(prog->findProc("b") == b);
+
+	b->setName("bee");
+	CPPUNIT_ASSERT(prog->findProc("b") == NULL);
+	CPPUNIT_ASSERT(prog->findProc("bee") == b);
+
+	// Give a two BBs, 0x1000-0x1008 and 0x1010-0x1010
+	Cfg* cfg = a->getCFG();
+	std::list<RTL*>* pRtls = new std::list<RTL*>;
+	pRtls->push_back(new RTL(0x1000));
+	pRtls->push_back(new RTL(0x1008));
+	PBB bb1 = cfg->newBB(pRtls, ONEWAY, 1);
+	pRtls = new std::list<RTL*>;
+	pRtls->push_back(new RTL(0x1010));
+	PBB bb2 = cfg->newBB(pRtls, RET, 0);
+	cfg->addOutEdge(bb1, bb2);
+	prog->updateProcRanges(a);
+	CPPUNIT_ASSERT(prog->findContainingProc(0x1004) == a);
+	CPPUNIT_ASSERT(prog->findContainingProc(0x1010) == a);
+	CPPUNIT_ASSERT(prog->findContainingProc(0x100C) == NULL);
+	CPPUNIT_ASSERT(prog->findContainingProc(0x2000) == b);
+	CPPUNIT_ASSERT(prog->findContainingProc(0x2004) == NULL);
+
+	prog->removeProc("a");
+	CPPUNIT_ASSERT(prog->getProc(0) == b);
+	CPPUNIT_ASSERT(prog->findProc("a") == NULL);
+	CPPUNIT_ASSERT(prog->findContainingProc(0x1004) == NULL);
+	delete prog;
+}
+
+/*==============================================================================
+ * FUNCTION:		ProgTest::testCheckpoint
+ * OVERVIEW:		Test that a decoded program loaded from a checkpoint is the same as the one saved, and that the
+ *					  body of a proc is read only when it is needed
+ *============================================================================*/
+void ProgTest::testCheckpoint () {
+	const char* ckpt = "checkpoint.tmp";
+	Prog* prog = new Prog;
+	FrontEnd* pFE = FrontEnd::Load(HELLO_PENTIUM, prog);
+	CPPUNIT_ASSERT(pFE != NULL);
+	prog->setFrontEnd(pFE);
+	pFE->decode(prog);
+	UserProc* main = (UserProc*)prog->findProc("main");
+	CPPUNIT_ASSERT(main != NULL);
+	ADDRESS mainAddr = main->getNativeAddress();
+	int numProcs = prog->getNumProcs();
+	std::ostringstream expected;
+	main->print(expected);
+	CPPUNIT_ASSERT(Checkpoint::save(prog, ckpt));
+	delete prog;
+
+	CPPUNIT_ASSERT(Checkpoint::isCheckpoint(ckpt));
+	prog = Checkpoint::load(ckpt);
+	CPPUNIT_ASSERT(prog != NULL);
+	CPPUNIT_ASSERT_EQUAL(numProcs, prog->getNumProcs());
+	main = (UserProc*)prog->findProc("main");
+	CPPUNIT_ASSERT(main != NULL);
+	CPPUNIT_ASSERT_EQUAL(mainAddr, main->getNativeAddress());
+	CPPUNIT_ASSERT(!main->isLoaded());
+	CPPUNIT_ASSERT(prog->findContainingProc(mainAddr) == main);	// From the directory
+	CPPUNIT_ASSERT(!main->isLoaded());
+	std::ostringstream actual;
+	main->print(actual);
+	CPPUNIT_ASSERT(main->isLoaded());
+	CPPUNIT_ASSERT_EQUAL(expected.str(), actual.str());
+	delete prog;
+	remove(ckpt);
+}
+
 // Pathetic: the second test we had (for readLibraryParams) is now obsolete;
 // the front end does this now.
+
+/*==============================================================================
+ * FUNCTION:		ProgTest::testCheckpointFromSSA
+ * OVERVIEW:		Test the passes over the whole program on procs loaded from a checkpoint that were never decompiled
+ *					  (e.g. with -LD and -nc): each has to read its body first
+ *============================================================================*/
+void ProgTest::testCheckpointFromSSA () {
+	const char* ckpt = "checkpoint.tmp";
+	Prog* prog = new Prog;
+	FrontEnd* pFE = FrontEnd::Load(HELLO_PENTIUM, prog);
+	CPPUNIT_ASSERT(pFE != NULL);
+	prog->setFrontEnd(pFE);
+	pFE->decode(prog);
+	CPPUNIT_ASSERT(Checkpoint::save(prog, ckpt));
+	delete prog;
+
+	prog = Checkpoint::load(ckpt);
+	CPPUNIT_ASSERT(prog != NULL);
+	UserProc* main = (UserProc*)prog->findProc("main");
+	CPPUNIT_ASSERT(main != NULL);
+	CPPUNIT_ASSERT(!main->isLoaded());
+	prog->fromSSAform();
+	CPPUNIT_ASSERT(main->isLoaded());
+	prog->removeUnusedGlobals();
+	StatementList stmts;
+	main->getStatements(stmts);
+	CPPUNIT_ASSERT(stmts.size() > 0);
+	delete prog;
+	remove(ckpt);
+}
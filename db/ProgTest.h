@@ -20,5 +20,9 @@ class ProgTest : public CppUnit::TestCase {
 	void tearDown ();
 
 	void testName ();
+	void testGlobals ();
+	void testProcIndex ();
+	void testCheckpoint ();
+	void testCheckpointFromSSA ();
 };
 
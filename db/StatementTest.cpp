@@ -9,6 +9,8 @@
  * 14 Jan 03 - Trent: Created
  * 17 Apr 03 - Mike: Added testRecursion to track down a nasty bug
  * 06 Jul 05 - Mike: Split testAddUsedLocs into six separate tests for Assign ... Bool
+ * 17 Oct 26 - Added testDefUse
+ * 17 Oct 26 - Added testDefUseUpdate
  */
 
 #define HELLO_PENTIUM	   "test/pentium/hello"
@@ -72,6 +74,8 @@ void StatementTest::registerTests(CppUnit::TestSuite* suite) {
 	MYTEST(testBypass);
 	MYTEST(testStripSizes);
 	MYTEST(testFindConstants);
+	MYTEST(testDefUse);
+	MYTEST(testDefUseUpdate);
 }
 
 int StatementTest::countTestCases () const
@@ -1486,3 +1490,110 @@ void StatementTest::testFindConstants () {
 	std::string expected("3, 4");
 	CPPUNIT_ASSERT_EQUAL(expected, actual);
 }
+
+/*==============================================================================
+ * FUNCTION:		StatementTest::testDefUse
+ * OVERVIEW:		Test the def-use chains: one entry per reference, maintained when a user is removed
+ *============================================================================*/
+void StatementTest::testDefUse () {
+	Prog* prog = new Prog;
+	UserProc* proc = (UserProc*) prog->newProc("test", 0x123);
+	// 1 r24 := 5
+	Assign* s1 = new Assign(Location::regOf(24), new Const(5));
+	s1->setNumber(1);
+	// 2 r25 := r24{1} + r24{1}
+	Assign* s2 = new Assign(Location::regOf(25),
+		new Binary(opPlus,
+			new RefExp(Location::regOf(24), s1),
+			new RefExp(Location::regOf(24), s1)));
+	s2->setNumber(2);
+	// 3 m[r25{2}] := r24{1}
+	Assign* s3 = new Assign(Location::memOf(new RefExp(Location::regOf(25), s2)),
+		new RefExp(Location::regOf(24), s1));
+	s3->setNumber(3);
+	StatementList stmts;
+	stmts.append(s1);
+	stmts.append(s2);
+	stmts.append(s3);
+	proc->buildDefUse(stmts);
+	CPPUNIT_ASSERT_EQUAL(3, s1->getNumUses());
+	CPPUNIT_ASSERT_EQUAL(1, s2->getNumUses());
+	CPPUNIT_ASSERT_EQUAL(0, s3->getNumUses());
+	CPPUNIT_ASSERT(!s1->usesAssign());
+	CPPUNIT_ASSERT(s2->usesAssign());
+
+	// Rebuilding gives the same chains
+	proc->buildDefUse(stmts);
+	CPPUNIT_ASSERT_EQUAL(3, s1->getNumUses());
+
+	// Remove the only user of 2
+	s3->removeDefUses();
+	CPPUNIT_ASSERT_EQUAL(2, s1->getNumUses());
+	CPPUNIT_ASSERT_EQUAL(0, s2->getNumUses());
+
+	// Propagate 1 into 2: 2 no longer uses anything
+	s2->setRight(new Binary(opPlus, new Const(5), new Const(5)));
+	s2->updateDefUses();
+	CPPUNIT_ASSERT_EQUAL(0, s1->getNumUses());
+	CPPUNIT_ASSERT(!s2->usesAssign());
+	delete prog;
+}
+
+/*==============================================================================
+ * FUNCTION:		StatementTest::testDefUseUpdate
+ * OVERVIEW:		Test that propagation keeps the def-use chains up to date, and only looks again at the statements
+ *					that have changed
+ *============================================================================*/
+void StatementTest::testDefUseUpdate () {
+	Prog* prog = new Prog;
+	UserProc* proc = (UserProc*) prog->newProc("test", 0x123);
+	Cfg *cfg = proc->getCFG();
+	// 1 r24 := 5
+	Assign* s1 = new Assign(Location::regOf(24), new Const(5));
+	s1->setNumber(1);
+	// 2 r25 := r24{1} + 1
+	Assign* s2 = new Assign(Location::regOf(25),
+		new Binary(opPlus,
+			new RefExp(Location::regOf(24), s1),
+			new Const(1)));
+	s2->setNumber(2);
+	// 3 r26 := r25{2}
+	Assign* s3 = new Assign(Location::regOf(26), new RefExp(Location::regOf(25), s2));
+	s3->setNumber(3);
+	RTL* rtl = new RTL(0x123);
+	rtl->appendStmt(s1);
+	rtl->appendStmt(s2);
+	rtl->appendStmt(s3);
+	std::list<RTL*>* pRtls = new std::list<RTL*>();
+	pRtls->push_back(rtl);
+	PBB bb = cfg->newBB(pRtls, RET, 0);
+	cfg->setEntryBB(bb);
+	s1->setProc(proc); s1->setBB(bb);
+	s2->setProc(proc); s2->setBB(bb);
+	s3->setProc(proc); s3->setBB(bb);
+
+	// The first pass builds the chains; 1 goes into 2, then the new 2 into 3
+	bool convert;
+	CPPUNIT_ASSERT(proc->propagateStatements(convert, 1));
+	std::ostringstream ost;
+	ost << s3;
+	std::string expected("   3 *v* r26 := 6");
+	CPPUNIT_ASSERT_EQUAL(expected, ost.str());
+	CPPUNIT_ASSERT_EQUAL(0, s1->getNumUses());
+	CPPUNIT_ASSERT_EQUAL(0, s2->getNumUses());
+
+	// Nothing more to do
+	CPPUNIT_ASSERT(!proc->propagateStatements(convert, 2));
+
+	// As if renaming had changed 3 to use 1: the chains follow, and only 3 is looked at
+	s3->setRight(new RefExp(Location::regOf(24), s1));
+	proc->stmtChanged(s3);
+	CPPUNIT_ASSERT_EQUAL(1, s1->getNumUses());
+	CPPUNIT_ASSERT(proc->propagateStatements(convert, 3));
+	std::ostringstream ost2;
+	ost2 << s3;
+	expected = "   3 *v* r26 := 5";
+	CPPUNIT_ASSERT_EQUAL(expected, ost2.str());
+	CPPUNIT_ASSERT_EQUAL(0, s1->getNumUses());
+	delete prog;
+}
@@ -55,5 +55,7 @@ class StatementTest : public CppUnit::TestCase {
 	void testBypass();
 	void testStripSizes();
 	void testFindConstants();
+	void testDefUse();
+	void testDefUseUpdate();
 };
 
@@ -23,6 +23,7 @@
  * 17 Jun 03 - Mike: Fixed an apparent error in generateCode (getCond)
  * 14 Jun 05 - Mike: Don't add redundant out edges to an N-way BB if some jump table entries repeat
  * 20 Mar 11 - Mike: Fixed braces near isLatchNode() in generateCode()
+ * 17 Oct 26 - Liveness (calcLiveness, getLiveOut) moved to Cfg::findInterferences, as bit vectors
 */
 
 
@@ -1618,124 +1619,6 @@ void BasicBlock::prependStmt(Statement* s, UserProc* proc) {
 	m_pRtls->push_front(rtl);
 }
 
-////////////////////////////////////////////////////
-
-// Check for overlap of liveness between the currently live locations (liveLocs) and the set of locations in ls
-// Also check for type conflicts if DFA_TYPE_ANALYSIS
-// This is a helper function that is not directly declated in the BasicBlock class
-void checkForOverlap(LocationSet& liveLocs, LocationSet& ls, ConnectionGraph& ig, UserProc* proc) {
-	// For each location to be considered
-	LocationSet::iterator uu;
-	for (uu = ls.begin(); uu != ls.end(); uu++) {
-		Exp* u = (Exp*)*uu;
-		if (!u->isSubscript()) continue;			// Only interested in subscripted vars
-		RefExp* r = (RefExp*)u;
-		// Interference if we can find a live variable which differs only in the reference
-		Exp *dr;
-		if (liveLocs.findDifferentRef(r, dr)) {
-			// We have an interference between r and dr. Record it
-			ig.connect(r, dr);
-			if (VERBOSE || DEBUG_LIVENESS)
-				LOG << "interference of " << dr << " with " << r << "\n";
-		}
-		// Add the uses one at a time. Note: don't use makeUnion, because then we don't discover interferences
-		// from the same statement, e.g.  blah := r24{2} + r24{3}
-		liveLocs.insert(u);
-	}
-}
-
-bool BasicBlock::calcLiveness(ConnectionGraph& ig, UserProc* myProc) {
-	// Start with the liveness at the bottom of the BB
-	LocationSet liveLocs, phiLocs;
-	getLiveOut(liveLocs, phiLocs);
-	// Do the livensses that result from phi statements at successors first.
-	// FIXME: document why this is necessary
-	checkForOverlap(liveLocs, phiLocs, ig, myProc);
-	// For each RTL in this BB
-	std::list<RTL*>::reverse_iterator rit;
-	if (m_pRtls)  // this can be NULL
-	for (rit = m_pRtls->rbegin(); rit != m_pRtls->rend(); rit++) {
-		std::list<Statement*>& stmts = (*rit)->getList();
-		std::list<Statement*>::reverse_iterator sit;
-		// For each statement this RTL
-		for (sit = stmts.rbegin(); sit != stmts.rend(); sit++) {
-			Statement* s = *sit;
-			LocationSet defs;
-			s->getDefinitions(defs);
-			// The definitions don't have refs yet
-			defs.addSubscript(s /* , myProc->getCFG() */);
-#if 0		// I used to think it necessary to consider definitions as a special case. However, I now believe that
-			// this was either an error of implementation (e.g. it didn't seem to correctly consider the livenesses
-			// causesd by phis) or something to do with renaming but not propagating certain memory locations.
-			// The idea is now to clearly divide locations into those that can be renamed and propagated, and those
-			// which are not renamed or propagated. (Check this.)
-
-			// Also consider it an interference if we define a location that is the same base variable. This can happen
-			// when there is a definition that is unused but for whatever reason not eliminated
-			// This check is done at the "bottom" of the statement, i.e. before we add s's uses and remove s's
-			// definitions to liveLocs
-			// Note that phi assignments don't count
-			if (!s->isPhi())
-				checkForOverlap(liveLocs, defs, ig, myProc, false);
-#endif
-			// Definitions kill uses. Now we are moving to the "top" of statement s
-			liveLocs.makeDiff(defs);
-			// Phi functions are a special case. The operands of phi functions are uses, but they don't interfere
-			// with each other (since they come via different BBs). However, we don't want to put these uses into
-			// liveLocs, because then the livenesses will flow to all predecessors. Only the appropriate livenesses
-			// from the appropriate phi parameter should flow to the predecessor. This is done in getLiveOut()
-			if (s->isPhi()) continue;
-			// Check for livenesses that overlap
-			LocationSet uses;
-			s->addUsedLocs(uses);
-			checkForOverlap(liveLocs, uses, ig, myProc);
-			if (DEBUG_LIVENESS)
-				LOG << " ## liveness: at top of " << s << ", liveLocs is " << liveLocs.prints() << "\n";
-		}
-	}
-	// liveIn is what we calculated last time
-	if (!(liveLocs == liveIn)) {
-		liveIn = liveLocs;
-		return true;		// A change
-	} else
-		// No change
-		return false;
-}
-
-// Locations that are live at the end of this BB are the union of the locations that are live at the start of its
-// successors
-// liveout gets all the livenesses, and phiLocs gets a subset of these, which are due to phi statements at the top of
-// successors
-void BasicBlock::getLiveOut(LocationSet &liveout, LocationSet& phiLocs) {
-	liveout.clear();
-	for (unsigned i = 0; i < m_OutEdges.size(); i++) {
-		PBB currBB = m_OutEdges[i];
-		// First add the non-phi liveness
-		liveout.makeUnion(currBB->liveIn);
-		int j = currBB->whichPred(this);
-		// The first RTL will have the phi functions, if any
-		if (currBB->m_pRtls == NULL || currBB->m_pRtls->size() == 0)
-			continue;
-		RTL* phiRtl = currBB->m_pRtls->front();
-		std::list<Statement*>& stmts = phiRtl->getList();
-		std::list<Statement*>::iterator it;
-		for (it = stmts.begin(); it != stmts.end(); it++) {
-			// Only interested in phi assignments. Note that it is possible that some phi assignments have been
-			// converted to ordinary assignments. So the below is a continue, not a break.
-			if (!(*it)->isPhi()) continue;
-			PhiAssign* pa = (PhiAssign*)*it;
-			// Get the jth operand to the phi function; it has a use from BB *this
-			Statement* def = pa->getStmtAt(j);
-			RefExp* r = new RefExp(pa->getLeft()->clone(), def);
-			liveout.insert(r);
-			phiLocs.insert(r);
-			if (DEBUG_LIVENESS)
-				LOG << " ## Liveness: adding " << r << " due to ref to phi " << *it << " in BB at " << getLowAddr() <<
-					"\n";
-		}
-	}
-}
-
 // Basically the "whichPred" function as per Briggs, Cooper, et al (and presumably "Cryton, Ferante, Rosen, Wegman, and
 // Zadek").  Return -1 if not found
 int BasicBlock::whichPred(PBB pred) {
@@ -2048,7 +1931,7 @@ bool BasicBlock::decodeIndirectJmp(UserProc* proc) {
 		// because of the alias safety issue. Eventually, we should use an alias-safe incremental propagation, but for
 		// now we'll assume no alias problems and force the propagation
 		bool convert;
-		lastStmt->propagateTo(convert, NULL, NULL, true /* force */);
+		lastStmt->propagateTo(convert, false, NULL, true /* force */);
 		Exp* e = lastStmt->getDest();
 		int n = sizeof(hlForms) / sizeof(Exp*);
 		char form = 0;
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   budget.cpp
+ * OVERVIEW:   Implementation of class Budget
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created
+ */
+
+#include <string>
+#include <vector>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+#include "boomerang.h"
+#include "proc.h"
+#include "log.h"
+#include "threads.h"
+#include "util.h"
+#include "budget.h"
+#ifndef NO_GARBAGE_COLLECTOR
+#include "gc.h"
+#endif
+
+double Budget::start = 0;
+volatile bool Budget::exceeded = false;
+double Budget::globalSecs = 0;
+size_t Budget::globalBytes = 0;
+double Budget::procSecs = 0;
+size_t Budget::procBytes = 0;
+
+struct Degraded {
+	std::string	name;
+	int			level;
+	const char*	why;
+};
+
+static Mutex budgetMutex;					// For degradedProcs
+static std::vector<Degraded> degradedProcs;	// In the order first cut back; a proc may appear more than once
+
+void Budget::startGlobal() {
+	start = wallClock();
+	exceeded = false;
+}
+
+// The size of the heap, or failing that the peak resident set size
+static size_t heapSize() {
+#ifndef NO_GARBAGE_COLLECTOR
+	return GC_get_heap_size();
+#elif !defined(_WIN32)
+	struct rusage ru;
+	if (getrusage(RUSAGE_SELF, &ru) == 0)
+		return (size_t)ru.ru_maxrss * 1024;
+	return 0;
+#else
+	return 0;
+#endif
+}
+
+bool Budget::globalExceeded() {
+	if (exceeded)
+		return true;
+	if ((globalSecs && wallClock() - start > globalSecs * 1e6) || (globalBytes && heapSize() > globalBytes)) {
+		exceeded = true;
+		std::cerr << "\nover the budget for the decompilation; the remaining procedures will be cut back\n";
+		LOG << "over the budget for the decompilation\n";
+	}
+	return exceeded;
+}
+
+size_t Budget::heapAllocated() {
+#ifndef NO_GARBAGE_COLLECTOR
+	return GC_get_total_bytes();
+#else
+	return 0;
+#endif
+}
+
+int Budget::level(double procStart, size_t heap0, const char*& why) {
+	int level = FULL;
+	why = NULL;
+	if (procSecs) {
+		double secs = (wallClock() - procStart) / 1e6;
+		if (secs > procSecs) {
+			level = secs > 2 * procSecs ? NO_PROVER : FEWER_PASSES;
+			why = "procedure time";
+		}
+	}
+	if (procBytes && level < NO_PROVER) {
+		size_t bytes = heapAllocated() - heap0;
+		if (bytes > procBytes) {
+			level = bytes > 2 * procBytes ? NO_PROVER : FEWER_PASSES;
+			why = "procedure memory";
+		}
+	}
+	if (level < NO_PROVER && globalExceeded()) {
+		level = NO_PROVER;
+		why = "global budget";
+	}
+	return level;
+}
+
+void Budget::degrade(UserProc* proc, int level, const char* why) {
+	LOG << "cutting back " << proc->getName() << " to " << levelName(level) << " (over the " << why << ")\n";
+	MutexLock ml(budgetMutex);
+	Degraded d;
+	d.name = proc->getName();
+	d.level = level;
+	d.why = why;
+	degradedProcs.push_back(d);
+}
+
+const char* Budget::levelName(int level) {
+	switch (level) {
+		case FULL:			return "full";
+		case FEWER_PASSES:	return "fewer passes";
+		case NO_PROVER:		return "fewer passes, no prover";
+		case DECODED:		return "not analysed";
+	}
+	return "?";
+}
+
+int Budget::report(std::ostream& os) {
+	MutexLock ml(budgetMutex);
+	// Only the last (most cut back) entry of each proc
+	std::vector<Degraded> last;
+	std::vector<Degraded>::iterator it, jt;
+	for (it = degradedProcs.begin(); it != degradedProcs.end(); ++it) {
+		for (jt = last.begin(); jt != last.end(); ++jt)
+			if (jt->name == it->name)
+				break;
+		if (jt == last.end())
+			last.push_back(*it);
+		else
+			*jt = *it;
+	}
+	if (last.size()) {
+		os << last.size() << " procedure" << (last.size() == 1 ? " was" : "s were") << " cut back to meet the budgets:\n";
+		for (it = last.begin(); it != last.end(); ++it)
+			os << "  " << it->name << ": " << levelName(it->level) << " (over the " << it->why << ")\n";
+	}
+	return last.size();
+}
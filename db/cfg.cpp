@@ -19,6 +19,10 @@
  * 18 Apr 02 - Mike: Mods for boomerang
  * 19 Jul 04 - Mike: Changed initialisation of BBs to not rely on out edges
  * 20 Mar 11 - Mike: Added missing braces in Cfg::findLoopFollow()
+ * 17 Oct 26 - findInterferences: liveness as bit vectors over a numbering of the locations; was LocationSets per BB
+ * 17 Oct 26 - removeForRedecode, so that switch analysis can decode part of a proc again
+ * 17 Oct 26 - The liveness for findInterferences ignores uses that are not subscripted, as it used to
+ * 17 Oct 26 - printToLog logs at the debug level, and prints nothing when that is not wanted
  */
 
 
@@ -32,6 +36,7 @@
 #endif 
 
 #include <algorithm>		// For find()
+#include <deque>
 #include <fstream>
 #include <sstream>
 #include <cstring>
@@ -47,6 +52,7 @@
 #include "util.h"
 #include "hllcode.h"
 #include "boomerang.h"
+#include "threads.h"
 #include "log.h"
 
 void delete_lrtls(std::list<RTL*>* pLrtl);
@@ -843,6 +849,71 @@ void Cfg::removeBB( PBB bb)
 	m_listBB.erase(bbit);
 }
 
+/*==============================================================================
+ * FUNCTION:		Cfg::removeForRedecode
+ * OVERVIEW:		Remove a set of BBs from the CFG, so that their code can be decoded again (by
+ *					  FrontEnd::decodeFragment at each of the entries). As with clear(), the BBs are not deleted
+ * PARAMETERS:		bbs: the BBs to remove
+ *					entries: the addresses of the removed BBs that the remaining ones have edges to. Each of these edges
+ *					  now goes to a new, incomplete BB
+ * RETURNS:			False (and nothing is changed) if a removed BB that has to be decoded again has no address
+ *============================================================================*/
+bool Cfg::removeForRedecode(std::set<PBB>& bbs, std::set<ADDRESS>& entries) {
+	std::map<PBB, ADDRESS> addrs;
+	MAPBB::iterator mm;
+	for (mm = m_mapBB.begin(); mm != m_mapBB.end(); mm++)
+		if (mm->second && bbs.find(mm->second) != bbs.end())
+			addrs[mm->second] = mm->first;
+	std::list<PBB>::iterator it;
+	for (it = m_listBB.begin(); it != m_listBB.end(); it++) {
+		if (bbs.find(*it) != bbs.end()) continue;
+		std::vector<PBB>& outs = (*it)->m_OutEdges;
+		for (unsigned i=0; i < outs.size(); i++)
+			if (bbs.find(outs[i]) != bbs.end() && addrs.find(outs[i]) == addrs.end())
+				return false;
+	}
+
+	for (it = m_listBB.begin(); it != m_listBB.end(); ) {
+		if (bbs.find(*it) != bbs.end()) {
+			it = m_listBB.erase(it);
+			continue;
+		}
+		// Drop the in-edges from removed BBs
+		std::vector<PBB>& ins = (*it)->m_InEdges;
+		for (unsigned i=0; i < ins.size(); )
+			if (bbs.find(ins[i]) != bbs.end())
+				ins.erase(ins.begin() + i);
+			else
+				i++;
+		(*it)->m_iNumInEdges = ins.size();
+		it++;
+	}
+	std::map<PBB, ADDRESS>::iterator aa;
+	for (aa = addrs.begin(); aa != addrs.end(); aa++)
+		m_mapBB.erase(aa->second);
+	if (exitBB && bbs.find(exitBB) != bbs.end())
+		exitBB = NULL;
+
+	// Point the edges into the removed BBs at incomplete BBs. Copy the list, as newIncompleteBB() appends to it
+	std::list<PBB> remaining(m_listBB);
+	for (it = remaining.begin(); it != remaining.end(); it++) {
+		std::vector<PBB>& outs = (*it)->m_OutEdges;
+		for (unsigned i=0; i < outs.size(); i++) {
+			if (bbs.find(outs[i]) == bbs.end()) continue;
+			ADDRESS a = addrs[outs[i]];
+			bool label = outs[i]->m_iLabelNum != 0;
+			mm = m_mapBB.find(a);
+			PBB pDestBB = (mm != m_mapBB.end() && mm->second) ? mm->second : newIncompleteBB(a);
+			outs[i] = pDestBB;
+			pDestBB->m_InEdges.push_back(*it);
+			pDestBB->m_iNumInEdges++;
+			if (label) setLabel(pDestBB);
+			entries.insert(a);
+		}
+	}
+	return true;
+}
+
 /*==============================================================================
  * FUNCTION:		Cfg::compressCfg
  * OVERVIEW:		Compress the CFG. For now, it only removes BBs that are
@@ -1201,9 +1272,11 @@ void Cfg::dumpImplicitMap() {
 }
 
 void Cfg::printToLog() {
+	if (!Boomerang::get()->logging(LCAT_DECODE, LL_DEBUG))
+		return;							// Don't print it just to throw it away
 	std::ostringstream ost;
 	print(ost);
-	LOG << ost.str().c_str();
+	LOGC(LCAT_DECODE, LL_DEBUG) << ost.str().c_str();
 }
 
 void Cfg::setTimeStamps() {
@@ -1753,43 +1826,255 @@ void Cfg::generateDotFile(std::ofstream& of) {
 //			Liveness			 //
 ////////////////////////////////////
 
-void updateWorkListRev(PBB currBB, std::list<PBB>&workList, std::set<PBB>& workSet) {
-	// Insert inedges of currBB into the worklist, unless already there
-	std::vector<PBB>& ins = currBB->getInEdges();
-	int n = ins.size();
-	for (int i=0; i < n; i++) {
-		PBB currIn = ins[i];
-		if (workSet.find(currIn) == workSet.end()) {
-			workList.push_front(currIn);
-			workSet.insert(currIn);
+// The liveness analysis for fromSSAform (Cfg::findInterferences). The subscripted locations of the procedure are given
+// dense numbers (a LocationNumbering), and the livenesses are sets of these numbers (BitSets). The definitions and uses
+// of each statement, and the phi operands flowing out of each BB, are found once, not at every visit of the BB
+class Liveness {
+		// A statement, as seen by the analysis
+		struct LiveStmt {
+			Statement*	stmt;
+			bool		phi;
+			std::vector<int> defs;			// Numbers of the (subscripted) definitions
+			std::vector<int> uses;			// Numbers of the subscripted uses, in LocationSet order; none for phis
+			LocationSet	defLocs, useLocs;	// The same, only while numbering
+		};
+		// A BB, as seen by the analysis
+		struct LiveBB {
+			std::vector<LiveStmt> stmts;	// Last statement first
+			std::vector<int> succs;			// Indexes of the out edges
+			std::vector<int> preds;			// Indexes of the in edges
+			// The operands of phi functions at the successors, that are live out of this BB because of the edge from
+			// this BB. In LocationSet order; phiLive is the same as a set
+			std::vector<int> phiUses;
+			BitSet		phiLive;
+			LocationSet	phiLocs;			// Only while numbering
+			BitSet		liveIn;				// Live at the top of the BB
+		};
+
+		LocationNumbering nums;
+		std::vector<LiveBB> bbs;			// In the order of Cfg::m_listBB
+		BitSet		live;					// The current liveness, in calcLiveness
+		// The interference graph, as adjacency lists of location numbers, and the edges in the order found. Each edge
+		// is found many times, so it is checked here before being added to the (slower) ConnectionGraph
+		std::vector<std::vector<int> > adj;
+		std::vector<std::pair<int, int> > edges;
+
+		void		connect(int a, int b);
+		void		checkForOverlap(std::vector<int>& locs);
+public:
+					Liveness(std::list<PBB>& listBB);
+		bool		calcLiveness(int i);
+		std::vector<int>& getPreds(int i) {return bbs[i].preds;}
+		void		getLiveIn(int i, LocationSet& ls) {nums.getLocs(bbs[i].liveIn, ls);}
+		void		getInterferences(ConnectionGraph& ig);
+};
+
+Liveness::Liveness(std::list<PBB>& listBB) : bbs(listBB.size()) {
+	std::map<PBB, int> bbNum;
+	std::list<PBB>::iterator it;
+	int i = 0;
+	for (it = listBB.begin(); it != listBB.end(); it++)
+		bbNum[*it] = i++;
+	// Find the locations defined and used, and number them
+	for (it = listBB.begin(), i = 0; it != listBB.end(); it++, i++) {
+		PBB bb = *it;
+		LiveBB& lb = bbs[i];
+		std::vector<PBB>& ins = bb->getInEdges();
+		for (unsigned j = 0; j < ins.size(); j++)
+			lb.preds.push_back(bbNum[ins[j]]);
+		std::vector<PBB>& outs = bb->getOutEdges();
+		for (unsigned j = 0; j < outs.size(); j++) {
+			PBB succ = outs[j];
+			lb.succs.push_back(bbNum[succ]);
+			int k = succ->whichPred(bb);
+			// The first RTL will have the phi functions, if any
+			std::list<RTL*>* rtls = succ->getRTLs();
+			if (rtls == NULL || rtls->size() == 0)
+				continue;
+			std::list<Statement*>& stmts = rtls->front()->getList();
+			std::list<Statement*>::iterator ss;
+			for (ss = stmts.begin(); ss != stmts.end(); ss++) {
+				// Only interested in phi assignments. Note that it is possible that some phi assignments have been
+				// converted to ordinary assignments. So the below is a continue, not a break.
+				if (!(*ss)->isPhi()) continue;
+				PhiAssign* pa = (PhiAssign*)*ss;
+				// Get the kth operand to the phi function; it has a use from this BB
+				RefExp* r = new RefExp(pa->getLeft()->clone(), pa->getStmtAt(k));
+				lb.phiLocs.insert(r);
+				if (DEBUG_LIVENESS)
+					LOG << " ## Liveness: adding " << r << " due to ref to phi " << *ss << " in BB at " <<
+						bb->getLowAddr() << "\n";
+			}
+		}
+		nums.add(lb.phiLocs);
+		std::list<RTL*>* rtls = bb->getRTLs();
+		if (rtls == NULL)
+			continue;
+		int n = 0;
+		std::list<RTL*>::reverse_iterator rit;
+		for (rit = rtls->rbegin(); rit != rtls->rend(); rit++)
+			n += (*rit)->getList().size();
+		lb.stmts.resize(n);
+		n = 0;
+		for (rit = rtls->rbegin(); rit != rtls->rend(); rit++) {
+			std::list<Statement*>& stmts = (*rit)->getList();
+			std::list<Statement*>::reverse_iterator sit;
+			for (sit = stmts.rbegin(); sit != stmts.rend(); sit++) {
+				LiveStmt& ls = lb.stmts[n++];
+				ls.stmt = *sit;
+				ls.phi = ls.stmt->isPhi();
+				ls.stmt->getDefinitions(ls.defLocs);
+				// The definitions don't have refs yet
+				ls.defLocs.addSubscript(ls.stmt);
+				nums.add(ls.defLocs);
+				// Phi functions are a special case. The operands of phi functions are uses, but they don't interfere
+				// with each other (since they come via different BBs). However, we don't want to put these uses into
+				// the liveness, because then the livenesses will flow to all predecessors. Only the appropriate
+				// livenesses from the appropriate phi parameter should flow to the predecessor (phiUses above)
+				if (ls.phi) continue;
+				// Only interested in subscripted uses; the others are not in the liveness at all
+				LocationSet used;
+				ls.stmt->addUsedLocs(used);
+				LocationSet::iterator uu;
+				for (uu = used.begin(); uu != used.end(); uu++)
+					if ((*uu)->isSubscript())
+						ls.useLocs.insert(*uu);
+				nums.add(ls.useLocs);
+			}
 		}
 	}
+	nums.number();
+	int size = nums.size();
+	live.resize(size);
+	adj.resize(size);
+	for (i = 0; i < (int)bbs.size(); i++) {
+		LiveBB& lb = bbs[i];
+		LocationSet::iterator ll;
+		lb.phiLive.resize(size);
+		for (ll = lb.phiLocs.begin(); ll != lb.phiLocs.end(); ll++) {
+			int n = nums.find(*ll);
+			lb.phiUses.push_back(n);
+			lb.phiLive.set(n);
+		}
+		lb.phiLocs.clear();
+		lb.liveIn.resize(size);
+		for (unsigned j = 0; j < lb.stmts.size(); j++) {
+			LiveStmt& ls = lb.stmts[j];
+			for (ll = ls.defLocs.begin(); ll != ls.defLocs.end(); ll++)
+				ls.defs.push_back(nums.find(*ll));
+			for (ll = ls.useLocs.begin(); ll != ls.useLocs.end(); ll++)
+				ls.uses.push_back(nums.find(*ll));
+			ls.defLocs.clear();
+			ls.useLocs.clear();
+		}
+	}
+}
+
+// Record an interference between locations a and b, unless already recorded
+void Liveness::connect(int a, int b) {
+	std::vector<int>& aa = adj[a];
+	if (std::find(aa.begin(), aa.end(), b) != aa.end())
+		return;
+	aa.push_back(b);
+	adj[b].push_back(a);
+	edges.push_back(std::pair<int, int>(a, b));
+}
+
+// Check for overlap of liveness between the currently live locations (live) and the locations numbered in locs
+void Liveness::checkForOverlap(std::vector<int>& locs) {
+	// For each location to be considered
+	for (unsigned i = 0; i < locs.size(); i++) {
+		int u = locs[i];
+		// Interference if we can find a live variable which differs only in the reference
+		int dr = live.findFirst(nums.getFirst(u), nums.getLast(u), u);
+		if (dr != -1) {
+			// We have an interference between u and dr. Record it
+			connect(u, dr);
+			if (VERBOSE || DEBUG_LIVENESS)
+				LOG << "interference of " << nums.getLoc(dr) << " with " << nums.getLoc(u) << "\n";
+		}
+		// Add the uses one at a time, so that we discover interferences from the same statement, e.g.
+		// blah := r24{2} + r24{3}
+		live.set(u);
+	}
+}
+
+// Calculate the locations live at the top of the ith BB, and the interferences within it. Return true if the liveness
+// at the top changed
+bool Liveness::calcLiveness(int i) {
+	LiveBB& lb = bbs[i];
+	// Start with the liveness at the bottom of the BB: the union of the livenesses at the top of the successors,
+	// and the phi operands due to this BB
+	live.clear();
+	for (unsigned j = 0; j < lb.succs.size(); j++)
+		live.makeUnion(bbs[lb.succs[j]].liveIn);
+	live.makeUnion(lb.phiLive);
+	// Do the livenesses that result from phi statements at successors first.
+	// FIXME: document why this is necessary
+	checkForOverlap(lb.phiUses);
+	// For each statement, last first
+	for (unsigned j = 0; j < lb.stmts.size(); j++) {
+		LiveStmt& ls = lb.stmts[j];
+		// Definitions kill uses. Now we are moving to the "top" of the statement
+		for (unsigned k = 0; k < ls.defs.size(); k++)
+			live.reset(ls.defs[k]);
+		if (ls.phi) continue;
+		// Check for livenesses that overlap
+		checkForOverlap(ls.uses);
+		if (DEBUG_LIVENESS) {
+			LocationSet liveLocs;
+			nums.getLocs(live, liveLocs);
+			LOG << " ## liveness: at top of " << ls.stmt << ", liveLocs is " << liveLocs.prints() << "\n";
+		}
+	}
+	// liveIn is what we calculated last time
+	if (live == lb.liveIn)
+		return false;		// No change
+	lb.liveIn = live;
+	return true;			// A change
+}
+
+// Add the interferences found to ig, in the order they were found (which is the order that they used to be added)
+void Liveness::getInterferences(ConnectionGraph& ig) {
+	for (unsigned i = 0; i < edges.size(); i++)
+		ig.connect(nums.getLoc(edges[i].first), nums.getLoc(edges[i].second));
 }
 
-static int progress = 0;
-void Cfg::findInterferences(ConnectionGraph& cg) {
+static volatile int progress = 0;		// Shared by all threads; only for the progress dots
+
+/*==============================================================================
+ * FUNCTION:		Cfg::findInterferences
+ * OVERVIEW:		Find the interferences between the subscripted locations of this proc: two versions of one
+ *					  location that are live at the same time. These are added to ig. Also sets the liveIn of each BB
+ * NOTE:			The BBs are visited in the same order as they always have been (the last BB first, and the
+ *					  predecessors of a BB whose liveness has changed are queued at the front). The interferences found
+ *					  on the early visits of a BB are kept, so a different order would give a different graph
+ *============================================================================*/
+void Cfg::findInterferences(ConnectionGraph& ig) {
 	if (m_listBB.size() == 0) return;
 
-	std::list<PBB> workList;			// List of BBs still to be processed
-	// Set of the same; used for quick membership test
-	std::set<PBB> workSet; 
-	appendBBs(workList, workSet);
+	Liveness lv(m_listBB);
+	std::vector<PBB> bbs(m_listBB.begin(), m_listBB.end());
+	int n = bbs.size();
+	std::deque<int> workList;			// Indexes of the BBs still to be processed
+	std::vector<char> inWorkList(n, 1);	// For quick membership test
+	for (int i = 0; i < n; i++)
+		workList.push_back(i);
 
 	bool change;
 	int count = 0;
 	while (workList.size() && count < 100000) {
 		count++;  // prevent infinite loop
-		if (++progress > 20) {
+		if (atomicIncrement(&progress) % 20 == 0)
 			std::cout << "i" << std::flush;
-			progress = 0;
-		}
-		PBB currBB = workList.back();
-		workList.erase(--workList.end());
-		workSet.erase(currBB);
+		int i = workList.back();
+		workList.pop_back();
+		inWorkList[i] = 0;
 		// Calculate live locations and interferences
-		change = currBB->calcLiveness(cg, myProc);
+		change = lv.calcLiveness(i);
 		if (change) {
 			if (DEBUG_LIVENESS) {
+				PBB currBB = bbs[i];
 				LOG << "Revisiting BB ending with stmt ";
 				Statement* last = NULL;
 				if (currBB->m_pRtls->size()) {
@@ -1803,9 +2088,19 @@ void Cfg::findInterferences(ConnectionGraph& cg) {
 					LOG << "<none>";
 				LOG << " due to change\n";
 			}
-			updateWorkListRev(currBB, workList, workSet);
+			// Insert the in edges of the BB into the worklist, unless already there
+			std::vector<int>& preds = lv.getPreds(i);
+			for (unsigned j = 0; j < preds.size(); j++) {
+				if (!inWorkList[preds[j]]) {
+					workList.push_front(preds[j]);
+					inWorkList[preds[j]] = 1;
+				}
+			}
 		}
 	}
+	lv.getInterferences(ig);
+	for (int i = 0; i < n; i++)
+		lv.getLiveIn(i, bbs[i]->liveIn);
 }
 
 void Cfg::appendBBs(std::list<PBB>& worklist, std::set<PBB>& workset) {
@@ -2014,11 +2309,14 @@ PBB Cfg::splitForBranch(PBB pBB, RTL* rtl, BranchStatement* br1, BranchStatement
 }
 
 // Check for indirect jumps and calls in all my BBs; decode any new code
-bool Cfg::decodeIndirectJmp(UserProc* proc) {
+bool Cfg::decodeIndirectJmp(UserProc* proc, std::list<PBB>* decoded /* = NULL */) {
 	std::list<PBB>::iterator it;
 	bool res = false;
 	for (it = m_listBB.begin(); it != m_listBB.end(); it++) {
-		res |= (*it)->decodeIndirectJmp(proc);
+		if ((*it)->decodeIndirectJmp(proc)) {
+			res = true;
+			if (decoded) decoded->push_back(*it);
+		}
 	}
 	return res;
 }
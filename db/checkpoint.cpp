@@ -0,0 +1,1491 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   checkpoint.cpp
+ * OVERVIEW:   Implementation of class Checkpoint, the binary save file of a decoded program (-SD and -LD)
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created
+ * 17 Oct 26 - saveTypes and loadTypes
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <iostream>
+#include "types.h"
+#include "prog.h"
+#include "proc.h"
+#include "cfg.h"
+#include "rtl.h"
+#include "exp.h"
+#include "type.h"
+#include "statement.h"
+#include "signature.h"
+#include "cluster.h"
+#include "frontend.h"
+#include "boomerang.h"
+#include "log.h"
+#include "checkpoint.h"
+
+/*
+ * The file is a sequence of 32 bit words (host order) and byte strings, in records. The header (CKPT_HEADER words) has
+ * CKPT_MAGIC, CKPT_VERSION, opNumOf and the size of an ADDRESS (a checkpoint from another build or host is refused),
+ * the modification time and size of the binary when it was saved, and the offset and size of the directory record.
+ * The bodies of the UserProcs follow, one record each, then the directory: the program's name and path, the clusters,
+ * the globals, and for each proc its address, signature and proven expressions, and (for a UserProc) where its body
+ * is and the address ranges of its BBs.
+ * Each object that can be pointed to more than once is given a number when it is first written (zero is NULL);
+ * procs and clusters are numbered for the whole file, and types, statements and BBs within the record. A statement is
+ * written in full where it is first met (in the RTLs of its BB), and as its number elsewhere. As with the XML, the
+ * collectors, the data flow information, the ranges and the def-use chains are not saved; they are recomputed by the
+ * decompiler.
+ */
+#define CKPT_MAGIC		0x54504b43		// "CKPT" on a little endian host
+#define CKPT_VERSION	1				// Increment when the format, or the classes saved, change
+#define CKPT_HEADER		8				// Words in the header
+
+// Tags for expressions
+enum {TAG_NULL, TAG_CONST, TAG_TERMINAL, TAG_UNARY, TAG_BINARY, TAG_TERNARY, TAG_LOCATION, TAG_REFEXP, TAG_FLAGDEF,
+	TAG_TYPEDEXP, TAG_TYPEVAL};
+
+// Kinds of clusters
+enum {CLUSTER_PLAIN, CLUSTER_MODULE, CLUSTER_CLASS};
+
+// Get the modification time and size of file path. Returns false if it does not exist
+static bool fileStamp(const char* path, unsigned& mtime, unsigned& size) {
+	struct stat st;
+	if (stat(path, &st) != 0)
+		return false;
+	mtime = (unsigned)st.st_mtime;
+	size = (unsigned)st.st_size;
+	return true;
+}
+
+Checkpoint::Checkpoint() : out(NULL), ok(true), in(NULL), prog(NULL), p(NULL), end(NULL) {
+}
+
+Checkpoint::~Checkpoint() {
+	if (in)
+		fclose(in);
+}
+
+/*
+ * Writing
+ */
+
+void Checkpoint::flush() {
+	if (buf.size() && fwrite(&buf[0], 1, buf.size(), out) != buf.size())
+		ok = false;
+	buf.clear();
+}
+
+void Checkpoint::procRef(Proc* p) {
+	std::map<Proc*, unsigned>::iterator it = procIds.find(p);
+	word(it == procIds.end() ? 0 : it->second);
+}
+
+unsigned Checkpoint::stmtId(Statement* s) {
+	std::map<Statement*, unsigned>::iterator it = stmtIds.find(s);
+	if (it != stmtIds.end())
+		return it->second;
+	unsigned id = stmtIds.size() + 1;
+	stmtIds[s] = id;
+	return id;
+}
+
+unsigned Checkpoint::bbRef(PBB bb) {
+	std::map<PBB, unsigned>::iterator it = bbIds.find(bb);
+	return it == bbIds.end() ? 0 : it->second;
+}
+
+void Checkpoint::writeType(Type* ty) {
+	if (ty == NULL) {
+		word(0);
+		return;
+	}
+	std::map<Type*, unsigned>::iterator it = typeIds.find(ty);
+	if (it != typeIds.end()) {
+		word(it->second);
+		return;
+	}
+	// Numbered before the parts are written, as a type can (through a pointer) contain itself
+	unsigned id = typeIds.size() + 1;
+	typeIds[ty] = id;
+	word(id);
+	eType kind = ty->isLower() ? eLower : ty->getId();		// A LowerType has the id of an UpperType
+	word(kind);
+	switch (kind) {
+		case eVoid: case eBoolean: case eChar:
+			break;
+		case eFunc:
+			writeSignature(((FuncType*)ty)->getSignature());
+			break;
+		case eInteger:
+			word(ty->getSize());
+			word(((IntegerType*)ty)->getSignedness());
+			break;
+		case eFloat: case eSize:
+			word(ty->getSize());
+			break;
+		case ePointer:
+			writeType(((PointerType*)ty)->getPointsTo());
+			break;
+		case eArray:
+			word(((ArrayType*)ty)->getLength());
+			writeType(((ArrayType*)ty)->getBaseType());
+			break;
+		case eNamed:
+			str(((NamedType*)ty)->getName());
+			break;
+		case eCompound: {
+			CompoundType* c = (CompoundType*)ty;
+			word(c->generic);
+			word(c->nextGenericMemberNum);
+			word(c->types.size());
+			for (unsigned i = 0; i < c->types.size(); i++) {
+				str(c->names[i]);
+				writeType(c->types[i]);
+			}
+			break;
+		}
+		case eUnion: {
+			UnionType* u = (UnionType*)ty;
+			word(u->li.size());
+			for (std::list<UnionElement>::iterator ee = u->li.begin(); ee != u->li.end(); ee++) {
+				str(ee->name);
+				writeType(ee->type);
+			}
+			break;
+		}
+		case eUpper:
+			writeType(((UpperType*)ty)->getBaseType());
+			break;
+		case eLower:
+			writeType(((LowerType*)ty)->getBaseType());
+			break;
+		default:
+			ok = false;
+	}
+}
+
+void Checkpoint::writeExp(Exp* e) {
+	if (e == NULL) {
+		word(TAG_NULL);
+		return;
+	}
+	OPER op = e->getOper();
+	if (dynamic_cast<TypeVal*>(e)) {
+		word(TAG_TYPEVAL);
+		writeType(((TypeVal*)e)->getType());
+	} else if (dynamic_cast<Terminal*>(e)) {
+		word(TAG_TERMINAL); word(op);
+	} else if (dynamic_cast<Const*>(e)) {
+		Const* c = (Const*)e;
+		word(TAG_CONST); word(op);
+		switch (op) {
+			case opIntConst:	addr(c->u.a); break;			// Whichever of i and a it was made from
+			case opLongConst:	bytes(&c->u.ll, sizeof(c->u.ll)); break;
+			case opFltConst:	bytes(&c->u.d, sizeof(c->u.d)); break;
+			case opStrConst:
+				word(c->u.p != NULL);
+				if (c->u.p) str(c->u.p);
+				break;
+			case opFuncConst:	procRef(c->u.pp); break;
+			default:			ok = false;
+		}
+		word(c->conscript);
+		writeType(c->type);
+	} else if (dynamic_cast<Location*>(e)) {
+		word(TAG_LOCATION); word(op);
+		procRef(((Location*)e)->proc);
+		writeExp(e->getSubExp1());
+	} else if (dynamic_cast<RefExp*>(e)) {
+		word(TAG_REFEXP);
+		stmtRef(((RefExp*)e)->def);
+		writeExp(e->getSubExp1());
+	} else if (dynamic_cast<FlagDef*>(e)) {
+		word(TAG_FLAGDEF);
+		writeExp(e->getSubExp1());
+		writeRTL(((FlagDef*)e)->getRtl());
+	} else if (dynamic_cast<TypedExp*>(e)) {
+		word(TAG_TYPEDEXP);
+		writeType(((TypedExp*)e)->getType());
+		writeExp(e->getSubExp1());
+	} else if (dynamic_cast<Ternary*>(e)) {
+		word(TAG_TERNARY); word(op);
+		writeExp(e->getSubExp1()); writeExp(e->getSubExp2()); writeExp(e->getSubExp3());
+	} else if (dynamic_cast<Binary*>(e)) {
+		word(TAG_BINARY); word(op);
+		writeExp(e->getSubExp1()); writeExp(e->getSubExp2());
+	} else if (dynamic_cast<Unary*>(e)) {
+		word(TAG_UNARY); word(op);
+		writeExp(e->getSubExp1());
+	} else {
+		ok = false;
+		word(TAG_NULL);
+	}
+}
+
+// A statement is written as its number, then 0 if it has been written already, else 1 + its kind and its parts
+void Checkpoint::writeStmt(Statement* s) {
+	if (s == NULL) {
+		word(0);
+		return;
+	}
+	word(stmtId(s));
+	if (!written.insert(s).second) {
+		word(0);
+		return;
+	}
+	word(1 + s->kind);
+	word(s->number);
+	word(bbRef(s->pbb));
+	procRef(s->proc);
+	stmtRef(s->parent);
+	switch (s->kind) {
+		case STMT_ASSIGN: {
+			Assign* a = (Assign*)s;
+			writeType(a->type);
+			writeExp(a->lhs);
+			writeExp(a->rhs);
+			writeExp(a->guard);
+			break;
+		}
+		case STMT_PHIASSIGN: {
+			PhiAssign* pa = (PhiAssign*)s;
+			writeType(pa->type);
+			writeExp(pa->lhs);
+			word(pa->defVec.size());
+			for (PhiAssign::iterator it = pa->defVec.begin(); it != pa->defVec.end(); it++) {
+				stmtRef(it->def);
+				writeExp(it->e);
+			}
+			break;
+		}
+		case STMT_IMPASSIGN:
+			writeType(((ImplicitAssign*)s)->type);
+			writeExp(((ImplicitAssign*)s)->lhs);
+			break;
+		case STMT_BOOLASSIGN: {
+			BoolAssign* b = (BoolAssign*)s;
+			writeType(b->type);
+			writeExp(b->lhs);
+			word(b->jtCond);
+			writeExp(b->pCond);
+			word(b->bFloat);
+			word(b->size);
+			break;
+		}
+		case STMT_GOTO: case STMT_BRANCH: case STMT_CASE: case STMT_CALL: {
+			GotoStatement* g = (GotoStatement*)s;
+			writeExp(g->pDest);
+			word(g->m_isComputed);
+			if (s->kind == STMT_BRANCH) {
+				BranchStatement* br = (BranchStatement*)s;
+				word(br->jtCond);
+				writeExp(br->pCond);
+				word(br->bFloat);
+				word(br->size);
+			} else if (s->kind == STMT_CASE) {
+				SWITCH_INFO* si = ((CaseStatement*)s)->getSwitchInfo();
+				word(si != NULL);
+				if (si == NULL) break;
+				writeExp(si->pSwitchVar);
+				word(si->chForm);
+				word(si->iLower);
+				word(si->iUpper);
+				word(si->iNumTable);
+				word(si->iOffset);
+				if (si->chForm == 'F')		// uTable is a host array of the values
+					for (int i = 0; i < si->iNumTable; i++)
+						word(((int*)si->uTable)[i]);
+				else
+					addr(si->uTable);
+			} else if (s->kind == STMT_CALL) {
+				CallStatement* c = (CallStatement*)s;
+				word(c->returnAfterCall);
+				writeStmtList(c->arguments);
+				writeStmtList(c->defines);
+				procRef(c->procDest);
+				writeSignature(c->signature);
+				// The callee's return statement is in the callee's body
+				ReturnStatement* ret = c->calleeReturn;
+				if (ret == NULL)
+					word(0);
+				else if (c->procDest && !c->procDest->isLib() && ret == ((UserProc*)c->procDest)->theReturnStatement)
+					word(1);
+				else {
+					word(2);
+					writeStmt(ret);
+				}
+			}
+			break;
+		}
+		case STMT_RET: {
+			ReturnStatement* r = (ReturnStatement*)s;
+			addr(r->retAddr);
+			writeStmtList(r->modifieds);
+			writeStmtList(r->returns);
+			break;
+		}
+		case STMT_IMPREF:
+			writeType(((ImpRefStatement*)s)->getType());
+			writeExp(((ImpRefStatement*)s)->getAddressExp());
+			break;
+		case STMT_JUNCTION:
+			break;
+		default:
+			ok = false;
+	}
+}
+
+void Checkpoint::writeStmtList(StatementList& sl) {
+	word(sl.size());
+	for (StatementList::iterator it = sl.begin(); it != sl.end(); it++)
+		writeStmt(*it);
+}
+
+void Checkpoint::writeRTL(RTL* r) {
+	if (r == NULL) {
+		word(0);
+		return;
+	}
+	word(1);
+	addr(r->getAddress());
+	std::list<Statement*>& l = r->getList();
+	word(l.size());
+	for (std::list<Statement*>::iterator it = l.begin(); it != l.end(); it++)
+		writeStmt(*it);
+}
+
+void Checkpoint::writeSignature(Signature* sig) {
+	if (sig == NULL) {
+		word(0);
+		return;
+	}
+	CustomSignature* cs = dynamic_cast<CustomSignature*>(sig);
+	word(cs ? 2 : 1);
+	word(sig->getPlatform());
+	word(sig->getConvention());
+	if (cs)
+		word(cs->sp);
+	str(sig->name);
+	str(sig->sigFile);
+	word(sig->params.size());
+	for (unsigned i = 0; i < sig->params.size(); i++) {
+		Parameter* pa = sig->params[i];
+		str(pa->getName());
+		writeType(pa->getType());
+		writeExp(pa->getExp());
+		str(pa->getBoundMax());
+	}
+	word(sig->returns.size());
+	for (Returns::iterator rr = sig->returns.begin(); rr != sig->returns.end(); rr++) {
+		writeType((*rr)->type);
+		writeExp((*rr)->exp);
+	}
+	writeType(sig->rettype);
+	word(sig->ellipsis);
+	word(sig->unknown);
+	word(sig->forced);
+	writeType(sig->preferedReturn);
+	str(sig->preferedName);
+	word(sig->preferedParams.size());
+	for (unsigned i = 0; i < sig->preferedParams.size(); i++)
+		word(sig->preferedParams[i]);
+}
+
+// Write cluster c and its children, in preorder
+void Checkpoint::writeCluster(Cluster* c) {
+	unsigned id = clusterIds.size() + 1;
+	clusterIds[c] = id;
+	if (dynamic_cast<Class*>(c))
+		word(CLUSTER_CLASS);
+	else if (dynamic_cast<Module*>(c))
+		word(CLUSTER_MODULE);
+	else
+		word(CLUSTER_PLAIN);
+	str(c->getName());
+	word(c->getNumChildren());
+	for (unsigned i = 0; i < c->getNumChildren(); i++)
+		writeCluster(c->getChild(i));
+}
+
+void Checkpoint::writeBB(PBB bb) {
+	word(bb->m_nodeType);
+	word(bb->m_iLabelNum);
+	str(bb->m_labelStr);
+	word(bb->m_labelneeded);
+	word(bb->m_bIncomplete);
+	word(bb->m_bJumpReqd);
+	word(bb->m_iTraversed);
+	word(bb->m_DFTfirst); word(bb->m_DFTlast); word(bb->m_DFTrevfirst); word(bb->m_DFTrevlast);
+	word(bb->m_structType);
+	word(bb->m_loopCondType);
+	word(bbRef(bb->m_loopHead)); word(bbRef(bb->m_caseHead)); word(bbRef(bb->m_condFollow));
+	word(bbRef(bb->m_loopFollow)); word(bbRef(bb->m_latchNode));
+	// Doug Simon's structuring
+	word(bb->ord); word(bb->revOrd);
+	word(bb->inEdgesVisited); word(bb->numForwardInEdges);
+	word(bb->loopStamps[0]); word(bb->loopStamps[1]);
+	word(bb->revLoopStamps[0]); word(bb->revLoopStamps[1]);
+	word(bb->traversed);
+	word(bb->hllLabel);
+	word(bb->labelStr != NULL);
+	if (bb->labelStr)
+		str(bb->labelStr);
+	word(bb->indentLevel);
+	word(bbRef(bb->immPDom)); word(bbRef(bb->loopHead)); word(bbRef(bb->caseHead));
+	word(bbRef(bb->condFollow)); word(bbRef(bb->loopFollow)); word(bbRef(bb->latchNode));
+	word(bb->sType); word(bb->usType); word(bb->lType); word(bb->cType);
+	word(bb->overlappedRegProcessingDone);
+
+	word(bb->m_InEdges.size());
+	for (unsigned i = 0; i < bb->m_InEdges.size(); i++)
+		word(bbRef(bb->m_InEdges[i]));
+	word(bb->m_OutEdges.size());
+	for (unsigned i = 0; i < bb->m_OutEdges.size(); i++)
+		word(bbRef(bb->m_OutEdges[i]));
+	word(bb->liveIn.size());
+	for (LocationSet::iterator ll = bb->liveIn.begin(); ll != bb->liveIn.end(); ll++)
+		writeExp(*ll);
+	word(bb->m_pRtls != NULL);
+	if (bb->m_pRtls) {
+		word(bb->m_pRtls->size());
+		for (std::list<RTL*>::iterator rr = bb->m_pRtls->begin(); rr != bb->m_pRtls->end(); rr++)
+			writeRTL(*rr);
+	}
+}
+
+void Checkpoint::writeCfg(Cfg* cfg) {
+	std::list<PBB>::iterator it;
+	unsigned n = 0;
+	for (it = cfg->m_listBB.begin(); it != cfg->m_listBB.end(); it++)
+		bbIds[*it] = ++n;
+	word(n);
+	for (it = cfg->m_listBB.begin(); it != cfg->m_listBB.end(); it++)
+		writeBB(*it);
+	word(bbRef(cfg->entryBB));
+	word(bbRef(cfg->exitBB));
+	word(cfg->m_bWellFormed);
+	word(cfg->structured);
+	word(cfg->lastLabel);
+	word(cfg->bImplicitsDone);
+	word(cfg->Ordering.size());
+	for (unsigned i = 0; i < cfg->Ordering.size(); i++)
+		word(bbRef(cfg->Ordering[i]));
+	word(cfg->revOrdering.size());
+	for (unsigned i = 0; i < cfg->revOrdering.size(); i++)
+		word(bbRef(cfg->revOrdering[i]));
+	word(cfg->m_mapBB.size());
+	for (MAPBB::iterator mm = cfg->m_mapBB.begin(); mm != cfg->m_mapBB.end(); mm++) {
+		addr(mm->first);
+		word(bbRef(mm->second));			// NULL for an address that is only the target of a jump so far
+	}
+	word(cfg->callSites.size());
+	for (std::set<CallStatement*>::iterator cc = cfg->callSites.begin(); cc != cfg->callSites.end(); cc++)
+		writeStmt(*cc);
+	word(cfg->implicitMap.size());
+	for (std::map<Exp*, Statement*, lessExpStar>::iterator ii = cfg->implicitMap.begin(); ii != cfg->implicitMap.end();
+			ii++) {
+		writeExp(ii->first);
+		writeStmt(ii->second);
+	}
+}
+
+void Checkpoint::writeBody(UserProc* proc) {
+	Cfg* cfg = proc->cfg;
+	word(cfg != NULL);
+	if (cfg)
+		writeCfg(cfg);
+	word(proc->locals.size());
+	for (std::map<std::string, Type*>::iterator ll = proc->locals.begin(); ll != proc->locals.end(); ll++) {
+		str(ll->first);
+		writeType(ll->second);
+	}
+	word(proc->symbolMap.size());
+	for (UserProc::SymbolMap::iterator ss = proc->symbolMap.begin(); ss != proc->symbolMap.end(); ss++) {
+		writeExp(ss->first);
+		writeExp(ss->second);
+	}
+	word(proc->calleeList.size());
+	for (std::list<Proc*>::iterator cc = proc->calleeList.begin(); cc != proc->calleeList.end(); cc++)
+		procRef(*cc);
+	writeStmtList(proc->parameters);
+	word(proc->addressEscapedVars.size());
+	for (LocationSet::iterator ee = proc->addressEscapedVars.begin(); ee != proc->addressEscapedVars.end(); ee++)
+		writeExp(*ee);
+	word(proc->nextLocal);
+	word(proc->nextParam);
+	word(proc->stmtNumber);
+	writeStmt(proc->theReturnStatement);
+}
+
+/*==============================================================================
+ * FUNCTION:		Checkpoint::write
+ * OVERVIEW:		Write prog to fname: the header, a record for the body of each UserProc (each written out as soon
+ *					  as it is made, so that only one is in memory at a time), and the directory
+ * RETURNS:			False if the file can't be written, or has something that the format does not support
+ *============================================================================*/
+bool Checkpoint::write(Prog* prog, const char* fname) {
+	out = fopen(fname, "wb");
+	if (out == NULL)
+		return false;
+	unsigned header[CKPT_HEADER] = {CKPT_MAGIC, CKPT_VERSION, opNumOf, sizeof(ADDRESS), 0, 0, 0, 0};
+	fileStamp((prog->m_path + prog->m_name).c_str(), header[4], header[5]);	// Not getPathAndName(): a temporary
+	bytes(header, sizeof(header));
+	flush();
+
+	std::list<Proc*>::iterator pp;
+	unsigned n = 0;
+	for (pp = prog->m_procs.begin(); pp != prog->m_procs.end(); pp++)
+		procIds[*pp] = ++n;
+
+	std::map<UserProc*, Body> placed;
+	unsigned offset = sizeof(header);
+	for (pp = prog->m_procs.begin(); pp != prog->m_procs.end() && ok; pp++) {
+		if ((*pp)->isLib()) continue;
+		UserProc* proc = (UserProc*)*pp;
+		typeIds.clear(); stmtIds.clear(); written.clear(); bbIds.clear();
+		writeBody(proc);
+		Body& body = placed[proc];
+		body.offset = offset;
+		body.size = buf.size();
+		offset += buf.size();
+		if (proc->cfg) {
+			BB_IT it;
+			for (PBB bb = proc->cfg->getFirstBB(it); bb; bb = proc->cfg->getNextBB(it)) {
+				if (bb->getRTLs() == NULL) continue;
+				ADDRESS lo = bb->getLowAddr(), hi = bb->getHiAddr();
+				if (hi >= lo)
+					body.ranges.push_back(std::pair<ADDRESS, ADDRESS>(lo, hi));
+			}
+		}
+		flush();
+	}
+
+	// The directory
+	typeIds.clear(); stmtIds.clear(); written.clear(); bbIds.clear();
+	str(prog->m_name);
+	str(prog->m_path);
+	word(prog->m_iNumberedProc);
+	writeCluster(prog->m_rootCluster);
+	word(prog->globals.size());
+	for (std::set<Global*>::iterator gg = prog->globals.begin(); gg != prog->globals.end(); gg++) {
+		str((*gg)->getName());
+		addr((*gg)->getAddress());
+		writeType((*gg)->getType());
+	}
+	word(prog->m_procs.size());
+	for (pp = prog->m_procs.begin(); pp != prog->m_procs.end(); pp++)
+		word((*pp)->isLib());
+	for (pp = prog->m_procs.begin(); pp != prog->m_procs.end(); pp++) {
+		Proc* proc = *pp;
+		addr(proc->address);
+		writeSignature(proc->signature);
+		word(proc->cluster ? clusterIds[proc->cluster] : 0);
+		procRef(proc->m_firstCaller);
+		addr(proc->m_firstCallerAddr);
+		word(proc->provenTrue.size());
+		for (std::map<Exp*, Exp*, lessExpStar>::iterator it = proc->provenTrue.begin(); it != proc->provenTrue.end();
+				it++) {
+			writeExp(it->first);
+			writeExp(it->second);
+		}
+		// The procs that call this one, which must be read before its set of callers is used
+		std::set<UserProc*> from;
+		for (std::set<CallStatement*>::iterator cc = proc->callerSet.begin(); cc != proc->callerSet.end(); cc++)
+			if ((*cc)->getProc())
+				from.insert((*cc)->getProc());
+		word(from.size());
+		for (std::set<UserProc*>::iterator ff = from.begin(); ff != from.end(); ff++)
+			procRef(*ff);
+		if (proc->isLib()) continue;
+		Body& body = placed[(UserProc*)proc];
+		word(((UserProc*)proc)->status);
+		word(body.offset);
+		word(body.size);
+		word(body.ranges.size());
+		for (unsigned i = 0; i < body.ranges.size(); i++) {
+			addr(body.ranges[i].first);
+			addr(body.ranges[i].second);
+		}
+	}
+	word(prog->entryProcs.size());
+	for (std::list<UserProc*>::iterator ee = prog->entryProcs.begin(); ee != prog->entryProcs.end(); ee++)
+		procRef(*ee);
+	std::vector<ADDRESS> deleted;			// Addresses not to be decoded again (see Prog::remProc)
+	for (PROGMAP::iterator it = prog->m_procLabels.begin(); it != prog->m_procLabels.end(); it++)
+		if (it->second == (Proc*)-1)
+			deleted.push_back(it->first);
+	word(deleted.size());
+	for (unsigned i = 0; i < deleted.size(); i++)
+		addr(deleted[i]);
+
+	header[6] = offset;
+	header[7] = buf.size();
+	flush();
+	if (ok && (fseek(out, 0, SEEK_SET) != 0 || fwrite(header, sizeof(header), 1, out) != 1))
+		ok = false;
+	ok = fclose(out) == 0 && ok;
+	out = NULL;
+	return ok;
+}
+
+/*==============================================================================
+ * FUNCTION:		Checkpoint::save
+ * OVERVIEW:		Save prog to the checkpoint fname. It is written to a temporary file, which is renamed when
+ *					  complete
+ * PARAMETERS:		prog: the program (if it was itself loaded from a checkpoint, its procs are all read first)
+ *					fname: the file to write
+ * RETURNS:			True if saved
+ *============================================================================*/
+bool Checkpoint::save(Prog* prog, const char* fname) {
+	if (prog->checkpoint)
+		prog->checkpoint->loadAll();
+	MutexLock ml(prog->getLock());
+	std::string tmp = std::string(fname) + ".tmp";
+	Checkpoint ck;
+	bool ok = ck.write(prog, tmp.c_str());
+#ifdef _WIN32
+	if (ok) remove(fname);				// rename() does not replace an existing file
+#endif
+	if (ok && rename(tmp.c_str(), fname) == 0)
+		return true;
+	remove(tmp.c_str());
+	std::cerr << "can't save the checkpoint " << fname << (ck.ok ? "\n" : " (unsupported expression or type)\n");
+	return false;
+}
+
+/*
+ * Reading
+ */
+
+unsigned Checkpoint::readWord() {
+	unsigned w = 0;
+	readBytes(&w, sizeof(w));
+	return w;
+}
+
+void Checkpoint::readBytes(void* dest, unsigned n) {
+	if (!ok || (size_t)(end - p) < n) {
+		ok = false;
+		memset(dest, 0, n);
+		return;
+	}
+	memcpy(dest, p, n);
+	p += n;
+}
+
+std::string Checkpoint::readStr() {
+	unsigned n = readWord();
+	if (!ok || (size_t)(end - p) < n) {
+		ok = false;
+		return "";
+	}
+	std::string s(p, n);
+	p += n;
+	return s;
+}
+
+unsigned Checkpoint::readCount() {
+	unsigned n = readWord();
+	if ((size_t)(end - p) < n) {		// Every element takes at least a byte; don't allocate for a corrupt count
+		ok = false;
+		return 0;
+	}
+	return n;
+}
+
+// Read the record at offset into rec, ready to be parsed. The numbering of types, statements and BBs starts again
+bool Checkpoint::readRecord(unsigned offset, unsigned size) {
+	rec.resize(size);
+	if (size && (fseek(in, offset, SEEK_SET) != 0 || fread(&rec[0], 1, size, in) != size))
+		return false;
+	p = size ? &rec[0] : NULL;
+	end = p + size;
+	types.clear();
+	stmts.clear();
+	stmtFixups.clear();
+	bbs.clear();
+	ok = true;
+	return true;
+}
+
+Proc* Checkpoint::readProcRef() {
+	unsigned id = readWord();
+	return id && id <= procs.size() ? procs[id-1] : NULL;
+}
+
+Statement* Checkpoint::stmtAt(unsigned id) {
+	return id && id <= stmts.size() ? stmts[id-1] : NULL;
+}
+
+void Checkpoint::resolveStmt(Statement*& s, unsigned id) {
+	s = stmtAt(id);
+	if (s == NULL && id)
+		stmtFixups.push_back(std::pair<Statement**, unsigned>(&s, id));
+}
+
+PBB Checkpoint::bbAt(unsigned id) {
+	return id && id <= bbs.size() ? bbs[id-1] : NULL;
+}
+
+Type* Checkpoint::readType() {
+	unsigned id = readWord();
+	if (id == 0 || !ok)
+		return NULL;
+	if (id <= types.size())
+		return types[id-1];
+	if (id != types.size() + 1) {
+		ok = false;
+		return NULL;
+	}
+	Type* ty;
+	switch (readWord()) {
+		case eVoid:		types.push_back(ty = new VoidType); break;
+		case eBoolean:	types.push_back(ty = new BooleanType); break;
+		case eChar:		types.push_back(ty = new CharType); break;
+		case eFunc: {
+			FuncType* f = new FuncType(NULL);
+			types.push_back(ty = f);
+			f->setSignature(readSignature());
+			break;
+		}
+		case eInteger: {
+			int size = readWord();
+			types.push_back(ty = new IntegerType(size, readWord()));
+			break;
+		}
+		case eFloat:	types.push_back(ty = new FloatType(readWord())); break;
+		case eSize:		types.push_back(ty = new SizeType(readWord())); break;
+		case ePointer: {
+			PointerType* pt = new PointerType(NULL);
+			types.push_back(ty = pt);
+			pt->setPointsTo(readType());
+			break;
+		}
+		case eArray: {
+			unsigned length = readWord();
+			ArrayType* a = new ArrayType(NULL, length);
+			types.push_back(ty = a);
+			a->fixBaseType(readType());
+			break;
+		}
+		case eNamed:	types.push_back(ty = new NamedType(readStr().c_str())); break;
+		case eCompound: {
+			CompoundType* c = new CompoundType(readWord() != 0);
+			types.push_back(ty = c);
+			c->nextGenericMemberNum = readWord();
+			unsigned n = readCount();
+			for (unsigned i = 0; i < n && ok; i++) {
+				c->names.push_back(readStr());
+				c->types.push_back(readType());
+			}
+			break;
+		}
+		case eUnion: {
+			UnionType* u = new UnionType;
+			types.push_back(ty = u);
+			unsigned n = readCount();
+			for (unsigned i = 0; i < n && ok; i++) {
+				UnionElement ue;
+				ue.name = readStr();
+				ue.type = readType();
+				u->li.push_back(ue);
+			}
+			break;
+		}
+		case eUpper: {
+			UpperType* up = new UpperType(NULL);
+			types.push_back(ty = up);
+			up->setBaseType(readType());
+			break;
+		}
+		case eLower: {
+			LowerType* lo = new LowerType(NULL);
+			types.push_back(ty = lo);
+			lo->setBaseType(readType());
+			break;
+		}
+		default:
+			ok = false;
+			return NULL;
+	}
+	return ty;
+}
+
+Exp* Checkpoint::readExp() {
+	unsigned tag = readWord();
+	if (!ok) return NULL;
+	OPER op;
+	switch (tag) {
+		case TAG_NULL:
+			return NULL;
+		case TAG_TYPEVAL:
+			return new TypeVal(readType());
+		case TAG_TERMINAL:
+			return new Terminal((OPER)readWord());
+		case TAG_CONST: {
+			Const* c;
+			op = (OPER)readWord();
+			switch (op) {
+				case opIntConst:	c = new Const(readAddr()); break;
+				case opLongConst:	{ QWord ll; readBytes(&ll, sizeof(ll)); c = new Const(ll); break; }
+				case opFltConst:	{ double d; readBytes(&d, sizeof(d)); c = new Const(d); break; }
+				case opStrConst:	c = new Const(readWord() ? strdup(readStr().c_str()) : (char*)NULL); break;
+				case opFuncConst:	c = new Const(readProcRef()); break;
+				default:			ok = false; return NULL;
+			}
+			c->conscript = readWord();
+			c->type = readType();
+			return c;
+		}
+		case TAG_LOCATION: {
+			op = (OPER)readWord();
+			UserProc* proc = (UserProc*)readProcRef();
+			Location* l = new Location(op);			// Not the usual constructor, which guesses the proc
+			l->subExp1 = readExp();
+			l->proc = proc;
+			return l;
+		}
+		case TAG_REFEXP: {
+			unsigned def = readWord();
+			RefExp* r = new RefExp(readExp(), NULL);
+			resolveStmt(r->def, def);
+			return r;
+		}
+		case TAG_FLAGDEF: {
+			Exp* params = readExp();
+			return new FlagDef(params, readRTL());
+		}
+		case TAG_TYPEDEXP: {
+			Type* ty = readType();
+			return new TypedExp(ty, readExp());
+		}
+		case TAG_TERNARY: {
+			op = (OPER)readWord();
+			Exp* e1 = readExp();
+			Exp* e2 = readExp();
+			return new Ternary(op, e1, e2, readExp());
+		}
+		case TAG_BINARY: {
+			op = (OPER)readWord();
+			Exp* e1 = readExp();
+			return new Binary(op, e1, readExp());
+		}
+		case TAG_UNARY:
+			op = (OPER)readWord();
+			return new Unary(op, readExp());
+	}
+	ok = false;
+	return NULL;
+}
+
+Statement* Checkpoint::readStmt() {
+	unsigned id = readWord();
+	if (id == 0 || !ok)
+		return NULL;
+	unsigned kind = readWord();
+	if (kind == 0) {
+		Statement* s = stmtAt(id);
+		if (s == NULL) ok = false;			// Always written in full the first time
+		return s;
+	}
+	int number = readWord();
+	PBB pbb = bbAt(readWord());
+	UserProc* proc = (UserProc*)readProcRef();
+	unsigned parent = readWord();
+	Statement* s;
+	switch (kind - 1) {
+		case STMT_ASSIGN: {
+			Type* ty = readType();
+			Exp* lhs = readExp();
+			Exp* rhs = readExp();
+			s = new Assign(ty, lhs, rhs, readExp());
+			break;
+		}
+		case STMT_PHIASSIGN: {
+			Type* ty = readType();
+			PhiAssign* pa = new PhiAssign(ty, readExp());
+			unsigned n = readCount();
+			pa->defVec.resize(n);
+			for (unsigned i = 0; i < n && ok; i++) {
+				unsigned def = readWord();
+				pa->defVec[i].e = readExp();
+				resolveStmt(pa->defVec[i].def, def);
+			}
+			s = pa;
+			break;
+		}
+		case STMT_IMPASSIGN: {
+			Type* ty = readType();
+			s = new ImplicitAssign(ty, readExp());
+			break;
+		}
+		case STMT_BOOLASSIGN: {
+			Type* ty = readType();
+			Exp* lhs = readExp();
+			BoolAssign* b = new BoolAssign(0);
+			b->type = ty;
+			b->lhs = lhs;
+			b->jtCond = (BRANCH_TYPE)readWord();
+			b->pCond = readExp();
+			b->bFloat = readWord() != 0;
+			b->size = readWord();
+			s = b;
+			break;
+		}
+		case STMT_GOTO: case STMT_BRANCH: case STMT_CASE: case STMT_CALL: {
+			GotoStatement* g;
+			switch (kind - 1) {
+				case STMT_GOTO:		g = new GotoStatement; break;
+				case STMT_BRANCH:	g = new BranchStatement; break;
+				case STMT_CASE:		g = new CaseStatement; break;
+				default:			g = new CallStatement; break;
+			}
+			g->pDest = readExp();
+			g->m_isComputed = readWord() != 0;
+			if (kind - 1 == STMT_BRANCH) {
+				BranchStatement* br = (BranchStatement*)g;
+				br->jtCond = (BRANCH_TYPE)readWord();
+				br->pCond = readExp();
+				br->bFloat = readWord() != 0;
+				br->size = readWord();
+			} else if (kind - 1 == STMT_CASE && readWord()) {
+				SWITCH_INFO* si = new SWITCH_INFO;
+				si->pSwitchVar = readExp();
+				si->chForm = (char)readWord();
+				si->iLower = readWord();
+				si->iUpper = readWord();
+				si->iNumTable = readWord();
+				si->iOffset = readWord();
+				if (si->chForm == 'F') {
+					unsigned n = si->iNumTable > 0 ? si->iNumTable : 0;
+					if (n > (size_t)(end - p)) {
+						ok = false;
+						n = 0;
+					}
+					int* table = new int[n];
+					for (unsigned i = 0; i < n; i++)
+						table[i] = readWord();
+					si->uTable = (ADDRESS)table;
+				} else
+					si->uTable = readAddr();
+				((CaseStatement*)g)->setSwitchInfo(si);
+			} else if (kind - 1 == STMT_CALL) {
+				CallStatement* c = (CallStatement*)g;
+				c->returnAfterCall = readWord() != 0;
+				readStmtList(c->arguments);
+				readStmtList(c->defines);
+				c->procDest = readProcRef();
+				c->signature = readSignature();
+				if (c->procDest)
+					c->procDest->callerSet.insert(c);
+				switch (readWord()) {
+					case 1: {
+						UserProc* dest = (UserProc*)c->procDest;
+						if (dest == NULL)
+							ok = false;
+						else if (dest->theReturnStatement)
+							c->calleeReturn = dest->theReturnStatement;
+						else							// Not read yet (or being read now)
+							pendingReturns[dest].push_back(c);
+						break;
+					}
+					case 2:
+						c->calleeReturn = (ReturnStatement*)readStmt();
+						break;
+				}
+			}
+			s = g;
+			break;
+		}
+		case STMT_RET: {
+			ReturnStatement* r = new ReturnStatement;
+			r->retAddr = readAddr();
+			readStmtList(r->modifieds);
+			readStmtList(r->returns);
+			s = r;
+			break;
+		}
+		case STMT_IMPREF: {
+			Type* ty = readType();
+			s = new ImpRefStatement(ty, readExp());
+			break;
+		}
+		case STMT_JUNCTION:
+			s = new JunctionStatement;
+			break;
+		default:
+			ok = false;
+			return NULL;
+	}
+	s->number = number;
+	s->pbb = pbb;
+	s->proc = proc;
+	resolveStmt(s->parent, parent);
+	if (id > stmts.size())
+		stmts.resize(id, NULL);
+	stmts[id-1] = s;
+	return s;
+}
+
+void Checkpoint::readStmtList(StatementList& sl) {
+	unsigned n = readCount();
+	for (unsigned i = 0; i < n && ok; i++)
+		sl.append(readStmt());
+}
+
+RTL* Checkpoint::readRTL() {
+	if (readWord() == 0)
+		return NULL;
+	RTL* r = new RTL(readAddr());
+	unsigned n = readCount();
+	for (unsigned i = 0; i < n && ok; i++)
+		r->getList().push_back(readStmt());		// Not appendStmt(), which would reorder flag assignments
+	return r;
+}
+
+Signature* Checkpoint::readSignature() {
+	unsigned kind = readWord();
+	if (kind == 0 || !ok)
+		return NULL;
+	platform plat = (platform)readWord();
+	callconv cc = (callconv)readWord();
+	int sp = kind == 2 ? readWord() : 0;
+	std::string name = readStr();
+	Signature* sig;
+	if (kind == 2) {
+		CustomSignature* cs = new CustomSignature(name.c_str());
+		cs->sp = sp;
+		sig = cs;
+	} else if (plat == PLAT_PENTIUM || plat == PLAT_SPARC || plat == PLAT_PPC || plat == PLAT_ST20)
+		sig = Signature::instantiate(plat, cc, name.c_str());
+	else
+		sig = new Signature(name.c_str());
+	// The constructors may add parameters and returns of their own
+	sig->params.clear();
+	sig->returns.clear();
+	sig->sigFile = readStr();
+	unsigned n = readCount();
+	for (unsigned i = 0; i < n && ok; i++) {
+		std::string nam = readStr();
+		Type* ty = readType();
+		Exp* e = readExp();
+		std::string boundMax = readStr();
+		sig->params.push_back(new Parameter(ty, nam.c_str(), e, boundMax.c_str()));
+	}
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++) {
+		Type* ty = readType();
+		sig->returns.push_back(new Return(ty, readExp()));
+	}
+	sig->rettype = readType();
+	sig->ellipsis = readWord() != 0;
+	sig->unknown = readWord() != 0;
+	sig->forced = readWord() != 0;
+	sig->preferedReturn = readType();
+	sig->preferedName = readStr();
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++)
+		sig->preferedParams.push_back(readWord());
+	return sig;
+}
+
+Cluster* Checkpoint::readCluster() {
+	unsigned kind = readWord();
+	std::string name = readStr();
+	Cluster* c;
+	switch (kind) {
+		case CLUSTER_CLASS:		c = new Class(name.c_str()); break;
+		case CLUSTER_MODULE:	c = new Module(name.c_str()); break;
+		default:				c = new Cluster(name.c_str()); break;
+	}
+	clusters.push_back(c);
+	unsigned n = readCount();
+	for (unsigned i = 0; i < n && ok; i++)
+		c->addChild(readCluster());
+	return c;
+}
+
+void Checkpoint::readBB(PBB bb) {
+	bb->m_nodeType = (BBTYPE)readWord();
+	bb->m_iLabelNum = readWord();
+	bb->m_labelStr = readStr();
+	bb->m_labelneeded = readWord() != 0;
+	bb->m_bIncomplete = readWord() != 0;
+	bb->m_bJumpReqd = readWord() != 0;
+	bb->m_iTraversed = readWord() != 0;
+	bb->m_DFTfirst = readWord(); bb->m_DFTlast = readWord();
+	bb->m_DFTrevfirst = readWord(); bb->m_DFTrevlast = readWord();
+	bb->m_structType = (SBBTYPE)readWord();
+	bb->m_loopCondType = (SBBTYPE)readWord();
+	bb->m_loopHead = bbAt(readWord()); bb->m_caseHead = bbAt(readWord()); bb->m_condFollow = bbAt(readWord());
+	bb->m_loopFollow = bbAt(readWord()); bb->m_latchNode = bbAt(readWord());
+	bb->ord = readWord(); bb->revOrd = readWord();
+	bb->inEdgesVisited = readWord(); bb->numForwardInEdges = readWord();
+	bb->loopStamps[0] = readWord(); bb->loopStamps[1] = readWord();
+	bb->revLoopStamps[0] = readWord(); bb->revLoopStamps[1] = readWord();
+	bb->traversed = (travType)readWord();
+	bb->hllLabel = readWord() != 0;
+	bb->labelStr = readWord() ? strdup(readStr().c_str()) : NULL;
+	bb->indentLevel = readWord();
+	bb->immPDom = bbAt(readWord()); bb->loopHead = bbAt(readWord()); bb->caseHead = bbAt(readWord());
+	bb->condFollow = bbAt(readWord()); bb->loopFollow = bbAt(readWord()); bb->latchNode = bbAt(readWord());
+	bb->sType = (structType)readWord(); bb->usType = (unstructType)readWord();
+	bb->lType = (loopType)readWord(); bb->cType = (condType)readWord();
+	bb->overlappedRegProcessingDone = readWord() != 0;
+
+	unsigned n = readCount();
+	for (unsigned i = 0; i < n && ok; i++)
+		bb->m_InEdges.push_back(bbAt(readWord()));
+	bb->m_iNumInEdges = bb->m_InEdges.size();
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++)
+		bb->m_OutEdges.push_back(bbAt(readWord()));
+	bb->m_iNumOutEdges = bb->m_OutEdges.size();
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++)
+		bb->liveIn.insert(readExp());
+	if (readWord()) {
+		bb->m_pRtls = new std::list<RTL*>;
+		n = readCount();
+		for (unsigned i = 0; i < n && ok; i++)
+			bb->m_pRtls->push_back(readRTL());
+	}
+}
+
+void Checkpoint::readCfg(UserProc* proc) {
+	Cfg* cfg = new Cfg;
+	cfg->setProc(proc);
+	proc->cfg = cfg;
+	unsigned n = readCount();
+	for (unsigned i = 0; i < n; i++) {
+		bbs.push_back(new BasicBlock);
+		cfg->m_listBB.push_back(bbs.back());
+	}
+	for (unsigned i = 0; i < n && ok; i++)
+		readBB(bbs[i]);
+	cfg->entryBB = bbAt(readWord());
+	cfg->exitBB = bbAt(readWord());
+	cfg->m_bWellFormed = readWord() != 0;
+	cfg->structured = readWord() != 0;
+	cfg->lastLabel = readWord();
+	cfg->bImplicitsDone = readWord() != 0;
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++)
+		cfg->Ordering.push_back(bbAt(readWord()));
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++)
+		cfg->revOrdering.push_back(bbAt(readWord()));
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++) {
+		ADDRESS a = readAddr();
+		cfg->m_mapBB[a] = bbAt(readWord());
+	}
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++)
+		cfg->callSites.insert((CallStatement*)readStmt());
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++) {
+		Exp* e = readExp();
+		cfg->implicitMap[e] = readStmt();
+	}
+}
+
+void Checkpoint::readBody(UserProc* proc) {
+	if (readWord())
+		readCfg(proc);
+	unsigned n = readCount();
+	for (unsigned i = 0; i < n && ok; i++) {
+		std::string name = readStr();
+		proc->locals[name] = readType();
+	}
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++) {
+		Exp* from = readExp();
+		proc->symbolMap.insert(std::pair<Exp*, Exp*>(from, readExp()));
+	}
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++)
+		proc->calleeList.push_back(readProcRef());
+	readStmtList(proc->parameters);
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++)
+		proc->addressEscapedVars.insert(readExp());
+	proc->nextLocal = readWord();
+	proc->nextParam = readWord();
+	proc->stmtNumber = readWord();
+	proc->theReturnStatement = (ReturnStatement*)readStmt();
+
+	// References to statements that were read after the reference
+	for (std::list<std::pair<Statement**, unsigned> >::iterator ff = stmtFixups.begin(); ff != stmtFixups.end(); ff++)
+		*ff->first = stmtAt(ff->second);
+	stmtFixups.clear();
+	// Calls (in procs read already, or in this one) whose callee return is this proc's return statement
+	std::map<UserProc*, std::list<CallStatement*> >::iterator pr = pendingReturns.find(proc);
+	if (pr != pendingReturns.end()) {
+		for (std::list<CallStatement*>::iterator cc = pr->second.begin(); cc != pr->second.end(); cc++)
+			(*cc)->calleeReturn = proc->theReturnStatement;
+		pendingReturns.erase(pr);
+	}
+}
+
+/*==============================================================================
+ * FUNCTION:		Checkpoint::read
+ * OVERVIEW:		Read the header and the directory of the checkpoint fname, and make the program: its front end (from
+ *					  the binary, which must still be there), clusters, globals, and procs without their bodies
+ * RETURNS:			The program, or NULL (after saying why) if it can't be loaded
+ *============================================================================*/
+Prog* Checkpoint::read(const char* fname) {
+	path = fname;
+	in = fopen(fname, "rb");
+	if (in == NULL) {
+		std::cerr << "can't open `" << fname << "'\n";
+		return NULL;
+	}
+	unsigned header[CKPT_HEADER];
+	if (fread(header, sizeof(header), 1, in) != 1 || header[0] != CKPT_MAGIC) {
+		std::cerr << "`" << fname << "' is not a checkpoint\n";
+		return NULL;
+	}
+	if (header[1] != CKPT_VERSION || header[2] != opNumOf || header[3] != sizeof(ADDRESS)) {
+		std::cerr << "checkpoint `" << fname << "' was saved by a different version of boomerang\n";
+		return NULL;
+	}
+	if (!readRecord(header[6], header[7])) {
+		std::cerr << "checkpoint `" << fname << "' is truncated\n";
+		return NULL;
+	}
+
+	std::string name = readStr();
+	std::string dir = readStr();
+	std::string binary = dir + name;
+	unsigned mtime, size;
+	if (fileStamp(binary.c_str(), mtime, size) && (mtime != header[4] || size != header[5]))
+		std::cerr << "warning: " << binary << " has changed since the checkpoint was saved\n";
+	prog = new Prog();
+	FrontEnd* fe = FrontEnd::Load(binary.c_str(), prog);
+	if (fe == NULL) {
+		std::cerr << "can't load " << binary << ", which checkpoint `" << fname << "' was saved from\n";
+		return NULL;
+	}
+	prog->setFrontEnd(fe);
+	fe->readLibraryCatalog();
+	prog->m_name = name;
+	prog->m_path = dir;
+	prog->m_iNumberedProc = readWord();
+	prog->m_rootCluster = readCluster();
+
+	unsigned n = readCount();
+	for (unsigned i = 0; i < n && ok; i++) {
+		std::string nam = readStr();
+		ADDRESS a = readAddr();
+		prog->addGlobal(new Global(readType(), a, nam.c_str()));
+	}
+
+	// Make all the procs first, as they refer to each other
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++) {
+		Proc* proc;
+		if (readWord())
+			proc = new LibProc();
+		else
+			proc = new UserProc();
+		proc->setProg(prog);
+		procs.push_back(proc);
+	}
+	for (unsigned i = 0; i < procs.size() && ok; i++) {
+		Proc* proc = procs[i];
+		proc->address = readAddr();
+		proc->signature = readSignature();
+		unsigned c = readWord();
+		proc->cluster = c && c <= clusters.size() ? clusters[c-1] : NULL;
+		proc->m_firstCaller = readProcRef();
+		proc->m_firstCallerAddr = readAddr();
+		unsigned np = readCount();
+		for (unsigned j = 0; j < np && ok; j++) {
+			Exp* left = readExp();
+			proc->provenTrue[left] = readExp();
+		}
+		np = readCount();
+		for (unsigned j = 0; j < np && ok; j++) {
+			UserProc* caller = (UserProc*)readProcRef();
+			if (caller) callers[proc].push_back(caller);
+		}
+		prog->m_procs.push_back(proc);
+		prog->m_procLabels[proc->address] = proc;
+		if (proc->isLib()) continue;
+		UserProc* u = (UserProc*)proc;
+		u->status = (ProcStatus)readWord();
+		Body& body = bodies[u];
+		body.offset = readWord();
+		body.size = readWord();
+		np = readCount();
+		for (unsigned j = 0; j < np && ok; j++) {
+			ADDRESS lo = readAddr();
+			body.ranges.push_back(std::pair<ADDRESS, ADDRESS>(lo, readAddr()));
+		}
+		u->inCheckpoint = true;
+	}
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++) {
+		Proc* proc = readProcRef();
+		if (proc && !proc->isLib())
+			prog->entryProcs.push_back((UserProc*)proc);
+	}
+	n = readCount();
+	for (unsigned i = 0; i < n && ok; i++)
+		prog->m_procLabels[readAddr()] = (Proc*)-1;
+	if (!ok) {
+		std::cerr << "checkpoint `" << fname << "' is corrupt\n";
+		return NULL;
+	}
+	stmtFixups.clear();							// Nothing to refer to outside a body
+
+	prog->checkpoint = this;
+	prog->indexProcs();
+	for (unsigned i = 0; i < procs.size(); i++)
+		Boomerang::get()->alert_load(procs[i]);
+	if (bodies.empty()) {
+		fclose(in);
+		in = NULL;
+	}
+	return prog;
+}
+
+/*==============================================================================
+ * FUNCTION:		Checkpoint::load
+ * OVERVIEW:		Load a program from the checkpoint fname. The bodies of the procs are read when first needed
+ * RETURNS:			The program, or NULL
+ *============================================================================*/
+Prog* Checkpoint::load(const char* fname) {
+	Checkpoint* ck = new Checkpoint;
+	Prog* prog = ck->read(fname);
+	if (prog == NULL) {
+		if (ck->prog) {
+			ck->prog->checkpoint = NULL;
+			delete ck->prog;
+		}
+		delete ck;
+	}
+	return prog;
+}
+
+bool Checkpoint::isCheckpoint(const char* fname) {
+	FILE* f = fopen(fname, "rb");
+	if (f == NULL)
+		return false;
+	unsigned magic = 0;
+	bool is = fread(&magic, sizeof(magic), 1, f) == 1 && magic == CKPT_MAGIC;
+	fclose(f);
+	return is;
+}
+
+/*==============================================================================
+ * FUNCTION:		Checkpoint::saveTypes
+ * OVERVIEW:		Save a map of types, as one record (so that shared types stay shared), without the file
+ * PARAMETERS:		types: the types, by name
+ *					data: gets the record
+ * RETURNS:			False if one of the types can't be saved
+ *============================================================================*/
+bool Checkpoint::saveTypes(std::map<std::string, Type*>& types, std::string& data) {
+	Checkpoint ck;
+	ck.word(types.size());
+	for (std::map<std::string, Type*>::iterator it = types.begin(); it != types.end(); it++) {
+		ck.str(it->first);
+		ck.writeType(it->second);
+	}
+	if (!ck.ok)
+		return false;
+	data.assign(ck.buf.begin(), ck.buf.end());
+	return true;
+}
+
+/*==============================================================================
+ * FUNCTION:		Checkpoint::loadTypes
+ * OVERVIEW:		Load the types saved by saveTypes
+ * PARAMETERS:		data, size: the record
+ *					types: gets the types, by name
+ * RETURNS:			False if the record is not valid
+ *============================================================================*/
+bool Checkpoint::loadTypes(const char* data, size_t size, std::map<std::string, Type*>& types) {
+	Checkpoint ck;
+	ck.p = data;
+	ck.end = data + size;
+	std::map<std::string, Type*> loaded;
+	unsigned n = ck.readCount();
+	for (unsigned i = 0; i < n && ck.ok; i++) {
+		std::string name = ck.readStr();
+		loaded[name] = ck.readType();
+	}
+	if (!ck.ok || ck.p != ck.end)
+		return false;
+	types.swap(loaded);
+	return true;
+}
+
+/*==============================================================================
+ * FUNCTION:		Checkpoint::loadProc
+ * OVERVIEW:		Read the body of proc, if it has not been read yet. A checkpoint that can't be read now is fatal,
+ *					  as the proc is already part of the program
+ *============================================================================*/
+void Checkpoint::loadProc(UserProc* proc) {
+	MutexLock ml(mutex);
+	std::map<UserProc*, Body>::iterator bb = bodies.find(proc);
+	if (bb == bodies.end())
+		return;
+	Body body = bb->second;
+	bodies.erase(bb);
+	proc->inCheckpoint = false;
+	if (VERBOSE)
+		LOG << "reading " << proc->getName() << " from the checkpoint\n";
+	if (!readRecord(body.offset, body.size)) {
+		std::cerr << "can't read " << proc->getName() << " from checkpoint `" << path << "'\n";
+		exit(1);
+	}
+	readBody(proc);
+	if (!ok || p != end) {
+		std::cerr << "the body of " << proc->getName() << " in checkpoint `" << path << "' is corrupt\n";
+		exit(1);
+	}
+	prog->updateProcRanges(proc);
+	if (bodies.empty()) {
+		fclose(in);
+		in = NULL;
+		std::vector<char>().swap(rec);
+	}
+}
+
+void Checkpoint::loadCallers(Proc* proc) {
+	MutexLock ml(mutex);
+	std::map<Proc*, std::vector<UserProc*> >::iterator cc = callers.find(proc);
+	if (cc == callers.end())
+		return;
+	std::vector<UserProc*> from = cc->second;
+	callers.erase(cc);
+	for (unsigned i = 0; i < from.size(); i++)
+		loadProc(from[i]);
+}
+
+void Checkpoint::loadAll() {
+	MutexLock ml(mutex);
+	while (!bodies.empty())
+		loadProc(bodies.begin()->first);
+	callers.clear();
+}
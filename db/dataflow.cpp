@@ -15,19 +15,33 @@
 /*
  * $Revision: 1.66 $	// 1.43.2.24
  * 15 Mar 05 - Mike: Separated from cfg.cpp
+ * 17 Oct 26 - dominators() may be called again after the CFG changes; the phi functions already placed are kept
+ * 17 Oct 26 - Phases for -M and -gt
+ * 17 Oct 26 - Dominators on flat arrays, without recursion; dominance frontiers as per Cooper, Harvey and Kennedy;
+ *				the last DFS vertex gets its deferred dominator too; updateDominators
+ * 17 Oct 26 - Pruned SSA (-pp): phi functions are only placed where the location is live
+ * 17 Oct 26 - Renaming walks the dominator tree without recursion, with the definitions of each location (by ID) in a
+ *				vector; DefCollector::updateDefs only creates the definitions that it doesn't have yet
+ * 17 Oct 26 - renameBlock tells the proc about the statements that it subscripts (for the def-use chains)
+ * 17 Oct 26 - LOG statements are in the LCAT_DATAFLOW log category
  */
 
+#define LOG_CATEGORY LCAT_DATAFLOW		// The category of this file's LOG statements (see boomerang.h)
+
 #include <sstream>
 #include <cstring>
+#include <algorithm>
 
 #include "dataflow.h"
 #include "cfg.h"
 #include "proc.h"
 #include "exp.h"
 #include "boomerang.h"
+#include "threads.h"
 #include "visitor.h"
 #include "log.h"
 #include "frontend.h"
+#include "phase.h"
 
 extern char debug_buffer[];		 // For prints functions
 
@@ -36,39 +50,15 @@ extern char debug_buffer[];		 // For prints functions
  * Dominator frontier code largely as per Appel 2002 ("Modern Compiler Implementation in Java")
  */
 
-void DataFlow::DFS(int p, int n) {
-	if (dfnum[n] == 0) {
-		dfnum[n] = N; vertex[N] = n; parent[n] = p;
-		N++;
-		// For each successor w of n
-		PBB bb = BBs[n];
-		std::vector<PBB>& outEdges = bb->getOutEdges();
-		std::vector<PBB>::iterator oo;
-		for (oo = outEdges.begin(); oo != outEdges.end(); oo++) {
-			DFS(n, indices[*oo]);
-		}
-	}
-}
-
-// Essentially Algorithm 19.9 of Appel's "modern compiler implementation in Java" 2nd ed 2002
-void DataFlow::dominators(Cfg* cfg) {
+// Number the BBs (the entry BB is 0, the rest in the order of the CFG), and set the compressed rows of the CFG. The
+// predecessors are from the out edges, so that they agree with the successors
+void DataFlow::numberBBs(Cfg* cfg) {
 	PBB r = cfg->getEntryBB();
 	unsigned numBB = cfg->getNumBBs();
-	BBs.resize(numBB, (PBB)-1);
-	N = 0; BBs[0] = r;
+	BBs.assign(numBB, (PBB)-1);
+	BBs[0] = r;
 	indices.clear();			// In case restart decompilation due to switch statements
 	indices[r] = 0;
-	// Initialise to "none"
-	dfnum.resize(numBB, 0);
-	semi.resize(numBB, -1);
-	ancestor.resize(numBB, -1);
-	idom.resize(numBB, -1);
-	samedom.resize(numBB, -1);
-	vertex.resize(numBB, -1);
-	parent.resize(numBB, -1);
-	best.resize(numBB, -1);
-	bucket.resize(numBB);
-	DF.resize(numBB);
 	// Set up the BBs and indices vectors. Do this here because sometimes a BB can be unreachable (so relying on
 	// in-edges doesn't work)
 	std::list<PBB>::iterator ii;
@@ -80,21 +70,104 @@ void DataFlow::dominators(Cfg* cfg) {
 			BBs[idx++] = bb;
 		}
 	}
+	succStart.assign(numBB + 1, 0);
+	succs.clear();
+	predStart.assign(numBB + 1, 0);
+	unsigned n;
+	for (n = 0; n < numBB; n++) {
+		succStart[n] = succs.size();
+		std::vector<PBB>& outEdges = BBs[n]->getOutEdges();
+		std::vector<PBB>::iterator oo;
+		for (oo = outEdges.begin(); oo != outEdges.end(); oo++) {
+			std::map<PBB, int>::iterator ii = indices.find(*oo);
+			if (ii == indices.end()) {
+				std::cerr << "BB not in indices: "; (*oo)->print(std::cerr);
+				assert(false);
+			}
+			succs.push_back(ii->second);
+			predStart[ii->second + 1]++;
+		}
+	}
+	succStart[numBB] = succs.size();
+	for (n = 0; n < numBB; n++)
+		predStart[n + 1] += predStart[n];
+	preds.resize(succs.size());
+	std::vector<int> fill(predStart.begin(), predStart.end() - 1);
+	for (n = 0; n < numBB; n++)
+		for (int i = succStart[n]; i < succStart[n + 1]; i++)
+			preds[fill[succs[i]]++] = n;
+}
+
+// The phi functions already placed are in the same BBs, which may now have different indices. BBs no longer in the
+// CFG are dropped (they are never deleted, so their pointers are not reused)
+void DataFlow::renumberA_phi(std::vector<PBB>& oldBBs) {
+	std::map<Exp*, std::set<int>, lessExpStar>::iterator pp;
+	for (pp = A_phi.begin(); pp != A_phi.end(); ++pp) {
+		std::set<int> renumbered;
+		std::set<int>::iterator nn;
+		for (nn = pp->second.begin(); nn != pp->second.end(); ++nn) {
+			std::map<PBB, int>::iterator ii = indices.find(oldBBs[*nn]);
+			if (ii != indices.end())
+				renumbered.insert(ii->second);
+		}
+		pp->second = renumbered;
+	}
+}
+
+// Depth first search from n (whose parent in the spanning tree is p), without recursion: the successors of each node
+// are visited in order, as Appel's recursive version does
+void DataFlow::DFS(int p, int n) {
+	if (dfnum[n] != -1)
+		return;
+	std::vector<std::pair<int, int> > stack;		// Node, and the index in succs of its next successor
+	dfnum[n] = N; vertex[N] = n; parent[n] = p;
+	N++;
+	stack.push_back(std::pair<int, int>(n, succStart[n]));
+	while (stack.size()) {
+		int v = stack.back().first;
+		int& i = stack.back().second;
+		if (i == succStart[v + 1]) {
+			stack.pop_back();
+			continue;
+		}
+		int w = succs[i++];
+		if (dfnum[w] == -1) {
+			dfnum[w] = N; vertex[N] = w; parent[w] = v;
+			N++;
+			stack.push_back(std::pair<int, int>(w, succStart[w]));
+		}
+	}
+}
+
+// Essentially Algorithm 19.9 of Appel's "modern compiler implementation in Java" 2nd ed 2002
+void DataFlow::dominators(Cfg* cfg) {
+	Phase ph("dominators", cfg->getProc());
+	std::vector<PBB> oldBBs(BBs);		// To renumber A_phi, if the CFG has changed (e.g. code added by switch analysis)
+	numberBBs(cfg);
+	renumberA_phi(oldBBs);
+	unsigned numBB = BBs.size();
+	N = 0;
+	// Initialise to "none". Assign, not resize: this may not be the first time
+	dfnum.assign(numBB, -1);
+	semi.assign(numBB, -1);
+	ancestor.assign(numBB, -1);
+	idom.assign(numBB, -1);
+	samedom.assign(numBB, -1);
+	vertex.assign(numBB, -1);
+	parent.assign(numBB, -1);
+	best.assign(numBB, -1);
+	bucketHead.assign(numBB, -1);
+	bucketNext.assign(numBB, -1);
 	DFS(-1, 0);
 	int i;
 	for (i=N-1; i >= 1; i--) {
 		int n = vertex[i]; int p = parent[n]; int s = p;
 		/* These lines calculate the semi-dominator of n, based on the Semidominator Theorem */
 		// for each predecessor v of n
-		PBB bb = BBs[n];
-		std::vector<PBB>& inEdges = bb->getInEdges();
-		std::vector<PBB>::iterator it;
-		for (it = inEdges.begin(); it != inEdges.end(); it++) {
-			if (indices.find(*it) == indices.end()) {
-				std::cerr << "BB not in indices: "; (*it)->print(std::cerr);
-				assert(false);
-			}
-			int v = indices[*it];
+		for (int j = predStart[n]; j < predStart[n + 1]; j++) {
+			int v = preds[j];
+			if (dfnum[v] == -1)
+				continue;					// Not reached: not on any path from the entry
 			int sdash;
 			if (dfnum[v] <= dfnum[n])
 				sdash = v;
@@ -104,12 +177,11 @@ void DataFlow::dominators(Cfg* cfg) {
 		}
 		semi[n] = s;
 		/* Calculation of n's dominator is deferred until the path from s to n has been linked into the forest */
-		bucket[s].insert(n);
+		bucketNext[n] = bucketHead[s];
+		bucketHead[s] = n;
 		Link(p, n);
 		// for each v in bucket[p]
-		std::set<int>::iterator jj;
-		for (jj=bucket[p].begin(); jj != bucket[p].end(); jj++) {
-			int v = *jj;
+		for (int v = bucketHead[p]; v != -1; v = bucketNext[v]) {
 			/* Now that the path from p to v has been linked into the spanning forest, these lines calculate the
 				dominator of v, based on the first clause of the Dominator Theorem, or else defer the calculation until
 				y's dominator is known. */
@@ -118,9 +190,9 @@ void DataFlow::dominators(Cfg* cfg) {
 				idom[v] = p;		 		// Success!
 			else samedom[v] = y;	 		// Defer
 		}
-		bucket[p].clear();
+		bucketHead[p] = -1;
 	}
-	for (i=1; i < N-1; i++) {
+	for (i=1; i < N; i++) {
 		/* Now all the deferred dominator calculations, based on the second clause of the Dominator Theorem, are
 			performed. */
 		int n = vertex[i];
@@ -128,18 +200,23 @@ void DataFlow::dominators(Cfg* cfg) {
 			idom[n] = idom[samedom[n]];		// Deferred success!
 		}
 	}
-	computeDF(0);							// Finally, compute the dominance frontiers
+	buildDomTree();
+	computeDF();							// Finally, compute the dominance frontiers
 }
 
 // Basically algorithm 19.10b of Appel 2002 (uses path compression for O(log N) amortised time per operation
-// (overall O(N log N))
+// (overall O(N log N)). Without recursion: the path from v is compressed from the top down
 int DataFlow::ancestorWithLowestSemi(int v) {
-	int a = ancestor[v];
-	if (ancestor[a] != -1) {
-		int b = ancestorWithLowestSemi(a);
-		ancestor[v] = ancestor[a];
-		if (dfnum[semi[b]] < dfnum[semi[best[v]]])
-			best[v] = b;
+	path.clear();
+	for (int a = v; ancestor[ancestor[a]] != -1; a = ancestor[a])
+		path.push_back(a);
+	for (int j = (int)path.size() - 1; j >= 0; j--) {
+		int u = path[j];
+		int a = ancestor[u];
+		int b = best[a];				// What the recursive call on a returns
+		ancestor[u] = ancestor[a];
+		if (dfnum[semi[b]] < dfnum[semi[best[u]]])
+			best[u] = b;
 	}
 	return best[v];
 }
@@ -148,49 +225,191 @@ void DataFlow::Link(int p, int n) {
 	ancestor[n] = p; best[n] = n;
 }
 
-// Return true if n dominates w
-bool DataFlow::doesDominate(int n, int w) {
-	while (idom[w] != -1) {
-		if (idom[w] == n)
-			return true;
-		w = idom[w];	 // Move up the dominator tree
+void DataFlow::buildDomTree() {
+	int numBB = idom.size();
+	int n;
+	domChildStart.assign(numBB + 1, 0);
+	for (n = 0; n < numBB; n++)
+		if (idom[n] != -1)
+			domChildStart[idom[n] + 1]++;
+	for (n = 0; n < numBB; n++)
+		domChildStart[n + 1] += domChildStart[n];
+	domChildren.resize(domChildStart[numBB]);
+	std::vector<int> fill(domChildStart.begin(), domChildStart.end() - 1);
+	for (n = 0; n < numBB; n++)
+		if (idom[n] != -1)
+			domChildren[fill[idom[n]]++] = n;
+	// Number the tree
+	domPre.assign(numBB, -1);
+	domPost.assign(numBB, -1);
+	depth.assign(numBB, -1);
+	int pre = 0, post = 0;
+	std::vector<std::pair<int, int> > stack;		// Node, and the index in domChildren of its next child
+	domPre[0] = pre++;
+	depth[0] = 0;
+	stack.push_back(std::pair<int, int>(0, domChildStart[0]));
+	while (stack.size()) {
+		int v = stack.back().first;
+		int& i = stack.back().second;
+		if (i == domChildStart[v + 1]) {
+			domPost[v] = post++;
+			stack.pop_back();
+			continue;
+		}
+		int c = domChildren[i++];
+		domPre[c] = pre++;
+		depth[c] = depth[v] + 1;
+		stack.push_back(std::pair<int, int>(c, domChildStart[c]));
 	}
-	return false;
 }
 
-void DataFlow::computeDF(int n) {
-	std::set<int> S;
-	/* THis loop computes DF_local[n] */
-	// for each node y in succ(n)
-	PBB bb = BBs[n];
-	std::vector<PBB>& outEdges = bb->getOutEdges();
-	std::vector<PBB>::iterator it;
-	for (it = outEdges.begin(); it != outEdges.end(); it++) {
-		int y = indices[*it];
-		if (idom[y] != n)
-			S.insert(y);
-	}
-	// for each child c of n in the dominator tree
-	// Note: this is a linear search!
-	int sz = idom.size();				// ? Was ancestor.size()
-	for (int c = 0; c < sz; ++c) {
-		if (idom[c] != n) continue;
-		computeDF(c);
-		/* This loop computes DF_up[c] */
-		// for each element w of DF[c]
-		std::set<int>& s = DF[c];
-		std::set<int>::iterator ww;
-		for (ww = s.begin(); ww != s.end(); ww++) {
-			int w = *ww;
-			// if n does not dominate w, or if n = w
-			if (n == w || !doesDominate(n, w)) {
-				S.insert(w);
-			}
+// Return true if n dominates w (strictly)
+bool DataFlow::doesDominate(int n, int w) {
+	return n != w && domPre[n] != -1 && domPre[w] != -1 && domPre[n] < domPre[w] && domPost[w] < domPost[n];
+}
+
+// Add y to the dominance frontier of n
+void DataFlow::addDF(int n, int y) {
+	std::vector<int>& df = DF[n];
+	std::vector<int>::iterator it = std::lower_bound(df.begin(), df.end(), y);
+	if (it == df.end() || *it != y)
+		df.insert(it, y);
+}
+
+// The dominance frontiers from the dominator tree, as per Cooper, Harvey and Kennedy ("A Simple, Fast Dominance
+// Algorithm", 2001): y is in DF[n] iff n dominates a predecessor of y but does not strictly dominate y, so walk up the
+// tree from each predecessor of y until the immediate dominator of y. The sets are the same as those of Appel's
+// algorithm 19.2, without its recursion and its linear search for the children of each node
+void DataFlow::computeDF() {
+	unsigned numBB = BBs.size();
+	DF.assign(numBB, std::vector<int>());
+	for (unsigned y = 0; y < numBB; y++) {
+		if (domPre[y] == -1)
+			continue;						// Not reached
+		for (int j = predStart[y]; j < predStart[y + 1]; j++) {
+			int p = preds[j];
+			if (domPre[p] == -1)
+				continue;
+			for (int r = p; r != idom[y]; r = idom[r])
+				DF[r].push_back(y);			// y is increasing, so each DF is sorted
 		}
 	}
-	DF[n] = S;
+	for (unsigned n = 0; n < numBB; n++)
+		DF[n].erase(std::unique(DF[n].begin(), DF[n].end()), DF[n].end());
 }	// end computeDF
 
+// A BB not in the CFG when the dominators were last computed; not reached as yet
+void DataFlow::addNode(PBB bb) {
+	indices[bb] = BBs.size();
+	BBs.push_back(bb);
+	idom.push_back(-1);
+	depth.push_back(-1);
+	DF.push_back(std::vector<int>());
+}
+
+// Update idom, depth and DF for a new edge from x to y. Only these cases are handled: x is not reached (nothing
+// changes), y is not reached as yet (it is now, with x as its immediate dominator, and so are its own edges), or the
+// nearest common dominator of x and y is y or y's immediate dominator (the dominator tree is unchanged; y is added to
+// the frontiers of the nodes that dominate x but not y). Otherwise y gets a new dominator, and maybe some of the nodes
+// that it dominates do too; returns false
+bool DataFlow::addEdge(int x, int y) {
+	if (depth[x] == -1)
+		return true;
+	std::vector<std::pair<int, int> > work;
+	work.push_back(std::pair<int, int>(x, y));
+	while (work.size()) {
+		x = work.back().first;
+		y = work.back().second;
+		work.pop_back();
+		if (depth[y] == -1) {
+			idom[y] = x;
+			depth[y] = depth[x] + 1;
+			std::vector<PBB>& outEdges = BBs[y]->getOutEdges();
+			for (unsigned i = 0; i < outEdges.size(); i++)
+				work.push_back(std::pair<int, int>(y, indices[outEdges[i]]));
+			continue;
+		}
+		int a = x, b = y;
+		while (a != b) {
+			if (depth[a] >= depth[b])
+				a = idom[a];
+			else
+				b = idom[b];
+		}
+		if (a != y && a != idom[y])
+			return false;
+		for (int r = x; r != idom[y]; r = idom[r])
+			addDF(r, y);
+	}
+	return true;
+}
+
+bool DataFlow::updateDominators(Cfg* cfg) {
+	Phase ph("dominators", cfg->getProc());
+	unsigned numOld = BBs.size();
+	if (numOld == 0 || domPre.size() != numOld || cfg->getEntryBB() != BBs[0])
+		return false;
+	// Every BB still in the CFG
+	std::vector<PBB> added;
+	unsigned kept = 0;
+	std::list<PBB>::iterator ii;
+	for (ii = cfg->begin(); ii != cfg->end(); ii++) {
+		if (indices.find(*ii) != indices.end())
+			kept++;
+		else
+			added.push_back(*ii);
+	}
+	if (kept != numOld)
+		return false;
+	unsigned n;
+	for (n = 0; n < added.size(); n++)
+		addNode(added[n]);
+	// Every edge too. Note the new ones from the BBs reached; the edges of the others are added when they are reached
+	std::vector<std::pair<int, int> > newEdges;
+	for (n = 0; n < numOld; n++) {
+		std::vector<PBB>& outEdges = BBs[n]->getOutEdges();
+		int i;
+		for (i = succStart[n]; i < succStart[n + 1]; i++)
+			if (std::find(outEdges.begin(), outEdges.end(), BBs[succs[i]]) == outEdges.end())
+				return false;
+		if (depth[n] == -1)
+			continue;
+		for (unsigned j = 0; j < outEdges.size(); j++) {
+			int d = indices[outEdges[j]];
+			for (i = succStart[n]; i < succStart[n + 1]; i++)
+				if (succs[i] == d)
+					break;
+			if (i == succStart[n + 1])
+				newEdges.push_back(std::pair<int, int>(n, d));
+		}
+	}
+	for (n = 0; n < newEdges.size(); n++)
+		if (!addEdge(newEdges[n].first, newEdges[n].second))
+			return false;
+
+	// Number the BBs as dominators() would, so that everything that goes by the indices (e.g. the order that the
+	// dominator tree is walked in) is the same as if they were computed again
+	std::vector<PBB> oldBBs(BBs);
+	numberBBs(cfg);
+	renumberA_phi(oldBBs);
+	unsigned numBB = BBs.size();
+	std::vector<int> oldIdom(idom);
+	std::vector<std::vector<int> > oldDF;
+	oldDF.swap(DF);
+	DF.resize(numBB);
+	for (n = 0; n < numBB; n++) {
+		int o = indices[oldBBs[n]];
+		idom[o] = oldIdom[n] == -1 ? -1 : indices[oldBBs[oldIdom[n]]];
+		std::vector<int>& df = DF[o];
+		df.swap(oldDF[n]);
+		for (unsigned j = 0; j < df.size(); j++)
+			df[j] = indices[oldBBs[df[j]]];
+		std::sort(df.begin(), df.end());
+	}
+	buildDomTree();
+	return true;
+}
+
 
 bool DataFlow::canRename(Exp* e, UserProc* proc) {
 	if (e->isSubscript()) e = ((RefExp*)e)->getSubExp1();	// Look inside refs
@@ -229,6 +448,7 @@ void DataFlow::dumpA_phi() {
 
 
 bool DataFlow::placePhiFunctions(UserProc* proc) {
+	Phase ph("placePhiFunctions", proc);
 	// First free some memory no longer needed
 	dfnum.resize(0);
 	semi.resize(0);
@@ -237,7 +457,8 @@ bool DataFlow::placePhiFunctions(UserProc* proc) {
 	vertex.resize(0);
 	parent.resize(0);
 	best.resize(0);
-	bucket.resize(0);
+	bucketHead.resize(0);
+	bucketNext.resize(0);
 	defsites.clear();			// Clear defsites map,
 	defallsites.clear();
 	A_orig.clear();				// and A_orig,
@@ -265,7 +486,7 @@ bool DataFlow::placePhiFunctions(UserProc* proc) {
 				defallsites.insert(n);									// then this block defines every variable
 			for (it = ls.begin(); it != ls.end(); it++) {
 				if (canRename(*it, proc)) {
-					A_orig[n].insert((*it)->clone());
+					A_orig[n].insert((*it)->cloneKey());
 					defStmts[*it] = s;
 				}
 			}
@@ -283,10 +504,17 @@ bool DataFlow::placePhiFunctions(UserProc* proc) {
 		}
 	}
 
+	bool pruned = Boomerang::get()->prunedSSA;
+	if (pruned)
+		computeLiveIn(proc);
+	int placed = 0, avoided = 0;
+
 	// For each variable a (in defsites, i.e. defined anywhere)
 	std::map<Exp*, std::set<int>, lessExpStar>::iterator mm;
-	for (mm = defsites.begin(); mm != defsites.end(); mm++) {
+	int i = 0;
+	for (mm = defsites.begin(); mm != defsites.end(); mm++, i++) {
 		Exp* a = (*mm).first;				// *mm is pair<Exp*, set<int>>
+		std::set<int> notLive;				// The nodes in the iterated frontier of a where a is not live
 
 		// Special processing for define-alls
 		// for each n in defallsites
@@ -302,15 +530,21 @@ bool DataFlow::placePhiFunctions(UserProc* proc) {
 			int n = *W.begin();				// Copy first element
 			W.erase(W.begin());				// Remove first element
 			// for each y in DF[n]
-			std::set<int>::iterator yy;
-			std::set<int>& DFn = DF[n];
+			std::vector<int>::iterator yy;
+			std::vector<int>& DFn = DF[n];
 			for (yy = DFn.begin(); yy != DFn.end(); yy++) {
 				int y = *yy;
 				// if y not element of A_phi[a]
 				std::set<int>& s = A_phi[a];
 				if (s.find(y) == s.end()) {
+					// With pruned SSA, no phi where nothing can use it. As it defines nothing, y is not added to W
+					if (pruned && !isLiveIn(i, y)) {
+						notLive.insert(y);
+						continue;
+					}
 					// Insert trivial phi function for a at top of block y: a := phi()
 					change = true;
+					placed++;
 					Statement* as = new PhiAssign(a->clone());
 					PBB Ybb = BBs[y];
 					Ybb->prependStmt(as, proc);
@@ -324,35 +558,189 @@ bool DataFlow::placePhiFunctions(UserProc* proc) {
 				}
 			}
 		}
+		avoided += notLive.size();
 	}
+	liveIn.resize(0);
+	phisPlaced += placed;
+	phisAvoided += avoided;
+	if (pruned && VERBOSE)
+		LOG << "placed " << placed << " phi functions in " << proc->getName() << ", avoided " << avoided <<
+			" where the location is not live\n";
 	return change;
 }		// end placePhiFunctions
 
+// Find the locations of defsites that are live at the start of each BB, for pruned SSA. Uses already subscripted don't
+// count, as renaming won't change them. A phi function uses its location at the end of each predecessor. The
+// collectors of calls and returns are renamed too, so a call or return uses every location that they can keep, i.e.
+// all but temporaries (filterReturns and filterParams drop them)
+void DataFlow::computeLiveIn(UserProc* proc) {
+	std::map<Exp*, int, lessExpStar> names;
+	std::map<Exp*, std::set<int>, lessExpStar>::iterator mm;
+	int numNames = 0;
+	for (mm = defsites.begin(); mm != defsites.end(); mm++)
+		names[mm->first] = numNames++;
+	int W = liveWords = (numNames + 31) / 32;
+	int numBB = BBs.size();
+	std::vector<unsigned> use(numBB * W, 0);		// Used before any definition in the BB
+	std::vector<unsigned> kill(numBB * W, 0);		// Defined in the BB
+	std::vector<unsigned> phiUse(numBB * W, 0);		// Has a phi function in the BB, so is used at the end of its preds
+	std::vector<unsigned> collected(W, 0);			// Used by collectors
+	std::map<Exp*, int, lessExpStar>::iterator nn;
+	for (nn = names.begin(); nn != names.end(); nn++)
+		if (!nn->first->isTemp())
+			collected[nn->second / 32] |= 1u << (nn->second % 32);
+
+	int n, w;
+	for (n = 0; n < numBB; n++) {
+		unsigned* u = &use[n * W];
+		unsigned* k = &kill[n * W];
+		BasicBlock::rtlit rit; StatementList::iterator sit;
+		PBB bb = BBs[n];
+		for (Statement* S = bb->getFirstStmt(rit, sit); S; S = bb->getNextStmt(rit, sit)) {
+			if (S->isPhi()) {
+				nn = names.find(((PhiAssign*)S)->getLeft());
+				if (nn != names.end()) {
+					phiUse[n * W + nn->second / 32] |= 1u << (nn->second % 32);
+					k[nn->second / 32] |= 1u << (nn->second % 32);
+				}
+				continue;
+			}
+			LocationSet locs;
+			S->addUsedLocs(locs);
+			LocationSet::iterator xx;
+			for (xx = locs.begin(); xx != locs.end(); xx++) {
+				if ((*xx)->isSubscript())
+					continue;
+				nn = names.find(*xx);
+				if (nn != names.end() && !(k[nn->second / 32] & (1u << (nn->second % 32))))
+					u[nn->second / 32] |= 1u << (nn->second % 32);
+			}
+			if (S->isCall() || S->isReturn())
+				for (w = 0; w < W; w++)
+					u[w] |= collected[w] & ~k[w];
+			LocationSet defs;
+			S->getDefinitions(defs);
+			for (xx = defs.begin(); xx != defs.end(); xx++) {
+				nn = names.find(*xx);
+				if (nn != names.end())
+					k[nn->second / 32] |= 1u << (nn->second % 32);
+			}
+		}
+	}
+
+	// liveIn(n) = use(n) | (liveOut(n) & ~kill(n)), liveOut(n) = the union of liveIn(s) | phiUse(s) for the successors
+	// s of n. Backwards, so the nodes in reverse order, until nothing changes
+	liveIn.assign(use.begin(), use.end());
+	std::vector<unsigned> out(W);
+	bool change = true;
+	while (change) {
+		change = false;
+		for (n = numBB-1; n >= 0; n--) {
+			for (w = 0; w < W; w++)
+				out[w] = 0;
+			for (int e = succStart[n]; e < succStart[n+1]; e++) {
+				int s = succs[e];
+				for (w = 0; w < W; w++)
+					out[w] |= liveIn[s * W + w] | phiUse[s * W + w];
+			}
+			for (w = 0; w < W; w++) {
+				unsigned live = use[n * W + w] | (out[w] & ~kill[n * W + w]);
+				if (live != liveIn[n * W + w]) {
+					liveIn[n * W + w] = live;
+					change = true;
+				}
+			}
+		}
+	}
+}
+
 
 
 static Exp* defineAll = new Terminal(opDefineAll);		// An expression representing <all>
 
-// There is an entry in stacks[defineAll] that represents the latest definition from a define-all source. It is needed
-// for variables that don't have a definition as yet (i.e. stacks[x].empty() is true). As soon as a real definition to
-// x appears, stacks[defineAll] does not apply for variable x. This is needed to get correct operation of the use
-// collectors in calls.
+// There is an entry in defStacks for defineAll (always ID 0) that represents the latest definition from a define-all
+// source. It is needed for variables that don't have a definition as yet (i.e. their stack is empty). As soon as a
+// real definition to x appears, the defineAll stack does not apply for variable x. This is needed to get correct
+// operation of the use collectors in calls.
 
-// Care with the Stacks object (a map from expression to stack); using Stacks[q].empty() can needlessly insert an empty
-// stack
-#define STACKS_EMPTY(q) (Stacks.find(q) == Stacks.end() || Stacks[q].empty())
+// The ID of location e, or -1 if it has not been defined (so its stack is empty)
+int DataFlow::findLocId(Exp* e) {
+	std::map<Exp*, int, lessExpStar>::iterator it = locIds.find(e);
+	return it == locIds.end() ? -1 : it->second;
+}
+
+// The ID of location e, which is given one (with an empty stack) if it has none yet
+int DataFlow::getLocId(Exp* e) {
+	std::map<Exp*, int, lessExpStar>::iterator it = locIds.lower_bound(e);
+	if (it != locIds.end() && !locIds.key_comp()(e, it->first))
+		return it->second;
+	// Note: we clone e because otherwise it could be an expression that gets deleted through various modifications.
+	// This is necessary because we do several passes of this algorithm to sort out the memory expressions
+	Exp* key = e->cloneKey();
+	int id = idLocs.size();
+	locIds.insert(it, std::pair<Exp*, int>(key, id));
+	idLocs.push_back(key);
+	defStacks.resize(id + 1);
+	return id;
+}
 
-// Subscript dataflow variables
-static int progress = 0;
+void DataFlow::pushDef(int id, Statement* s) {
+	defStacks[id].push_back(s);
+	pushed.push_back(id);
+}
+
+// A block of the dominator tree being renamed: the next of its children to rename, and the size of pushed before its
+// definitions were pushed
+struct RenameFrame {
+	int			n;
+	int			child;
+	size_t		mark;
+				RenameFrame(int n, int child, size_t mark) : n(n), child(child), mark(mark) {}
+};
+
+// Subscript dataflow variables: rename block n and all the blocks it dominates, in a depth first walk of the dominator
+// tree with an explicit stack, so that deep trees can't overflow the machine stack
 bool DataFlow::renameBlockVars(UserProc* proc, int n, bool clearStacks /* = false */ ) {
-	if (++progress > 200) {
-		std::cerr << 'r' << std::flush;
-		progress = 0;
+	// Need to clear the stacks of old, renamed locations like m[esp-4] (these will be deleted, and will cause compare
+	// failures in locIds, so it can't be correctly ordered and hence balanced etc, and will lead to segfaults)
+	if (clearStacks) {
+		locIds.clear();
+		idLocs.clear();
+		defStacks.clear();
 	}
+	if (idLocs.empty())
+		getLocId(defineAll);			// ID 0
+	pushed.clear();
+
 	bool changed = false;
+	std::vector<RenameFrame> walk;
+	walk.push_back(RenameFrame(n, domChildStart[n], 0));
+	changed |= renameBlock(proc, n);
+	while (walk.size()) {
+		RenameFrame& f = walk.back();
+		if (f.child < domChildStart[f.n+1]) {
+			// Rename the next child of f.n
+			int c = domChildren[f.child++];
+			walk.push_back(RenameFrame(c, domChildStart[c], pushed.size()));
+			changed |= renameBlock(proc, c);
+			continue;
+		}
+		// Done with f.n and all it dominates: pop its definitions
+		while (pushed.size() > f.mark) {
+			defStacks[pushed.back()].pop_back();
+			pushed.pop_back();
+		}
+		walk.pop_back();
+	}
+	return changed;
+}
 
-	// Need to clear the Stacks of old, renamed locations like m[esp-4] (these will be deleted, and will cause compare
-	// failures in the Stacks, so it can't be correctly ordered and hence balanced etc, and will lead to segfaults)
-	if (clearStacks) Stacks.clear();
+// Rename the uses in block n and push its definitions, then fill in its operands of the phi functions of its successors
+static volatile int progress = 0;		// Shared by all threads; only for the progress dots
+bool DataFlow::renameBlock(UserProc* proc, int n) {
+	if (atomicIncrement(&progress) % 200 == 0)
+		std::cerr << 'r' << std::flush;
+	bool changed = false;
 
 	// For each statement S in block n
 	BasicBlock::rtlit rit; StatementList::iterator sit;
@@ -381,6 +769,7 @@ bool DataFlow::renameBlockVars(UserProc* proc, int n, bool clearStacks /* = fals
 				S->addUsedLocs(locs);
 			}
 			LocationSet::iterator xx;
+			bool subscripted = false;
 			for (xx = locs.begin(); xx != locs.end(); xx++) {
 				Exp* x = *xx;
 				// Don't rename memOfs that are not renamable according to the current policy
@@ -403,9 +792,10 @@ bool DataFlow::renameBlockVars(UserProc* proc, int n, bool clearStacks /* = fals
 					continue;							// Don't re-rename the renamed variable
 				}
 				// Else x is not subscripted yet
-				if (STACKS_EMPTY(x)) {
-					if (!Stacks[defineAll].empty())
-						def = Stacks[defineAll].top();
+				int id = findLocId(x);
+				if (id == -1 || defStacks[id].empty()) {
+					if (!defStacks[0].empty())
+						def = defStacks[0].back();
 					else {
 						// If the both stacks are empty, use a NULL definition. This will be changed into a pointer
 						// to an implicit definition at the start of type analysis, but not until all the m[...]
@@ -416,12 +806,13 @@ bool DataFlow::renameBlockVars(UserProc* proc, int n, bool clearStacks /* = fals
 					}
 				}
 				else
-					def = Stacks[x].top();
+					def = defStacks[id].back();
 				if (def && def->isCall())
 					// Calls have UseCollectors for locations that are used before definition at the call
 					((CallStatement*)def)->useBeforeDefine(x->clone());
 				// Replace the use of x with x{def} in S
 				changed = true;
+				subscripted = true;
 				if (S->isPhi()) {
 					Exp* phiLeft = ((PhiAssign*)S)->getLeft();
 					phiLeft->setSubExp1(phiLeft->getSubExp1()->expSubscriptVar(x, def /*, this*/));
@@ -429,6 +820,8 @@ bool DataFlow::renameBlockVars(UserProc* proc, int n, bool clearStacks /* = fals
 					S->subscriptVar(x, def /*, this */);
 				}
 			}
+			if (subscripted)
+				proc->stmtChanged(S);
 		}
 
 		// MVE: Check for Call and Return Statements; these have DefCollector objects that need to be updated
@@ -439,7 +832,7 @@ bool DataFlow::renameBlockVars(UserProc* proc, int n, bool clearStacks /* = fals
 				col = ((CallStatement*)S)->getDefCollector();
 			else
 				col = ((ReturnStatement*)S)->getCollector();
-			col->updateDefs(Stacks, proc);
+			col->updateDefs(idLocs, defStacks, proc);
 		}
 
 		// For each definition of some variable a in S
@@ -451,11 +844,8 @@ bool DataFlow::renameBlockVars(UserProc* proc, int n, bool clearStacks /* = fals
 			// Don't consider a if it cannot be renamed
 			bool suitable = canRename(a, proc);
 			if (suitable) {
-				// Push i onto Stacks[a]
-				// Note: we clone a because otherwise it could be an expression that gets deleted through various
-				// modifications. This is necessary because we do several passes of this algorithm to sort out the
-				// memory expressions
-				Stacks[a->clone()].push(S);
+				// Push S onto the stack of a
+				pushDef(getLocId(a), S);
 				// Replace definition of a with definition of a_i in S (we don't do this)
 			}
 			// FIXME: MVE: do we need this awful hack?
@@ -463,9 +853,9 @@ bool DataFlow::renameBlockVars(UserProc* proc, int n, bool clearStacks /* = fals
 				Exp *a1 = S->getProc()->expFromSymbol(((Const*)a->getSubExp1())->getStr());
 				assert(a1);
 				a = a1;
-				// Stacks already has a definition for a (as just the bare local)
+				// The stacks already have a definition for a (as just the bare local)
 				if (suitable) {
-					Stacks[a->clone()].push(S);
+					pushDef(getLocId(a), S);
 				}
 			}
 		}
@@ -473,12 +863,8 @@ bool DataFlow::renameBlockVars(UserProc* proc, int n, bool clearStacks /* = fals
 // But note that only everythings at the current memory level are defined!
 		if (S->isCall() && ((CallStatement*)S)->isChildless() && !Boomerang::get()->assumeABI) {
 			// S is a childless call (and we're not assuming ABI compliance)
-			Stacks[defineAll];										// Ensure that there is an entry for defineAll
-			std::map<Exp*, std::stack<Statement*>, lessExpStar>::iterator dd;
-			for (dd = Stacks.begin(); dd != Stacks.end(); ++dd) {
-// if (dd->first->isMemDepth(memDepth))
-					dd->second.push(S);								// Add a definition for all vars
-			}
+			for (unsigned id = 0; id < idLocs.size(); id++)		// Including defineAll
+				pushDef(id, S);									// Add a definition for all vars
 		}
 	}
 
@@ -502,67 +888,30 @@ bool DataFlow::renameBlockVars(UserProc* proc, int n, bool clearStacks /* = fals
 			Exp* a = pa->getLeft();
 			// Only consider variables that can be renamed
 			if (!canRename(a, proc)) continue;
-			Statement* def;
-			if (STACKS_EMPTY(a))
-				def = NULL;				// No reaching definition
-			else
-				def = Stacks[a].top();
+			Statement* def = NULL;		// No reaching definition
+			int id = findLocId(a);
+			if (id != -1 && !defStacks[id].empty())
+				def = defStacks[id].back();
 			// "Replace jth operand with a_i"
+			bool newDef = j >= pa->getNumDefs() || pa->getAt(j).def != def || pa->getAt(j).e == NULL;
 			pa->putAt(j, def, a);
+			if (newDef)
+				proc->stmtChanged(pa);
 		}
 	}
-
-	// For each child X of n
-	// Note: linear search!
-	unsigned numBB = proc->getCFG()->getNumBBs();
-	for (unsigned X=0; X < numBB; X++) {
-		if (idom[X] == n)
-			renameBlockVars(proc, X);
-	}
-
-	// For each statement S in block n
-	// NOTE: Because of the need to pop childless calls from the Stacks, it is important in my algorithm to process the
-	// statments in the BB *backwards*. (It is not important in Appel's algorithm, since he always pushes a definition
-	// for every variable defined on the Stacks).
-	BasicBlock::rtlrit rrit; StatementList::reverse_iterator srit;
-	for (S = bb->getLastStmt(rrit, srit); S; S = bb->getPrevStmt(rrit, srit)) {
-		// For each definition of some variable a in S
-		LocationSet defs;
-		S->getDefinitions(defs);
-		LocationSet::iterator dd;
-		for (dd = defs.begin(); dd != defs.end(); dd++) {
-			if (canRename(*dd, proc)) {
-				// if ((*dd)->getMemDepth() == memDepth)
-				std::map<Exp*, std::stack<Statement*>, lessExpStar>::iterator ss = Stacks.find(*dd);
-				if (ss == Stacks.end()) {
-					std::cerr << "Tried to pop " << *dd << " from Stacks; does not exist\n";
- 					assert(0);
-				}
-					ss->second.pop();
-			}
-		}
-		// Pop all defs due to childless calls
-		if (S->isCall() && ((CallStatement*)S)->isChildless()) {
-			std::map<Exp*, std::stack<Statement*>, lessExpStar>::iterator sss;
-			for (sss = Stacks.begin(); sss != Stacks.end(); ++sss) {
-				if (!sss->second.empty() && sss->second.top() == S) {
-					sss->second.pop();
-				}
-			}
-		}
-	}
+	// The definitions of S are popped by renameBlockVars, once the blocks that n dominates are renamed. (Because of the
+	// need to pop childless calls, which define every variable, it keeps a log of what is pushed, rather than pushing
+	// a definition for every variable defined, as Appel's algorithm does)
 	return changed;
 }
 
 void DataFlow::dumpStacks() {
-	std::cerr << "Stacks: " << Stacks.size() << " entries\n";
-	std::map<Exp*, std::stack<Statement*>, lessExpStar>::iterator zz;
-	for (zz = Stacks.begin(); zz != Stacks.end(); zz++) {
-		std::cerr << "Var " << zz->first << " [ ";
-		std::stack<Statement*>tt = zz->second;               // Copy the stack!
-		while (!tt.empty()) {
-			std::cerr << tt.top()->getNumber() << " "; tt.pop();
-		}
+	std::cerr << "Stacks: " << idLocs.size() << " entries\n";
+	for (unsigned id = 0; id < idLocs.size(); id++) {
+		std::cerr << "Var " << idLocs[id] << " [ ";
+		std::vector<Statement*>& st = defStacks[id];
+		for (int i = st.size() - 1; i >= 0; i--)			// Top first
+			std::cerr << st[i]->getNumber() << " ";
 		std::cerr << "]\n";
 	}
 }
@@ -591,16 +940,17 @@ void DataFlow::dumpA_orig() {
 	}
 }
 
-void DefCollector::updateDefs(std::map<Exp*, std::stack<Statement*>, lessExpStar>& Stacks, UserProc* proc) {
-	std::map<Exp*, std::stack<Statement*>, lessExpStar>::iterator it;
-	for (it = Stacks.begin(); it != Stacks.end(); it++) {
-		if (it->second.size() == 0)
+void DefCollector::updateDefs(std::vector<Exp*>& locs, std::vector<std::vector<Statement*> >& stacks, UserProc* proc) {
+	for (unsigned id = 0; id < locs.size(); id++) {
+		if (stacks[id].empty())
 			continue;					// This variable's definition doesn't reach here
+		if (existsOnLeft(locs[id]))
+			continue;					// Already collected (and insert keeps the first)
 		// Create an assignment of the form loc := loc{def}
-		RefExp* re = new RefExp(it->first->clone(), it->second.top());
-		Assign* as = new Assign(it->first->clone(), re);
+		RefExp* re = new RefExp(locs[id]->clone(), stacks[id].back());
+		Assign* as = new Assign(locs[id]->clone(), re);
 		as->setProc(proc);				// Simplify sometimes needs this
-		insert(as);
+		defs.insert(as);
 	}
 	initialised = true;
 }
@@ -834,15 +1184,11 @@ void DataFlow::findLiveAtDomPhi(int n, LocationSet& usedByDomPhi, LocationSet& u
 	}
 
 	// Visit each child in the dominator graph
-	// Note: this is a linear search!
-	// Note also that usedByDomPhi0 may have some irrelevant entries, but this will do no harm, and attempting to erase
+	// Note that usedByDomPhi0 may have some irrelevant entries, but this will do no harm, and attempting to erase
 	// the irrelevant ones would probably cost more than leaving them alone
-	int sz = idom.size();
-	for (int c = 0; c < sz; ++c) {
-		if (idom[c] != n) continue;
+	for (int c = domChildStart[n]; c < domChildStart[n+1]; c++)
 		// Recurse to the child
-		findLiveAtDomPhi(c, usedByDomPhi, usedByDomPhi0, defdByPhi);
-	}
+		findLiveAtDomPhi(domChildren[c], usedByDomPhi, usedByDomPhi0, defdByPhi);
 }
 
 #if USE_DOMINANCE_NUMS
@@ -852,12 +1198,9 @@ void DataFlow::setDominanceNums(int n, int& currNum) {
 	Statement* S;
 	for (S = bb->getFirstStmt(rit, sit); S; S = bb->getNextStmt(rit, sit))
 		S->setDomNumber(currNum++);
-	int sz = idom.size();
-	for (int c = 0; c < sz; ++c) {
-		if (idom[c] != n) continue;
+	for (int c = domChildStart[n]; c < domChildStart[n+1]; c++)
 		// Recurse to the child
-		setDominanceNums(c, currNum);
-	}
+		setDominanceNums(domChildren[c], currNum);
 }
 #endif
 
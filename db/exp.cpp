@@ -8,6 +8,10 @@
 /*
  * $Revision: 1.217 $	// 1.172.2.20
  * 05 Apr 02 - Mike: Created
+ * 17 Oct 26 - Structural hashing and interning (hash consing); copy on write for interned expressions
+ * 17 Oct 26 - The intern table is locked, for parallel decompilation
+ * 17 Oct 26 - Interned expressions are owned by the proc they refer to, and dropped from the table when it is final
+ * 17 Oct 26 - lessExpStar and lessTI no longer order by hash; releaseAllInterned
  */
 
 #include <assert.h>
@@ -23,6 +27,7 @@
 #include <map>			// In decideType()
 #include <sstream>		// Need gcc 3.0 or better
 #include <cstring>
+#include <typeinfo>		// For typeid in sameShape()
 #include "types.h"
 #include "statement.h"
 #include "cfg.h"
@@ -35,6 +40,7 @@
 #include "operstrings.h"// Defines a large array of strings for the createDotFile etc. functions. Needs -I. to find it
 #include "util.h"
 #include "boomerang.h"
+#include "threads.h"
 //#include "transformer.h"
 #include "visitor.h"
 #include "log.h"
@@ -208,16 +214,19 @@ TypeVal::~TypeVal() {
  * RETURNS:			<nothing>
  *============================================================================*/
 void Unary::setSubExp1(Exp* e) {
+	assert(!internId);		// Interned expressions are shared; unshare() first
 	if (subExp1 != 0) ;//delete subExp1;
 	subExp1 = e;
     assert(subExp1);
 }
 void Binary::setSubExp2(Exp* e) {
+	assert(!internId);
 	if (subExp2 != 0) ;//delete subExp2;
 	subExp2 = e;
     assert(subExp1 && subExp2);
 }
 void Ternary::setSubExp3(Exp* e) {
+	assert(!internId);
 	if (subExp3 != 0) ;//delete subExp3;
 	subExp3 = e;
     assert(subExp1 && subExp2 && subExp3);
@@ -268,6 +277,7 @@ Exp*& Exp::refSubExp3() {return dummy;}
  *============================================================================*/
 /// Swap the two subexpressions.
 void Binary::commute() {
+	assert(!internId);
 	Exp* t = subExp1;
 	subExp1 = subExp2;
 	subExp2 = t;
@@ -1615,6 +1625,16 @@ Exp* Exp::searchReplace(Exp* search, Exp* replace, bool& change)
  *============================================================================*/
 Exp* Exp::searchReplaceAll(Exp* search, Exp* replace, bool& change, bool once /* = false */ ) {
 	std::list<Exp**> li;
+	if (internId) {
+		// Copy on write: never replace inside a shared, interned expression. Only pay for the copy if there is
+		// something to replace
+		Exp* found;
+		if (!this->search(search, found)) {
+			change = false;
+			return this;
+		}
+		return clone()->searchReplaceAll(search, replace, change, once);
+	}
 	Exp* top = this;		// top may change; that's why we have to return it
 	doSearch(search, top, li, false);
 	std::list<Exp**>::iterator it;
@@ -1889,6 +1909,8 @@ Exp* Exp::simplify() {
 	Exp* save = clone();
 #endif
 	bool bMod = false;					// True if simplified at this or lower level
+	if (internId)
+		return clone()->simplify();		// Simplification works in place; don't modify a shared expression
 	Exp* res = this;
 	//res = ExpTransformer::applyAllTo(res, bMod);
 	//return res;
@@ -3153,14 +3175,197 @@ Exp* Exp::fromSSAleft(UserProc* proc, Statement* d) {
 }
 
 // A helper class for comparing Exp*'s sensibly
+// Note: no hashes here. The probes of a lookup are usually not interned, so their hashes would be recomputed (deeply)
+// on every comparison, and ordering interned keys by hash but other keys structurally would not be a consistent order
 bool lessExpStar::operator()(const Exp* x, const Exp* y) const {
+	if (x == y) return false;			// Same expression (always the case for equal interned expressions)
 	return (*x < *y);		// Compare the actual Exps
 }
 
 bool lessTI::operator()(const Exp* x, const Exp* y) const {
+	if (x == y) return false;
 	return (*x << *y);		// Compare the actual Exps
 }
 
+//	//	//	//	//	//	//	//
+//	Hashing and interning	//
+//	//	//	//	//	//	//	//
+
+bool Exp::interning = false;
+
+// The table of interned expressions, keyed by structural hash
+typedef std::multimap<unsigned, Exp*> InternTable;
+static InternTable internTable;
+static int lastInternId = 0;
+// The proc that each interned expression refers to, if any, and the entries of internTable owned by each proc
+static std::map<Exp*, UserProc*> internOwner;
+static std::map<UserProc*, std::vector<InternTable::iterator> > ownedInterns;
+static Mutex internLock;						// Guards all the above
+
+// Combine v into the hash h (FNV-1a style)
+static inline unsigned hashMix(unsigned h, unsigned v) {
+	return (h ^ v) * 16777619u;
+}
+
+/*==============================================================================
+ * FUNCTION:		Exp::computeHash etc
+ * OVERVIEW:		Compute the structural hash of this expression. Subexpressions contribute through hash(), so
+ *					  this is O(1) per level when the subexpressions are interned
+ * NOTE:			Must be consistent with operator== and operator<: equal expressions must have equal hashes.
+ *					  Hence types, subscript definitions (which may be wildcards) and Location procs are ignored
+ * RETURNS:			The hash
+ *============================================================================*/
+unsigned Exp::computeHash() const {
+	return hashMix(2166136261u, op);			// Terminal, TypeVal
+}
+
+unsigned Const::computeHash() const {
+	unsigned h = hashMix(hashMix(2166136261u, op), conscript);
+	switch (op) {
+		case opIntConst:
+			return hashMix(h, u.i);
+		case opLongConst:
+			return hashMix(hashMix(h, (unsigned)u.ll), (unsigned)(u.ll >> 32));
+		case opFltConst: {
+			unsigned w[sizeof(double)/sizeof(unsigned)];
+			memcpy(w, &u.d, sizeof(double));
+			for (unsigned i=0; i < sizeof(double)/sizeof(unsigned); i++)
+				h = hashMix(h, w[i]);
+			return h;
+		}
+		case opStrConst:
+			for (const char* p = u.p; *p; p++)
+				h = hashMix(h, (unsigned char)*p);
+			return h;
+		default:
+			return hashMix(h, (unsigned)(size_t)u.pp);		// opFuncConst
+	}
+}
+
+unsigned Unary::computeHash() const {
+	// Also TypedExp (ignoring the type), RefExp (ignoring the definition), Location, FlagDef
+	return hashMix(hashMix(2166136261u, op), subExp1->hash());
+}
+
+unsigned Binary::computeHash() const {
+	return hashMix(hashMix(hashMix(2166136261u, op), subExp1->hash()), subExp2->hash());
+}
+
+unsigned Ternary::computeHash() const {
+	return hashMix(hashMix(hashMix(hashMix(2166136261u, op), subExp1->hash()), subExp2->hash()), subExp3->hash());
+}
+
+bool Const::isSameConst(Const& o) {
+	if (op != o.op || conscript != o.conscript) return false;
+	switch (op) {
+		case opIntConst:	return u.i == o.u.i;
+		case opLongConst:	return u.ll == o.u.ll;
+		case opFltConst:	return memcmp(&u.d, &o.u.d, sizeof(double)) == 0;
+		case opStrConst:	return strcmp(u.p, o.u.p) == 0;
+		default:			return u.pp == o.u.pp;
+	}
+}
+
+// True if a and b are identical apart from the identity of their (already interned) subexpressions, which are
+// compared by pointer. Stricter than operator==: no wildcards, and definitions, procs and types must match
+static bool sameShape(Exp* a, Exp* b) {
+	if (a->getOper() != b->getOper() || typeid(*a) != typeid(*b))
+		return false;
+	switch (a->getArity()) {
+		case 3: if (a->getSubExp3() != b->getSubExp3()) return false;		// Fall through
+		case 2: if (a->getSubExp2() != b->getSubExp2()) return false;		// Fall through
+		case 1: if (a->getSubExp1() != b->getSubExp1()) return false;
+	}
+	if (typeid(*a) == typeid(Const))
+		return ((Const*)a)->isSameConst(*(Const*)b);
+	if (typeid(*a) == typeid(RefExp))
+		return ((RefExp*)a)->getDef() == ((RefExp*)b)->getDef();
+	if (typeid(*a) == typeid(Location))
+		return ((Location*)a)->getProc() == ((Location*)b)->getProc();
+	if (typeid(*a) == typeid(TypedExp))
+		return *((TypedExp*)a)->getType() == *((TypedExp*)b)->getType();
+	if (typeid(*a) == typeid(TypeVal))
+		return *((TypeVal*)a)->getType() == *((TypeVal*)b)->getType();
+	if (typeid(*a) == typeid(FlagDef))
+		return ((FlagDef*)a)->getRtl() == ((FlagDef*)b)->getRtl();
+	return true;
+}
+
+/*==============================================================================
+ * FUNCTION:		Exp::intern
+ * OVERVIEW:		Find or make the canonical (interned) copy of this expression. Subexpressions are interned
+ *					  first, so interned expressions share all their common subtrees
+ * NOTE:			This expression is not modified. The result must not be modified in place (use unshare())
+ * NOTE:			The type of a Const is not part of its identity; the canonical copy has the type of the first
+ *					  such constant interned
+ * RETURNS:			The canonical copy
+ *============================================================================*/
+Exp* Exp::intern() {
+	if (internId) return this;
+	Exp* e = clone();
+	switch (getArity()) {
+		case 3: e->refSubExp3() = getSubExp3()->intern();		// Fall through
+		case 2: e->refSubExp2() = getSubExp2()->intern();		// Fall through
+		case 1: e->refSubExp1() = getSubExp1()->intern();
+	}
+	unsigned h = e->computeHash();
+	MutexLock ml(internLock);
+	std::pair<InternTable::iterator, InternTable::iterator> range = internTable.equal_range(h);
+	for (InternTable::iterator it = range.first; it != range.second; ++it)
+		if (sameShape(it->second, e))
+			return it->second;
+	e->hashVal = h;
+	e->internId = ++lastInternId;
+	InternTable::iterator ins = internTable.insert(range.second, std::pair<unsigned, Exp*>(h, e));
+
+	// The owner: the proc of a definition or Location, else that of an (interned) subexpression
+	UserProc* owner = NULL;
+	if (typeid(*e) == typeid(RefExp) && ((RefExp*)e)->getDef())
+		owner = ((RefExp*)e)->getDef()->getProc();
+	else if (typeid(*e) == typeid(Location))
+		owner = ((Location*)e)->getProc();
+	for (int i = 1; owner == NULL && i <= e->getArity(); i++) {
+		Exp* sub = i == 1 ? e->getSubExp1() : i == 2 ? e->getSubExp2() : e->getSubExp3();
+		std::map<Exp*, UserProc*>::iterator oo = internOwner.find(sub);
+		if (oo != internOwner.end())
+			owner = oo->second;
+	}
+	if (owner) {
+		internOwner[e] = owner;
+		ownedInterns[owner].push_back(ins);
+	}
+	return e;
+}
+
+int Exp::numInterned() {
+	return lastInternId;
+}
+
+int Exp::numInternedLive() {
+	MutexLock ml(internLock);
+	return internTable.size();
+}
+
+void Exp::releaseInterned(UserProc* proc) {
+	MutexLock ml(internLock);
+	std::map<UserProc*, std::vector<InternTable::iterator> >::iterator pp = ownedInterns.find(proc);
+	if (pp == ownedInterns.end())
+		return;
+	std::vector<InternTable::iterator>& owned = pp->second;
+	for (unsigned i = 0; i < owned.size(); i++) {
+		internOwner.erase(owned[i]->second);
+		internTable.erase(owned[i]);
+	}
+	ownedInterns.erase(pp);
+}
+
+void Exp::releaseAllInterned() {
+	MutexLock ml(internLock);
+	internTable.clear();
+	internOwner.clear();
+	ownedInterns.clear();
+}
+
 //	//	//	//	//	//
 //	genConstraints	//
 //	//	//	//	//	//
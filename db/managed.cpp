@@ -17,6 +17,8 @@
  *
  * 26 Aug 03 - Mike: Split off from statement.cpp
  * 21 Jun 05 - Mike: Added AssignSet
+ * 17 Oct 26 - Added BitSet and LocationNumbering
+ * 17 Oct 26 - LocationSet may be in a Region
  */
 
 #include <sstream>
@@ -304,7 +306,7 @@ bool AssignSet::operator<(const AssignSet& o) const {
 // Assignment operator
 LocationSet& LocationSet::operator=(const LocationSet& o) {
 	lset.clear();
-	std::set<Exp*, lessExpStar>::const_iterator it;
+	const_iterator it;
 	for (it = o.lset.begin(); it != o.lset.end(); it++) {
 		lset.insert((*it)->clone());
 	}
@@ -313,14 +315,14 @@ LocationSet& LocationSet::operator=(const LocationSet& o) {
 
 // Copy constructor
 LocationSet::LocationSet(const LocationSet& o) {
-	std::set<Exp*, lessExpStar>::const_iterator it;
+	const_iterator it;
 	for (it = o.lset.begin(); it != o.lset.end(); it++)
 		lset.insert((*it)->clone());
 }
 
 char* LocationSet::prints() {
 	std::ostringstream ost;
-	std::set<Exp*, lessExpStar>::iterator it;
+	iterator it;
 	for (it = lset.begin(); it != lset.end(); it++) {
 		if (it != lset.begin()) ost << ",\t";
 		ost << *it;
@@ -335,7 +337,7 @@ void LocationSet::dump() {
 }
 
 void LocationSet::print(std::ostream& os) {
-	std::set<Exp*, lessExpStar>::iterator it;
+	iterator it;
 	for (it = lset.begin(); it != lset.end(); it++) {
 		if (it != lset.begin()) os << ",\t";
 		os << *it;
@@ -343,7 +345,7 @@ void LocationSet::print(std::ostream& os) {
 }
 
 void LocationSet::remove(Exp* given) {
-	std::set<Exp*, lessExpStar>::iterator it = lset.find(given);
+	iterator it = lset.find(given);
 	if (it == lset.end()) return;
 //std::cerr << "LocationSet::remove at " << std::hex << (unsigned)this << " of " << *it << "\n";
 //std::cerr << "before: "; print();
@@ -378,7 +380,7 @@ void LocationSet::makeUnion(LocationSet& other) {
 
 // Make this set the set difference of itself and other
 void LocationSet::makeDiff(LocationSet& other) {
-	std::set<Exp*, lessExpStar>::iterator it;
+	iterator it;
 	for (it = other.lset.begin(); it != other.lset.end(); it++) {
 		lset.erase(*it);
 	}
@@ -387,7 +389,7 @@ void LocationSet::makeDiff(LocationSet& other) {
 bool LocationSet::operator==(const LocationSet& o) const {
 	// We want to compare the locations, not the pointers
 	if (size() != o.size()) return false;
-	std::set<Exp*, lessExpStar>::const_iterator it1, it2;
+	const_iterator it1, it2;
 	for (it1 = lset.begin(), it2 = o.lset.begin(); it1 != lset.end(); it1++, it2++) {
 		if (!(**it1 == **it2)) return false;
 	}
@@ -433,7 +435,7 @@ bool LocationSet::existsImplicit(Exp* e) {
 // return true if r28{20} in the set. If return true, dr points to the first different ref
 bool LocationSet::findDifferentRef(RefExp* e, Exp *&dr) {
 	RefExp search(e->getSubExp1()->clone(), (Statement*)-1);
-	std::set<Exp*, lessExpStar>::iterator pos = lset.find(&search);
+	iterator pos = lset.find(&search);
 	if (pos == lset.end()) return false;
 	while (pos != lset.end()) {
 		// Exit if we've gone to a new base expression
@@ -453,8 +455,8 @@ bool LocationSet::findDifferentRef(RefExp* e, Exp *&dr) {
 
 // Add a subscript (to definition d) to each element
 void LocationSet::addSubscript(Statement* d /* , Cfg* cfg */) {
-	std::set<Exp*, lessExpStar>::iterator it;
-	std::set<Exp*, lessExpStar> newSet;
+	iterator it;
+	Set newSet(lset.key_comp(), lset.get_allocator());
 	for (it = lset.begin(); it != lset.end(); it++)
 		newSet.insert((*it)->expSubscriptVar(*it, d /* , cfg */));
 	lset = newSet;			// Replace the old set!
@@ -467,7 +469,7 @@ void LocationSet::substitute(Assign& a) {
 	if (lhs == NULL) return;
 	Exp* rhs = a.getRight();
 	if (rhs == NULL) return;		// ? Will this ever happen?
-	std::set<Exp*, lessExpStar>::iterator it;
+	iterator it;
 	// Note: it's important not to change the pointer in the set of pointers to expressions, without removing and
 	// inserting again. Otherwise, the set becomes out of order, and operations such as set comparison fail!
 	// To avoid any funny behaviour when iterating the loop, we use the following two sets
@@ -511,7 +513,7 @@ void LocationSet::substitute(Assign& a) {
 	makeDiff(removeAndDelete); // These are to be removed as well
 	makeUnion(insertSet);	   // Insert the items to be added
 	// Now delete the expressions that are no longer needed
-	std::set<Exp*, lessExpStar>::iterator dd;
+	iterator dd;
 	for (dd = removeAndDelete.lset.begin(); dd != removeAndDelete.lset.end();
 	  dd++)
 		delete *dd;				// Plug that memory leak
@@ -659,7 +661,7 @@ Assignment* StatementList::findOnLeft(Exp* loc) {
 }
 
 void LocationSet::diff(LocationSet* o) {
-	std::set<Exp*, lessExpStar>::iterator it;
+	iterator it;
 	bool printed2not1 = false;
 	for (it = o->lset.begin(); it != o->lset.end(); it++) {
 		Exp* oe = *it;
@@ -910,6 +912,85 @@ bool RangeMap::isSubset(RangeMap &other) {
 }
 
 
+//	class BitSet
+
+void BitSet::makeUnion(const BitSet& other) {
+	unsigned n = words.size();
+	for (unsigned i = 0; i < n; i++)
+		words[i] |= other.words[i];
+}
+
+void BitSet::makeDiff(const BitSet& other) {
+	unsigned n = words.size();
+	for (unsigned i = 0; i < n; i++)
+		words[i] &= ~other.words[i];
+}
+
+int BitSet::findFirst(int lo, int hi, int except) const {
+	for (int i = lo / BITS; i * BITS < hi; i++) {
+		Word w = words[i];
+		if (i == lo / BITS)
+			w &= ~(Word)0 << (lo % BITS);
+		if (except / BITS == i && except >= 0)
+			w &= ~((Word)1 << (except % BITS));
+		if (w == 0) continue;
+		int n = i * BITS;
+		while (!(w & 1)) {
+			w >>= 1;
+			n++;
+		}
+		return n < hi ? n : -1;
+	}
+	return -1;
+}
+
+
+//	class LocationNumbering
+
+void LocationNumbering::add(LocationSet& ls) {
+	LocationSet::iterator it;
+	for (it = ls.begin(); it != ls.end(); it++)
+		add(*it);
+}
+
+void LocationNumbering::number() {
+	int n = 0;
+	locs.resize(nums.size());
+	first.resize(nums.size());
+	last.resize(nums.size());
+	std::map<Exp*, int, lessExpStar>::iterator it;
+	for (it = nums.begin(); it != nums.end(); it++, n++) {
+		it->second = n;
+		locs[n] = it->first;
+		first[n] = n;
+		// The same base expression as the previous location? Note: the bases are compared with their own subscripts,
+		// as in LocationSet::findDifferentRef
+		if (n > 0 && locs[n]->isSubscript() && locs[n-1]->isSubscript() &&
+				*locs[n]->getSubExp1() == *locs[n-1]->getSubExp1())
+			first[n] = first[n-1];
+	}
+	for (n = locs.size()-1; n >= 0; n--) {
+		if (n+1 < (int)locs.size() && first[n+1] == first[n])
+			last[n] = last[n+1];
+		else
+			last[n] = n+1;
+	}
+}
+
+int LocationNumbering::find(Exp* loc) {
+	std::map<Exp*, int, lessExpStar>::iterator it = nums.find(loc);
+	if (it == nums.end()) return -1;
+	return it->second;
+}
+
+void LocationNumbering::getLocs(const BitSet& bs, LocationSet& ls) {
+	ls.clear();
+	for (unsigned n = 0; n < locs.size(); n++)
+		if (bs.test(n))
+			ls.insert(locs[n]);
+}
+
+
 //	class ConnectionGraph
 
 void ConnectionGraph::add(Exp* a, Exp* b) {
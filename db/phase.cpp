@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   phase.cpp
+ * OVERVIEW:   Implementation of class Phase
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created, from PhaseMemory (was in region.cpp)
+ * 17 Oct 26 - wallClock moved to util.cpp
+ */
+
+#include <stdio.h>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include "boomerang.h"
+#include "proc.h"
+#include "threads.h"
+#include "util.h"
+#include "region.h"
+#include "phase.h"
+#ifndef NO_GARBAGE_COLLECTOR
+#include "gc.h"
+#endif
+
+bool Phase::active = false;
+volatile long Phase::objects = 0;
+
+struct PhaseTotals {
+	double		time;					// Microseconds
+	size_t		heap;
+	size_t		region;
+	size_t		objects;
+	int			count;
+				PhaseTotals() : time(0), heap(0), region(0), objects(0), count(0) {}
+};
+
+struct TraceEvent {
+	const char*	name;
+	std::string	proc;
+	int			pass;
+	int			tid;
+	double		start, dur;				// Microseconds
+	size_t		heap, region, objects;
+};
+
+static Mutex phaseMutex;							// For all the below
+static std::map<std::string, PhaseTotals> phaseTotals;
+static std::vector<TraceEvent> traceEvents;
+static ThreadLocal<Phase> currentPhase;
+static ThreadLocal<void> threadNumber;				// One more than the number of the thread in the trace
+static volatile int numThreads = 0;
+
+static size_t heapAllocated() {
+#ifndef NO_GARBAGE_COLLECTOR
+	return GC_get_total_bytes();
+#else
+	return 0;
+#endif
+}
+
+void Phase::begin() {
+	outer = currentPhase.get();
+	currentPhase.set(this);
+	nestedHeap = nestedRegion = nestedObjects = 0;
+	heap0 = heapAllocated();
+	region0 = Region::getTotalAllocated();
+	objects0 = (size_t)atomicAdd(&objects, 0);
+	start = wallClock();
+}
+
+void Phase::end() {
+	double dur = wallClock() - start;
+	size_t heap = heapAllocated() - heap0;
+	size_t region = Region::getTotalAllocated() - region0;
+	size_t objs = (size_t)atomicAdd(&objects, 0) - objects0;
+	currentPhase.set(outer);
+	if (outer) {
+		outer->nestedHeap += heap;
+		outer->nestedRegion += region;
+		outer->nestedObjects += objs;
+	}
+	int tid = (int)(size_t)threadNumber.get();
+	if (tid == 0) {
+		tid = atomicIncrement(&numThreads);
+		threadNumber.set((void*)(size_t)tid);
+	}
+
+	MutexLock ml(phaseMutex);
+	PhaseTotals& t = phaseTotals[name];
+	t.time += dur;
+	t.heap += heap - nestedHeap;
+	t.region += region - nestedRegion;
+	t.objects += objs - nestedObjects;
+	t.count++;
+	if (Boomerang::get()->traceFile) {
+		TraceEvent e;
+		e.name = name;
+		if (proc)
+			e.proc = proc->getName();
+		e.pass = pass;
+		e.tid = tid;
+		e.start = start;
+		e.dur = dur;
+		e.heap = heap;
+		e.region = region;
+		e.objects = objs;
+		traceEvents.push_back(e);
+	}
+}
+
+void Phase::report(std::ostream& os) {
+	MutexLock ml(phaseMutex);
+	os << "time and allocations per phase (not including nested phases):\n";
+	os << std::setw(24) << std::left << "phase" << std::right << std::setw(10) << "times" << std::setw(12) << "secs" <<
+		std::setw(16) << "heap bytes" << std::setw(14) << "objects" << std::setw(16) << "region bytes" << "\n";
+	std::map<std::string, PhaseTotals>::iterator it;
+	for (it = phaseTotals.begin(); it != phaseTotals.end(); ++it) {
+		PhaseTotals& t = it->second;
+		os << std::setw(24) << std::left << it->first << std::right << std::setw(10) << t.count << std::setw(12) <<
+			std::fixed << std::setprecision(3) << t.time / 1e6 << std::setw(16) << t.heap << std::setw(14) <<
+			t.objects << std::setw(16) << t.region << "\n";
+	}
+	os.unsetf(std::ios::fixed);
+#ifdef NO_GARBAGE_COLLECTOR
+	os << "(heap bytes and objects are only counted by the garbage collector)\n";
+#endif
+}
+
+// Write s as a JSON string
+static void writeJsonString(FILE* f, const char* s) {
+	fputc('"', f);
+	for (; *s; s++) {
+		unsigned char c = *s;
+		if (c == '"' || c == '\\')
+			fprintf(f, "\\%c", c);
+		else if (c < 0x20)
+			fprintf(f, "\\u%04x", c);
+		else
+			fputc(c, f);
+	}
+	fputc('"', f);
+}
+
+bool Phase::writeTrace(const char* fname) {
+	FILE* f = fopen(fname, "w");
+	if (f == NULL) {
+		std::cerr << "can't write the trace file " << fname << "\n";
+		return false;
+	}
+	MutexLock ml(phaseMutex);
+	double origin = traceEvents.size() ? traceEvents[0].start : 0;
+	std::vector<TraceEvent>::iterator it;
+	for (it = traceEvents.begin(); it != traceEvents.end(); ++it)
+		if (it->start < origin)
+			origin = it->start;
+	fprintf(f, "{\"traceEvents\":[\n");
+	for (it = traceEvents.begin(); it != traceEvents.end(); ++it) {
+		if (it != traceEvents.begin())
+			fprintf(f, ",\n");
+		// A complete event; the name says which proc, so that the phases of different procs are told apart
+		std::string name = it->name;
+		if (it->proc.size())
+			name += " " + it->proc;
+		fprintf(f, "{\"name\":");
+		writeJsonString(f, name.c_str());
+		fprintf(f, ",\"cat\":");
+		writeJsonString(f, it->name);
+		fprintf(f, ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.0f,\"dur\":%.0f,\"args\":{", it->tid,
+			it->start - origin, it->dur);
+		if (it->proc.size()) {
+			fprintf(f, "\"proc\":");
+			writeJsonString(f, it->proc.c_str());
+			fprintf(f, ",");
+		}
+		if (it->pass != -1)
+			fprintf(f, "\"pass\":%d,", it->pass);
+		fprintf(f, "\"heapBytes\":%lu,\"objects\":%lu,\"regionBytes\":%lu}}", (unsigned long)it->heap,
+			(unsigned long)it->objects, (unsigned long)it->region);
+	}
+	fprintf(f, "\n],\"displayTimeUnit\":\"ms\"}\n");
+	return fclose(f) == 0;
+}
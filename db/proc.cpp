@@ -27,6 +27,22 @@
  * 03 Feb 03 - Mike: removeStatement no longer linear searches for the BB
  * 13 Jul 05 - Mike: Fixed a segfault in processDecodedICTs with zero lentgth (!) BBs. Also one in the ad-hoc TA
  * 08 Mar 06 - Mike: fixed use of invalidated iterator in set/map::erase() (thanks, tamlin!)
+ * 17 Oct 26 - Callees owned by another thread under -j are waited for, not decompiled; addCaller is locked
+ * 17 Oct 26 - setName and setSignature tell the Prog, which indexes procs by name
+ * 17 Oct 26 - Procs loaded from a checkpoint read their bodies (and their callers) when first needed
+ * 17 Oct 26 - Switch statements found in middleDecompile are spliced into the CFG, instead of decoding again
+ * 17 Oct 26 - Scratch region for the prover and propagation, released after each pass; bytes allocated per phase
+ * 17 Oct 26 - Phases (time and allocations, per proc and pass) for -M and -gt
+ * 17 Oct 26 - Time and memory budgets: a proc over budget is cut back (fewer passes, no prover, or not analysed)
+ * 17 Oct 26 - releaseBody, for -F
+ * 17 Oct 26 - spliceSwitches updates the dominators incrementally when it can
+ * 17 Oct 26 - spliceSwitches restarts the proc if it has x87 stack code, or with -ns
+ * 17 Oct 26 - setStatus releases the interned expressions of a final proc
+ * 17 Oct 26 - getStatements, fromSSAform and typeAnalysis load the body of a proc from a checkpoint
+ * 17 Oct 26 - With -j, calls to later call graph groups stay childless whatever the timing
+ * 17 Oct 26 - The def-use chains are updated where statements change, and propagateStatements only looks at the
+ *				statements whose references or definitions have changed since the last pass
+ * 17 Oct 26 - printToLog logs at the debug level, and prints nothing when that is not wanted
  */
 
 /*==============================================================================
@@ -51,6 +67,10 @@
 #include "constraint.h"
 #include "visitor.h"
 #include "log.h"
+#include "scheduler.h"
+#include "checkpoint.h"
+#include "phase.h"
+#include "budget.h"
 #include <iomanip>			// For std::setw etc
 #include <sstream>
 #include <cstring>
@@ -115,7 +135,27 @@ const char* Proc::getName() {
  *============================================================================*/
 void Proc::setName(const char *nam) {
 	assert(signature);
+	std::string oldName(signature->getName() ? signature->getName() : "");
 	signature->setName(nam);
+	if (prog)
+		prog->procRenamed(this, oldName.c_str());
+}
+
+/*==============================================================================
+ * FUNCTION:		Proc::setSignature
+ * OVERVIEW:		Set the signature of this procedure, which may rename it
+ * PARAMETERS:		sig - the new signature
+ * RETURNS:			<nothing>
+ *============================================================================*/
+void Proc::setSignature(Signature *sig) {
+	if (signature == NULL || prog == NULL) {
+		signature = sig;
+		return;
+	}
+	std::string oldName(signature->getName() ? signature->getName() : "");
+	signature = sig;
+	if (oldName != (sig->getName() ? sig->getName() : ""))
+		prog->procRenamed(this, oldName.c_str());
 }
 
 
@@ -143,6 +183,7 @@ bool UserProc::isNoReturn()
     // undecoded procs are assumed to always return (and define everything)
     if (!this->isDecoded())
         return false;
+	loadBody();
 
 	PBB exitbb = cfg->getExitBB();
 	if (exitbb == NULL)
@@ -163,6 +204,7 @@ bool UserProc::isNoReturn()
  * RETURNS:		  true if it does
  *============================================================================*/
 bool UserProc::containsAddr(ADDRESS uAddr) {
+	loadBody();
 	BB_IT it;
 	for (PBB bb = cfg->getFirstBB(it); bb; bb = cfg->getNextBB(it))
 		if (bb->getRTLs() && bb->getLowAddr() <= uAddr && bb->getHiAddr() >= uAddr)
@@ -421,7 +463,9 @@ bool LibProc::isPreserved(Exp* e) {
 UserProc::UserProc() : Proc(), cfg(NULL), status(PROC_UNDECODED),
 		// decoded(false), analysed(false),
 		nextLocal(0), nextParam(0),	// decompileSeen(false), decompiled(false), isRecursive(false)
-		cycleGrp(NULL), theReturnStatement(NULL) {
+		cycleGrp(NULL), theReturnStatement(NULL), DFGcount(0), dfaTouched(NULL), dfaVisits(0), dfaMeets(0),
+		dfaChanges(0), inCheckpoint(false), budgetStart(0), budgetHeap(0), degraded(Budget::FULL),
+		defUseValid(false) {
 	localTable.setProc(this);
 }
 UserProc::UserProc(Prog *prog, std::string& name, ADDRESS uNative) :
@@ -430,7 +474,9 @@ UserProc::UserProc(Prog *prog, std::string& name, ADDRESS uNative) :
 		Proc(prog, uNative, new Signature(name.c_str())),
 		cfg(new Cfg()), status(PROC_UNDECODED),
 		nextLocal(0),  nextParam(0),// decompileSeen(false), decompiled(false), isRecursive(false),
-		cycleGrp(NULL), theReturnStatement(NULL), DFGcount(0)
+		cycleGrp(NULL), theReturnStatement(NULL), DFGcount(0), dfaTouched(NULL), dfaVisits(0), dfaMeets(0),
+		dfaChanges(0), inCheckpoint(false), budgetStart(0), budgetHeap(0), degraded(Budget::FULL),
+		defUseValid(false)
 {
 	cfg->setProc(this);				 // Initialise cfg.myProc
 	localTable.setProc(this);
@@ -441,6 +487,19 @@ UserProc::~UserProc() {
 		delete cfg; 
 }
 
+/*==============================================================================
+ * FUNCTION:		UserProc::readBody
+ * OVERVIEW:		Read the body of this proc from the checkpoint that the program was loaded from (see loadBody)
+ *============================================================================*/
+void UserProc::readBody() {
+	prog->getCheckpoint()->loadProc(this);
+}
+
+void Proc::loadCallers() {
+	if (prog && prog->getCheckpoint())
+		prog->getCheckpoint()->loadCallers(this);
+}
+
 /*==============================================================================
  * FUNCTION:		UserProc::deleteCFG
  * OVERVIEW:		Deletes the whole CFG for this proc object. Also clears the
@@ -449,10 +508,21 @@ UserProc::~UserProc() {
  * RETURNS:			<nothing>
  *============================================================================*/
 void UserProc::deleteCFG() {
+	loadBody();
 	delete cfg;
 	cfg = NULL;
 }
 
+void UserProc::releaseBody() {
+	assert(status >= PROC_CODE_GENERATED);
+	cfg->clear();
+	df = DataFlow();
+	invalidateDefUse();
+	scratch.release();
+	if (VERBOSE)
+		LOG << "released the body of " << getName() << "\n";
+}
+
 class lessEvaluate : public std::binary_function<SyntaxNode*, SyntaxNode*, bool> {
 public:
 	bool operator()(const SyntaxNode* x, const SyntaxNode* y) const
@@ -572,6 +642,7 @@ void UserProc::unDecode() {
  * RETURNS:		Pointer to the entry point BB, or NULL if not found
  *============================================================================*/
 PBB UserProc::getEntryBB() {
+	loadBody();
 	return cfg->getEntryBB();
 }
 
@@ -608,10 +679,15 @@ void UserProc::addCallee(Proc* callee) {
 }
 
 void UserProc::generateCode(HLLCode *hll) {
+	loadBody();
 	assert(cfg);
 	assert(getEntryBB());
 
-	cfg->structure();
+	{
+		Phase ph("structure", this);
+		cfg->structure();
+	}
+	Phase ph("generateCode", this);
 	removeUnusedLocals();
 
 	// Note: don't try to remove unused statements here; that requires the
@@ -621,6 +697,11 @@ void UserProc::generateCode(HLLCode *hll) {
 		printToLog();
 
 	hll->AddProcStart(this);
+	if (degraded != Budget::FULL) {
+		std::ostringstream ost;
+		ost << "over budget: " << Budget::levelName(degraded) << " ";
+		hll->AddLineComment((char*)ost.str().c_str());
+	}
 	
 	// Local variables; print everything in the locals map
 	std::map<std::string, Type*>::iterator last = locals.end();
@@ -653,6 +734,7 @@ void UserProc::generateCode(HLLCode *hll) {
 
 // print this userproc, maining for debugging
 void UserProc::print(std::ostream &out, bool html) {
+	loadBody();
 	signature->print(out, html);
 	if (html)
 		out << "<br>";
@@ -682,6 +764,9 @@ void UserProc::print(std::ostream &out, bool html) {
 void UserProc::setStatus(ProcStatus s)
 {
 	status = s;
+	scratch.release();
+	if (s >= PROC_FINAL)
+		Exp::releaseInterned(this);		// Its dataflow is done; don't pin its statements
 	Boomerang::get()->alert_proc_status_change(this);
 }
 
@@ -716,9 +801,11 @@ void UserProc::dump() {
 }
 
 void UserProc::printToLog() {
+	if (!Boomerang::get()->logging(LCAT_DATAFLOW, LL_DEBUG))
+		return;							// Don't print it just to throw it away
 	std::ostringstream ost;
 	print(ost);
-	LOG << ost.str().c_str();
+	LOGC(LCAT_DATAFLOW, LL_DEBUG) << ost.str().c_str();
 }
 
 void UserProc::printDFG() { 
@@ -801,6 +888,7 @@ void UserProc::numberStatements() {
 // get all statements
 // Get to a statement list, so they come out in a reasonable and consistent order
 void UserProc::getStatements(StatementList &stmts) {
+	loadBody();
 	BB_IT it;
 	for (PBB bb = cfg->getFirstBB(it); bb; bb = cfg->getNextBB(it)) 
 		bb->getStatements(stmts);
@@ -838,6 +926,9 @@ void UserProc::removeStatement(Statement *stmt) {
 		++it;			// it is incremented with the erase, or here
 	}
 
+	// Keep the def-use chains of the definitions that stmt uses up to date
+	stmtRemoved(stmt);
+
 	// remove from BB/RTL
 	PBB bb = stmt->getBB();			// Get our enclosing BB
 	std::list<RTL*> *rtls = bb->getRTLs();
@@ -952,6 +1043,7 @@ void UserProc::insertStatementAfter(Statement* s, Statement* a) {
 
 // Decompile this UserProc
 ProcSet* UserProc::decompile(ProcList* path, int& indent) {
+	loadBody();
 	Boomerang::get()->alert_considering(path->empty() ? NULL : path->back(), this);
 	std::cout << std::setw(++indent) << " " << (status >= PROC_VISITED ? "re" : "") << "considering " << getName() <<
 		"\n";
@@ -992,6 +1084,18 @@ ProcSet* UserProc::decompile(ProcList* path, int& indent) {
 				assert(call->isCall());
 				UserProc* c = (UserProc*)call->getDestProc();
 				if (c == NULL || c->isLib()) continue;
+				DecompileScheduler* sched = prog->getScheduler();
+				if (sched && !sched->claim(this, c)) {
+					// c is in another group, which another thread decompiles. Wait for it, unless its group comes
+					// after this one (only possible for call edges found during decompilation, e.g. after switch
+					// analysis): then the call stays childless, however far the other thread has got
+					if (sched->awaitFinal(this, c))
+						call->setCalleeReturn(c->getTheReturnStatement());
+					else
+						LOG << "warning: not waiting for " << c->getName() << " called from " << getName() <<
+							" (its call graph group comes later)\n";
+					continue;
+				}
 				if (c->status == PROC_FINAL) {
 					// Already decompiled, but the return statement still needs to be set for this call
 					call->setCalleeReturn(c->getTheReturnStatement());
@@ -1065,16 +1169,24 @@ ProcSet* UserProc::decompile(ProcList* path, int& indent) {
 		Boomerang::get()->alert_decompiling(this);
 		std::cout << std::setw(indent) << " " << "decompiling " << getName() << "\n";
 		initialiseDecompile();					// Sort the CFG, number statements, etc
-		earlyDecompile();
-		child = middleDecompile(path, indent);
-		// If there is a switch statement, middleDecompile could contribute some cycles. If so, we need to test for
-		// the recursion logic again
-		if (child->size() != 0)
-			// We've just come back out of decompile(), so we've lost the current proc from the path.
-			path->push_back(this);
+		if (Budget::enabled() && Budget::globalExceeded() && degraded < Budget::DECODED) {
+			// Over the global budget before the analysis of this proc has started. Leave it as decoded; its code
+			// will be generated from the RTLs
+			degraded = Budget::DECODED;
+			Budget::degrade(this, degraded, "global budget");
+		} else {
+			earlyDecompile();
+			child = middleDecompile(path, indent);
+			// If there is a switch statement, middleDecompile could contribute some cycles. If so, we need to test
+			// for the recursion logic again
+			if (child->size() != 0)
+				// We've just come back out of decompile(), so we've lost the current proc from the path.
+				path->push_back(this);
+		}
 	}
 	if (child->size() == 0) {
-		remUnusedStmtEtc();	// Do the whole works
+		if (degraded < Budget::DECODED)
+			remUnusedStmtEtc();	// Do the whole works
 		setStatus(PROC_FINAL);
 		Boomerang::get()->alert_end_decompile(this);
 	} else {
@@ -1107,6 +1219,22 @@ ProcSet* UserProc::decompile(ProcList* path, int& indent) {
 	return child;
 }
 
+bool UserProc::overBudget() {
+	if (!Budget::enabled())
+		return false;
+	if (budgetStart == 0) {
+		budgetStart = wallClock();
+		budgetHeap = Budget::heapAllocated();
+	}
+	const char* why;
+	int level = Budget::level(budgetStart, budgetHeap, why);
+	if (level > degraded) {
+		degraded = level;
+		Budget::degrade(this, level, why);
+	}
+	return degraded >= Budget::FEWER_PASSES;
+}
+
 /*	*	*	*	*	*	*	*	*	*	*	*
  *											*
  *		D e c o m p i l e   p r o p e r		*
@@ -1115,6 +1243,8 @@ ProcSet* UserProc::decompile(ProcList* path, int& indent) {
  *	*	*	*	*	*	*	*	*	*	*	*/
 
 void UserProc::initialiseDecompile() {
+	Phase ph("initialiseDecompile", this);
+	overBudget();							// Starts the budget of this proc
 
 	Boomerang::get()->alert_start_decompile(this);
 
@@ -1162,6 +1292,8 @@ void UserProc::earlyDecompile() {
 
 	if (status >= PROC_EARLYDONE)
 		return; 
+	Phase ph("earlyDecompile", this);
+	invalidateDefUse();				// In case this is a restart
 
 	Boomerang::get()->alert_decompile_debug_point(this, "before early");
 	if (VERBOSE) LOG << "early decompile for " << getName() << "\n";
@@ -1206,7 +1338,18 @@ void UserProc::earlyDecompile() {
 	Boomerang::get()->alert_decompile_debug_point(this, "after early");
 }
 
+// True if cfg has any computed jumps not yet analysed as switch statements
+static bool hasComputedJumps(Cfg* cfg) {
+	BB_IT it;
+	for (PBB bb = cfg->getFirstBB(it); bb; bb = cfg->getNextBB(it))
+		if (bb->getType() == COMPJUMP)
+			return true;
+	return false;
+}
+
 ProcSet* UserProc::middleDecompile(ProcList* path, int indent) {
+	Phase ph("middleDecompile", this);
+	invalidateDefUse();				// Built by the first propagation, then kept up to date by the passes
 
 	Boomerang::get()->alert_decompile_debug_point(this, "before middle");
 
@@ -1371,7 +1514,9 @@ ProcSet* UserProc::middleDecompile(ProcList* path, int indent) {
 		Boomerang::get()->alert_decompile_debug_point(this, "after propagating statements");
 
 		// this is just to make it readable, do NOT rely on these statements being removed 
-		removeSpAssignsIfPossible();
+		// Not while there are computed jumps: the code found by analysing them may use the stack pointer
+		if (!hasComputedJumps(cfg))
+			removeSpAssignsIfPossible();
 		// The problem with removing %flags and %CF is that %CF is a subset of %flags
 		//removeMatchingAssignsIfPossible(new Terminal(opFlags));
 		//removeMatchingAssignsIfPossible(new Terminal(opCF));
@@ -1380,8 +1525,12 @@ ProcSet* UserProc::middleDecompile(ProcList* path, int indent) {
 
 		//processTypes();
 
+		scratch.release();		// Nothing allocated in it by this pass is still in use
+
 		if (!change)
 			break;				// Until no change
+		if (overBudget())
+			break;				// Make do with what the passes so far have found
 	}
 
 	// At this point, there will be some memofs that have still not been renamed. They have been prevented from
@@ -1428,17 +1577,32 @@ ProcSet* UserProc::middleDecompile(ProcList* path, int indent) {
 	}
 
 	// Check for indirect jumps or calls not already removed by propagation of constants
-	if (cfg->decodeIndirectJmp(this)) {
-		// There was at least one indirect jump or call found and decoded. That means that most of what has been done
-		// to this function so far is invalid. So redo everything. Very expensive!!
-		// Code pointed to by the switch table entries has merely had FrontEnd::processFragment() called on it
-		LOG << "=== about to restart decompilation of " << getName() <<
-			" because indirect jumps or calls have been analysed\n\n";
-		Boomerang::get()->alert_decompile_debug_point(this, "before restarting decompilation because indirect jumps or calls have been analysed");
-
+	std::list<PBB> decoded;
+	bool computedJumps = hasComputedJumps(cfg);
+	if (cfg->decodeIndirectJmp(this, &decoded)) {
 		// First copy any new indirect jumps or calls that were decoded this time around. Just copy them all, the map
 		// will prevent duplicates
 		processDecodedICTs();
+
+		// If only switch statements were found, decode their arms into this CFG. Only the code that the new code can
+		// reach has to be decoded and analysed again
+		bool onlySwitches = status != PROC_INCYCLE;
+		for (std::list<PBB>::iterator dd = decoded.begin(); dd != decoded.end(); ++dd)
+			if ((*dd)->getType() != COMPJUMP)
+				onlySwitches = false;
+		if (onlySwitches && spliceSwitches(decoded)) {
+			if (VERBOSE)
+				LOG << "=== continuing decompilation of " << getName() << " with the code of " << decoded.size() <<
+					" switch statement(s)\n\n";
+			Boomerang::get()->alert_decompile_debug_point(this, "after splicing switch statements");
+			return middleDecompile(path, indent);
+		}
+
+		// There was at least one indirect call, or the new code needs procs that are not decompiled yet. That means
+		// that most of what has been done to this function so far is invalid. So redo everything. Very expensive!!
+		LOG << "=== about to restart decompilation of " << getName() <<
+			" because indirect jumps or calls have been analysed\n\n";
+		Boomerang::get()->alert_decompile_debug_point(this, "before restarting decompilation because indirect jumps or calls have been analysed");
 		// Now, decode from scratch
 		theReturnStatement = NULL;
 		cfg->clear();
@@ -1454,6 +1618,8 @@ ProcSet* UserProc::middleDecompile(ProcList* path, int indent) {
 		// It is important to keep the result of this call for the recursion analysis
 		return ret;
 	}
+	if (computedJumps)
+		removeSpAssignsIfPossible();		// Was put off while there could be more code
 
 	findPreserveds();
 
@@ -1488,6 +1654,7 @@ ProcSet* UserProc::middleDecompile(ProcList* path, int indent) {
  *	*	*	*	*	*	*	*	*	*	*	*	*	*/
 
 void UserProc::remUnusedStmtEtc() {
+	Phase ph("remUnusedStmtEtc", this);
 
 	// NO! Removing of unused statements is an important part of the global removing unused returns analysis, which
 	// happens after UserProc::decompile is complete
@@ -1508,6 +1675,7 @@ void UserProc::remUnusedStmtEtc() {
 	// to printf/scanf), and removing unused statements is unsafe without full use information
 	if (status < PROC_FINAL) {
 		typeAnalysis();
+		invalidateDefUse();					// Types and symbols have changed
 		// Now that locals are identified, redo the dataflow
 		bool change = df.placePhiFunctions(this);
 		if (change) numberStatements();		// Number the new statements
@@ -1588,77 +1756,71 @@ void UserProc::remUnusedStmtEtc() {
 	Boomerang::get()->alert_decompile_debug_point(this, "after final");
 }
 
+// Can s be removed if it is unused?
+bool UserProc::isRemovableIfUnused(Statement* s) {
+	if (!s->isAssignment())
+		// Never delete a statement other than an assignment (e.g. nothing "uses" a Jcond)
+		return false;
+	Exp* asLeft = ((Assignment*)s)->getLeft();
+	if (asLeft && asLeft->getOper() == opGlobal)
+		// assignments to globals must always be kept
+		return false;
+	// If it's a memof and renameable it can still be deleted
+	if (asLeft->getOper() == opMemOf && !canRename(asLeft))
+		// Assignments to memof-anything-but-local must always be kept.
+		return false;
+	if (asLeft->getOper() == opMemberAccess || asLeft->getOper() == opArrayIndex)
+		// can't say with these; conservatively never remove them
+		return false;
+	return true;
+}
+
 void UserProc::remUnusedStmtEtc(RefCounter& refCounts) {
 	
 	Boomerang::get()->alert_decompile_debug_point(this, "before remUnusedStmtEtc");
 
 	StatementList stmts;
 	getStatements(stmts);
-	bool change;
-	do {								// FIXME: check if this is ever needed
-		change = false;
-		StatementList::iterator ll = stmts.begin();
-		while (ll != stmts.end()) {
-			Statement* s = *ll;
-			if (!s->isAssignment()) {
-				// Never delete a statement other than an assignment (e.g. nothing "uses" a Jcond)
-				ll++;
-				continue;
-			}
-			Assignment* as = (Assignment*)s;
-			Exp* asLeft = as->getLeft();
-			// If depth < 0, consider all depths
-			//if (asLeft && depth >= 0 && asLeft->getMemDepth() > depth) {
-			//	ll++;
-			//	continue;
-			//}
-			if (asLeft && asLeft->getOper() == opGlobal) {
-				// assignments to globals must always be kept
-				ll++;
-				continue;
-			}
-			// If it's a memof and renameable it can still be deleted
-			if (asLeft->getOper() == opMemOf && !canRename(asLeft)) {
-				// Assignments to memof-anything-but-local must always be kept.
-				ll++;
-				continue;
-			}
-			if (asLeft->getOper() == opMemberAccess || asLeft->getOper() == opArrayIndex) {
-				// can't say with these; conservatively never remove them
-				ll++;
-				continue;
+	// A worklist of unused statements. Removing one can make the statements that it uses unused, and only those need to
+	// be considered again
+	StatementSet live;					// Statements not (yet) removed
+	std::list<Statement*> work;
+	StatementList::iterator ll;
+	for (ll = stmts.begin(); ll != stmts.end(); ll++) {
+		live.insert(*ll);
+		if ((refCounts.find(*ll) == refCounts.end() || refCounts[*ll] == 0) && isRemovableIfUnused(*ll))
+			work.push_back(*ll);
+	}
+	while (!work.empty()) {
+		Statement* s = work.front();
+		work.pop_front();
+		if (!live.exists(s)) continue;
+		// First adjust the counts, due to statements only referenced by statements that are themselves unused.
+		// Need to be careful not to count two refs to the same def as two; refCounts is a count of the number
+		// of statements that use a definition, not the total number of refs
+		StatementSet stmtsRefdByUnused;
+		LocationSet components;
+		s->addUsedLocs(components, false);		// Second parameter false to ignore uses in collectors
+		LocationSet::iterator cc;
+		for (cc = components.begin(); cc != components.end(); cc++) {
+			if ((*cc)->isSubscript()) {
+				stmtsRefdByUnused.insert(((RefExp*)*cc)->getDef());
 			}
-			if (refCounts.find(s) == refCounts.end() || refCounts[s] == 0) {	// Care not to insert unnecessarily
-				// First adjust the counts, due to statements only referenced by statements that are themselves unused.
-				// Need to be careful not to count two refs to the same def as two; refCounts is a count of the number
-				// of statements that use a definition, not the total number of refs
-				StatementSet stmtsRefdByUnused;
-				LocationSet components;
-				s->addUsedLocs(components, false);		// Second parameter false to ignore uses in collectors
-				LocationSet::iterator cc;
-				for (cc = components.begin(); cc != components.end(); cc++) {
-					if ((*cc)->isSubscript()) {
-						stmtsRefdByUnused.insert(((RefExp*)*cc)->getDef());
-					}
-				}
-				StatementSet::iterator dd;
-				for (dd = stmtsRefdByUnused.begin(); dd != stmtsRefdByUnused.end(); dd++) {
-					if (*dd == NULL) continue;
-					if (DEBUG_UNUSED)
-						LOG << "decrementing ref count of " << (*dd)->getNumber() << " because " << s->getNumber() <<
-							" is unused\n";
-					refCounts[*dd]--;
-				}
-				if (DEBUG_UNUSED)
-					LOG << "removing unused statement " << s->getNumber() << " " << s << "\n";
-				removeStatement(s);
-				ll = stmts.erase(ll);	// So we don't try to re-remove it
-				change = true;
-				continue;				// Don't call getNext this time
-			}
-			ll++;
 		}
-	} while (change);
+		StatementSet::iterator dd;
+		for (dd = stmtsRefdByUnused.begin(); dd != stmtsRefdByUnused.end(); dd++) {
+			if (*dd == NULL) continue;
+			if (DEBUG_UNUSED)
+				LOG << "decrementing ref count of " << (*dd)->getNumber() << " because " << s->getNumber() <<
+					" is unused\n";
+			if (--refCounts[*dd] == 0 && live.exists(*dd) && isRemovableIfUnused(*dd))
+				work.push_back(*dd);
+		}
+		if (DEBUG_UNUSED)
+			LOG << "removing unused statement " << s->getNumber() << " " << s << "\n";
+		removeStatement(s);
+		live.remove(s);			// So we don't try to re-remove it
+	}
 	// Recaluclate at least the livenesses. Example: first call to printf in test/pentium/fromssa2, eax used only in a
 	// removed statement, so liveness in the call needs to be removed
 	removeCallLiveness();		// Kill all existing livenesses
@@ -1669,6 +1831,7 @@ void UserProc::remUnusedStmtEtc(RefCounter& refCounts) {
 }
 
 void UserProc::recursionGroupAnalysis(ProcList* path, int indent) {
+	Phase ph("recursionGroupAnalysis");		// Only what the per proc phases of the group don't count
 	/* Overall algorithm:
 		for each proc in the group
 			initialise
@@ -1722,6 +1885,7 @@ void UserProc::recursionGroupAnalysis(ProcList* path, int indent) {
 		//(*p)->initialParameters();					// FIXME: I think this needs to be mapping locals and params now
 		(*p)->mapLocalsAndParams();
 		(*p)->updateArguments();
+		(*p)->invalidateDefUse();
 		(*p)->propagateStatements(convert, 0);		// Need to propagate into arguments
 	}
 
@@ -1855,6 +2019,7 @@ void UserProc::fixUglyBranches() {
 }
 
 bool UserProc::doRenameBlockVars(int pass, bool clearStacks) {
+	Phase ph("doRenameBlockVars", this, pass);
 	if (VERBOSE)
 		LOG << "### rename block vars for " << getName() << " pass " << pass << ", clear = " << clearStacks << " ###\n";
 	bool b = df.renameBlockVars(this, 0, clearStacks);
@@ -1896,6 +2061,7 @@ void UserProc::findSpPreservation() {
 }
 
 void UserProc::findPreserveds() {
+	Phase ph("findPreserveds", this);
 	std::set<Exp*> removes;
 
 	if (VERBOSE)
@@ -2335,6 +2501,7 @@ void Proc::removeParameter(Exp *e) {
 	int n = signature->findParam(e);
 	if (n != -1) {
 		signature->removeParameter(n);
+		loadCallers();
 		for (std::set<CallStatement*>::iterator it = callerSet.begin(); it != callerSet.end(); it++) {
 			if (DEBUG_UNUSED)
 				LOG << "removing argument " << e << " in pos " << n << " from " << *it << "\n";
@@ -2678,25 +2845,42 @@ bool UserProc::removeNullStatements() {
 
 // Propagate statements, but don't remove
 // Return true if change; set convert if an indirect call is converted to direct (else clear)
+// Only the statements in dirty are looked at: those whose references have changed, or whose definitions have changed
+// or lost uses (which can lift the -l limit), since the last pass
 bool UserProc::propagateStatements(bool& convert, int pass) {
+	Phase ph("propagateStatements", this, pass);
 	if (VERBOSE)
 		LOG << "--- begin propagating statements pass " << pass << " ---\n";
 	StatementList stmts;
 	getStatements(stmts);
 	// propagate any statements that can be
 	StatementList::iterator it;
-	// Find the locations that are used by a live, dominating phi-function
-	LocationSet usedByDomPhi;
-	findLiveAtDomPhi(usedByDomPhi);
-	// Next pass: count the number of times each assignment LHS would be propagated somewhere
-	std::map<Exp*, int, lessExpStar> destCounts;
-	// Also maintain a set of locations which are used by phi statements
-	for (it = stmts.begin(); it != stmts.end(); it++) {
-		Statement* s = *it;
-		ExpDestCounter edc(destCounts);
-		StmtDestCounter sdc(&edc);
-		s->accept(&sdc);
-	}
+	if (!defUseValid) {
+		buildDefUse(stmts);
+		for (it = stmts.begin(); it != stmts.end(); it++)
+			dirty.insert(*it);
+		defUseValid = true;
+	}
+	// The collectors of calls and returns are not in the chains, and their arguments and returns are rebuilt between
+	// passes, so always look at them again
+	for (it = stmts.begin(); it != stmts.end(); it++)
+		if ((*it)->isCall() || (*it)->isReturn())
+			updateUses(*it);
+	// Find the locations that are used by a live, dominating phi-function. Only the experimental propagation limiting
+	// heuristic uses these
+	LocationSet usedByDomPhi(&scratch);
+	if (EXPERIMENTAL) {
+		findLiveAtDomPhi(usedByDomPhi);
+		for (it = stmts.begin(); it != stmts.end(); it++)
+			dirty.insert(*it);				// The heuristic depends on more than the def-use chains
+	}
+	// The def-use chains give the number of times each assignment would be propagated somewhere (for the -l limit).
+	// The counts must be those from before any propagation of this pass, so the chains of the statements that change
+	// are only updated at the end. Their users are marked dirty straight away, so that later statements see the
+	// change in this pass
+	StatementList changed, phis;
+	StatementSet changedSet;
+	int looked = 0;
 #if USE_DOMINANCE_NUMS
 	// A third pass for dominance numbers
 	setDominanceNumbers();
@@ -2705,23 +2889,127 @@ bool UserProc::propagateStatements(bool& convert, int pass) {
 	bool change = false;
 	for (it = stmts.begin(); it != stmts.end(); it++) {
 		Statement* s = *it;
-		if (s->isPhi()) continue;
-		change |= s->propagateFlagsTo();
+		if (s->isPhi() || !dirty.exists(s)) continue;
+		if (!s->usesAssign() && !s->isCall() && !s->isReturn()) {
+			// Nothing can be propagated here (calls and returns can also be propagated to via their collectors)
+			s->simplify();
+			continue;
+		}
+		if (s->propagateFlagsTo()) {
+			change = true;
+			if (!changedSet.exists(s)) {
+				changedSet.insert(s);
+				changed.append(s);
+			}
+			markUsersDirty(s);
+		}
 	}
 	// Finally the actual propagation
 	convert = false;
 	for (it = stmts.begin(); it != stmts.end(); it++) {
 		Statement* s = *it;
-		if (s->isPhi()) continue;
-		change |= s->propagateTo(convert, &destCounts, &usedByDomPhi);
+		if (!dirty.remove(s)) continue;
+		if (s->isPhi()) {
+			phis.append(s);					// Simplified (perhaps to an assignment) with the changed statements
+			continue;
+		}
+		if (!s->usesAssign() && !s->isCall() && !s->isReturn() && !changedSet.exists(s))
+			continue;
+		looked++;
+		if (s->propagateTo(convert, true, EXPERIMENTAL ? &usedByDomPhi : NULL)) {
+			change = true;
+			if (!changedSet.exists(s)) {
+				changedSet.insert(s);
+				changed.append(s);
+			}
+			markUsersDirty(s);
+		}
 	}
-	simplify();
 	propagateToCollector();
+	// Bring the chains of the changed statements up to date (this also marks them dirty again, since the new
+	// references may be propagated into in turn), then simplify their BBs (e.g. for branches that are now constant)
+	// and those of the phi functions that have changed
+	std::list<PBB> changedBBs;
+	std::set<PBB> seenBBs;
+	for (it = changed.begin(); it != changed.end(); it++) {
+		updateUses(*it);
+		PBB bb = (*it)->getBB();
+		if (bb && seenBBs.insert(bb).second)
+			changedBBs.push_back(bb);
+	}
+	for (it = phis.begin(); it != phis.end(); it++) {
+		PBB bb = (*it)->getBB();
+		if (bb && seenBBs.insert(bb).second)
+			changedBBs.push_back(bb);
+	}
+	for (std::list<PBB>::iterator bb = changedBBs.begin(); bb != changedBBs.end(); bb++)
+		(*bb)->simplify();
+	for (it = phis.begin(); it != phis.end(); it++)
+		if (!(*it)->isPhi())
+			stmtChanged(*it);			// Converted to an assignment, so it can now be propagated
+	if (convert)
+		invalidateDefUse();				// Calls have changed kind; start again
 	if (VERBOSE)
-		LOG << "=== end propagating statements at pass " << pass << " ===\n";
+		LOG << "=== end propagating statements at pass " << pass << " (" << (int)changed.size() << " of " << looked <<
+			" statements looked at changed, " << (int)stmts.size() << " statements) ===\n";
 	return change;
 }	// propagateStatements
 
+void UserProc::buildDefUse(StatementList& stmts) {
+	StatementList::iterator it;
+	// Clear the old chains, including those of any definitions that are not in stmts
+	for (it = stmts.begin(); it != stmts.end(); it++) {
+		(*it)->clearUsers();
+		(*it)->findUsedDefs();
+	}
+	std::vector<Statement*>::iterator dd;
+	for (it = stmts.begin(); it != stmts.end(); it++)
+		for (dd = (*it)->getUsedDefs().begin(); dd != (*it)->getUsedDefs().end(); ++dd)
+			(*dd)->clearUsers();
+	for (it = stmts.begin(); it != stmts.end(); it++)
+		(*it)->addDefUses();
+}
+
+void UserProc::stmtChanged(Statement* s) {
+	if (!defUseValid) return;
+	updateUses(s);
+	markUsersDirty(s);
+}
+
+void UserProc::stmtRemoved(Statement* s) {
+	dirty.remove(s);
+	if (!defUseValid) {
+		s->removeDefUses();
+		return;
+	}
+	std::vector<Statement*> oldDefs(s->getUsedDefs());
+	s->removeDefUses();
+	noteFewerUses(oldDefs);
+}
+
+// Recompute the definitions that s uses, and mark s dirty
+void UserProc::updateUses(Statement* s) {
+	std::vector<Statement*> oldDefs(s->getUsedDefs());
+	s->updateDefUses();
+	dirty.insert(s);
+	noteFewerUses(oldDefs);
+}
+
+// Some uses of defs have gone. A definition that is now used only once is no longer held back by the -l limit, so
+// its user has to be looked at again
+void UserProc::noteFewerUses(std::vector<Statement*>& defs) {
+	std::vector<Statement*>::iterator dd;
+	for (dd = defs.begin(); dd != defs.end(); ++dd)
+		if ((*dd)->getNumUses() == 1)
+			markUsersDirty(*dd);
+}
+
+void UserProc::markUsersDirty(Statement* s) {
+	std::multiset<Statement*>::iterator uu;
+	for (uu = s->getUsers().begin(); uu != s->getUsers().end(); ++uu)
+		dirty.insert(*uu);
+}
+
 Statement *UserProc::getStmtAtLex(unsigned int begin, unsigned int end)
 {
 	StatementList stmts;
@@ -3030,6 +3318,8 @@ void UserProc::removeUnusedLocals() {
 //
 
 void UserProc::fromSSAform() {
+	loadBody();
+	Phase ph("fromSSAform", this);
     Boomerang::get()->alert_decompiling(this);
 
 	if (VERBOSE)
@@ -3379,6 +3669,12 @@ static Binary allEqAll(opEquals,
 
 // this function was non-reentrant, but now reentrancy is frequently used
 bool UserProc::prove(Exp *query, bool conditional /* = false */) {
+	Phase ph("prove", this);
+	if (Budget::enabled()) {
+		overBudget();
+		if (degraded >= Budget::NO_PROVER)
+			return false;					// Over budget; not proving anything is safe (just less precise)
+	}
 
 	assert(query->isEquality());
 	Exp* queryLeft = ((Binary*)query)->getSubExp1();
@@ -3403,7 +3699,7 @@ bool UserProc::prove(Exp *query, bool conditional /* = false */) {
 
 	
 	// subscript locs on the right with {-} (NULL reference)
-	LocationSet locs;
+	LocationSet locs(&scratch);
 	query->getSubExp2()->addUsedLocs(locs);
 	LocationSet::iterator xx;
 	for (xx = locs.begin(); xx != locs.end(); xx++) {
@@ -3442,8 +3738,8 @@ bool UserProc::prove(Exp *query, bool conditional /* = false */) {
 							//	then save the original query as a premise for bypassing calls
 		recurPremises[origLeft->clone()] = origRight;
 
-	std::set<PhiAssign*> lastPhis;
-	std::map<PhiAssign*, Exp*> cache;
+	ProverPhiSet lastPhis(std::less<PhiAssign*>(), &scratch);
+	ProverCache cache(std::less<PhiAssign*>(), &scratch);
 	bool result = prover(query, lastPhis, cache, original);
 	if (cycleGrp)
 		recurPremises.erase(origLeft);			// Remove the premise, regardless of result
@@ -3461,10 +3757,11 @@ bool UserProc::prove(Exp *query, bool conditional /* = false */) {
 	return result;
 }
 
-bool UserProc::prover(Exp *query, std::set<PhiAssign*>& lastPhis, std::map<PhiAssign*, Exp*> &cache, Exp* original,
+bool UserProc::prover(Exp *query, ProverPhiSet& lastPhis, ProverCache &cache, Exp* original,
 		PhiAssign* lastPhi /* = NULL */) {
 	// A map that seems to be used to detect loops in the call graph:
-	std::map<CallStatement*, Exp*> called;
+	std::map<CallStatement*, Exp*, std::less<CallStatement*>, RegionAllocator<std::pair<CallStatement* const, Exp*> > >
+		called(std::less<CallStatement*>(), &scratch);
 	Exp *phiInd = query->getSubExp2()->clone();
 
 	if (lastPhi && cache.find(lastPhi) != cache.end() && *cache[lastPhi] == *phiInd) {
@@ -3473,7 +3770,8 @@ bool UserProc::prover(Exp *query, std::set<PhiAssign*>& lastPhis, std::map<PhiAs
 		return true;
 	} 
 
-	std::set<Statement*> refsTo;
+	typedef std::set<Statement*, std::less<Statement*>, RegionAllocator<Statement*> > ScratchStmtSet;
+	ScratchStmtSet refsTo(std::less<Statement*>(), &scratch);
 
 	query = query->clone();
 	bool change = true;
@@ -3635,7 +3933,7 @@ bool UserProc::prover(Exp *query, std::set<PhiAssign*>& lastPhis, std::map<PhiAs
 					if (s && refsTo.find(s) != refsTo.end()) {
 						LOG << "detected ref loop " << s << "\n";
 						LOG << "refsTo: ";
-						std::set<Statement*>::iterator ll;
+						ScratchStmtSet::iterator ll;
 						for (ll = refsTo.begin(); ll != refsTo.end(); ++ll)
 							LOG << (*ll)->getNumber() << ", ";
 						LOG << "\n";
@@ -3718,7 +4016,22 @@ void UserProc::getDefinitions(LocationSet& ls) {
 	}
 }
 
+void Proc::addCaller(CallStatement* caller) {
+	if (prog == NULL) {						// E.g. while loading from XML
+		callerSet.insert(caller);
+		return;
+	}
+	MutexLock ml(prog->getLock());			// Callers may be in procs decompiled by other threads
+	callerSet.insert(caller);
+}
+
+void Proc::removeCaller(CallStatement* caller) {
+	MutexLock ml(prog->getLock());
+	callerSet.erase(caller);
+}
+
 void Proc::addCallers(std::set<UserProc*>& callers) {
+	loadCallers();
 	std::set<CallStatement*>::iterator it;
 	for (it = callerSet.begin(); it != callerSet.end(); it++) {
 		UserProc* callerProc = (*it)->getProc();
@@ -4143,6 +4456,7 @@ void UserProc::reverseStrengthReduction()
 									(*it2)->searchAndReplace(r, new Binary(opMult, r->clone(), new Const(c)));
 							// that done we can replace c with 1 in as
 							((Const*)as->getRight()->getSubExp2())->setInt(1);
+							invalidateDefUse();
 						}
 					}
 				}
@@ -4355,6 +4669,7 @@ void UserProc::fixCallAndPhiRefs() {
 		if (s->isPhi()) {
 			PhiAssign* ps = (PhiAssign*)s;
 			RefExp* r = new RefExp(ps->getLeft(), ps);
+			bool erased = false;
 			for (PhiAssign::iterator p = ps->begin(); p != ps->end(); ) {
 				if (p->e == NULL) {						// Can happen due to PhiAssign::setAt
 					++p;
@@ -4363,6 +4678,7 @@ void UserProc::fixCallAndPhiRefs() {
 				Exp* current = new RefExp(p->e, p->def);
 				if (*current == *r) {					// Will we ever see this?
 					p = ps->erase(p);					// Erase this phi parameter
+					erased = true;
 					continue;
 				}
 				// Chase the definition
@@ -4374,11 +4690,14 @@ void UserProc::fixCallAndPhiRefs() {
 					Exp* rhs = ((Assign*)p->def)->getRight();
 					if (*rhs == *r) {					// Check if RHS is a single reference to ps
 						p = ps->erase(p);				// Yes, erase this phi parameter
+						erased = true;
 						continue;
 					}
 				}
 				++p;
 			}
+			if (erased)
+				stmtChanged(ps);
 		}
 	}
 		
@@ -4391,6 +4710,7 @@ void UserProc::fixCallAndPhiRefs() {
 														// involved in a recursion group
 			Exp* lhs = ps->getLeft();
 			bool allSame = true;
+			bool modified = false;
 			// Let first be a reference built from the first parameter
 			PhiAssign::iterator p = ps->begin();
 			while (p->e == NULL && p != ps->end())
@@ -4405,9 +4725,11 @@ void UserProc::fixCallAndPhiRefs() {
 			first = first->propagateAll();				// Propagate everything repeatedly
 			if (cb.isMod()) {						// Modified? 
 				// if first is of the form lhs{x}
-				if (first->isSubscript() && *((RefExp*)first)->getSubExp1() == *lhs)
+				if (first->isSubscript() && *((RefExp*)first)->getSubExp1() == *lhs) {
 					// replace first with x
+					modified |= p->def != ((RefExp*)first)->getDef();
 					p->def = ((RefExp*)first)->getDef();
+				}
 			}
 			// For each parameter p of ps after the first
 			for (++p; p != ps->end(); ++p) {
@@ -4420,9 +4742,11 @@ void UserProc::fixCallAndPhiRefs() {
 				current = current->propagateAll();
 				if (cb2.isMod()	)					// Modified?
 					// if current is of the form lhs{x}
-					if (current->isSubscript() && *((RefExp*)current)->getSubExp1() == *lhs)
+					if (current->isSubscript() && *((RefExp*)current)->getSubExp1() == *lhs) {
 						// replace current with x
+						modified |= p->def != ((RefExp*)current)->getDef();
 						p->def = ((RefExp*)current)->getDef();
+					}
 				if (!(*first == *current))
 					allSame = false;
 			}
@@ -4446,11 +4770,15 @@ void UserProc::fixCallAndPhiRefs() {
 					// If p->def is a call, this is the worst case; keep only (via first) if all parameters are calls
 				}
 				ps->convertToAssign(best);
+				modified = true;
 				if (VERBOSE)
 					LOG << "redundant phi replaced with copy assign; now " << ps << "\n";
 			}
+			if (modified)
+				stmtChanged(ps);
 		} else {	// Ordinary statement
-			s->bypass();
+			if (s->bypass())
+				stmtChanged(s);
 		}
 	}
 
@@ -4905,6 +5233,7 @@ bool UserProc::removeRedundantReturns(std::set<UserProc*>& removeRetSet) {
 
 	if (removedParams || removedRets) {
 		// Update the statements that call us
+		loadCallers();
 		std::set<CallStatement*>::iterator it;
 		for (it = callerSet.begin(); it != callerSet.end() ; it++) {
 			(*it)->updateArguments();				// Update caller's arguments
@@ -5013,6 +5342,8 @@ void UserProc::clearUses() {
 }
 
 void UserProc::typeAnalysis() {
+	loadBody();
+	invalidateDefUse();
 	if (VERBOSE)
 		LOG << "### type analysis for " << getName() << " ###\n";
 
@@ -5030,6 +5361,7 @@ void UserProc::typeAnalysis() {
 		bool first = true;
 		do {
 			if (!first) {
+				invalidateDefUse();					// Types (and with ellipsis processing, calls) have changed
 				doRenameBlockVars(-1, true);		// Subscript the discovered extra parameters
 				//propagateAtDepth(maxDepth);		// Hack: Can sometimes be needed, if call was indirect
 				bool convert;
@@ -5181,6 +5513,128 @@ void UserProc::processDecodedICTs() {
 	}
 }
 
+// True if bb has statements that have been numbered, i.e. that were there when the proc was initialised
+static bool hasNumberedStmts(PBB bb) {
+	BasicBlock::rtlit rit; StatementList::iterator sit;
+	for (Statement* s = bb->getFirstStmt(rit, sit); s; s = bb->getNextStmt(rit, sit))
+		if (s->getNumber() != 0)
+			return true;
+	return false;
+}
+
+/*==============================================================================
+ * FUNCTION:		UserProc::spliceSwitches
+ * OVERVIEW:		Decode the arms of switch statements found by middleDecompile into this CFG, instead of decoding and
+ *					  decompiling the whole proc again. The old BBs that the new code can reach (usually the code after
+ *					  the switch, or the head of a loop around it) may have new reaching definitions, which propagation
+ *					  has lost track of; those BBs are decoded again. The rest of the old code (its statements, phi
+ *					  functions and propagations, and the proven preservations if the exit is not reached) is kept: no
+ *					  new path reaches it, so its dominators and definitions are unchanged. The new code is then
+ *					  numbered, renamed and propagated as in initialiseDecompile and earlyDecompile
+ * PARAMETERS:		switches: the BBs whose computed jumps have just been analysed as switch statements
+ * RETURNS:			False if the proc has to be decompiled again from scratch: the new code calls procs that are not
+ *					  decompiled yet (that needs the recursion logic in decompile()), or it reaches the entry BB. The CFG
+ *					  is then only fit for clearing. Also false, before anything is changed, with -ns, or if the front end
+ *					  can't decode fragments of this proc (Pentium x87 stack code: see canDecodeFragment)
+ *============================================================================*/
+bool UserProc::spliceSwitches(std::list<PBB>& switches) {
+	if (Boomerang::get()->noSplice || !prog->canDecodeFragment(this))
+		return false;
+	std::set<PBB> old(cfg->begin(), cfg->end());
+	std::list<PBB>::iterator ss;
+	for (ss = switches.begin(); ss != switches.end(); ++ss)
+		(*ss)->processSwitch(this);			// Set the out edges, and decode the arms
+
+	// The new code is in the new BBs with no numbered statements; the others are the bottom halves of old BBs that
+	// the new code jumps into. Find the old code reachable from the new
+	std::set<PBB> reached, redecode;
+	std::list<PBB> work;
+	BB_IT it;
+	PBB bb;
+	for (bb = cfg->getFirstBB(it); bb; bb = cfg->getNextBB(it))
+		if (old.find(bb) == old.end() && !hasNumberedStmts(bb)) {
+			reached.insert(bb);
+			work.push_back(bb);
+		}
+	std::set<PBB> fresh(reached);
+	while (work.size()) {
+		bb = work.front();
+		work.pop_front();
+		std::vector<PBB>& outs = bb->getOutEdges();
+		for (unsigned i=0; i < outs.size(); i++)
+			if (reached.insert(outs[i]).second) {
+				work.push_back(outs[i]);
+				if (fresh.find(outs[i]) == fresh.end())
+					redecode.insert(outs[i]);
+			}
+	}
+	if (redecode.find(cfg->getEntryBB()) != redecode.end())
+		return false;
+
+	ReturnStatement* oldReturn = theReturnStatement;
+	if (redecode.size()) {
+		std::set<ADDRESS> entries;
+		if (!cfg->removeForRedecode(redecode, entries))
+			return false;
+		if (VERBOSE)
+			LOG << "decoding " << (int)redecode.size() << " BBs of " << getName() << " again\n";
+		// Forget the calls and the return statement of the removed BBs
+		std::set<PBB>::iterator rr;
+		for (rr = redecode.begin(); rr != redecode.end(); ++rr) {
+			BasicBlock::rtlit rit; StatementList::iterator sit;
+			for (Statement* s = (*rr)->getFirstStmt(rit, sit); s; s = (*rr)->getNextStmt(rit, sit)) {
+				if (s->isCall()) {
+					CallStatement* call = (CallStatement*)s;
+					cfg->getCalls().erase(call);
+					if (call->getDestProc())
+						call->getDestProc()->removeCaller(call);
+				} else if (s == theReturnStatement)
+					theReturnStatement = NULL;		// Decoding the return instruction again makes a new one
+			}
+		}
+		std::set<ADDRESS>::iterator ee;
+		for (ee = entries.begin(); ee != entries.end(); ++ee)
+			prog->decodeFragment(this, *ee);
+		setEntryBB();							// Also finds the exit BB
+	}
+
+	// The calls in the new code must be to procs that are already decompiled. With -j, also to procs that decompile()
+	// would wait for, so that whether this splices doesn't change the result with the timing of the other threads
+	DecompileScheduler* sched = prog->getScheduler();
+	for (bb = cfg->getFirstBB(it); bb; bb = cfg->getNextBB(it)) {
+		if (old.find(bb) != old.end() || hasNumberedStmts(bb)) continue;
+		BasicBlock::rtlit rit; StatementList::iterator sit;
+		for (Statement* s = bb->getFirstStmt(rit, sit); s; s = bb->getNextStmt(rit, sit)) {
+			if (!s->isCall()) continue;
+			CallStatement* call = (CallStatement*)s;
+			Proc* dest = call->getDestProc();
+			if (dest == NULL || dest->isLib()) continue;
+			UserProc* c = (UserProc*)dest;
+			if (c->status != PROC_FINAL || (sched && !sched->mayWaitFor(this, c)))
+				return false;
+			call->setCalleeReturn(c->getTheReturnStatement());
+		}
+	}
+
+	// Bring the new code up to the state of the rest
+	invalidateDefUse();
+	if (theReturnStatement != oldReturn)
+		provenTrue.clear();						// New paths reach the exit
+	cfg->sortByAddress();
+	initStatements();
+	if (!df.updateDominators(cfg))				// Incrementally, if the CFG has only grown
+		df.dominators(cfg);
+	numberStatements();
+	df.setRenameLocalsParams(false);			// No memofs in the new code until the stack pointer is propagated
+	updateCallDefines();
+	if (df.placePhiFunctions(this))
+		numberStatements();
+	doRenameBlockVars(1, true);
+	bool convert;
+	propagateStatements(convert, 1);
+	return true;
+}
+
 // Find or insert a new implicit reference just before statement s, for address expression a with type t.
 // Meet types if necessary
 void UserProc::setImplicitRef(Statement* s, Exp* a, Type* ty) {
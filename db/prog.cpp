@@ -23,6 +23,15 @@
  * 20 Jul 04 - Mike: Got rid of BOOMDIR
  * 03 Mar 06 - tamlin: prevent arrays from crossing section boundaries
  * 20 Mar 11 - Mike: Added missing braces in Prog::getFloatConstant()
+ * 17 Oct 26 - Parallel decompilation (-j) using the DecompileScheduler; lock the shared state
+ * 17 Oct 26 - getStringConstant uses BinaryFile::readRange
+ * 17 Oct 26 - Globals are indexed by address and by name (findGlobalContaining, getGlobal); was a linear search
+ * 17 Oct 26 - Procs are indexed by position, name and address range (getProc, findProc, findContainingProc)
+ * 17 Oct 26 - A Prog loaded from a checkpoint owns it; the ranges of procs not yet read come from it
+ * 17 Oct 26 - Unused returns are not removed once over the global budget
+ * 17 Oct 26 - Code generation streams each proc's code to its file; the files are generated in parallel with -j
+ * 17 Oct 26 - canDecodeFragment
+ * 17 Oct 26 - The intern table is emptied once the dataflow of the whole program is done
  */
 
 /*==============================================================================
@@ -45,6 +54,7 @@
 #include <cstring>
 #include <stdlib.h>
 #include <vector>
+#include <algorithm>					// For std::find
 #include <math.h>
 #ifdef _WIN32
 #include <direct.h>					// For Windows mkdir()
@@ -69,6 +79,9 @@
 #include "config.h"
 #include "managed.h"
 #include "log.h"
+#include "scheduler.h"
+#include "checkpoint.h"
+#include "budget.h"
 
 #ifdef _WIN32
 #undef NO_ADDRESS
@@ -85,11 +98,26 @@ namespace dbghelp {
 #include <sys/stat.h>
 #include <sys/types.h>
 
+// A hash of the name of a global or proc, for Prog::globalsByName and procsByName (FNV-1a)
+static unsigned hashName(const char* nam) {
+	unsigned h = 2166136261u;
+	if (nam == NULL) return h;
+	while (*nam) {
+		h ^= (unsigned char)*nam++;
+		h *= 16777619u;
+	}
+	return h;
+}
+
 Prog::Prog() :
 		pBF(NULL),
 		pFE(NULL),
+		maxProcRange(0),
+		maxGlobalSize(0),
 		m_iNumberedProc(1),
-		m_rootCluster(new Cluster("prog")) {
+		m_rootCluster(new Cluster("prog")),
+		scheduler(NULL),
+		checkpoint(NULL) {
 	// Default constructor
 }
 
@@ -106,13 +134,18 @@ Prog::Prog(const char* name) :
 		pBF(NULL),
 		pFE(NULL),
 		m_name(name),
+		maxProcRange(0),
+		maxGlobalSize(0),
 		m_iNumberedProc(1),
-		m_rootCluster(new Cluster(getNameNoPathNoExt().c_str())) {
+		m_rootCluster(new Cluster(getNameNoPathNoExt().c_str())),
+		scheduler(NULL),
+		checkpoint(NULL) {
 	// Constructor taking a name. Technically, the allocation of the space for the name could fail, but this is unlikely
 	 m_path = m_name;
 }
 
 Prog::~Prog() {
+	if (checkpoint) delete checkpoint;
 	if (pBF) delete pBF;
 	if (pFE) delete pFE;
 	for (std::list<Proc*>::iterator it = m_procs.begin(); it != m_procs.end(); it++) {
@@ -234,6 +267,7 @@ void Prog::generateCode(Cluster *cluster, UserProc *proc, bool intermixRTL) {
 	// First declare prototypes for all but the first proc
 	std::list<Proc*>::iterator it = m_procs.begin();
 	bool first = true, proto = false;
+	HLLCode *code = Boomerang::get()->getHLLCode();
 	for (it = m_procs.begin(); it != m_procs.end(); it++) {
 		if ((*it)->isLib()) continue;
 		if (first) {
@@ -242,14 +276,19 @@ void Prog::generateCode(Cluster *cluster, UserProc *proc, bool intermixRTL) {
 		}
 		proto = true;
 		UserProc* up = (UserProc*)*it;
-		HLLCode *code = Boomerang::get()->getHLLCode(up);
+		code->reset();
+		code->setProc(up);
 		code->AddPrototype(up);					// May be the wrong signature if up has ellipsis
 		if (cluster == NULL || cluster == m_rootCluster)
 			code->print(os);
 	}
+	delete code;
 	if ((proto && cluster == NULL) || cluster == m_rootCluster)
 		os << "\n";				// Separate prototype(s) from first proc
-		
+
+	// Each output file is written by one thread, in the order of the procs, so the files don't depend on the timing
+	std::vector<CodeUnit> units;
+	std::map<Cluster*, int> unitOf;
 	for (it = m_procs.begin(); it != m_procs.end(); it++) {
 		Proc *pProc = *it;
 		if (pProc->isLib()) continue;
@@ -257,23 +296,59 @@ void Prog::generateCode(Cluster *cluster, UserProc *proc, bool intermixRTL) {
 		if (!up->isDecoded()) continue;
 		if (proc != NULL && up != proc)
 			continue;
-		up->getCFG()->compressCfg();
-		HLLCode *code = Boomerang::get()->getHLLCode(up);
-		up->generateCode(code);
-		if (up->getCluster() == m_rootCluster) {
-			if (cluster == NULL || cluster == m_rootCluster)
-				code->print(os);
-		} else {
-			if (cluster == NULL || cluster == up->getCluster()) {
-				up->getCluster()->openStream("c");
-				code->print(up->getCluster()->getStream());
+		Cluster* c = up->getCluster();
+		std::map<Cluster*, int>::iterator uu = unitOf.find(c);
+		if (uu == unitOf.end()) {
+			CodeUnit u;
+			u.os = NULL;				// Code generated, but not wanted
+			if (c == m_rootCluster) {
+				if (cluster == NULL || cluster == m_rootCluster)
+					u.os = &os;
+			} else if (cluster == NULL || cluster == c) {
+				c->openStream("c");
+				u.os = &c->getStream();
 			}
+			uu = unitOf.insert(std::pair<Cluster*, int>(c, units.size())).first;
+			units.push_back(u);
 		}
+		units[uu->second].procs.push_back(up);
 	}
+	if (Boomerang::get()->numThreads > 1 && units.size() > 1)
+		parallelFor(units.size(), Boomerang::get()->numThreads, generateUnit, &units);
+	else
+		for (unsigned i = 0; i < units.size(); i++)
+			generateUnit(&units, i);
+
 	os.close();
 	m_rootCluster->closeStreams();
 }
 
+/*==============================================================================
+ * FUNCTION:		Prog::generateUnit
+ * OVERVIEW:		Generate the code of the procs of one output file, in order, writing each proc's code as soon as it
+ *					  is generated. One HLLCode (and its buffer) is reused for all of them. With -F, the body of each
+ *					  proc is freed once its code is written.
+ * PARAMETERS:		arg: the vector of CodeUnits
+ *					i: the index of the one to generate
+ * RETURNS:			<nothing>
+ *============================================================================*/
+void Prog::generateUnit(void* arg, int i) {
+	CodeUnit& u = (*(std::vector<CodeUnit>*)arg)[i];
+	HLLCode *code = Boomerang::get()->getHLLCode();
+	for (std::vector<UserProc*>::iterator pp = u.procs.begin(); pp != u.procs.end(); pp++) {
+		UserProc* up = *pp;
+		up->getCFG()->compressCfg();
+		code->reset();
+		code->setProc(up);
+		up->generateCode(code);
+		if (u.os)
+			code->print(*u.os);
+		if (Boomerang::get()->freeAfterCode)
+			up->releaseBody();
+	}
+	delete code;
+}
+
 void Prog::generateRTL(Cluster *cluster, UserProc *proc) {
 	for (std::list<Proc*>::iterator it = m_procs.begin(); it != m_procs.end(); it++) {
 		Proc *pProc = *it;
@@ -432,18 +507,18 @@ void Prog::generateCode(std::ostream &os) {
 			code->AddGlobal((*it1)->getName(), (*it1)->getType(), e);
 	}
 	code->print(os);
-	delete code;
 	for (std::list<Proc*>::iterator it = m_procs.begin(); it != m_procs.end(); it++) {
 		Proc *pProc = *it;
 		if (pProc->isLib()) continue;
 		UserProc *p = (UserProc*)pProc;
 		if (!p->isDecoded()) continue;
 		p->getCFG()->compressCfg();
-		code = Boomerang::get()->getHLLCode(p);
+		code->reset();
+		code->setProc(p);
 		p->generateCode(code);
 		code->print(os);
-		delete code;
 	}
+	delete code;
 }
 
 // Print this program, mainly for debugging
@@ -462,11 +537,15 @@ void Prog::print(std::ostream &out) {
 // clear the current project
 void Prog::clear() {
 	m_name = std::string("");
+	if (checkpoint)
+		delete checkpoint;
+	checkpoint = NULL;
 	for (std::list<Proc*>::iterator it = m_procs.begin(); it != m_procs.end(); it++)
 		if (*it)
 			delete *it;
 	m_procs.clear();
 	m_procLabels.clear();
+	indexProcs();
 	if (pBF)
 		delete pBF;
 	pBF = NULL;
@@ -487,6 +566,7 @@ void Prog::clear() {
  *				  be decoded) address
  *============================================================================*/
 Proc* Prog::setNewProc(ADDRESS uAddr) {
+	MutexLock ml(lock);
 	// this test fails when decoding sparc, why?  Please investigate - trent
 	// Likely because it is in the Procedure Linkage Table (.plt), which for Sparc is in the data section
 	//assert(uAddr >= limitTextLow && uAddr < limitTextHigh);
@@ -668,6 +748,7 @@ BOOL CALLBACK addSymbol(
  * RETURNS:		A pointer to the new Proc object
  *============================================================================*/
 Proc* Prog::newProc (const char* name, ADDRESS uNative, bool bLib /*= false*/) {
+	MutexLock ml(lock);
 	Proc* pProc;
 	std::string sname(name);
 	if (bLib)
@@ -715,8 +796,7 @@ Proc* Prog::newProc (const char* name, ADDRESS uNative, bool bLib /*= false*/) {
 		}
 	}
 #endif
-	m_procs.push_back(pProc);		// Append this to list of procs
-	m_procLabels[uNative] = pProc;
+	registerProc(pProc);			// Append this to list of procs
 	// alert the watchers of a new proc
 	Boomerang::get()->alert_new(pProc);
 	return pProc;
@@ -729,18 +809,14 @@ Proc* Prog::newProc (const char* name, ADDRESS uNative, bool bLib /*= false*/) {
  * RETURNS:		   <nothing>
  *============================================================================*/
 void Prog::remProc(UserProc* uProc) {
+	MutexLock ml(lock);
 	// Delete the cfg etc.
 	uProc->deleteCFG();
 
 	// Replace the entry in the procedure map with -1 as a warning not to decode that address ever again
 	m_procLabels[uProc->getNativeAddress()] = (Proc*)-1;
 
-	for (std::list<Proc*>::iterator it = m_procs.begin(); it != m_procs.end(); it++) {
-		if (*it == uProc) {
-			m_procs.erase(it);
-			break;
-		}
-	}
+	unregisterProc(uProc);
 
 	// Delete the UserProc object as well
 	delete uProc;
@@ -748,12 +824,130 @@ void Prog::remProc(UserProc* uProc) {
 
 void Prog::removeProc(const char *name)
 {
-	for (std::list<Proc*>::iterator it = m_procs.begin(); it != m_procs.end(); it++)
-        if (std::string(name) == (*it)->getName()) {
-            Boomerang::get()->alert_remove(*it);
-			m_procs.erase(it);
+	MutexLock ml(lock);
+	Proc* p = findProc(name);
+	if (p) {
+		Boomerang::get()->alert_remove(p);
+		unregisterProc(p);
+	}
+}
+
+// Append p to the list of procs, and add it to the indexes
+void Prog::registerProc(Proc* p) {
+	MutexLock ml(lock);
+	m_procs.push_back(p);
+	m_procLabels[p->getNativeAddress()] = p;
+	procIndex.push_back(p);
+	procsByName.insert(std::pair<unsigned, Proc*>(hashName(p->getName()), p));
+}
+
+// Remove p from the list of procs and the indexes (but not from m_procLabels)
+void Prog::unregisterProc(Proc* p) {
+	MutexLock ml(lock);
+	m_procs.remove(p);
+	std::vector<Proc*>::iterator pp = std::find(procIndex.begin(), procIndex.end(), p);
+	if (pp != procIndex.end())
+		procIndex.erase(pp);
+	typedef std::multimap<unsigned, Proc*>::iterator iterator;
+	std::pair<iterator, iterator> range = procsByName.equal_range(hashName(p->getName()));
+	for (iterator it = range.first; it != range.second; it++)
+		if (it->second == p) {
+			procsByName.erase(it);
 			break;
-        }
+		}
+	if (!p->isLib())
+		removeProcRanges((UserProc*)p);
+}
+
+void Prog::procRenamed(Proc* p, const char* oldName) {
+	MutexLock ml(lock);
+	typedef std::multimap<unsigned, Proc*>::iterator iterator;
+	std::pair<iterator, iterator> range = procsByName.equal_range(hashName(oldName));
+	for (iterator it = range.first; it != range.second; it++)
+		if (it->second == p) {
+			procsByName.erase(it);
+			procsByName.insert(std::pair<unsigned, Proc*>(hashName(p->getName()), p));
+			return;
+		}
+	// Else p is not (yet) one of ours
+}
+
+#define BIG_PROC_RANGE	0x4000		// Ranges of more than this many bytes are kept in bigProcRanges
+
+// Remove the ranges of p from procRanges and bigProcRanges
+void Prog::removeProcRanges(UserProc* p) {
+	std::map<UserProc*, std::vector<ADDRESS> >::iterator ss = procRangeStarts.find(p);
+	if (ss == procRangeStarts.end())
+		return;
+	typedef std::multimap<ADDRESS, std::pair<ADDRESS, UserProc*> >::iterator iterator;
+	for (unsigned i = 0; i < ss->second.size(); i++) {
+		std::pair<iterator, iterator> range = procRanges.equal_range(ss->second[i]);
+		iterator it;
+		for (it = range.first; it != range.second; it++)
+			if (it->second.second == p) {
+				procRanges.erase(it);
+				break;
+			}
+		if (it != range.second) continue;
+		range = bigProcRanges.equal_range(ss->second[i]);
+		for (it = range.first; it != range.second; it++)
+			if (it->second.second == p) {
+				bigProcRanges.erase(it);
+				break;
+			}
+	}
+	procRangeStarts.erase(ss);
+	// Note: maxProcRange is not reduced; it need only be big enough
+}
+
+// Add the range lo to hi (inclusive) of p to procRanges or bigProcRanges
+void Prog::addProcRange(UserProc* p, ADDRESS lo, ADDRESS hi) {
+	std::pair<ADDRESS, std::pair<ADDRESS, UserProc*> > range(lo, std::pair<ADDRESS, UserProc*>(hi, p));
+	if (hi - lo > BIG_PROC_RANGE)
+		bigProcRanges.insert(range);
+	else {
+		procRanges.insert(range);
+		if (hi - lo > maxProcRange)
+			maxProcRange = hi - lo;
+	}
+	procRangeStarts[p].push_back(lo);
+}
+
+void Prog::updateProcRanges(UserProc* p) {
+	MutexLock ml(lock);
+	removeProcRanges(p);
+	if (!p->isLoaded()) {
+		// Still in the checkpoint, which has the ranges as they were when it was saved
+		std::vector<std::pair<ADDRESS, ADDRESS> >& ranges = checkpoint->getProcRanges(p);
+		for (unsigned i = 0; i < ranges.size(); i++)
+			addProcRange(p, ranges[i].first, ranges[i].second);
+		return;
+	}
+	Cfg* cfg = p->getCFG();
+	if (cfg == NULL) return;
+	BB_IT it;
+	for (PBB bb = cfg->getFirstBB(it); bb; bb = cfg->getNextBB(it)) {
+		if (bb->getRTLs() == NULL) continue;		// Incomplete
+		ADDRESS lo = bb->getLowAddr(), hi = bb->getHiAddr();
+		if (hi < lo) continue;
+		addProcRange(p, lo, hi);
+	}
+}
+
+// Rebuild all the proc indexes from m_procs
+void Prog::indexProcs() {
+	MutexLock ml(lock);
+	procIndex.assign(m_procs.begin(), m_procs.end());
+	procsByName.clear();
+	procRanges.clear();
+	bigProcRanges.clear();
+	procRangeStarts.clear();
+	maxProcRange = 0;
+	for (std::list<Proc*>::iterator it = m_procs.begin(); it != m_procs.end(); it++) {
+		procsByName.insert(std::pair<unsigned, Proc*>(hashName((*it)->getName()), *it));
+		if (!(*it)->isLib())
+			updateProcRanges((UserProc*)*it);
+	}
 }
 
 /*==============================================================================
@@ -781,14 +975,10 @@ int Prog::getNumUserProcs() {
  * RETURNS:		Pointer to the Proc object, or 0 if index invalid
  *============================================================================*/
 Proc* Prog::getProc(int idx) const {
-	// Return the indexed procedure. If this is used often, we should use a vector instead of a list
-	// If index is invalid, result will be 0
-	if ((idx < 0) || (idx >= (int)m_procs.size())) return 0;
-	std::list<Proc*>::const_iterator it;
-	it = m_procs.begin();
-	for (int i=0; i < idx; i++)
-		it++;
-	return (*it);
+	// Return the indexed procedure. If index is invalid, result will be 0
+	MutexLock ml(lock);
+	if ((idx < 0) || (idx >= (int)procIndex.size())) return 0;
+	return procIndex[idx];
 }
 
 
@@ -800,6 +990,7 @@ Proc* Prog::getProc(int idx) const {
  * RETURNS:		Pointer to the Proc object, or 0 if none, or -1 if deleted
  *============================================================================*/
 Proc* Prog::findProc(ADDRESS uAddr) const {
+	MutexLock ml(lock);
 	PROGMAP::const_iterator it;
 	it = m_procLabels.find(uAddr);
 	if (it == m_procLabels.end())
@@ -809,15 +1000,18 @@ Proc* Prog::findProc(ADDRESS uAddr) const {
 }
 
 Proc* Prog::findProc(const char *name) const {	 
-	std::list<Proc *>::const_iterator it;
-	for (it = m_procs.begin(); it != m_procs.end(); it++)
-		if (!strcmp((*it)->getName(), name))
-			return *it;
+	MutexLock ml(lock);
+	typedef std::multimap<unsigned, Proc*>::const_iterator iterator;
+	std::pair<iterator, iterator> range = procsByName.equal_range(hashName(name));
+	for (iterator it = range.first; it != range.second; it++)
+		if (!strcmp(it->second->getName(), name))
+			return it->second;
 	return NULL;
 }
 
 // get a library procedure by name; create if does not exist
 LibProc *Prog::getLibraryProc(const char *nam) {
+	MutexLock ml(lock);
 	Proc *p = findProc(nam);
 	if (p && p->isLib())
 		return (LibProc*)p;
@@ -825,6 +1019,7 @@ LibProc *Prog::getLibraryProc(const char *nam) {
 }
 
 Signature* Prog::getLibSignature(const char *nam) {
+	MutexLock ml(lock);				// Signatures are parsed on first use
 	return pFE->getLibSignature(nam);
 }
 
@@ -867,19 +1062,78 @@ bool Prog::isWin32() {
 
 const char *Prog::getGlobalName(ADDRESS uaddr)
 {
-	// FIXME: inefficient
-	for (std::set<Global*>::iterator it = globals.begin(); it != globals.end(); it++) {
-		if ((*it)->getAddress() == uaddr)
-			return (*it)->getName();
-		else if ((*it)->getAddress() < uaddr &&
-				(*it)->getAddress() + (*it)->getType()->getSize() / 8 > uaddr)
-			return (*it)->getName();
-	}
+	MutexLock ml(lock);
+	Global* global = findGlobalContaining(uaddr);
+	if (global)
+		return global->getName();
 	if (pBF)
 		return pBF->SymbolByAddress(uaddr);
 	return NULL;
 }
 
+#define BIG_GLOBAL	4096		// Globals bigger than this many bytes are kept in bigGlobals
+
+// The size of global g in bytes
+static unsigned globalSize(Global* g) {
+	Type* ty = g->getType();
+	if (ty == NULL) return 0;
+	return ty->getSize() / 8;
+}
+
+// True if global g starts at uaddr, or contains it
+static bool globalContains(Global* g, ADDRESS uaddr) {
+	ADDRESS a = g->getAddress();
+	return a == uaddr || (a < uaddr && a + globalSize(g) > uaddr);
+}
+
+Global* Prog::findGlobalContaining(ADDRESS uaddr) {
+	MutexLock ml(lock);
+	// Search down from uaddr: first the globals that start at uaddr, then the ones that might reach it
+	std::multimap<ADDRESS, Global*>::iterator it = globalsByAddr.upper_bound(uaddr);
+	while (it != globalsByAddr.begin()) {
+		--it;
+		if (it->first < uaddr && uaddr - it->first >= maxGlobalSize)
+			break;						// This, and all below it, are too far away
+		if (globalContains(it->second, uaddr))
+			return it->second;
+	}
+	for (std::set<Global*>::iterator bb = bigGlobals.begin(); bb != bigGlobals.end(); bb++)
+		if (globalContains(*bb, uaddr))
+			return *bb;
+	return NULL;
+}
+
+void Prog::addGlobal(Global* global) {
+	MutexLock ml(lock);
+	if (!globals.insert(global).second)
+		return;							// Already have it
+	globalsByAddr.insert(std::pair<ADDRESS, Global*>(global->getAddress(), global));
+	globalsByName.insert(std::pair<unsigned, Global*>(hashName(global->getName()), global));
+	globalTypeChanged(global);
+}
+
+void Prog::globalTypeChanged(Global* global) {
+	MutexLock ml(lock);
+	unsigned size = globalSize(global);
+	// Note: a global that becomes smaller stays where it is; maxGlobalSize and bigGlobals need only be big enough
+	if (size > BIG_GLOBAL)
+		bigGlobals.insert(global);
+	else if (size > maxGlobalSize)
+		maxGlobalSize = size;
+}
+
+void Prog::indexGlobals() {
+	MutexLock ml(lock);
+	std::set<Global*> all = globals;
+	globals.clear();
+	globalsByAddr.clear();
+	globalsByName.clear();
+	bigGlobals.clear();
+	maxGlobalSize = 0;
+	for (std::set<Global*>::iterator it = all.begin(); it != all.end(); it++)
+		addGlobal(*it);
+}
+
 void Prog::dumpGlobals() {
 	for (std::set<Global*>::iterator it = globals.begin(); it != globals.end(); it++) {
 		(*it)->print(std::cerr, this);
@@ -889,33 +1143,32 @@ void Prog::dumpGlobals() {
 		
 ADDRESS Prog::getGlobalAddr(char *nam)
 {
-   	for (std::set<Global*>::iterator it = globals.begin(); it != globals.end(); it++) {
-        if (!strcmp((*it)->getName(), nam))
-        	return (*it)->getAddress();
-   	}
+	MutexLock ml(lock);
+	Global* global = getGlobal(nam);
+	if (global)
+		return global->getAddress();
 	return pBF->GetAddressByName(nam);
 }
 
 Global* Prog::getGlobal(char *nam) {
-   	for (std::set<Global*>::iterator it = globals.begin(); it != globals.end(); it++) {
-        if (!strcmp((*it)->getName(), nam))
-        	return *it;
-   	}
+	MutexLock ml(lock);
+	typedef std::multimap<unsigned, Global*>::iterator iterator;
+	std::pair<iterator, iterator> range = globalsByName.equal_range(hashName(nam));
+	for (iterator it = range.first; it != range.second; it++)
+		if (!strcmp(it->second->getName(), nam))
+			return it->second;
 	return NULL;
 }
 
 bool Prog::globalUsed(ADDRESS uaddr, Type* knownType) {
-    Global* global;
-    
-    for (std::set<Global*>::iterator it = globals.begin(); it != globals.end(); it++) {
-        if ((*it)->getAddress() == uaddr) {
-			if (knownType) (*it)->meetType(knownType);
-            return true;
-		}
-        else if ((*it)->getAddress() < uaddr && (*it)->getAddress() + (*it)->getType()->getSize() / 8 > uaddr) {
-			if (knownType) (*it)->meetType(knownType);
-            return true;
+	MutexLock ml(lock);
+    Global* global = findGlobalContaining(uaddr);
+	if (global) {
+		if (knownType) {
+			global->meetType(knownType);
+			globalTypeChanged(global);
 		}
+		return true;
 	}
 
 	if (pBF->GetSectionInfoByAddr(uaddr) == NULL) {
@@ -942,7 +1195,7 @@ bool Prog::globalUsed(ADDRESS uaddr, Type* knownType) {
 		ty = guessGlobalType(nam, uaddr);
 		
 	global = new Global(ty, uaddr, nam);
-    globals.insert(global);
+	addGlobal(global);
 
     if (VERBOSE) {
         LOG << "globalUsed: name " << nam << ", address " << uaddr;
@@ -1003,10 +1256,15 @@ Type *Prog::guessGlobalType(const char *nam, ADDRESS u) {
 
 const char *Prog::newGlobalName(ADDRESS uaddr)
 {
+	MutexLock ml(lock);
 	const char *nam = getGlobalName(uaddr);
 	if (nam == NULL) {
 		std::ostringstream os;
-		os << "global" << globals.size();
+		if (Boomerang::get()->numThreads > 1)
+			// Globals are found in no particular order when decompiling in parallel, so name them by address
+			os << "global_" << std::hex << uaddr;
+		else
+			os << "global" << globals.size();
 		nam = strdup(os.str().c_str());
 		if (VERBOSE)
 			LOG << "naming new global: " << nam << " at address " << uaddr << "\n";
@@ -1015,38 +1273,38 @@ const char *Prog::newGlobalName(ADDRESS uaddr)
 }
 
 Type *Prog::getGlobalType(char* nam) {
- 	for (std::set<Global*>::iterator it = globals.begin(); it != globals.end(); it++)
-		if (!strcmp((*it)->getName(), nam))
-			return (*it)->getType();
+	MutexLock ml(lock);
+	Global* global = getGlobal(nam);
+	if (global)
+		return global->getType();
 	return NULL;
 }
 
 void Prog::setGlobalType(const char* nam, Type* ty) {
-	// FIXME: inefficient
-	for (std::set<Global*>::iterator it = globals.begin(); it != globals.end(); it++) {
-		if (!strcmp((*it)->getName(), nam)) {
-			(*it)->setType(ty);
-			return;
-		}
+	MutexLock ml(lock);
+	Global* global = getGlobal((char*)nam);
+	if (global) {
+		global->setType(ty);
+		globalTypeChanged(global);
 	}
 }
 
 // get a string constant at a given address if appropriate
 // if knownString, it is already known to be a char*
 char *Prog::getStringConstant(ADDRESS uaddr, bool knownString /* = false */) {
-	const SectionInfo* si = pBF->GetSectionInfoByAddr(uaddr);
 	// Too many compilers put constants, including string constants, into read/write sections
 	//if (si && si->bReadOnly)
-	if (si && !si->isAddressBss(uaddr)) {
+	size_t len;
+	char* p = (char*)pBF->readRange(uaddr, len);
+	if (p) {
 		// At this stage, only support ascii, null terminated, non unicode strings.
 		// At least 4 of the first 6 chars should be printable ascii
-		char* p = (char*)(uaddr + si->uHostAddr - si->uNativeAddr);
 		if (knownString)
 			// No need to guess... this is hopefully a known string
 			return p;
 		int printable = 0;
 		char last = 0;
-		for (int i=0; i < 6; i++) {
+		for (int i=0; i < 6 && i < (int)len; i++) {
 			char c = p[i];
 			if (c == 0) break;
 			if (c >= ' ' && c < '\x7F') printable++;
@@ -1084,17 +1342,24 @@ double Prog::getFloatConstant(ADDRESS uaddr, bool &ok, int bits) {
  * RETURNS:		Pointer to the Proc object, or 0 if none, or -1 if deleted
  *============================================================================*/
 Proc* Prog::findContainingProc(ADDRESS uAddr) const {
-	for (std::list<Proc*>::const_iterator it = m_procs.begin();
-	  it != m_procs.end(); it++) {
-		Proc *p = (*it);
-		if (p->getNativeAddress() == uAddr)
-			return p;
-		if (p->isLib()) continue;
-
-		UserProc *u = (UserProc *)p;
-		if (u->containsAddr(uAddr))
-			return p;
-	}
+	MutexLock ml(lock);
+	PROGMAP::const_iterator pp = m_procLabels.find(uAddr);
+	if (pp != m_procLabels.end() && pp->second && pp->second != (Proc*)-1)
+		return pp->second;
+
+	// Search down from uAddr for a BB range that contains it
+	typedef std::multimap<ADDRESS, std::pair<ADDRESS, UserProc*> >::const_iterator iterator;
+	iterator it = procRanges.upper_bound(uAddr);
+	while (it != procRanges.begin()) {
+		--it;
+		if (uAddr - it->first > maxProcRange)
+			break;						// This, and all below it, are too far away
+		if (it->second.first >= uAddr)
+			return it->second.second;
+	}
+	for (it = bigProcRanges.begin(); it != bigProcRanges.end() && it->first <= uAddr; it++)
+		if (it->second.first >= uAddr)
+			return it->second.second;
 	return NULL;
 }
 
@@ -1105,6 +1370,7 @@ Proc* Prog::findContainingProc(ADDRESS uAddr) const {
  * RETURNS:		True if a real (non deleted) proc
  *============================================================================*/
 bool Prog::isProcLabel (ADDRESS addr) {
+	MutexLock ml(lock);
 	if (m_procLabels[addr] == 0)
 		return false;
 	return true;
@@ -1236,6 +1502,7 @@ const void* Prog::getCodeInfo(ADDRESS uAddr, const char*& last, int& delta) {
 }
 
 void Prog::decodeEntryPoint(ADDRESS a) { 
+	MutexLock ml(lock);
 	Proc* p = (UserProc*)findProc(a);
 	if (p == NULL || (!p->isLib() && !((UserProc*)p)->isDecoded())) {
 		if (a < pBF->getLimitTextLow() || a >= pBF->getLimitTextHigh()) {
@@ -1272,15 +1539,40 @@ void Prog::decodeEverythingUndecoded() {
 	finishDecode();
 }
 
+// Order procedures by native address
+static bool lessNativeAddress(Proc* a, Proc* b) {
+	return a->getNativeAddress() < b->getNativeAddress();
+}
+
 void Prog::decompile() {
 	assert(m_procs.size());
 
 	if (VERBOSE) 
 		LOG << (int)m_procs.size() << " procedures\n";
 
+	if (Boomerang::get()->numThreads > 1) {
+		// Decompile the strongly connected components of the call graph in parallel, callees first
+		std::cerr << "decompiling on " << Boomerang::get()->numThreads << " threads\n";
+		if (checkpoint)
+			checkpoint->loadAll();				// UserProc::loadBody is not thread safe
+		std::list<Proc*>::iterator last = --m_procs.end();
+		DecompileScheduler sched(this, Boomerang::get()->numThreads);
+		scheduler = &sched;
+		sched.run();
+		scheduler = NULL;
+		// Procs found while decompiling were created in whatever order the threads ran; put them in address order so
+		// that the output does not depend on the timing
+		std::list<Proc*> found;
+		found.splice(found.end(), m_procs, ++last, m_procs.end());
+		found.sort(lessNativeAddress);
+		m_procs.splice(m_procs.end(), found);
+		procIndex.assign(m_procs.begin(), m_procs.end());
+	}
+
 	// Start decompiling each entry point
 	std::list<UserProc*>::iterator ee;
 	for (ee = entryProcs.begin(); ee != entryProcs.end(); ++ee) {
+		if ((*ee)->isDecompiled()) continue;			// E.g. by the scheduler
 		std::cerr << "decompiling entry point " << (*ee)->getName() << "\n";
 		if (VERBOSE)
 			LOG << "decompiling entry point " << (*ee)->getName() << "\n";
@@ -1314,7 +1606,9 @@ void Prog::decompile() {
 
 
 	if (!Boomerang::get()->noDecompile) {
-		if (!Boomerang::get()->noRemoveReturns) {
+		if (Budget::enabled() && Budget::globalExceeded())
+			std::cerr << "over budget: not removing unused returns\n";
+		else if (!Boomerang::get()->noRemoveReturns) {
 			// A final pass to remove returns not used by any caller
 			if (VERBOSE)
 				LOG << "prog: global removing unused returns\n";
@@ -1333,6 +1627,10 @@ void Prog::decompile() {
 	if (VERBOSE)
 		LOG << "transforming from SSA\n";
 
+	// The dataflow is done, so nothing needs the canonical copies of expressions any more (those owned by procs have
+	// mostly gone as the procs became final)
+	Exp::releaseAllInterned();
+
 	// Now it is OK to transform out of SSA form
 	fromSSAform();
 
@@ -1365,27 +1663,24 @@ void Prog::removeUnusedGlobals() {
 		}
 	}
 
-	// make a map to find a global by its name (could be a global var too)
-	std::map<std::string, Global*> namedGlobals;
-	for (std::set<Global*>::iterator it = globals.begin(); it != globals.end(); it++)
-		namedGlobals[(*it)->getName()] = (*it);
-		
     // rebuild the globals vector
     char* name;
     Global* usedGlobal;
+    std::set<Global*> used;
     
-    globals.clear();
 	for (std::list<Exp*>::iterator it = usedGlobals.begin(); it != usedGlobals.end(); it++) {
 		if (DEBUG_UNUSED)
 			LOG << " " << *it << " is used\n";
      	name = ((Const*)(*it)->getSubExp1())->getStr();
-     	usedGlobal=namedGlobals[name];
+     	usedGlobal = getGlobal(name);
      	if(usedGlobal) {
-     		globals.insert(usedGlobal);
+     		used.insert(usedGlobal);
 		} else {
       		LOG << "warning: an expression refers to a nonexistent global\n";
     	}
 	}
+	globals = used;
+	indexGlobals();
 }
 
 // This is the global removing of unused and redundant returns. The initial idea is simple enough: remove some returns
@@ -1655,7 +1950,7 @@ void Prog::readSymbolFile(const char *fname) {
 			if (ty == NULL) {
 				ty = guessGlobalType(nam, (*it)->addr);
 			}
-			globals.insert(new Global(ty, (*it)->addr, nam));
+			addGlobal(new Global(ty, (*it)->addr, nam));
 		}
 	}
 
@@ -1804,6 +2099,7 @@ void Global::meetType(Type* ty) {
 }
 
 void Prog::reDecode(UserProc* proc) {
+	MutexLock ml(lock);
 	std::ofstream os;
 	pFE->processProc(proc->getNativeAddress(), proc, os);
 }
@@ -1915,12 +2211,14 @@ void Prog::readMemo(Memo *mm, bool dec)
 	m_procs = m->m_procs;
 	m_procLabels = m->m_procLabels;
 	globals = m->globals;
+	indexGlobals();
 	globalMap = m->globalMap;
 	m_iNumberedProc = m->m_iNumberedProc;
 	m_rootCluster = m->m_rootCluster;
 
 	for (std::list<Proc*>::iterator it = m_procs.begin(); it != m_procs.end(); it++)
 		(*it)->restoreMemo(m->mId, dec);
+	indexProcs();
 	m_rootCluster->restoreMemo(m->mId, dec);
 	for (std::set<Global*>::iterator it = globals.begin(); it != globals.end(); it++)
 		(*it)->restoreMemo(m->mId, dec);
@@ -2039,6 +2337,7 @@ void Memoisable::restoreMemo(bool dec)
 
 void Prog::decodeFragment(UserProc* proc, ADDRESS a)
 {
+	MutexLock ml(lock);
 	if (a >= pBF->getLimitTextLow() && a < pBF->getLimitTextHigh())
 		pFE->decodeFragment(proc, a);
 	else {
@@ -2048,6 +2347,13 @@ void Prog::decodeFragment(UserProc* proc, ADDRESS a)
 	}
 }
 
+// True if the front end can decode fragments into proc (see UserProc::spliceSwitches)
+bool Prog::canDecodeFragment(UserProc* proc)
+{
+	MutexLock ml(lock);
+	return pFE->canDecodeFragment(proc);
+}
+
 Exp	*Prog::addReloc(Exp *e, ADDRESS lc)
 {
 	assert(e->isConst());
@@ -2065,7 +2371,7 @@ Exp	*Prog::addReloc(Exp *e, ADDRESS lc)
 			unsigned int sz = pBF->GetSizeByName(n);
 			if (getGlobal((char*)n) == NULL) {
 				Global *global = new Global(new SizeType(sz*8), a, n);
-				globals.insert(global);
+				addGlobal(global);
 			}
 			e = new Unary(opAddrOf, Location::global(n, NULL));
 		} else {
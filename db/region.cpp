@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   region.cpp
+ * OVERVIEW:   Implementation of class Region
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created
+ * 17 Oct 26 - PhaseMemory moved to phase.cpp (as Phase)
+ */
+
+#include <stdlib.h>
+#include "threads.h"
+#include "region.h"
+#ifndef NO_GARBAGE_COLLECTOR
+#include "gc.h"
+#endif
+
+// The chunks hold pointers to collected objects (e.g. the expressions in a set of locations), so the garbage
+// collector must scan them; but they are freed explicitly
+static void* chunkAlloc(size_t n) {
+#ifndef NO_GARBAGE_COLLECTOR
+	void* p = GC_malloc_uncollectable(n);
+#else
+	void* p = malloc(n);
+#endif
+	if (p == NULL)
+		throw std::bad_alloc();
+	return p;
+}
+
+static void chunkFree(void* p) {
+#ifndef NO_GARBAGE_COLLECTOR
+	GC_free(p);
+#else
+	free(p);
+#endif
+}
+
+bool Region::counting = false;
+static volatile long totalRegion = 0;
+
+void Region::count(size_t n) {
+	atomicAdd(&totalRegion, (long)n);
+}
+
+size_t Region::getTotalAllocated() {
+	return (size_t)atomicAdd(&totalRegion, 0);
+}
+
+Region::~Region() {
+	while (chunks) {
+		Chunk* c = chunks;
+		chunks = c->next;
+		chunkFree(c);
+	}
+}
+
+void* Region::allocSlow(size_t n) {
+	Chunk* c;
+	if (n > CHUNK_SIZE / 4) {
+		// Large; give it a chunk of its own, after the current one so that the rest of that can still be used
+		c = (Chunk*)chunkAlloc(sizeof(Chunk) + n);
+		c->size = n;
+		if (chunks) {
+			c->next = chunks->next;
+			chunks->next = c;
+		} else {
+			c->next = NULL;
+			chunks = c;
+			next = limit = (char*)(c+1) + n;
+		}
+	} else {
+		c = (Chunk*)chunkAlloc(sizeof(Chunk) + CHUNK_SIZE);
+		c->size = CHUNK_SIZE;
+		c->next = chunks;
+		chunks = c;
+		next = (char*)(c+1) + n;
+		limit = (char*)(c+1) + CHUNK_SIZE;
+	}
+	allocated += n;
+	if (counting)
+		count(n);
+	return c+1;
+}
+
+void Region::release() {
+	Chunk* keep = NULL;
+	while (chunks) {
+		Chunk* c = chunks;
+		chunks = c->next;
+		if (keep == NULL && c->size == CHUNK_SIZE)
+			keep = c;
+		else
+			chunkFree(c);
+	}
+	if (keep) {
+		keep->next = NULL;
+		chunks = keep;
+		next = (char*)(keep+1);
+		limit = next + CHUNK_SIZE;
+	} else
+		next = limit = NULL;
+	allocated = 0;
+}
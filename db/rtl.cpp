@@ -23,6 +23,7 @@
  * 15 May 02 - Mike: Fixed a nasty bug in updateExp (when update with same
  *				expression as existing)
  * 25 Jul 02 - Mike: RTL is now list of Statements
+ * 17 Oct 26 - simplify tells the proc about the statements that it removes (for the def-use chains)
  */
 
 #include <assert.h>
@@ -573,12 +574,16 @@ void RTL::simplify() {
 				if (((Const*)cond)->getInt() == 0) {
 					if (VERBOSE)
 						LOG << "removing branch with false condition at " << getAddress()  << " " << *it << "\n";
+					if (s->getProc())
+						s->getProc()->stmtRemoved(s);
 					it = stmtList.erase(it);
 					continue;
 				} else {
 					if (VERBOSE)
 						LOG << "replacing branch with true condition with goto at " << getAddress() << " " << *it <<
 							"\n";
+					if (s->getProc())
+						s->getProc()->stmtRemoved(s);
 					*it = new GotoStatement(((BranchStatement*)s)->getFixedDest());
 				}
 			}
@@ -588,6 +593,8 @@ void RTL::simplify() {
 				// This assignment statement can be deleted
 				if (VERBOSE)
 					LOG << "removing assignment with false guard at " << getAddress() << " " << *it << "\n";
+				if (s->getProc())
+					s->getProc()->stmtRemoved(s);
 				it = stmtList.erase(it);
 				continue;
 			}
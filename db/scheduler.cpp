@@ -0,0 +1,320 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   scheduler.cpp
+ * OVERVIEW:   Implementation of class DecompileScheduler, the parallel (-j) decompilation of a program's call graph
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created
+ * 17 Oct 26 - parallelFor
+ * 17 Oct 26 - run doesn't change numThreads when a thread can't be created (the workers read it)
+ * 17 Oct 26 - awaitFinal waits only for groups with lower numbers, so the outcome doesn't depend on the timing
+ */
+
+#include <assert.h>
+#include <iostream>
+#include <algorithm>		// For find()
+#include "types.h"
+#include "prog.h"
+#include "proc.h"
+#include "boomerang.h"
+#include "log.h"
+#include "scheduler.h"
+
+#if HAVE_THREADS && !defined(NO_GARBAGE_COLLECTOR)
+// Have the collector see the worker threads (this makes pthread_create etc go through the collector)
+#define GC_THREADS 1
+#include "gc.h"
+#endif
+
+// Is p one of the procs that the scheduler decompiles?
+static bool schedulable(Proc* p) {
+	return p && !p->isLib() && !((UserProc*)p)->isDecompiled();
+}
+
+/*==============================================================================
+ * FUNCTION:		DecompileScheduler::DecompileScheduler
+ * OVERVIEW:		Constructor. Finds the strongly connected components of the call graph (Tarjan's algorithm), and
+ *					  the edges between them. Groups that call no other group are ready at once
+ * PARAMETERS:		prog: the program to decompile
+ *					numThreads: the number of threads to decompile on
+ *============================================================================*/
+DecompileScheduler::DecompileScheduler(Prog* prog, int numThreads) : prog(prog), numThreads(numThreads),
+		queues(numThreads), nextIndex(0) {
+	// Entry points first, so that their groups have the lowest numbers, then anything not reachable from them
+	std::list<UserProc*>::iterator ee;
+	for (ee = prog->entryProcs.begin(); ee != prog->entryProcs.end(); ++ee)
+		if (schedulable(*ee) && index.find(*ee) == index.end())
+			strongConnect(*ee);
+	std::list<Proc*>::iterator it;
+	for (UserProc* p = prog->getFirstUserProc(it); p; p = prog->getNextUserProc(it))
+		if (schedulable(p) && index.find(p) == index.end())
+			strongConnect(p);
+	index.clear(); lowlink.clear(); onStack.clear();
+	addEdges();
+
+	remaining = groups.size();
+	int w = 0;
+	for (unsigned g = 0; g < groups.size(); g++)
+		if (groups[g].pending == 0) {
+			queues[w].push_back(g);
+			w = (w+1) % numThreads;
+		}
+	if (VERBOSE)
+		LOG << (int)groups.size() << " call graph groups to decompile on " << numThreads << " threads\n";
+}
+
+// Tarjan's strongly connected components algorithm, from p. Components are found callees first
+void DecompileScheduler::strongConnect(UserProc* p) {
+	index[p] = lowlink[p] = nextIndex++;
+	stack.push_back(p);
+	onStack.insert(p);
+	std::list<Proc*>& callees = p->getCallees();
+	for (std::list<Proc*>::iterator cc = callees.begin(); cc != callees.end(); ++cc) {
+		if (!schedulable(*cc)) continue;
+		UserProc* c = (UserProc*)*cc;
+		if (index.find(c) == index.end()) {
+			strongConnect(c);
+			if (lowlink[c] < lowlink[p]) lowlink[p] = lowlink[c];
+		} else if (onStack.find(c) != onStack.end()) {
+			if (index[c] < lowlink[p]) lowlink[p] = index[c];
+		}
+	}
+	if (lowlink[p] != index[p])
+		return;
+	// p is the root (first discovered member) of a new group
+	int g = groups.size();
+	groups.push_back(Group());
+	std::vector<UserProc*>::iterator root = std::find(stack.begin(), stack.end(), p);
+	for (std::vector<UserProc*>::iterator ss = root; ss != stack.end(); ++ss) {
+		groups[g].procs.push_back(*ss);
+		groupOf[*ss] = g;
+		onStack.erase(*ss);
+	}
+	stack.erase(root, stack.end());
+}
+
+// Record the calls between groups, and how many callee groups each group waits for
+void DecompileScheduler::addEdges() {
+	for (unsigned g = 0; g < groups.size(); g++) {
+		std::set<int> seen;
+		for (unsigned i = 0; i < groups[g].procs.size(); i++) {
+			std::list<Proc*>& callees = groups[g].procs[i]->getCallees();
+			for (std::list<Proc*>::iterator cc = callees.begin(); cc != callees.end(); ++cc) {
+				std::map<UserProc*, int>::iterator gg = groupOf.find((UserProc*)*cc);
+				if (gg == groupOf.end() || gg->second == (int)g) continue;
+				if (!seen.insert(gg->second).second) continue;
+				groups[g].callees.push_back(gg->second);
+				groups[gg->second].callers.push_back(g);
+				groups[g].pending++;
+			}
+		}
+	}
+}
+
+/*==============================================================================
+ * FUNCTION:		DecompileScheduler::run
+ * OVERVIEW:		Decompile all groups, on numThreads threads (the calling thread is worker 0). Returns when all
+ *					  groups are done
+ *============================================================================*/
+void DecompileScheduler::run() {
+#if HAVE_THREADS
+	std::vector<pthread_t> threads(numThreads);
+	std::vector<std::pair<DecompileScheduler*, int> > args(numThreads);
+	// numThreads is left alone (the workers read it): the workers not started never run, and their queues are
+	// stolen from
+	int started = 1;
+	for (; started < numThreads; started++) {
+		args[started] = std::pair<DecompileScheduler*, int>(this, started);
+		if (pthread_create(&threads[started], NULL, threadMain, &args[started]) != 0) {
+			std::cerr << "warning: could not create decompilation thread " << started << "\n";
+			break;
+		}
+	}
+	work(0);
+	for (int w = 1; w < started; w++)
+		pthread_join(threads[w], NULL);
+#else
+	work(0);
+#endif
+}
+
+void* DecompileScheduler::threadMain(void* arg) {
+	std::pair<DecompileScheduler*, int>* a = (std::pair<DecompileScheduler*, int>*)arg;
+	a->first->work(a->second);
+	return NULL;
+}
+
+// The main loop of worker w: decompile ready groups until all are done
+void DecompileScheduler::work(int w) {
+	MutexLock ml(mutex);
+	while (remaining > 0) {
+		int g = nextGroup(w);
+		if (g == -1)
+			changed.wait(mutex);
+		else
+			runGroup(w, g);
+	}
+	changed.broadcast();
+}
+
+// Find a ready group for worker w: the newest from its own queue, else the oldest from another's. Mutex held
+int DecompileScheduler::nextGroup(int w) {
+	for (int i = 0; i < (int)queues.size(); i++) {
+		std::deque<int>& q = queues[(w+i) % queues.size()];
+		while (!q.empty()) {
+			int g;
+			if (i == 0) {
+				g = q.back();
+				q.pop_back();
+			} else {
+				g = q.front();
+				q.pop_front();
+			}
+			if (!groups[g].started)		// May have been run early, by a worker waiting for it
+				return g;
+		}
+	}
+	return -1;
+}
+
+// Decompile group g on worker w. Called and returns with the mutex held (once)
+void DecompileScheduler::runGroup(int w, int g) {
+	groups[g].started = true;
+	groups[g].worker = w;
+	mutex.unlock();
+	decompileGroup(g);
+	mutex.lock();
+	finish(w, g);
+}
+
+// Decompile the members of group g. The first decompiles the rest, unless the call graph has changed
+void DecompileScheduler::decompileGroup(int g) {
+	for (unsigned i = 0; ; i++) {
+		UserProc* p;
+		{
+			MutexLock ml(mutex);		// procs can grow, by claim()
+			if (i >= groups[g].procs.size()) break;
+			p = groups[g].procs[i];
+		}
+		if (p->isDecompiled()) continue;
+		int indent = 0;
+		p->decompile(new ProcList, indent);
+	}
+}
+
+// Group g is done: make ready the callers that were waiting only for it. Mutex held
+void DecompileScheduler::finish(int w, int g) {
+	groups[g].done = true;
+	remaining--;
+	for (unsigned i = 0; i < groups[g].callers.size(); i++) {
+		Group& c = groups[groups[g].callers[i]];
+		if (--c.pending == 0 && !c.started)
+			queues[w].push_back(groups[g].callers[i]);
+	}
+	changed.broadcast();
+}
+
+/*==============================================================================
+ * FUNCTION:		DecompileScheduler::claim
+ * OVERVIEW:		Decide whether the caller's thread should decompile callee itself. Procs not known when the
+ *					  groups were found (e.g. found by switch analysis) join the caller's group
+ * PARAMETERS:		caller: the proc being decompiled
+ *					callee: a proc that it calls
+ * RETURNS:			True if callee is (now) in the caller's group
+ *============================================================================*/
+bool DecompileScheduler::claim(UserProc* caller, UserProc* callee) {
+	MutexLock ml(mutex);
+	std::map<UserProc*, int>::iterator cg = groupOf.find(caller);
+	assert(cg != groupOf.end());
+	std::map<UserProc*, int>::iterator gg = groupOf.find(callee);
+	if (gg == groupOf.end()) {
+		groupOf[callee] = cg->second;
+		groups[cg->second].procs.push_back(callee);
+		return true;
+	}
+	return gg->second == cg->second;
+}
+
+/*==============================================================================
+ * FUNCTION:		DecompileScheduler::awaitFinal
+ * OVERVIEW:		Wait until the group of callee is done. If no thread has started on it yet, the caller's thread
+ *					  decompiles it (as the serial decompiler would).
+ *					Groups are numbered callees first, so every call edge known when the groups were found goes to a
+ *					  lower number. A call found during decompilation (e.g. after switch analysis) to a group with a
+ *					  higher number may close a cycle of groups; it is never waited for, whatever the other threads are
+ *					  doing, so the output doesn't depend on the timing. As each thread only waits for lower numbers,
+ *					  waiting can't deadlock
+ * PARAMETERS:		caller: the proc being decompiled
+ *					callee: a proc that it calls, in another group
+ * RETURNS:			True if callee is final, false if it is in a group with a higher number than caller's
+ *============================================================================*/
+bool DecompileScheduler::awaitFinal(UserProc* caller, UserProc* callee) {
+	MutexLock ml(mutex);
+	int g = groupOf[caller];
+	int t = groupOf[callee];
+	if (t > g)
+		return false;
+	if (!groups[t].started) {
+		runGroup(groups[g].worker, t);
+		return true;
+	}
+	while (!groups[t].done)
+		changed.wait(mutex);
+	return true;
+}
+
+bool DecompileScheduler::mayWaitFor(UserProc* caller, UserProc* callee) {
+	MutexLock ml(mutex);
+	std::map<UserProc*, int>::iterator gg = groupOf.find(callee);
+	if (gg == groupOf.end())
+		return callee->isDecompiled();		// Final before the groups were found; else not known yet
+	return gg->second <= groupOf[caller];
+}
+
+struct ParallelFor {
+	int			n;
+	void		(*body)(void* arg, int i);
+	void*		arg;
+	volatile int next;				// One more than the next i to take
+};
+
+static void* parallelForMain(void* arg) {
+	ParallelFor* pf = (ParallelFor*)arg;
+	int i;
+	while ((i = atomicIncrement(&pf->next) - 1) < pf->n)
+		pf->body(pf->arg, i);
+	return NULL;
+}
+
+void parallelFor(int n, int numThreads, void (*body)(void* arg, int i), void* arg) {
+	ParallelFor pf;
+	pf.n = n;
+	pf.body = body;
+	pf.arg = arg;
+	pf.next = 0;
+	if (numThreads > n)
+		numThreads = n;
+#if HAVE_THREADS
+	std::vector<pthread_t> threads(numThreads);
+	int started = 1;
+	for (; started < numThreads; started++)
+		if (pthread_create(&threads[started], NULL, parallelForMain, &pf) != 0)
+			break;					// The threads already started (and this one) do the rest
+	parallelForMain(&pf);
+	for (int t = 1; t < started; t++)
+		pthread_join(threads[t], NULL);
+#else
+	parallelForMain(&pf);
+#endif
+}
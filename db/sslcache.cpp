@@ -0,0 +1,543 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   sslcache.cpp
+ * OVERVIEW:   The binary cache of an RTLInstDict, so that the SSL file need not be parsed (and its tables expanded,
+ *			   and its parameters fixed up) on every run. The cache of e.g. pentium.ssl is pentium.ssl.cache, next to
+ *			   it. It is rebuilt whenever the SSL file changes, or the cache was written by a build with a different
+ *			   format or operator numbering.
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "types.h"
+#include "rtl.h"
+#include "exp.h"
+#include "type.h"
+#include "statement.h"
+#include "register.h"
+#include "BinaryFile.h"			// For mapFile
+#include "boomerang.h"
+#include "log.h"
+
+/*
+ * The cache is a sequence of 32 bit words (host order) and byte strings. It starts with SSLC_MAGIC, SSLC_VERSION,
+ * opNumOf and the size of an ADDRESS (so that a cache from another build or host is rebuilt), and the modification
+ * time and size of the SSL file. Then come the maps of the dictionary, each as a count and its entries.
+ * Expressions, types and statements are written as a tag and their parts. Only the kinds that the SSL parser makes
+ * are supported; anything else makes writeCache give up, so the file is simply parsed every time.
+ */
+#define SSLC_MAGIC		0x43534c53		// "SLSC" on a little endian host
+#define SSLC_VERSION	1				// Increment when the format, or what the SSL parser makes, changes
+
+// Tags for expressions
+enum {TAG_NULL, TAG_CONST, TAG_TERMINAL, TAG_UNARY, TAG_BINARY, TAG_TERNARY, TAG_LOCATION, TAG_FLAGDEF,
+	TAG_TYPEDEXP, TAG_ASSIGN};
+
+class SSLCacheWriter {
+public:
+		std::vector<char> buf;
+		bool		ok;						// Cleared if there is something that can't be written
+
+					SSLCacheWriter() : ok(true) {}
+		void		word(unsigned w) { buf.insert(buf.end(), (char*)&w, (char*)(&w+1)); }
+		void		bytes(const void* p, unsigned n) { buf.insert(buf.end(), (const char*)p, (const char*)p + n); }
+		void		str(const std::string& s) { word(s.size()); bytes(s.data(), s.size()); }
+		void		strList(std::list<std::string>& l);
+		void		type(Type* ty);
+		void		exp(Exp* e);
+		void		stmt(Statement* s);
+		void		rtl(RTL* r);
+		void		reg(Register& r);
+};
+
+class SSLCacheReader {
+		const char*	p;
+		const char*	end;
+public:
+		bool		ok;						// Cleared if the cache is truncated or has an unknown tag
+
+					SSLCacheReader(const char* p, size_t size) : p(p), end(p + size), ok(true) {}
+		unsigned	word();
+		void		bytes(void* dest, unsigned n);
+		std::string	str();
+		void		strList(std::list<std::string>& l);
+		Type*		type();
+		Exp*		exp();
+		Statement*	stmt();
+		RTL*		rtl();
+		void		reg(Register& r);
+};
+
+void SSLCacheWriter::strList(std::list<std::string>& l) {
+	word(l.size());
+	for (std::list<std::string>::iterator it = l.begin(); it != l.end(); it++)
+		str(*it);
+}
+
+void SSLCacheWriter::type(Type* ty) {
+	if (ty == NULL) {
+		word((unsigned)-1);
+		return;
+	}
+	word(ty->getId());
+	switch (ty->getId()) {
+		case eVoid: case eBoolean: case eChar:
+			break;
+		case eInteger:
+			word(ty->getSize());
+			word(((IntegerType*)ty)->getSignedness());
+			break;
+		case eFloat: case eSize:
+			word(ty->getSize());
+			break;
+		default:
+			ok = false;
+	}
+}
+
+void SSLCacheWriter::exp(Exp* e) {
+	if (e == NULL) {
+		word(TAG_NULL);
+		return;
+	}
+	OPER op = e->getOper();
+	if (dynamic_cast<FlagDef*>(e)) {
+		word(TAG_FLAGDEF);
+		exp(e->getSubExp1());
+		rtl(((FlagDef*)e)->getRtl());
+	} else if (dynamic_cast<Location*>(e)) {
+		if (((Location*)e)->getProc())
+			ok = false;
+		word(TAG_LOCATION); word(op);
+		exp(e->getSubExp1());
+	} else if (dynamic_cast<TypedExp*>(e)) {
+		word(TAG_TYPEDEXP);
+		type(((TypedExp*)e)->getType());
+		exp(e->getSubExp1());
+	} else if (dynamic_cast<RefExp*>(e) || dynamic_cast<TypeVal*>(e)) {
+		ok = false;
+		word(TAG_NULL);
+	} else if (dynamic_cast<Ternary*>(e)) {
+		word(TAG_TERNARY); word(op);
+		exp(e->getSubExp1()); exp(e->getSubExp2()); exp(e->getSubExp3());
+	} else if (dynamic_cast<Binary*>(e)) {
+		word(TAG_BINARY); word(op);
+		exp(e->getSubExp1()); exp(e->getSubExp2());
+	} else if (dynamic_cast<Unary*>(e)) {
+		word(TAG_UNARY); word(op);
+		exp(e->getSubExp1());
+	} else if (dynamic_cast<Terminal*>(e)) {
+		word(TAG_TERMINAL); word(op);
+	} else {
+		Const* c = (Const*)e;
+		word(TAG_CONST); word(op);
+		switch (op) {
+			case opIntConst:	word(c->getInt()); break;
+			case opLongConst:	{ QWord ll = c->getLong(); bytes(&ll, sizeof(ll)); break; }
+			case opFltConst:	{ double d = c->getFlt(); bytes(&d, sizeof(d)); break; }
+			case opStrConst:	if (c->getStr()) str(c->getStr()); else ok = false; break;
+			default:			ok = false;
+		}
+		word(c->getConscript());
+		type(c->getType());
+	}
+}
+
+void SSLCacheWriter::stmt(Statement* s) {
+	if (s == NULL) {
+		word(TAG_NULL);
+		return;
+	}
+	if (!s->isAssign()) {
+		ok = false;
+		return;
+	}
+	Assign* as = (Assign*)s;
+	word(TAG_ASSIGN);
+	type(as->getType());
+	exp(as->getLeft());
+	exp(as->getRight());
+	exp(as->getGuard());
+}
+
+void SSLCacheWriter::rtl(RTL* r) {
+	if (r == NULL) {
+		word(0);
+		return;
+	}
+	word(1);
+	ADDRESS a = r->getAddress();
+	bytes(&a, sizeof(a));
+	std::list<Statement*>& l = r->getList();
+	word(l.size());
+	for (std::list<Statement*>::iterator it = l.begin(); it != l.end(); it++)
+		stmt(*it);
+}
+
+void SSLCacheWriter::reg(Register& r) {
+	word(r.g_name() != NULL);
+	if (r.g_name())
+		str(r.g_name());
+	word(r.g_size());
+	word(r.isFloat());
+	word(r.g_mappedIndex());
+	word(r.g_mappedOffset());
+	if (r.g_address())
+		ok = false;						// Only the interpreter sets these
+}
+
+unsigned SSLCacheReader::word() {
+	unsigned w = 0;
+	bytes(&w, sizeof(w));
+	return w;
+}
+
+void SSLCacheReader::bytes(void* dest, unsigned n) {
+	if (!ok || (size_t)(end - p) < n) {
+		ok = false;
+		memset(dest, 0, n);
+		return;
+	}
+	memcpy(dest, p, n);
+	p += n;
+}
+
+std::string SSLCacheReader::str() {
+	unsigned n = word();
+	if (!ok || (size_t)(end - p) < n) {
+		ok = false;
+		return "";
+	}
+	std::string s(p, n);
+	p += n;
+	return s;
+}
+
+void SSLCacheReader::strList(std::list<std::string>& l) {
+	unsigned n = word();
+	for (unsigned i = 0; i < n && ok; i++)
+		l.push_back(str());
+}
+
+Type* SSLCacheReader::type() {
+	unsigned id = word();
+	switch (id) {
+		case (unsigned)-1:	return NULL;
+		case eVoid:			return new VoidType;
+		case eBoolean:		return new BooleanType;
+		case eChar:			return new CharType;
+		case eInteger: {
+			int size = word();
+			return new IntegerType(size, word());
+		}
+		case eFloat:		return new FloatType(word());
+		case eSize:			return new SizeType(word());
+	}
+	ok = false;
+	return NULL;
+}
+
+Exp* SSLCacheReader::exp() {
+	unsigned tag = word();
+	if (!ok) return NULL;
+	OPER op;
+	switch (tag) {
+		case TAG_NULL:
+			return NULL;
+		case TAG_FLAGDEF: {
+			Exp* params = exp();
+			return new FlagDef(params, rtl());
+		}
+		case TAG_LOCATION:
+			op = (OPER)word();
+			return new Location(op, exp(), NULL);
+		case TAG_TYPEDEXP: {
+			Type* ty = type();
+			return new TypedExp(ty, exp());
+		}
+		case TAG_TERNARY: {
+			op = (OPER)word();
+			Exp* e1 = exp();
+			Exp* e2 = exp();
+			return new Ternary(op, e1, e2, exp());
+		}
+		case TAG_BINARY: {
+			op = (OPER)word();
+			Exp* e1 = exp();
+			return new Binary(op, e1, exp());
+		}
+		case TAG_UNARY:
+			op = (OPER)word();
+			return new Unary(op, exp());
+		case TAG_TERMINAL:
+			return new Terminal((OPER)word());
+		case TAG_CONST: {
+			Const* c;
+			op = (OPER)word();
+			switch (op) {
+				case opIntConst:	c = new Const((int)word()); break;
+				case opLongConst:	{ QWord ll; bytes(&ll, sizeof(ll)); c = new Const(ll); break; }
+				case opFltConst:	{ double d; bytes(&d, sizeof(d)); c = new Const(d); break; }
+				case opStrConst:	c = new Const(strdup(str().c_str())); break;
+				default:			ok = false; return NULL;
+			}
+			c->setConscript(word());
+			c->setType(type());
+			return c;
+		}
+	}
+	ok = false;
+	return NULL;
+}
+
+Statement* SSLCacheReader::stmt() {
+	unsigned tag = word();
+	if (tag != TAG_ASSIGN) {
+		if (tag != TAG_NULL) ok = false;
+		return NULL;
+	}
+	Type* ty = type();
+	Exp* lhs = exp();
+	Exp* rhs = exp();
+	return new Assign(ty, lhs, rhs, exp());
+}
+
+RTL* SSLCacheReader::rtl() {
+	if (word() == 0)
+		return NULL;
+	ADDRESS a;
+	bytes(&a, sizeof(a));
+	RTL* r = new RTL(a);
+	unsigned n = word();
+	for (unsigned i = 0; i < n && ok; i++)
+		r->appendStmt(stmt());
+	return r;
+}
+
+void SSLCacheReader::reg(Register& r) {
+	if (word()) {
+		std::string name = str();
+		r.s_name(name.c_str());
+	}
+	r.s_size(word());
+	r.s_float(word() != 0);
+	r.s_address(NULL);
+	r.s_mappedIndex(word());
+	r.s_mappedOffset(word());
+}
+
+// Get the modification time and size of the SSL file
+static bool sslStamp(const std::string& SSLFileName, unsigned& mtime, unsigned& size) {
+	struct stat st;
+	if (stat(SSLFileName.c_str(), &st) != 0)
+		return false;
+	mtime = (unsigned)st.st_mtime;
+	size = (unsigned)st.st_size;
+	return true;
+}
+
+/*==============================================================================
+ * FUNCTION:		RTLInstDict::writeCache
+ * OVERVIEW:		Write this dictionary, as just read from the SSL file, to the binary cache. Nothing is written if
+ *					  it has anything that the cache can't represent, or the file can't be written
+ * PARAMETERS:		cacheName: the cache file
+ *					SSLFileName: the SSL file that the dictionary was read from
+ *============================================================================*/
+void RTLInstDict::writeCache(const std::string& cacheName, const std::string& SSLFileName) {
+	unsigned mtime, size;
+	if (!sslStamp(SSLFileName, mtime, size))
+		return;
+	SSLCacheWriter w;
+	w.word(SSLC_MAGIC);
+	w.word(SSLC_VERSION);
+	w.word(opNumOf);
+	w.word(sizeof(ADDRESS));
+	w.word(mtime);
+	w.word(size);
+	w.word(bigEndian);
+
+	w.word(RegMap.size());
+	for (std::map<std::string, int>::iterator it = RegMap.begin(); it != RegMap.end(); it++) {
+		w.str(it->first);
+		w.word(it->second);
+	}
+	w.word(DetRegMap.size());
+	for (std::map<int, Register>::iterator it = DetRegMap.begin(); it != DetRegMap.end(); it++) {
+		w.word(it->first);
+		w.reg(it->second);
+	}
+	w.word(SpecialRegMap.size());
+	for (std::map<std::string, Register>::iterator it = SpecialRegMap.begin(); it != SpecialRegMap.end(); it++) {
+		w.str(it->first);
+		w.reg(it->second);
+	}
+	w.word(ParamSet.size());
+	for (std::set<std::string>::iterator it = ParamSet.begin(); it != ParamSet.end(); it++)
+		w.str(*it);
+	w.word(DetParamMap.size());
+	for (std::map<std::string, ParamEntry>::iterator it = DetParamMap.begin(); it != DetParamMap.end(); it++) {
+		ParamEntry& pe = it->second;
+		w.str(it->first);
+		w.strList(pe.params);
+		w.strList(pe.funcParams);
+		w.stmt(pe.asgn);
+		w.word(pe.lhs);
+		w.word(pe.kind);
+		w.type(pe.type);
+		w.type(pe.regType);
+		w.word(pe.regIdx.size());
+		for (std::set<int>::iterator rr = pe.regIdx.begin(); rr != pe.regIdx.end(); rr++)
+			w.word(*rr);
+		w.word(pe.mark);
+	}
+	w.word(FlagFuncs.size());
+	for (std::map<std::string, Exp*>::iterator it = FlagFuncs.begin(); it != FlagFuncs.end(); it++) {
+		w.str(it->first);
+		w.exp(it->second);
+	}
+	w.word(AliasMap.size());
+	for (std::map<int, Exp*>::iterator it = AliasMap.begin(); it != AliasMap.end(); it++) {
+		w.word(it->first);
+		w.exp(it->second);
+	}
+	w.word(fastMap.size());
+	for (std::map<std::string, std::string>::iterator it = fastMap.begin(); it != fastMap.end(); it++) {
+		w.str(it->first);
+		w.str(it->second);
+	}
+	w.word(idict.size());
+	for (std::map<std::string, TableEntry>::iterator it = idict.begin(); it != idict.end(); it++) {
+		w.str(it->first);
+		w.strList(it->second.params);
+		w.rtl(&it->second.rtl);
+		w.word(it->second.flags);
+	}
+	w.rtl(fetchExecCycle);
+	if (!w.ok) {
+		if (VERBOSE)
+			LOG << "not caching " << SSLFileName.c_str() << ": it has semantics that the cache can't represent\n";
+		return;
+	}
+
+	// Write to a temporary file and rename it, so that a concurrent run never reads half a cache
+	std::string tmp = cacheName + ".tmp";
+	FILE* f = fopen(tmp.c_str(), "wb");
+	if (f == NULL)
+		return;					// E.g. a read only install
+	bool written = fwrite(&w.buf[0], 1, w.buf.size(), f) == w.buf.size();
+	written = fclose(f) == 0 && written;
+#ifdef _WIN32
+	if (written) remove(cacheName.c_str());		// rename() does not replace an existing file
+#endif
+	if (!written || rename(tmp.c_str(), cacheName.c_str()) != 0)
+		remove(tmp.c_str());
+}
+
+/*==============================================================================
+ * FUNCTION:		RTLInstDict::readCache
+ * OVERVIEW:		Read this dictionary from the binary cache, if it is there and up to date
+ * PARAMETERS:		cacheName: the cache file
+ *					SSLFileName: the SSL file that the cache must have been made from
+ * RETURNS:			True if the dictionary was read (but not yet compiled); else the dictionary is empty
+ *============================================================================*/
+bool RTLInstDict::readCache(const std::string& cacheName, const std::string& SSLFileName) {
+	unsigned mtime, size;
+	if (!sslStamp(SSLFileName, mtime, size))
+		return false;
+	size_t len;
+	char* image = BinaryFile::mapFile(cacheName.c_str(), len);
+	if (image == NULL)
+		return false;
+	SSLCacheReader r(image, len);
+	if (r.word() != SSLC_MAGIC || r.word() != SSLC_VERSION || r.word() != opNumOf || r.word() != sizeof(ADDRESS) ||
+			r.word() != mtime || r.word() != size || !r.ok) {
+		BinaryFile::unmapImage(image, len);
+		return false;
+	}
+	bigEndian = r.word() != 0;
+
+	unsigned n = r.word();
+	for (unsigned i = 0; i < n && r.ok; i++) {
+		std::string name = r.str();
+		RegMap[name] = r.word();
+	}
+	n = r.word();
+	for (unsigned i = 0; i < n && r.ok; i++) {
+		int id = r.word();
+		r.reg(DetRegMap[id]);
+	}
+	n = r.word();
+	for (unsigned i = 0; i < n && r.ok; i++) {
+		std::string name = r.str();
+		r.reg(SpecialRegMap[name]);
+	}
+	n = r.word();
+	for (unsigned i = 0; i < n && r.ok; i++)
+		ParamSet.insert(r.str());
+	n = r.word();
+	for (unsigned i = 0; i < n && r.ok; i++) {
+		ParamEntry& pe = DetParamMap[r.str()];
+		r.strList(pe.params);
+		r.strList(pe.funcParams);
+		pe.asgn = r.stmt();
+		pe.lhs = r.word() != 0;
+		pe.kind = (ParamKind)r.word();
+		pe.type = r.type();
+		pe.regType = r.type();
+		unsigned nr = r.word();
+		for (unsigned j = 0; j < nr && r.ok; j++)
+			pe.regIdx.insert(r.word());
+		pe.mark = r.word();
+	}
+	n = r.word();
+	for (unsigned i = 0; i < n && r.ok; i++) {
+		std::string name = r.str();
+		FlagFuncs[name] = r.exp();
+	}
+	n = r.word();
+	for (unsigned i = 0; i < n && r.ok; i++) {
+		int id = r.word();
+		AliasMap[id] = r.exp();
+	}
+	n = r.word();
+	for (unsigned i = 0; i < n && r.ok; i++) {
+		std::string from = r.str();
+		fastMap[from] = r.str();
+	}
+	n = r.word();
+	for (unsigned i = 0; i < n && r.ok; i++) {
+		TableEntry& te = idict[r.str()];
+		r.strList(te.params);
+		RTL* rtl = r.rtl();
+		if (rtl) {
+			te.rtl.setAddress(rtl->getAddress());
+			te.rtl.getList().swap(rtl->getList());
+		}
+		te.flags = r.word();
+	}
+	fetchExecCycle = r.rtl();
+	BinaryFile::unmapImage(image, len);
+	if (!r.ok) {
+		LOG << "warning: the SSL cache " << cacheName.c_str() << " is corrupt; reading " << SSLFileName.c_str() << "\n";
+		reset();
+		return false;
+	}
+	return true;
+}
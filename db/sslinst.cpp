@@ -25,6 +25,10 @@
  * 04 Feb 03 - Mike: Fixed a bug with instantiating NOP (could cause bus error?)
  * 22 May 03 - Mike: Fixed a small memory leak (char* opcode)
  * 16 Jul 04 - Mike: Simplify decoded semantics
+ * 17 Oct 26 - Templates are compiled after parsing; instances for constant operands are cached
+ * 17 Oct 26 - Opcode ids, and getOpcodeId()
+ * 17 Oct 26 - lookupOpcodeId(), for resolving the decoders' names once
+ * 17 Oct 26 - readSSLFile uses the binary cache of the SSL file when it is up to date
  */
 
 /*==============================================================================
@@ -49,6 +53,7 @@
 #include "prog.h"
 #include "sslparser.h"
 #include "boomerang.h"
+#include "visitor.h"
 // For some reason, MSVC 5.00 complains about use of undefined types a lot
 #if defined(_MSC_VER) && _MSC_VER <= 1100
 #include "signature.h"		// For MSVC 5.00
@@ -63,7 +68,7 @@
  * PARAMETERS:		<none>
  * RETURNS:			<nothing>
  *============================================================================*/
-TableEntry::TableEntry() { flags = 0; }
+TableEntry::TableEntry() : flags(0), id(-1), compiled(false), hasPostVars(false), hasSuccessor(false) { }
 
 /*==============================================================================
  * FUNCTION:		TableEntry::TableEntry
@@ -77,6 +82,8 @@ TableEntry::TableEntry(std::list<std::string>& p, RTL& r) : rtl(r)
 	for (std::list<std::string>::iterator it = p.begin(); it != p.end(); it++)
 		params.push_back(*it);
 	flags = 0; 
+	id = -1;
+	compiled = hasPostVars = hasSuccessor = false;
 }
 
 /*==============================================================================
@@ -126,11 +133,129 @@ int TableEntry::appendRTL(std::list<std::string>& p, RTL& r) {
 		;
 	if (match) {
 		rtl.appendRTL(r);
+		compiled = false;
 		return 0;
 	}
 	return -1;
 }
 
+// Maximum number of constant operand instances cached for any one instruction
+#define MAX_INST_CACHE 64
+
+/*==============================================================================
+ * FUNCTION:		lessActuals::operator()
+ * OVERVIEW:		Compare two vectors of actual operands, element by element
+ * PARAMETERS:		x, y - the vectors to compare
+ * RETURNS:			True if x is less than y
+ *============================================================================*/
+bool lessActuals::operator()(const std::vector<Exp*>& x, const std::vector<Exp*>& y) const {
+	return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end(), lessExpStar());
+}
+
+// Return true if statement s contains pattern, including in the guard of an Assign (which Statement::search skips)
+static bool stmtContains(Statement* s, Exp* pattern) {
+	Exp* result;
+	if (s->search(pattern, result))
+		return true;
+	if (s->isAssign()) {
+		Exp* guard = ((Assign*)s)->getGuard();
+		if (guard && guard->search(pattern, result))
+			return true;
+	}
+	return false;
+}
+
+/*==============================================================================
+ * FUNCTION:		TableEntry::compile
+ * OVERVIEW:		Work out once which template statements refer to the formals, and whether any of them needs
+ *					fixSuccessor or transformPostVars at all. Also discards any cached instances
+ * PARAMETERS:		<none>
+ * RETURNS:			<nothing>
+ *============================================================================*/
+void TableEntry::compile() {
+	clearCache();
+	hasPostVars = hasSuccessor = false;
+	usesParams.clear();
+	std::list<Exp*> formals;
+	std::list<std::string>::iterator pp;
+	for (pp = params.begin(); pp != params.end(); pp++)
+		formals.push_back(Location::param(pp->c_str()));
+	Exp* succ = new Unary(opSuccessor, new Terminal(opWild));
+
+	std::list<Statement*>& stmts = rtl.getList();
+	for (std::list<Statement*>::iterator ss = stmts.begin(); ss != stmts.end(); ss++) {
+		bool uses = false;
+		for (std::list<Exp*>::iterator ff = formals.begin(); !uses && ff != formals.end(); ff++)
+			uses = stmtContains(*ss, *ff);
+		usesParams.push_back(uses);
+		if (stmtContains(*ss, succ))
+			hasSuccessor = true;
+		if ((*ss)->isAssign()) {
+			// A formal on the left could be instantiated with a post-variable, so be conservative
+			Exp* lhs = ((Assign*)*ss)->getLeft();
+			if (lhs->isPostVar() || lhs->getOper() == opParam)
+				hasPostVars = true;
+		}
+	}
+	compiled = true;
+}
+
+/*==============================================================================
+ * FUNCTION:		TableEntry::findInstance
+ * OVERVIEW:		Look up the instance cache
+ * PARAMETERS:		actuals - the actual parameter values
+ * RETURNS:			The cached (simplified) statement list, or NULL if there is none
+ *============================================================================*/
+std::list<Statement*>* TableEntry::findInstance(std::vector<Exp*>& actuals) {
+	if (instCache.empty())
+		return NULL;
+	std::map<std::vector<Exp*>, std::list<Statement*>*, lessActuals>::iterator it = instCache.find(actuals);
+	if (it == instCache.end())
+		return NULL;
+	return it->second;
+}
+
+/*==============================================================================
+ * FUNCTION:		TableEntry::addInstance
+ * OVERVIEW:		Cache a copy of an instance, if all its actuals are integer constants or r[K], and the cache for this
+ *					entry is not yet full. Other actuals (e.g. addressing modes involving variable registers) vary too
+ *					much to be worth keeping.
+ * PARAMETERS:		actuals - the actual parameter values
+ *					stmts - the instantiated statements; these are copied, not kept
+ * RETURNS:			<nothing>
+ *============================================================================*/
+void TableEntry::addInstance(std::vector<Exp*>& actuals, std::list<Statement*>* stmts) {
+	if (instCache.size() >= MAX_INST_CACHE)
+		return;
+	std::vector<Exp*>::iterator aa;
+	for (aa = actuals.begin(); aa != actuals.end(); aa++)
+		if (!(*aa)->isIntConst() && !(*aa)->isRegOfK())
+			return;
+	std::vector<Exp*> key;
+	for (aa = actuals.begin(); aa != actuals.end(); aa++)
+		key.push_back((*aa)->clone());
+	std::list<Statement*>* copy = new std::list<Statement*>;
+	for (std::list<Statement*>::iterator ss = stmts->begin(); ss != stmts->end(); ss++)
+		copy->push_back((*ss)->clone());
+	instCache[key] = copy;
+}
+
+/*==============================================================================
+ * FUNCTION:		TableEntry::clearCache
+ * OVERVIEW:		Delete all cached instances
+ * PARAMETERS:		<none>
+ * RETURNS:			<nothing>
+ *============================================================================*/
+void TableEntry::clearCache() {
+	std::map<std::vector<Exp*>, std::list<Statement*>*, lessActuals>::iterator it;
+	for (it = instCache.begin(); it != instCache.end(); it++) {
+		for (std::list<Statement*>::iterator ss = it->second->begin(); ss != it->second->end(); ss++)
+			delete *ss;
+		delete it->second;
+	}
+	instCache.clear();
+}
+
 /*==============================================================================
  * FUNCTION:		RTLInstDict::appendToDict
  * OVERVIEW:		Appends one RTL to the dictionary
@@ -178,22 +303,34 @@ bool RTLInstDict::readSSLFile(const std::string& SSLFileName)
 	// Clear all state
 	reset();
 	
-	// Attempt to Parse the SSL file
-	SSLParser theParser(SSLFileName,
+	std::string cacheName = SSLFileName + ".cache";
+	if (!readCache(cacheName, SSLFileName)) {
+		// Attempt to Parse the SSL file
+		SSLParser theParser(SSLFileName,
 #ifdef DEBUG_SSLPARSER
-	true
+		true
 #else
-	false
+		false
 #endif
-);
-	if (theParser.theScanner == NULL)
-		return false;
-	addRegister( "%CTI", -1, 1, false );
-	addRegister( "%NEXT", -1, 32, false );
-	
-	theParser.yyparse(*this);
+	);
+		if (theParser.theScanner == NULL)
+			return false;
+		addRegister( "%CTI", -1, 1, false );
+		addRegister( "%NEXT", -1, 32, false );
+		
+		theParser.yyparse(*this);
+
+		fixupParams();
+		writeCache(cacheName, SSLFileName);
+	}
 
-	fixupParams();
+	// Compile the templates, now that all the parts of each entry are known, and number them
+	std::map<std::string, TableEntry>::iterator it;
+	for (it = idict.begin(); it != idict.end(); it++) {
+		it->second.compile();
+		it->second.id = idTable.size();
+		idTable.push_back(&it->second);
+	}
 
 	if (Boomerang::get()->debugDecoder) {
 		std::cout << "\n=======Expanded RTL template dictionary=======\n";
@@ -376,6 +513,42 @@ std::pair<std::string,unsigned> RTLInstDict::getSignature(const char* name) {
 	return ret;
 }
 
+/*==============================================================================
+ * FUNCTION:		 RTLInstDict::getOpcodeId
+ * OVERVIEW:		 Returns the opcode id of the given instruction. Only the first lookup of any name does the string
+ *					 work of getSignature; later lookups of the same (static) string are by its address.
+ * PARAMETERS:		 name - the instruction name, as used by the decoders (any case, may contain dots)
+ * RETURNS:			 the opcode id, or -1 if the instruction is not in the dictionary
+ *============================================================================*/
+int RTLInstDict::getOpcodeId(const char* name) {
+	std::map<const char*, int>::iterator ii = nameIds.find(name);
+	if (ii != nameIds.end())
+		return ii->second;
+
+	int id = lookupOpcodeId(name);
+	if (id == -1)
+		std::cerr << "Error: no entry for `" << name << "' in RTL dictionary\n";
+	nameIds[name] = id;
+	return id;
+}
+
+/*==============================================================================
+ * FUNCTION:		 RTLInstDict::lookupOpcodeId
+ * OVERVIEW:		 Returns the opcode id of the given instruction, without caching it or complaining if there is none
+ * PARAMETERS:		 name - the instruction name, as used by the decoders (any case, may contain dots)
+ * RETURNS:			 the opcode id, or -1 if the instruction is not in the dictionary
+ *============================================================================*/
+int RTLInstDict::lookupOpcodeId(const char* name) {
+	char *opcode = new char[strlen(name) + 1];
+	upperStr(name, opcode);
+	std::remove(opcode,opcode+strlen(opcode)+1,'.');
+	std::map<std::string,TableEntry>::iterator it = idict.find(opcode);
+	delete [] opcode;
+	if (it == idict.end())
+		return -1;
+	return it->second.id;
+}
+
 /*==============================================================================
  * FUNCTION:		 RTLInstDict::partialType
  * OVERVIEW:		 Scan the Exp* pointed to by exp; if its top level operator indicates even a partial type, then set
@@ -423,7 +596,102 @@ if (0) {
 	}
 	TableEntry& entry = idict[*lname];
 
-	return instantiateRTL( entry.rtl, natPC, entry.params, actuals );
+	return instantiateRTL( entry, natPC, actuals );
+}
+
+// Replaces each formal parameter (param`name') by a copy of its actual, in a single pass over an expression
+class ParamSubstituter : public ExpModifier {
+		std::map<std::string, Exp*>& subs;		// Formal name to actual
+public:
+					ParamSubstituter(std::map<std::string, Exp*>& subs) : subs(subs) { }
+virtual Exp*		preVisit(Unary* e, bool& recur) {return replace(e, recur);}
+virtual Exp*		preVisit(Location* e, bool& recur) {return replace(e, recur);}
+private:
+		Exp*		replace(Exp* e, bool& recur) {
+						recur = true;
+						if (e->getOper() != opParam || !e->getSubExp1()->isStrConst())
+							return e;
+						std::map<std::string, Exp*>::iterator it = subs.find(((Const*)e->getSubExp1())->getStr());
+						if (it == subs.end())
+							return e;
+						recur = false;
+						mod = true;
+						return it->second->clone();
+					}
+};
+
+/*==============================================================================
+ * FUNCTION:		 RTLInstDict::instantiateRTL
+ * OVERVIEW:		 Returns an instance of a register transfer list for a compiled dictionary entry. The result is the
+ *					 same as for the version taking the template and formals, but only the statements that refer to
+ *					 formals are visited, all the formals are replaced in one pass, and fixSuccessor and
+ *					 transformPostVars are only used if the template can need them. Instances whose actuals are all
+ *					 constants are cached, and copied on later requests.
+ * PARAMETERS:		 entry - the (compiled) dictionary entry
+ *					 actuals - the actual parameter values
+ * RETURNS:			 the instantiated list of Exps
+ *============================================================================*/
+std::list<Statement*>* RTLInstDict::instantiateRTL(TableEntry& entry, ADDRESS natPC, std::vector<Exp*>& actuals) {
+	if (!entry.compiled)
+		return instantiateRTL( entry.rtl, natPC, entry.params, actuals );
+	assert(entry.params.size() == actuals.size());
+	std::list<Statement*>* newList = new std::list<Statement*>();
+	std::list<Statement*>::iterator ss;
+
+	std::list<Statement*>* cached = entry.findInstance(actuals);
+	if (cached) {
+		for (ss = cached->begin(); ss != cached->end(); ss++) {
+			newList->push_back((*ss)->clone());
+			if (Boomerang::get()->debugDecoder)
+				std::cout << "			" << newList->back() << "\n";
+		}
+		return newList;
+	}
+
+	std::map<std::string, Exp*> subs;
+	std::list<std::string>::iterator param = entry.params.begin();
+	std::vector<Exp*>::iterator actual = actuals.begin();
+	for (; param != entry.params.end(); param++, actual++)
+		subs[*param] = *actual;
+	ParamSubstituter ps(subs);
+
+	// Get a deep copy of the template RTL
+	entry.rtl.deepCopyList(*newList);
+
+	std::vector<bool>::iterator uses = entry.usesParams.begin();
+	for (ss = newList->begin(); ss != newList->end(); ss++, uses++) {
+		if (*uses) {
+			if ((*ss)->isAssign()) {
+				Assign* as = (Assign*)*ss;
+				as->setLeft(as->getLeft()->accept(&ps));
+				as->setRight(as->getRight()->accept(&ps));
+				if (as->getGuard())
+					as->setGuard(as->getGuard()->accept(&ps));
+			} else {
+				// Rare; just search for each formal in turn
+				std::map<std::string, Exp*>::iterator it;
+				for (it = subs.begin(); it != subs.end(); it++) {
+					Exp* formal = Location::param(it->first.c_str());
+					(*ss)->searchAndReplace(formal, it->second);
+				}
+			}
+		}
+		if (entry.hasSuccessor)
+			(*ss)->fixSuccessor();
+		if (Boomerang::get()->debugDecoder)
+			std::cout << "			" << *ss << "\n";
+	}
+
+	if (entry.hasPostVars)
+		transformPostVars( newList, true );
+
+	// Perform simplifications, e.g. *1 in Pentium addressing modes
+	for (ss = newList->begin(); ss != newList->end(); ss++) {
+		(*ss)->simplify();
+	}
+
+	entry.addInstance(actuals, newList);
+	return newList;
 }
 
 /*==============================================================================
@@ -645,6 +913,10 @@ void RTLInstDict::reset() {
 	DefMap.clear();
 	AliasMap.clear();
 	fastMap.clear();
+	idTable.clear();
+	nameIds.clear();
+	for (std::map<std::string, TableEntry>::iterator it = idict.begin(); it != idict.end(); it++)
+		it->second.clearCache();
 	idict.clear();
 	fetchExecCycle = 0;
 }
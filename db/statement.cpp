@@ -17,6 +17,9 @@
  * $Revision: 1.235 $	// 1.148.2.38
  * 03 Jul 02 - Trent: Created
  * 25 Jul 03 - Mike: dataflow.cpp, hrtl.cpp -> statement.cpp
+ * 17 Oct 26 - Def-use chains; the -l limit uses them instead of a map of destination counts
+ * 17 Oct 26 - The sets of locations used by propagation are in the proc's scratch region
+ * 17 Oct 26 - bypass returns true if it changed anything; convertToAssign keeps the def-use chains
  */
 
 /*==============================================================================
@@ -35,6 +38,7 @@
 #include "proc.h"
 #include "prog.h"
 #include "boomerang.h"
+#include "threads.h"
 #include "rtl.h"			// For debugging code
 #include "util.h"
 #include "signature.h"
@@ -712,22 +716,20 @@ bool Statement::canPropagateToExp(Exp*e) {
 }
 
 // Return true if any change; set convert if an indirect call statement is converted to direct (else unchanged)
-// destCounts is a set of maps from location to number of times it is used this proc
+// limit is true to apply the -l limit, using the number of uses of each definition from the def-use chains
 // usedByDomPhi is a set of subscripted locations used in phi statements
-static int progress = 0;
-bool Statement::propagateTo(bool& convert, std::map<Exp*, int, lessExpStar>* destCounts /* = NULL */,
-		LocationSet* usedByDomPhi /* = NULL */, bool force /* = false */) {
-	if (++progress > 1000) {
+static volatile int progress = 0;		// Shared by all threads; only for the progress dots
+bool Statement::propagateTo(bool& convert, bool limit /* = false */, LocationSet* usedByDomPhi /* = NULL */,
+		bool force /* = false */) {
+	if (atomicIncrement(&progress) % 1000 == 0)
 		std::cerr << 'p' << std::flush;
-		progress = 0;
-	}
 	bool change;
 	int changes = 0;
 	// int sp = proc->getSignature()->getStackRegister(proc->getProg());
 	// Exp* regSp = Location::regOf(sp);
 	int propMaxDepth = Boomerang::get()->propMaxDepth;
 	do {
-		LocationSet exps;
+		LocationSet exps(proc ? proc->getScratch() : NULL);		// Only needed for this iteration
 		addUsedLocs(exps, true);		// True to also add uses from collectors. For example, want to propagate into
 										// the reaching definitions of calls. Third parameter defaults to false, to
 										// find all locations, not just those inside m[...]
@@ -770,7 +772,7 @@ bool Statement::propagateTo(bool& convert, std::map<Exp*, int, lessExpStar>* des
 				//		domNum(def) <= domNum(OW) && dimNum(OW) < domNum(def)
 				//		if so, don't propagate (heuristic takes effect)
 				if (usedByDomPhi) {
-					LocationSet rhsComps;
+					LocationSet rhsComps(proc->getScratch());
 					rhs->addUsedLocs(rhsComps);
 					LocationSet::iterator rcit;
 					bool doNotPropagate = false;
@@ -816,9 +818,8 @@ if (OW) std::cerr << "Ow is " << OW << "\n";
 #endif
 
 			// Check if the -l flag (propMaxDepth) prevents this propagation
-			if (destCounts && !lhs->isFlags()) {			// Always propagate to %flags
-				std::map<Exp*, int, lessExpStar>::iterator ff = destCounts->find(e);
-				if (ff != destCounts->end() && ff->second > 1 && rhs->getComplexityDepth(proc) >= propMaxDepth) {
+			if (limit && !lhs->isFlags()) {					// Always propagate to %flags
+				if (def->getNumUses() > 1 && rhs->getComplexityDepth(proc) >= propMaxDepth) {
 					if (!def->getRight()->containsFlags()) {
 						// This propagation is prevented by the -l limit
 						continue;
@@ -839,7 +840,7 @@ bool Statement::propagateFlagsTo() {
 	bool change = false, convert;
 	int changes = 0;
 	do {
-		LocationSet exps;
+		LocationSet exps(proc ? proc->getScratch() : NULL);		// Only needed for this iteration
 		addUsedLocs(exps, true);
 		LocationSet::iterator ll;
 		for (ll = exps.begin(); ll != exps.end(); ll++) {
@@ -858,6 +859,42 @@ bool Statement::propagateFlagsTo() {
 }
 
 
+// Find the definitions referred to by this statement's expressions (not including collectors), once per reference
+void Statement::findUsedDefs() {
+	usedDefs.clear();
+	DefUseFinder duf(usedDefs);
+	StmtExpVisitor sev(&duf);
+	accept(&sev);
+}
+
+// Enter this statement in the def-use chains of the definitions in usedDefs
+void Statement::addDefUses() {
+	std::vector<Statement*>::iterator dd;
+	for (dd = usedDefs.begin(); dd != usedDefs.end(); ++dd)
+		(*dd)->users.insert(this);
+}
+
+// Remove this statement from the def-use chains of the definitions in usedDefs
+void Statement::removeDefUses() {
+	std::vector<Statement*>::iterator dd;
+	for (dd = usedDefs.begin(); dd != usedDefs.end(); ++dd) {
+		std::multiset<Statement*>::iterator uu = (*dd)->users.find(this);
+		if (uu != (*dd)->users.end())
+			(*dd)->users.erase(uu);			// Only one of them
+	}
+	usedDefs.clear();
+}
+
+// True if any expression of this statement refers to an ordinary assignment. If not, there is nothing that
+// propagateTo() or propagateFlagsTo() could propagate here (except into collectors)
+bool Statement::usesAssign() {
+	std::vector<Statement*>::iterator dd;
+	for (dd = usedDefs.begin(); dd != usedDefs.end(); ++dd)
+		if ((*dd)->isAssign())
+			return true;
+	return false;
+}
+
 // Parameter convert is set true if an indirect call is converted to direct
 // Return true if a change made
 // Note: this procedure does not control what part of this statement is propagated to
@@ -4103,13 +4140,14 @@ bool BoolAssign::accept(StmtPartModifier* v) {
 	return true;
 }
 
-// Fix references to the returns of call statements
-void Statement::bypass() {
+// Fix references to the returns of call statements. Return true if any reference changed
+bool Statement::bypass() {
 	CallBypasser cb(this);
 	StmtPartModifier sm(&cb);			// Use the Part modifier so we don't change the top level of LHS of assigns etc
 	accept(&sm);
 	if (cb.isTopChanged())
 		simplify();						// E.g. m[esp{20}] := blah -> m[esp{-}-20+4] := blah
+	return cb.isMod();
 }
 
 // Find the locations used by expressions in this Statement.
@@ -4156,11 +4194,17 @@ void PhiAssign::convertToAssign(Exp* rhs) {
 	Exp* lhs_ = lhs;
 	Exp* rhs_ = rhs;
 	Type* type_ = type;
+	std::multiset<Statement*> users_;				// Keep the def-use chains (see UserProc::stmtChanged())
+	std::vector<Statement*> usedDefs_;
+	users_.swap(users);
+	usedDefs_.swap(usedDefs);
 	this->~PhiAssign(); 							// Explicitly destroy this, but keep the memory allocated.
 	Assign* a = new(this) Assign(type_, lhs_, rhs_);// construct in-place. Note that 'a' == 'this' 
 	a->setNumber(n); 
 	a->setProc(p); 
 	a->setBB(bb); 
+	users.swap(users_);
+	usedDefs.swap(usedDefs_);
 //	RTL* rtl = bb->getRTLWithStatement(this);
 //	if (rtl->getAddress() == 0)
 //		rtl->setAddress(1);				// Strange things happen to real assignments with address 0
@@ -5033,14 +5077,6 @@ void PhiAssign::enumerateParams(std::list<Exp*>& le) {
 	}
 }
 
-// For debugging
-void dumpDestCounts(std::map<Exp*, int, lessExpStar>* destCounts) {
-	std::map<Exp*, int, lessExpStar>::iterator it;
-	for (it = destCounts->begin(); it != destCounts->end(); ++it) {
-		std::cerr << std::setw(4) << std::dec << it->second << " " << it->first << "\n";
-	}
-}
-
 bool JunctionStatement::accept(StmtVisitor* visitor)
 {
 	return true;
@@ -8,6 +8,7 @@
 /*
  * $Revision: 1.59 $
  *
+ * 17 Oct 26 - DefUseFinder (for def-use chains) replaces ExpDestCounter and StmtDestCounter
  * 18 Aug 06 - Mike: Moved DfaLocalMapper here from type/dfa.cpp
  * 14 Jun 04 - Mike: Created, from work started by Trent in 2003
  */
@@ -846,18 +847,14 @@ Exp* ConstGlobalConverter::preVisit(RefExp* e, bool& recur) {
 	return e;
 }
 
-bool ExpDestCounter::visit(RefExp *e, bool& override) {
-	if (Statement::canPropagateToExp(e))
-		destCounts[e]++;
+bool DefUseFinder::visit(RefExp *e, bool& override) {
+	Statement* def = e->getDef();
+	if (def)
+		defs.push_back(def);
 	override = false;		// Continue searching my children
 	return true;			// Continue visiting the rest of Exp* e
 }
 
-bool StmtDestCounter::visit(PhiAssign *stmt, bool& override) {
-	override = false;
-	return true;
-}
-
 
 bool FlagsFinder::visit(Binary *e,	bool& override) {
 	if (e->isFlagCall()) {
@@ -285,7 +285,7 @@ void XMLProgParser::addToContext_prog(Context *c, int e)
 		c->prog->m_rootCluster = stack.front()->cluster;
 		break;
 	case e_global:
-		c->prog->globals.insert(stack.front()->global);
+		c->prog->addGlobal(stack.front()->global);
 		break;
 	default:
 		if (e == e_unknown)
@@ -2134,6 +2134,7 @@ Prog *XMLProgParser::parse(const char *filename)
 	}
 	if (prog == NULL)
 		return NULL;
+	prog->indexProcs();
 	//FrontEnd *pFE = FrontEnd::Load(prog->getPath(), prog);		// Path is usually empty!?
 	FrontEnd *pFE = FrontEnd::Load(prog->getPathAndName(), prog);
 	prog->setFrontEnd(pFE);
@@ -18,9 +18,12 @@
  * $Revision: 1.26 $
  *
  * 30 Aug 05 - Mike: Added init_dfa() etc for garbage collection safety
+ * 17 Oct 26 - operator new counts the objects allocated, for Phase
  */
 
 #include "boomerang.h"
+#include "threads.h"
+#include "phase.h"
 //#define GC_DEBUG 1		// Uncomment to debug the garbage collector
 #include "gc.h"
 
@@ -45,6 +48,8 @@ int main(int argc, const char* argv[]) {
 /* This makes sure that the garbage collector sees all allocations, even those
 	that we can't be bothered collecting, especially standard STL objects */
 void* operator new(size_t n) {
+	if (Phase::active)
+		atomicAdd(&Phase::objects, 1);
 #ifdef DONT_COLLECT_STL
 	return GC_malloc_uncollectable(n);	// Don't collect, but mark
 #else
@@ -8,6 +8,8 @@
  *
  * 05 Apr 02 - Mike: Created
  * 21 May 02 - Mike: Mods for gcc 3.1
+ * 17 Oct 26 - testPredecode
+ * 17 Oct 26 - testDecodeCache
  */
 
 #define HELLO_PENT		"test/pentium/hello"
@@ -24,6 +26,10 @@
 #include "pentiumfrontend.h"
 #include "BinaryFile.h"
 #include "BinaryFileStub.h"
+#include "boomerang.h"
+#include "proc.h"
+#include "cfg.h"
+#include "decodecache.h"
 
 /*==============================================================================
  * FUNCTION:		FrontPentTest::registerTests
@@ -41,6 +47,8 @@ void FrontPentTest::registerTests(CppUnit::TestSuite* suite) {
 	MYTEST(test3);
 	MYTEST(testBranch);
 	MYTEST(testFindMain);
+	MYTEST(testPredecode);
+	MYTEST(testDecodeCache);
 }
 
 int FrontPentTest::countTestCases () const
@@ -281,3 +289,89 @@ void FrontPentTest::testFindMain() {
 
 	delete pFE;
 }
+
+// Decode all of SUSE_TRUE on numThreads threads, and print its procs and their CFGs
+static std::string decodeAll(int numThreads) {
+	Boomerang::get()->numThreads = numThreads;
+	BinaryFileFactory bff;
+	BinaryFile* pBF = bff.Load(SUSE_TRUE);
+	CPPUNIT_ASSERT(pBF != NULL);
+	Prog* prog = new Prog;
+	FrontEnd* pFE = new PentiumFrontEnd(pBF, prog, &bff);
+	prog->setFrontEnd(pFE);
+	pFE->decode(prog, true);
+	pFE->decode(prog, NO_ADDRESS);
+	std::ostringstream ost;
+	PROGMAP::const_iterator it;
+	for (Proc* p = prog->getFirstProc(it); p; p = prog->getNextProc(it)) {
+		ost << p->getName() << " " << std::hex << p->getNativeAddress() << std::dec << "\n";
+		if (!p->isLib())
+			((UserProc*)p)->getCFG()->print(ost);
+	}
+	Boomerang::get()->numThreads = 1;
+	return ost.str();
+}
+
+/*==============================================================================
+ * FUNCTION:		FrontPentTest::testPredecode
+ * OVERVIEW:		Test that decoding with the instructions predecoded on several threads gives the same procs and
+ *					  CFGs as decoding on one
+ *============================================================================*/
+void FrontPentTest::testPredecode() {
+	std::string expected = decodeAll(1);
+	std::string actual = decodeAll(4);
+	CPPUNIT_ASSERT(expected.size() > 0);
+	CPPUNIT_ASSERT_EQUAL(expected, actual);
+}
+
+/*==============================================================================
+ * FUNCTION:		FrontPentTest::testDecodeCache
+ * OVERVIEW:		Test that an instruction decoded again is a clone from the decode cache, and that the least
+ *					  recently used instructions are dropped when the cache is full
+ *============================================================================*/
+void FrontPentTest::testDecodeCache() {
+	BinaryFileFactory bff;
+	BinaryFile *pBF = bff.Load(HELLO_PENT);
+	if (pBF == NULL)
+		pBF = new BinaryFileStub();
+	CPPUNIT_ASSERT(pBF != 0);
+	Prog* prog = new Prog;
+	FrontEnd *pFE = new PentiumFrontEnd(pBF, prog, &bff);
+	prog->setFrontEnd(pFE);
+	DecodeCache* cache = pFE->getDecodeCache();
+
+	ADDRESS addr = 0x804833b;
+	DecodeResult inst = pFE->decodeInstruction(addr);
+	CPPUNIT_ASSERT_EQUAL(0UL, cache->getHits());
+	CPPUNIT_ASSERT_EQUAL(1UL, cache->getMisses());
+	std::ostringstream o1;
+	inst.rtl->print(o1);
+	RTL* first = inst.rtl;
+	first->clear();							// As if changed by the caller; the cached RTL is not
+
+	DecodeResult again = pFE->decodeInstruction(addr);
+	CPPUNIT_ASSERT_EQUAL(1UL, cache->getHits());
+	CPPUNIT_ASSERT_EQUAL(1UL, cache->getMisses());
+	CPPUNIT_ASSERT(again.rtl != first);
+	CPPUNIT_ASSERT_EQUAL(inst.numBytes, again.numBytes);
+	std::ostringstream o2;
+	again.rtl->print(o2);
+	std::string expected(
+		"0804833b    0 *32* m[r28 - 4] := 0x80483fc\n"
+		"            0 *32* r28 := r28 - 4\n");
+	CPPUNIT_ASSERT_EQUAL(expected, o1.str());
+	CPPUNIT_ASSERT_EQUAL(expected, o2.str());
+
+	// Room for only one of these two instructions: the first is dropped
+	size_t size = DecodeCache::estimateSize(again.rtl);
+	DecodeCache small(size + size / 2);
+	small.add(addr, again);
+	DecodeResult r;
+	CPPUNIT_ASSERT(small.lookup(addr, r));
+	small.add(addr + again.numBytes, again);
+	CPPUNIT_ASSERT(!small.lookup(addr, r));
+	CPPUNIT_ASSERT(small.lookup(addr + again.numBytes, r));
+	CPPUNIT_ASSERT(small.getBytes() <= small.getMaxBytes());
+
+	delete pFE;
+}
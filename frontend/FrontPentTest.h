@@ -26,5 +26,7 @@ class FrontPentTest : public CppUnit::TestCase {
 	void test3 ();
 	void testBranch();
 	void testFindMain();
+	void testPredecode();
+	void testDecodeCache();
 };
 
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   decodecache.cpp
+ * OVERVIEW:   Implementation of class DecodeCache
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created
+ */
+
+#include <assert.h>
+#include <list>
+#include <map>
+#include "types.h"
+#include "exp.h"
+#include "statement.h"
+#include "rtl.h"
+#include "visitor.h"
+#include "decoder.h"
+#include "threads.h"
+#include "decodecache.h"
+
+DecodeCache::DecodeCache(size_t maxBytes) : bytes(0), maxBytes(maxBytes), hits(0), misses(0), evictions(0) {
+}
+
+DecodeCache::~DecodeCache() {
+	clear();
+}
+
+bool DecodeCache::lookup(ADDRESS pc, DecodeResult& r) {
+	MutexLock ml(mutex);
+	std::map<ADDRESS, Entry>::iterator it = entries.find(pc);
+	if (it == entries.end()) {
+		misses++;
+		return false;
+	}
+	hits++;
+	Entry& e = it->second;
+	lru.splice(lru.begin(), lru, e.lru);			// Now the most recently used
+	r = e.result;
+	r.rtl = e.result.rtl ? e.result.rtl->clone() : NULL;
+	r.newProcCall = NULL;
+	if (e.callIndex != -1)
+		r.newProcCall = (CallStatement*)r.rtl->elementAt(e.callIndex);
+	return true;
+}
+
+void DecodeCache::add(ADDRESS pc, DecodeResult& r) {
+	assert(r.valid && r.reusable && !r.reDecode);
+	if (maxBytes == 0)
+		return;
+	size_t size = estimateSize(r.rtl);
+	if (size > maxBytes)
+		return;
+	int callIndex = -1;
+	if (r.newProcCall) {
+		std::list<Statement*>& sl = r.rtl->getList();
+		std::list<Statement*>::iterator ss;
+		int i = 0;
+		for (ss = sl.begin(); ss != sl.end(); ss++, i++)
+			if (*ss == r.newProcCall)
+				break;
+		if (ss == sl.end())
+			return;				// Not in the RTL: can't say which call of a clone it would be
+		callIndex = i;
+	}
+
+	RTL* rtl = r.rtl ? r.rtl->clone() : NULL;		// Before the caller changes it
+	MutexLock ml(mutex);
+	if (entries.find(pc) != entries.end()) {
+		delete rtl;					// Already cached
+		return;
+	}
+	while (bytes + size > maxBytes && !lru.empty()) {
+		evict(entries.find(lru.back()));
+		evictions++;
+	}
+	Entry& e = entries[pc];
+	e.result = r;
+	e.result.rtl = rtl;
+	e.result.newProcCall = NULL;
+	e.callIndex = callIndex;
+	e.bytes = size;
+	e.lru = lru.insert(lru.begin(), pc);
+	bytes += size;
+}
+
+void DecodeCache::evict(std::map<ADDRESS, Entry>::iterator it) {
+	bytes -= it->second.bytes;
+	lru.erase(it->second.lru);
+	delete it->second.result.rtl;
+	entries.erase(it);
+}
+
+void DecodeCache::clear() {
+	MutexLock ml(mutex);
+	while (!entries.empty())
+		evict(entries.begin());
+}
+
+void DecodeCache::report(std::ostream& os) {
+	MutexLock ml(mutex);
+	os << "decode cache: " << hits << " hits, " << misses << " misses, " << evictions << " evictions, " <<
+		entries.size() << " instructions (about " << bytes << " of " << maxBytes << " bytes)\n";
+}
+
+// Adds up the sizes of the nodes of an expression
+class ExpSizeCounter : public ExpVisitor {
+public:
+		size_t		bytes;
+					ExpSizeCounter() : bytes(0) {}
+virtual bool		visit(Unary *e,		bool& override) {bytes += sizeof(Unary);	override = false; return true;}
+virtual bool		visit(Binary *e,	bool& override) {bytes += sizeof(Binary);	override = false; return true;}
+virtual bool		visit(Ternary *e,	bool& override) {bytes += sizeof(Ternary);	override = false; return true;}
+virtual bool		visit(TypedExp *e,	bool& override) {bytes += sizeof(TypedExp);	override = false; return true;}
+virtual bool		visit(FlagDef *e,	bool& override) {bytes += sizeof(FlagDef);	override = false; return true;}
+virtual bool		visit(RefExp *e,	bool& override) {bytes += sizeof(RefExp);	override = false; return true;}
+virtual bool		visit(Location *e,	bool& override) {bytes += sizeof(Location);	override = false; return true;}
+virtual bool		visit(Const *e	 ) {bytes += sizeof(Const);		return true;}
+virtual bool		visit(Terminal *e) {bytes += sizeof(Terminal);	return true;}
+virtual bool		visit(TypeVal *e ) {bytes += sizeof(TypeVal);	return true;}
+};
+
+// Adds up the sizes of the statements (the expressions are counted by its ExpSizeCounter)
+class StmtSizeCounter : public StmtExpVisitor {
+public:
+		size_t		bytes;
+					StmtSizeCounter(ExpSizeCounter* esc) : StmtExpVisitor(esc), bytes(0) {}
+virtual bool		visit(         Assign *s, bool& override) {bytes += sizeof(Assign);			override = false; return true;}
+virtual bool		visit(      PhiAssign *s, bool& override) {bytes += sizeof(PhiAssign);		override = false; return true;}
+virtual bool		visit( ImplicitAssign *s, bool& override) {bytes += sizeof(ImplicitAssign);	override = false; return true;}
+virtual bool		visit(     BoolAssign *s, bool& override) {bytes += sizeof(BoolAssign);		override = false; return true;}
+virtual bool		visit(  GotoStatement *s, bool& override) {bytes += sizeof(GotoStatement);	override = false; return true;}
+virtual bool		visit(BranchStatement *s, bool& override) {bytes += sizeof(BranchStatement);	override = false; return true;}
+virtual bool		visit(  CaseStatement *s, bool& override) {bytes += sizeof(CaseStatement);	override = false; return true;}
+virtual bool		visit(  CallStatement *s, bool& override) {bytes += sizeof(CallStatement);	override = false; return true;}
+virtual bool		visit(ReturnStatement *s, bool& override) {bytes += sizeof(ReturnStatement);	override = false; return true;}
+virtual bool		visit(ImpRefStatement *s, bool& override) {bytes += sizeof(ImpRefStatement);	override = false; return true;}
+};
+
+size_t DecodeCache::estimateSize(RTL* rtl) {
+	// The RTL itself, and the entry that refers to it (a map node and a list node)
+	size_t bytes = sizeof(Entry) + 8 * sizeof(void*);
+	if (rtl == NULL)
+		return bytes;
+	bytes += sizeof(RTL);
+	ExpSizeCounter esc;
+	StmtSizeCounter ssc(&esc);
+	std::list<Statement*>& sl = rtl->getList();
+	for (std::list<Statement*>::iterator ss = sl.begin(); ss != sl.end(); ss++) {
+		(*ss)->accept(&ssc);
+		bytes += 3 * sizeof(void*);				// The node of the RTL's list
+	}
+	return bytes + ssc.bytes + esc.bytes;
+}
@@ -24,8 +24,15 @@
  * 22 Nov 02 - Mike: Quelched warnings
  * 16 Apr 03 - Mike: trace (-t) to cerr not cout now
  * 02 Feb 05 - Gerard: Check for thunks to library functions and don't create procs for these
+ * 17 Oct 26 - processProc updates the Prog's address ranges of the proc
+ * 17 Oct 26 - Library signatures are read from precompiled databases, and parsed when first looked up
+ * 17 Oct 26 - With -j, instructions are predecoded on worker threads
+ * 17 Oct 26 - Instructions decoded again are cloned from the DecodeCache
+ * 17 Oct 26 - LOG statements are in the LCAT_DECODE log category
  */
 
+#define LOG_CATEGORY LCAT_DECODE		// The category of this file's LOG statements (see boomerang.h)
+
 #include <assert.h>
 #include <cstring>
 #include <stdlib.h>
@@ -35,6 +42,8 @@
 
 #include "frontend.h"
 #include <queue>
+#include <deque>
+#include <set>
 #include <stdarg.h>			// For varargs
 #include <sstream>
 #ifndef _WIN32
@@ -59,6 +68,11 @@
 #include "boomerang.h"
 #include "log.h"
 #include "ansi-c-parser.h"
+#include "sigdb.h"
+#include "threads.h"
+#include "scheduler.h"
+#include "phase.h"
+#include "decodecache.h"
 
 /*==============================================================================
  * FUNCTION:	  FrontEnd::FrontEnd
@@ -68,7 +82,9 @@
  *				  pbff: pointer to a BinaryFileFactory object (so the library can be unloaded)
  * RETURNS:		  <N/a>
  *============================================================================*/
-FrontEnd::FrontEnd(BinaryFile *pBF, Prog* prog, BinaryFileFactory* pbff) : pBF(pBF), pbff(pbff), prog(prog)
+FrontEnd::FrontEnd(BinaryFile *pBF, Prog* prog, BinaryFileFactory* pbff) : pBF(pBF), pbff(pbff), prog(prog),
+		predecodedResult(NULL), decodeCache(new DecodeCache(Boomerang::get()->decodeCacheBytes)),
+		cachedResult(new DecodeResult), reDecodeAt(NO_ADDRESS)
 {}
 
 // Static function to instantiate an appropriate concrete front end
@@ -100,6 +116,14 @@ FrontEnd* FrontEnd::Load(const char *fname, Prog* prog) {
 
 // destructor
 FrontEnd::~FrontEnd() {
+	for (unsigned i = 0; i < libraryDBs.size(); i++)
+		delete libraryDBs[i];
+	dropPredecoded();
+	delete predecodedResult;
+	delete decodeCache;
+	delete cachedResult;
+	for (unsigned i = 0; i < workerDecoders.size(); i++)
+		delete workerDecoders[i];
 	if (pbff)
 		pbff->UnLoad();			// Unload the BinaryFile library with dlclose() or FreeLibrary()
 }
@@ -149,6 +173,7 @@ void FrontEnd::readLibraryCatalog(const char *sPath) {
 		exit(1);
 	}
 
+	std::vector<SignatureDB::Source> sources;
 	while (!inf.eof()) {
 		std::string sFile;
 		inf >> sFile;
@@ -162,13 +187,26 @@ void FrontEnd::readLibraryCatalog(const char *sPath) {
 		callconv cc = CONV_C;			// Most APIs are C calling convention
 		if (sFile == "windows.h")	cc = CONV_PASCAL;		// One exception
 		if (sFile == "mfc.h")		cc = CONV_THISCALL;		// Another exception
-		readLibrarySignatures(sPath.c_str(), cc);
+		sources.push_back(SignatureDB::Source(sFile, sPath, cc));
 	}
 	inf.close();
+
+	// The database for e.g. signatures/common.hs on pentium is signatures/common.pentium.sigdb
+	std::string dbPath(sPath);
+	if (dbPath.size() > 3 && dbPath.substr(dbPath.size()-3) == ".hs")
+		dbPath = dbPath.substr(0, dbPath.size()-3);
+	dbPath = dbPath + "." + Signature::platformName(getFrontEndId()) + ".sigdb";
+	SignatureDB* db = new SignatureDB;
+	db->open(dbPath.c_str(), sources, getFrontEndId());
+	db->readTypes();
+	libraryDBs.push_back(db);
 }
 
 void FrontEnd::readLibraryCatalog() {
 	librarySignatures.clear();
+	for (unsigned i = 0; i < libraryDBs.size(); i++)
+		delete libraryDBs[i];
+	libraryDBs.clear();
 	std::string sList = Boomerang::get()->getProgPath() + "signatures/common.hs";
 
 	readLibraryCatalog(sList.c_str());
@@ -261,15 +299,25 @@ void FrontEnd::decode(Prog* prog, bool decodeMain, const char *pname) {
 	ADDRESS a = getMainEntryPoint(gotMain);
 	if (VERBOSE)
 		LOG << "start: " << a << " gotmain: " << (gotMain ? "true" : "false") << "\n";
+	std::vector<ADDRESS> entrypoints;
+	if (a == NO_ADDRESS)
+		entrypoints = getEntryPoints();
+	else
+		entrypoints.push_back(a);
+	if (Boomerang::get()->numThreads > 1)
+		predecode(entrypoints, !Boomerang::get()->noDecodeChildren);
 	if (a == NO_ADDRESS) {
-		std::vector<ADDRESS> entrypoints = getEntryPoints();
 		for (std::vector<ADDRESS>::iterator it = entrypoints.begin(); it != entrypoints.end(); it++)
 			decode(prog, *it);
+		if (Boomerang::get()->noDecodeChildren)
+			dropPredecoded();				// Else still wanted by decode(prog, NO_ADDRESS)
 		return;
 	}
 
 	decode(prog, a);
 	prog->setEntryPoint(a);
+	if (Boomerang::get()->noDecodeChildren)
+		dropPredecoded();
 
 	if (gotMain) {
 		static const char *mainName[] = { "main", "WinMain", "DriverEntry" };
@@ -289,7 +337,7 @@ void FrontEnd::decode(Prog* prog, bool decodeMain, const char *pname) {
 					LOG << "unable to find signature for known entrypoint " << name << "\n";
 				else {
 					proc->setSignature(fty->getSignature()->clone());
-					proc->getSignature()->setName(name);
+					proc->setName(name);
 					//proc->getSignature()->setFullSig(true);		// Don't add or remove parameters
 					proc->getSignature()->setForced(true);			// Don't add or remove parameters
 				}
@@ -345,6 +393,7 @@ void FrontEnd::decode(Prog *prog, ADDRESS a) {
 			if (Boomerang::get()->noDecodeChildren)
 				break;
 		}
+		dropPredecoded();
 	}
 	prog->wellForm();
 }
@@ -367,7 +416,30 @@ void FrontEnd::decodeFragment(UserProc* proc, ADDRESS a) {
 	processProc(a, proc, os, true);
 }
 
+// Set the destination proc of the call of r whose proc was not set by the decoder, if any; what the decoder would have
+// done, had it decoded the instruction now
+static void setNewProc(Prog* prog, DecodeResult& r) {
+	if (r.newProcCall == NULL)
+		return;
+	Proc* destProc = prog->setNewProc(r.newProcDest);
+	if (destProc == (Proc*)-1) destProc = NULL;
+	r.newProcCall->setDestProc(destProc);
+}
+
 DecodeResult& FrontEnd::decodeInstruction(ADDRESS pc) {
+	if (predecoded.size()) {
+		std::map<ADDRESS, DecodeResult*>::iterator pp = predecoded.find(pc);
+		if (pp != predecoded.end()) {
+			// Each is used once, as the caller changes the RTL. If the same instruction is wanted again, it comes
+			// from the cache, as it would have without predecoding
+			delete predecodedResult;
+			predecodedResult = pp->second;
+			predecoded.erase(pp);
+			setNewProc(prog, *predecodedResult);
+			decodeCache->add(pc, *predecodedResult);
+			return *predecodedResult;
+		}
+	}
 	if (pBF->GetSectionInfoByAddr(pc) == NULL) {
 		LOG << "ERROR: attempted to decode outside any known segment " << pc << "\n";
 		static DecodeResult invalid;
@@ -375,7 +447,207 @@ DecodeResult& FrontEnd::decodeInstruction(ADDRESS pc) {
 		invalid.valid = false;
 		return invalid;
 	}
-	return decoder->decodeInstruction(pc, pBF->getTextDelta());
+	// An instruction decoded in several steps (reDecode, by a state machine in the decoder) is decoded every time;
+	// none of its steps are cached, nor looked up
+	bool steps = pc == reDecodeAt;
+	if (!steps && decodeCache->lookup(pc, *cachedResult)) {
+		setNewProc(prog, *cachedResult);
+		return *cachedResult;
+	}
+	DecodeResult& r = decoder->decodeInstruction(pc, pBF->getTextDelta());
+	if (r.reDecode)
+		reDecodeAt = pc;
+	else {
+		reDecodeAt = NO_ADDRESS;
+		if (!steps && r.valid && r.reusable)
+			decodeCache->add(pc, r);
+	}
+	return r;
+}
+
+// The state shared by the threads of predecode()
+struct Predecoder {
+	BinaryFile*	pBF;
+	bool		callees;				// Also decode the procs called
+	std::vector<NJMCDecoder*>* decoders;	// One per thread
+	std::vector<std::map<ADDRESS, DecodeResult> > decoded;	// The instructions decoded by each thread
+	Mutex		mutex;					// Guards the below
+	Condition	changed;				// Signalled when a proc is queued, or the last one is done
+	std::deque<ADDRESS> queue;			// The entry addresses of the procs still to be decoded
+	std::set<ADDRESS> seen;				// The procs queued so far
+	int			busy;					// The number of threads decoding a proc
+};
+
+// Queue the proc at a, if it hasn't been already
+static void queueProc(Predecoder& pd, ADDRESS a) {
+	MutexLock ml(pd.mutex);
+	if (pd.seen.insert(a).second) {
+		pd.queue.push_back(a);
+		pd.changed.broadcast();
+	}
+}
+
+// Take the next proc to decode. Returns false when none are queued, and none are being decoded (which could queue
+// more)
+static bool nextProc(Predecoder& pd, ADDRESS& a) {
+	MutexLock ml(pd.mutex);
+	while (pd.queue.empty()) {
+		if (pd.busy == 0)
+			return false;
+		pd.changed.wait(pd.mutex);
+	}
+	a = pd.queue.front();
+	pd.queue.pop_front();
+	pd.busy++;
+	return true;
+}
+
+static void procDone(Predecoder& pd) {
+	MutexLock ml(pd.mutex);
+	if (--pd.busy == 0 && pd.queue.empty())
+		pd.changed.broadcast();
+}
+
+// Decode the instruction at pc into decoded, unless it can't be predecoded. Returns the result, or NULL
+static DecodeResult* predecodeInst(Predecoder& pd, NJMCDecoder* decoder, std::map<ADDRESS, DecodeResult>& decoded,
+		ADDRESS pc) {
+	DecodeResult& inst = decoder->decodeInstruction(pc, pd.pBF->getTextDelta());
+	if (inst.reDecode) {
+		// Decoded in several steps, by a state machine in the decoder. Finish with it, but leave the instruction to be
+		// decoded when it is needed
+		while (decoder->decodeInstruction(pc, pd.pBF->getTextDelta()).reDecode)
+			;
+		return NULL;
+	}
+	if (!inst.valid || !inst.reusable || inst.numBytes <= 0)
+		return NULL;
+	return &(decoded[pc] = inst);
+}
+
+// Decode the instructions of the proc at entry, following its control flow, and queue the procs that it calls. This
+// need not be exact: an instruction not decoded here is just decoded when it is needed, and one decoded in vain is
+// dropped at the end
+static void predecodeProc(Predecoder& pd, NJMCDecoder* decoder, std::map<ADDRESS, DecodeResult>& decoded,
+		ADDRESS entry) {
+	BinaryFile* pBF = pd.pBF;
+	ADDRESS low = pBF->getLimitTextLow(), high = pBF->getLimitTextHigh();
+	std::vector<ADDRESS> targets;
+	targets.push_back(entry);
+	while (targets.size()) {
+		ADDRESS pc = targets.back();
+		targets.pop_back();
+		while (pc >= low && pc < high && decoded.find(pc) == decoded.end() && pBF->GetSectionInfoByAddr(pc)) {
+			DecodeResult* inst = predecodeInst(pd, decoder, decoded, pc);
+			if (inst == NULL)
+				break;
+			bool fallThrough = true;
+			Statement* last = NULL;
+			if (inst->rtl && inst->rtl->getList().size())
+				last = inst->rtl->getList().back();
+			if (last) {
+				ADDRESS dest;
+				switch (last->getKind()) {
+					case STMT_GOTO:
+						dest = ((GotoStatement*)last)->getFixedDest();
+						if (dest != NO_ADDRESS)
+							targets.push_back(dest);
+						fallThrough = false;
+						break;
+					case STMT_BRANCH:
+						targets.push_back(((BranchStatement*)last)->getFixedDest());
+						break;
+					case STMT_CASE:
+					case STMT_RET:
+						fallThrough = false;
+						break;
+					case STMT_CALL:
+						dest = ((CallStatement*)last)->getFixedDest();
+						if (pd.callees && dest != NO_ADDRESS && dest >= low && dest < high &&
+								!pBF->IsDynamicLinkedProc(dest))
+							queueProc(pd, dest);
+						break;
+					default:
+						break;
+				}
+			}
+			if (!fallThrough) {
+				// The delay slot of a delayed jump (e.g. on SPARC) is still wanted, but nothing after it
+				ADDRESS slot = pc + inst->numBytes;
+				if ((inst->type == SD || inst->type == DD) && slot < high && decoded.find(slot) == decoded.end())
+					predecodeInst(pd, decoder, decoded, slot);
+				break;
+			}
+			pc += inst->numBytes;
+		}
+	}
+}
+
+// The body of each thread of predecode()
+static void predecodeThread(void* arg, int i) {
+	Predecoder& pd = *(Predecoder*)arg;
+	ADDRESS entry;
+	while (nextProc(pd, entry)) {
+		predecodeProc(pd, (*pd.decoders)[i], pd.decoded[i], entry);
+		procDone(pd);
+	}
+}
+
+/*==============================================================================
+ * FUNCTION:	   FrontEnd::predecode
+ * OVERVIEW:	   Decode the instructions of the procs at entries (and of the procs that they call, if callees is set)
+ *					 in advance, on as many threads as -j says. Each thread has its own decoder, and takes the procs
+ *					 from a shared queue, adding those that they call. The decoders don't change the Prog (see
+ *					 NJMCDecoder::setPredecoding), so decodeInstruction gives the same results as if it had decoded the
+ *					 instructions itself, and the procs and CFGs are the same as without this.
+ * PARAMETERS:	   entries: the entry points
+ *				   callees: if true, also decode the procs called, and those that they call, etc
+ * RETURNS:		   <nothing>
+ *============================================================================*/
+void FrontEnd::predecode(std::vector<ADDRESS>& entries, bool callees) {
+	int numThreads = Boomerang::get()->numThreads;
+	while ((int)workerDecoders.size() < numThreads) {
+		NJMCDecoder* d = newDecoder();		// On this thread: reading the SSL file may not be thread safe
+		if (d == NULL)
+			return;							// Not supported by this front end
+		d->setPredecoding(true);
+		workerDecoders.push_back(d);
+	}
+	Phase ph("predecode");
+	Predecoder pd;
+	pd.pBF = pBF;
+	pd.callees = callees;
+	pd.decoders = &workerDecoders;
+	pd.decoded.resize(numThreads);
+	pd.busy = 0;
+	for (unsigned i = 0; i < entries.size(); i++)
+		queueProc(pd, entries[i]);
+	parallelFor(numThreads, numThreads, predecodeThread, &pd);
+
+	// Where threads decoded the same instruction, keep one
+	int n = 0;
+	for (int i = 0; i < numThreads; i++) {
+		std::map<ADDRESS, DecodeResult>::iterator it;
+		for (it = pd.decoded[i].begin(); it != pd.decoded[i].end(); ++it) {
+			DecodeResult*& r = predecoded[it->first];
+			if (r == NULL) {
+				r = new DecodeResult(it->second);
+				n++;
+			}
+		}
+		pd.decoded[i].clear();
+	}
+	if (VERBOSE)
+		LOG << "predecoded " << n << " instructions of " << (int)pd.seen.size() << " procs on " << numThreads <<
+			" threads\n";
+}
+
+void FrontEnd::dropPredecoded() {
+	if (predecoded.size() && VERBOSE)
+		LOG << (int)predecoded.size() << " predecoded instructions were not used\n";
+	std::map<ADDRESS, DecodeResult*>::iterator it;
+	for (it = predecoded.begin(); it != predecoded.end(); ++it)
+		delete it->second;
+	predecoded.clear();
 }
 
 /*==============================================================================
@@ -431,6 +703,15 @@ Signature *FrontEnd::getLibSignature(const char *name) {
 	std::map<std::string, Signature*>::iterator it;
 	it = librarySignatures.find(name);
 	if (it == librarySignatures.end()) {
+		// Not parsed yet; the last catalog that declares it wins
+		for (int i = libraryDBs.size()-1; i >= 0; i--) {
+			signature = libraryDBs[i]->lookup(name);
+			if (signature) {
+				librarySignatures[name] = signature;
+				signature->setUnknown(false);
+				return signature;
+			}
+		}
 		LOG << "Unknown library function " << name << "\n";
 		signature = getDefaultSignature(name);
 	}
@@ -1017,6 +1298,9 @@ bool FrontEnd::processProc(ADDRESS uAddr, UserProc* pProc, std::ofstream &os, bo
 	if (VERBOSE)
 		LOG << "finished processing proc " << pProc->getName() << " at address " << pProc->getNativeAddress() << "\n";
 
+	// Let the Prog find this proc by the addresses that it now covers
+	pProc->getProg()->updateProcRanges(pProc);
+
 	return true;
 }
 
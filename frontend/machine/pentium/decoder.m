@@ -23,6 +23,8 @@
  *				that had 8 bit instead of 32 bit modrm sizes
  * 24 Oct 03 - Mike: Fixed DIS_IDXP1: did not have +32 in macro
  * 02 Sep 05 - Mike: POP.Evod/w take Eaddr now, not Mem
+ * 17 Oct 26 - The BSF/BSR state and the result are members, so that decoders can run on different threads
+ * 17 Oct 26 - An instruction with a relocated operand is not reusable (cached), as addReloc may add a global
 */
 
 #include <assert.h>
@@ -66,11 +68,6 @@
 #define DIS_OFF		(addReloc(new Const(off)))
 
 
-// Function to generate statements for the BSF/BSR series (Bit Scan Forward/
-// Reverse)
-void genBSFR(ADDRESS pc, Exp* reg, Exp* modrm, int init, int size, OPER incdec,
-	int numBytes);
-
 /**********************************
  * PentiumDecoder methods.
  **********************************/   
@@ -98,7 +95,6 @@ void PentiumDecoder::unused(int x)
  *				   proc - the enclosing procedure
  * RETURNS:		   a DecodeResult structure containing all the information gathered during decoding
  *============================================================================*/
-static DecodeResult result;
 DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 {
 	ADDRESS hostPC = pc + delta;
@@ -118,7 +114,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 		 * Register call
 		 */
 		// Mike: there should probably be a HLNwayCall class for this!
-		stmts = instantiate(pc,	 "CALL.Evod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_CALL_Evod, DIS_EADDR32);
 		CallStatement* newCall = new CallStatement;
 		// Record the fact that this is a computed call
 		newCall->setIsComputed();
@@ -314,195 +310,195 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 	//	SETS(name, DIS_EADDR8, BRANCH_JSG)
 
 	| XLATB() =>
-		stmts = instantiate(pc,	 "XLATB");
+		stmts = instantiate(pc,	 OP_XLATB);
 
 	| XCHG.Ev.Gvod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "XCHG.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_XCHG_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
 	| XCHG.Ev.Gvow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "XCHG.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_XCHG_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
 	| XCHG.Eb.Gb(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "XCHG.Eb.Gb", DIS_EADDR8, DIS_REG8);
+		stmts = instantiate(pc,	 OP_XCHG_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
 	| NOP() =>
-		stmts = instantiate(pc,	 "NOP");
+		stmts = instantiate(pc,	 OP_NOP);
 
 	| SEG.CS() =>		 // For now, treat seg.cs as a 1 byte NOP
-		stmts = instantiate(pc,	 "NOP");
+		stmts = instantiate(pc,	 OP_NOP);
 
 	| SEG.DS() =>		 // For now, treat seg.ds as a 1 byte NOP
-		stmts = instantiate(pc,	 "NOP");
+		stmts = instantiate(pc,	 OP_NOP);
 
 	| SEG.ES() =>		 // For now, treat seg.es as a 1 byte NOP
-		stmts = instantiate(pc,	 "NOP");
+		stmts = instantiate(pc,	 OP_NOP);
 
 	| SEG.FS() =>		 // For now, treat seg.fs as a 1 byte NOP
-		stmts = instantiate(pc,	 "NOP");
+		stmts = instantiate(pc,	 OP_NOP);
 
 	| SEG.GS() =>		 // For now, treat seg.gs as a 1 byte NOP
-		stmts = instantiate(pc,	 "NOP");
+		stmts = instantiate(pc,	 OP_NOP);
 
 	| SEG.SS() =>		 // For now, treat seg.ss as a 1 byte NOP
-		stmts = instantiate(pc,	 "NOP");
+		stmts = instantiate(pc,	 OP_NOP);
 
 	| XCHGeAXod(r32) =>
-		stmts = instantiate(pc,	 "XCHGeAXod", DIS_R32);
+		stmts = instantiate(pc,	 OP_XCHGeAXod, DIS_R32);
 
 	| XCHGeAXow(r32) =>
-		stmts = instantiate(pc,	 "XCHGeAXow", DIS_R32);
+		stmts = instantiate(pc,	 OP_XCHGeAXow, DIS_R32);
 
 	| XADD.Ev.Gvod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "XADD.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_XADD_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
 	| XADD.Ev.Gvow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "XADD.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_XADD_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
 	| XADD.Eb.Gb(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "XADD.Eb.Gb", DIS_EADDR8, DIS_REG8);
+		stmts = instantiate(pc,	 OP_XADD_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
 	| WRMSR() =>
-		stmts = instantiate(pc,	 "WRMSR");
+		stmts = instantiate(pc,	 OP_WRMSR);
 
 	| WBINVD() =>
-		stmts = instantiate(pc,	 "WBINVD");
+		stmts = instantiate(pc,	 OP_WBINVD);
 
 	| WAIT() =>
-		stmts = instantiate(pc,	 "WAIT");
+		stmts = instantiate(pc,	 OP_WAIT);
 
 	| VERW(Eaddr) =>
-		stmts = instantiate(pc,	 "VERW", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_VERW, DIS_EADDR32);
 
 	| VERR(Eaddr) =>
-		stmts = instantiate(pc,	 "VERR", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_VERR, DIS_EADDR32);
 
 	| TEST.Ev.Gvod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "TEST.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_TEST_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
 	| TEST.Ev.Gvow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "TEST.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_TEST_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
 	| TEST.Eb.Gb(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "TEST.Eb.Gb", DIS_EADDR8, DIS_REG8);
+		stmts = instantiate(pc,	 OP_TEST_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
 	| TEST.Ed.Id(Eaddr, i32) =>
-		stmts = instantiate(pc,	 "TEST.Ed.Id", DIS_EADDR32, DIS_I32);
+		stmts = instantiate(pc,	 OP_TEST_Ed_Id, DIS_EADDR32, DIS_I32);
 
 	| TEST.Ew.Iw(Eaddr, i16) =>
-		stmts = instantiate(pc,	 "TEST.Ew.Iw", DIS_EADDR16, DIS_I16);
+		stmts = instantiate(pc,	 OP_TEST_Ew_Iw, DIS_EADDR16, DIS_I16);
 
 	| TEST.Eb.Ib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "TEST.Eb.Ib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_TEST_Eb_Ib, DIS_EADDR8, DIS_I8);
 
 	| TEST.eAX.Ivod(i32) =>
-		stmts = instantiate(pc,	 "TEST.eAX.Ivod", DIS_I32);
+		stmts = instantiate(pc,	 OP_TEST_eAX_Ivod, DIS_I32);
 
 	| TEST.eAX.Ivow(i16) =>
-		stmts = instantiate(pc,	 "TEST.eAX.Ivow", DIS_I16);
+		stmts = instantiate(pc,	 OP_TEST_eAX_Ivow, DIS_I16);
 
 	| TEST.AL.Ib(i8) =>
-		stmts = instantiate(pc,	 "TEST.AL.Ib", DIS_I8);
+		stmts = instantiate(pc,	 OP_TEST_AL_Ib, DIS_I8);
 
 	| STR(Mem) =>
-		stmts = instantiate(pc,	 "STR", DIS_MEM);
+		stmts = instantiate(pc,	 OP_STR, DIS_MEM);
 
 	| STOSvod() =>
-		stmts = instantiate(pc,	 "STOSvod");
+		stmts = instantiate(pc,	 OP_STOSvod);
 
 	| STOSvow() =>
-		stmts = instantiate(pc,	 "STOSvow");
+		stmts = instantiate(pc,	 OP_STOSvow);
 
 	| STOSB() =>
-		stmts = instantiate(pc,	 "STOSB");
+		stmts = instantiate(pc,	 OP_STOSB);
 
 	| STI() =>
-		stmts = instantiate(pc,	 "STI");
+		stmts = instantiate(pc,	 OP_STI);
 
 	| STD() =>
-		stmts = instantiate(pc,	 "STD");
+		stmts = instantiate(pc,	 OP_STD);
 
 	| STC() =>
-		stmts = instantiate(pc,	 "STC");
+		stmts = instantiate(pc,	 OP_STC);
 
 	| SMSW(Eaddr) =>
-		stmts = instantiate(pc,	 "SMSW", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_SMSW, DIS_EADDR32);
 
 	| SLDT(Eaddr) =>
-		stmts = instantiate(pc,	 "SLDT", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_SLDT, DIS_EADDR32);
 
 	| SHLD.CLod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "SHLD.CLod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_SHLD_CLod, DIS_EADDR32, DIS_REG32);
 
 	| SHLD.CLow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "SHLD.CLow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_SHLD_CLow, DIS_EADDR16, DIS_REG16);
 
 	| SHRD.CLod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "SHRD.CLod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_SHRD_CLod, DIS_EADDR32, DIS_REG32);
 
 	| SHRD.CLow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "SHRD.CLow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_SHRD_CLow, DIS_EADDR16, DIS_REG16);
 
 	| SHLD.Ibod(Eaddr, reg, count) =>
-		stmts = instantiate(pc,	 "SHLD.Ibod", DIS_EADDR32, DIS_REG32, DIS_COUNT);
+		stmts = instantiate(pc,	 OP_SHLD_Ibod, DIS_EADDR32, DIS_REG32, DIS_COUNT);
 
 	| SHLD.Ibow(Eaddr, reg, count) =>
-		stmts = instantiate(pc,	 "SHLD.Ibow", DIS_EADDR16, DIS_REG16, DIS_COUNT);
+		stmts = instantiate(pc,	 OP_SHLD_Ibow, DIS_EADDR16, DIS_REG16, DIS_COUNT);
 
 	| SHRD.Ibod(Eaddr, reg, count) =>
-		stmts = instantiate(pc,	 "SHRD.Ibod", DIS_EADDR32, DIS_REG32, DIS_COUNT);
+		stmts = instantiate(pc,	 OP_SHRD_Ibod, DIS_EADDR32, DIS_REG32, DIS_COUNT);
 
 	| SHRD.Ibow(Eaddr, reg, count) =>
-		stmts = instantiate(pc,	 "SHRD.Ibow", DIS_EADDR16, DIS_REG16, DIS_COUNT);
+		stmts = instantiate(pc,	 OP_SHRD_Ibow, DIS_EADDR16, DIS_REG16, DIS_COUNT);
 
 	| SIDT(Mem) =>
-		stmts = instantiate(pc,	 "SIDT", DIS_MEM);
+		stmts = instantiate(pc,	 OP_SIDT, DIS_MEM);
 
 	| SGDT(Mem) =>
-		stmts = instantiate(pc,	 "SGDT", DIS_MEM);
+		stmts = instantiate(pc,	 OP_SGDT, DIS_MEM);
 
 	// Sets are now in the high level instructions
 	| SCASvod() =>
-		stmts = instantiate(pc,	 "SCASvod");
+		stmts = instantiate(pc,	 OP_SCASvod);
 
 	| SCASvow() =>
-		stmts = instantiate(pc,	 "SCASvow");
+		stmts = instantiate(pc,	 OP_SCASvow);
 
 	| SCASB() =>
-		stmts = instantiate(pc,	 "SCASB");
+		stmts = instantiate(pc,	 OP_SCASB);
 
 	| SAHF() =>
-		stmts = instantiate(pc,	 "SAHF");
+		stmts = instantiate(pc,	 OP_SAHF);
 
 	| RSM() =>
-		stmts = instantiate(pc,	 "RSM");
+		stmts = instantiate(pc,	 OP_RSM);
 
 	| RET.far.Iw(i16) =>
-		stmts = instantiate(pc,	 "RET.far.Iw", DIS_I16);
+		stmts = instantiate(pc,	 OP_RET_far_Iw, DIS_I16);
 		ReturnStatement *ret = new ReturnStatement;
 		result.rtl = new RTL(pc, stmts);
 		result.rtl->appendStmt(ret);
 
 	| RET.Iw(i16) =>
-		stmts = instantiate(pc,	 "RET.Iw", DIS_I16);
+		stmts = instantiate(pc,	 OP_RET_Iw, DIS_I16);
 		ReturnStatement *ret = new ReturnStatement;
 		result.rtl = new RTL(pc, stmts);
 		result.rtl->appendStmt(ret);
 
 	| RET.far() =>
-		stmts = instantiate(pc,	 "RET.far");
+		stmts = instantiate(pc,	 OP_RET_far);
 		result.rtl = new RTL(pc, stmts);
 		result.rtl->appendStmt(new ReturnStatement);
 
 	| RET() =>
-		stmts = instantiate(pc,	 "RET");
+		stmts = instantiate(pc,	 OP_RET);
 		result.rtl = new RTL(pc, stmts);
 		result.rtl->appendStmt(new ReturnStatement);
 
 //	 | REPNE() =>
-//		stmts = instantiate(pc,	 "REPNE");
+//		stmts = instantiate(pc,	 OP_REPNE);
 
 //	| REP() =>
-//		stmts = instantiate(pc,	 "REP");
+//		stmts = instantiate(pc,	 OP_REP);
 
 	| REP.CMPSB() [name] =>
 		stmts = instantiate(pc,	 name);
@@ -595,694 +591,694 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 		stmts = instantiate(pc,	 name);
 
 	| RDMSR() =>
-		stmts = instantiate(pc,	 "RDMSR");
+		stmts = instantiate(pc,	 OP_RDMSR);
 
 	| SARB.Ev.Ibod(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SARB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_SARB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
 	| SARB.Ev.Ibow(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SARB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_SARB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
 	| SHRB.Ev.Ibod(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SHRB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_SHRB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
 	| SHRB.Ev.Ibow(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SHRB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_SHRB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
 	| SHLSALB.Ev.Ibod(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SHLSALB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_SHLSALB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
 	| SHLSALB.Ev.Ibow(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SHLSALB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_SHLSALB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
 	| RCRB.Ev.Ibod(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "RCRB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_RCRB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
 	| RCRB.Ev.Ibow(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "RCRB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_RCRB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
 	| RCLB.Ev.Ibod(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "RCLB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_RCLB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
 	| RCLB.Ev.Ibow(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "RCLB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_RCLB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
 	| RORB.Ev.Ibod(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "RORB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_RORB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
 	| RORB.Ev.Ibow(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "RORB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_RORB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
 	| ROLB.Ev.Ibod(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "ROLB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_ROLB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
 	| ROLB.Ev.Ibow(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "ROLB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_ROLB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
 	| SARB.Eb.Ib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SARB.Eb.Ib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_SARB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
 	| SHRB.Eb.Ib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SHRB.Eb.Ib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_SHRB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
 	| SHLSALB.Eb.Ib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SHLSALB.Eb.Ib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_SHLSALB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
 	| RCRB.Eb.Ib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "RCRB.Eb.Ib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_RCRB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
 	| RCLB.Eb.Ib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "RCLB.Eb.Ib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_RCLB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
 	| RORB.Eb.Ib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "RORB.Eb.Ib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_RORB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
 	| ROLB.Eb.Ib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "ROLB.Eb.Ib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_ROLB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
 	| SARB.Ev.CLod(Eaddr) =>
-		stmts = instantiate(pc,	 "SARB.Ev.CLod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_SARB_Ev_CLod, DIS_EADDR32);
 
 	| SARB.Ev.CLow(Eaddr) =>
-		stmts = instantiate(pc,	 "SARB.Ev.CLow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_SARB_Ev_CLow, DIS_EADDR16);
 
 	| SARB.Ev.1od(Eaddr) =>
-		stmts = instantiate(pc,	 "SARB.Ev.1od", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_SARB_Ev_1od, DIS_EADDR32);
 
 	| SARB.Ev.1ow(Eaddr) =>
-		stmts = instantiate(pc,	 "SARB.Ev.1ow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_SARB_Ev_1ow, DIS_EADDR16);
 
 	| SHRB.Ev.CLod(Eaddr) =>
-		stmts = instantiate(pc,	 "SHRB.Ev.CLod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_SHRB_Ev_CLod, DIS_EADDR32);
 
 	| SHRB.Ev.CLow(Eaddr) =>
-		stmts = instantiate(pc,	 "SHRB.Ev.CLow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_SHRB_Ev_CLow, DIS_EADDR16);
 
 	| SHRB.Ev.1od(Eaddr) =>
-		stmts = instantiate(pc,	 "SHRB.Ev.1od", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_SHRB_Ev_1od, DIS_EADDR32);
 
 	| SHRB.Ev.1ow(Eaddr) =>
-		stmts = instantiate(pc,	 "SHRB.Ev.1ow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_SHRB_Ev_1ow, DIS_EADDR16);
 
 	| SHLSALB.Ev.CLod(Eaddr) =>
-		stmts = instantiate(pc,	 "SHLSALB.Ev.CLod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_SHLSALB_Ev_CLod, DIS_EADDR32);
 
 	| SHLSALB.Ev.CLow(Eaddr) =>
-		stmts = instantiate(pc,	 "SHLSALB.Ev.CLow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_SHLSALB_Ev_CLow, DIS_EADDR16);
 
 	| SHLSALB.Ev.1od(Eaddr) =>
-		stmts = instantiate(pc,	 "SHLSALB.Ev.1od", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_SHLSALB_Ev_1od, DIS_EADDR32);
 
 	| SHLSALB.Ev.1ow(Eaddr) =>
-		stmts = instantiate(pc,	 "SHLSALB.Ev.1ow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_SHLSALB_Ev_1ow, DIS_EADDR16);
 
 	| RCRB.Ev.CLod(Eaddr) =>
-		stmts = instantiate(pc,	 "RCRB.Ev.CLod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_RCRB_Ev_CLod, DIS_EADDR32);
 
 	| RCRB.Ev.CLow(Eaddr) =>
-		stmts = instantiate(pc,	 "RCRB.Ev.CLow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_RCRB_Ev_CLow, DIS_EADDR16);
 
 	| RCRB.Ev.1od(Eaddr) =>
-		stmts = instantiate(pc,	 "RCRB.Ev.1od", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_RCRB_Ev_1od, DIS_EADDR32);
 
 	| RCRB.Ev.1ow(Eaddr) =>
-		stmts = instantiate(pc,	 "RCRB.Ev.1ow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_RCRB_Ev_1ow, DIS_EADDR16);
 
 	| RCLB.Ev.CLod(Eaddr) =>
-		stmts = instantiate(pc,	 "RCLB.Ev.CLod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_RCLB_Ev_CLod, DIS_EADDR32);
 
 	| RCLB.Ev.CLow(Eaddr) =>
-		stmts = instantiate(pc,	 "RCLB.Ev.CLow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_RCLB_Ev_CLow, DIS_EADDR16);
 
 	| RCLB.Ev.1od(Eaddr) =>
-		stmts = instantiate(pc,	 "RCLB.Ev.1od", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_RCLB_Ev_1od, DIS_EADDR32);
 
 	| RCLB.Ev.1ow(Eaddr) =>
-		stmts = instantiate(pc,	 "RCLB.Ev.1ow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_RCLB_Ev_1ow, DIS_EADDR16);
 
 	| RORB.Ev.CLod(Eaddr) =>
-		stmts = instantiate(pc,	 "RORB.Ev.CLod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_RORB_Ev_CLod, DIS_EADDR32);
 
 	| RORB.Ev.CLow(Eaddr) =>
-		stmts = instantiate(pc,	 "RORB.Ev.CLow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_RORB_Ev_CLow, DIS_EADDR16);
 
 	| RORB.Ev.1od(Eaddr) =>
-		stmts = instantiate(pc,	 "RORB.Ev.1od", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_RORB_Ev_1od, DIS_EADDR32);
 
 	| RORB.Ev.1ow(Eaddr) =>
-		stmts = instantiate(pc,	 "ORB.Ev.1owR", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_ORB_Ev_1owR, DIS_EADDR16);
 
 	| ROLB.Ev.CLod(Eaddr) =>
-		stmts = instantiate(pc,	 "ROLB.Ev.CLod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_ROLB_Ev_CLod, DIS_EADDR32);
 
 	| ROLB.Ev.CLow(Eaddr) =>
-		stmts = instantiate(pc,	 "ROLB.Ev.CLow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_ROLB_Ev_CLow, DIS_EADDR16);
 
 	| ROLB.Ev.1od(Eaddr) =>
-		stmts = instantiate(pc,	 "ROLB.Ev.1od", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_ROLB_Ev_1od, DIS_EADDR32);
 
 	| ROLB.Ev.1ow(Eaddr) =>
-		stmts = instantiate(pc,	 "ROLB.Ev.1ow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_ROLB_Ev_1ow, DIS_EADDR16);
 
 	| SARB.Eb.CL(Eaddr) =>
-		stmts = instantiate(pc,	 "SARB.Eb.CL", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_SARB_Eb_CL, DIS_EADDR32);
 
 	| SARB.Eb.1(Eaddr) =>
-		stmts = instantiate(pc,	 "SARB.Eb.1", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_SARB_Eb_1, DIS_EADDR16);
 
 	| SHRB.Eb.CL(Eaddr) =>
-		stmts = instantiate(pc,	 "SHRB.Eb.CL", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_SHRB_Eb_CL, DIS_EADDR8);
 
 	| SHRB.Eb.1(Eaddr) =>
-		stmts = instantiate(pc,	 "SHRB.Eb.1", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_SHRB_Eb_1, DIS_EADDR8);
 
 	| SHLSALB.Eb.CL(Eaddr) =>
-		stmts = instantiate(pc,	 "SHLSALB.Eb.CL", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_SHLSALB_Eb_CL, DIS_EADDR8);
 
 	| SHLSALB.Eb.1(Eaddr) =>
-		stmts = instantiate(pc,	 "SHLSALB.Eb.1", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_SHLSALB_Eb_1, DIS_EADDR8);
 
 	| RCRB.Eb.CL(Eaddr) =>
-		stmts = instantiate(pc,	 "RCRB.Eb.CL", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_RCRB_Eb_CL, DIS_EADDR8);
 
 	| RCRB.Eb.1(Eaddr) =>
-		stmts = instantiate(pc,	 "RCRB.Eb.1", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_RCRB_Eb_1, DIS_EADDR8);
 
 	| RCLB.Eb.CL(Eaddr) =>
-		stmts = instantiate(pc,	 "RCLB.Eb.CL", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_RCLB_Eb_CL, DIS_EADDR8);
 
 	| RCLB.Eb.1(Eaddr) =>
-		stmts = instantiate(pc,	 "RCLB.Eb.1", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_RCLB_Eb_1, DIS_EADDR8);
 
 	| RORB.Eb.CL(Eaddr) =>
-		stmts = instantiate(pc,	 "RORB.Eb.CL", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_RORB_Eb_CL, DIS_EADDR8);
 
 	| RORB.Eb.1(Eaddr) =>
-		stmts = instantiate(pc,	 "RORB.Eb.1", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_RORB_Eb_1, DIS_EADDR8);
 
 	| ROLB.Eb.CL(Eaddr) =>
-		stmts = instantiate(pc,	 "ROLB.Eb.CL", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_ROLB_Eb_CL, DIS_EADDR8);
 
 	| ROLB.Eb.1(Eaddr) =>
-		stmts = instantiate(pc,	 "ROLB.Eb.1", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_ROLB_Eb_1, DIS_EADDR8);
 
 	// There is no SSL for these, so don't call instantiate, it will only
 	// cause an assert failure. Also, may as well treat these as invalid instr
 //	  | PUSHFod() =>
-//		  stmts = instantiate(pc,  "PUSHFod");
+//		  stmts = instantiate(pc,  OP_PUSHFod);
 
 //	  | PUSHFow() =>
-//		  stmts = instantiate(pc,  "PUSHFow");
+//		  stmts = instantiate(pc,  OP_PUSHFow);
 
 //	  | PUSHAod() =>
-//		  stmts = instantiate(pc,  "PUSHAod");
+//		  stmts = instantiate(pc,  OP_PUSHAod);
 
 //	  | PUSHAow() =>
-//		  stmts = instantiate(pc,  "PUSHAow");
+//		  stmts = instantiate(pc,  OP_PUSHAow);
 
 	| PUSH.GS() =>
-		stmts = instantiate(pc,	 "PUSH.GS");
+		stmts = instantiate(pc,	 OP_PUSH_GS);
 
 	| PUSH.FS() =>
-		stmts = instantiate(pc,	 "PUSH.FS");
+		stmts = instantiate(pc,	 OP_PUSH_FS);
 
 	| PUSH.ES() =>
-		stmts = instantiate(pc,	 "PUSH.ES");
+		stmts = instantiate(pc,	 OP_PUSH_ES);
 
 	| PUSH.DS() =>
-		stmts = instantiate(pc,	 "PUSH.DS");
+		stmts = instantiate(pc,	 OP_PUSH_DS);
 
 	| PUSH.SS() =>
-		stmts = instantiate(pc,	 "PUSH.SS");
+		stmts = instantiate(pc,	 OP_PUSH_SS);
 
 	| PUSH.CS() =>
-		stmts = instantiate(pc,	 "PUSH.CS");
+		stmts = instantiate(pc,	 OP_PUSH_CS);
 
 	| PUSH.Ivod(i32) =>
-		stmts = instantiate(pc,	 "PUSH.Ivod", DIS_I32);
+		stmts = instantiate(pc,	 OP_PUSH_Ivod, DIS_I32);
 
 	| PUSH.Ivow(i16) =>
-		stmts = instantiate(pc,	 "PUSH.Ivow", DIS_I16);
+		stmts = instantiate(pc,	 OP_PUSH_Ivow, DIS_I16);
 
 	| PUSH.Ixob(i8) =>
-		stmts = instantiate(pc,	 "PUSH.Ixob", DIS_I8);
+		stmts = instantiate(pc,	 OP_PUSH_Ixob, DIS_I8);
 
 	| PUSH.Ixow(i8) =>
-		stmts = instantiate(pc,	 "PUSH.Ixow", DIS_I8);
+		stmts = instantiate(pc,	 OP_PUSH_Ixow, DIS_I8);
 
 	| PUSHod(r32) =>
-		stmts = instantiate(pc,	 "PUSHod", DIS_R32);
+		stmts = instantiate(pc,	 OP_PUSHod, DIS_R32);
 
 	| PUSHow(r32) =>
-		stmts = instantiate(pc,	 "PUSHow", DIS_R32);  // Check!
+		stmts = instantiate(pc,	 OP_PUSHow, DIS_R32);  // Check!
 
 	| PUSH.Evod(Eaddr) =>
-		stmts = instantiate(pc,	 "PUSH.Evod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_PUSH_Evod, DIS_EADDR32);
 
 	| PUSH.Evow(Eaddr) =>
-		stmts = instantiate(pc,	 "PUSH.Evow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_PUSH_Evow, DIS_EADDR16);
 
 //	  | POPFod() =>
-//		  stmts = instantiate(pc,  "POPFod");
+//		  stmts = instantiate(pc,  OP_POPFod);
 
 //	  | POPFow() =>
-//		  stmts = instantiate(pc,  "POPFow");
+//		  stmts = instantiate(pc,  OP_POPFow);
 
 //	  | POPAod() =>
-//		  stmts = instantiate(pc,  "POPAod");
+//		  stmts = instantiate(pc,  OP_POPAod);
 
 //	  | POPAow() =>
-//		  stmts = instantiate(pc,  "POPAow");
+//		  stmts = instantiate(pc,  OP_POPAow);
 
 	| POP.GS() =>
-		stmts = instantiate(pc,	 "POP.GS");
+		stmts = instantiate(pc,	 OP_POP_GS);
 
 	| POP.FS() =>
-		stmts = instantiate(pc,	 "POP.FS");
+		stmts = instantiate(pc,	 OP_POP_FS);
 
 	| POP.DS() =>
-		stmts = instantiate(pc,	 "POP.DS");
+		stmts = instantiate(pc,	 OP_POP_DS);
 
 	| POP.SS() =>
-		stmts = instantiate(pc,	 "POP.SS");
+		stmts = instantiate(pc,	 OP_POP_SS);
 
 	| POP.ES() =>
-		stmts = instantiate(pc,	 "POP.ES");
+		stmts = instantiate(pc,	 OP_POP_ES);
 
 	| POPod(r32) =>
-		stmts = instantiate(pc,	 "POPod", DIS_R32);
+		stmts = instantiate(pc,	 OP_POPod, DIS_R32);
 
 	| POPow(r32) =>
-		stmts = instantiate(pc,	 "POPow", DIS_R32);	  // Check!
+		stmts = instantiate(pc,	 OP_POPow, DIS_R32);	  // Check!
 
 	| POP.Evod(Eaddr) =>
-		stmts = instantiate(pc,	 "POP.Evod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_POP_Evod, DIS_EADDR32);
 
 	| POP.Evow(Eaddr) =>
-		stmts = instantiate(pc,	 "POP.Evow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_POP_Evow, DIS_EADDR16);
 
 //	  | OUTSvod() =>
-//		  stmts = instantiate(pc,  "OUTSvod");
+//		  stmts = instantiate(pc,  OP_OUTSvod);
 
 //	  | OUTSvow() =>
-//		  stmts = instantiate(pc,  "OUTSvow");
+//		  stmts = instantiate(pc,  OP_OUTSvow);
 
 //	  | OUTSB() =>
-//		  stmts = instantiate(pc,  "OUTSB");
+//		  stmts = instantiate(pc,  OP_OUTSB);
 
 //	  | OUT.DX.eAXod() =>
-//		  stmts = instantiate(pc,  "OUT.DX.eAXod");
+//		  stmts = instantiate(pc,  OP_OUT_DX_eAXod);
 
 //	  | OUT.DX.eAXow() =>
-//		  stmts = instantiate(pc,  "OUT.DX.eAXow");
+//		  stmts = instantiate(pc,  OP_OUT_DX_eAXow);
 
 //	  | OUT.DX.AL() =>
-//		  stmts = instantiate(pc,  "OUT.DX.AL");
+//		  stmts = instantiate(pc,  OP_OUT_DX_AL);
 
 //	  | OUT.Ib.eAXod(i8) =>
-//		  stmts = instantiate(pc,  "OUT.Ib.eAXod", DIS_I8);
+//		  stmts = instantiate(pc,  OP_OUT_Ib_eAXod, DIS_I8);
 
 //	  | OUT.Ib.eAXow(i8) =>
-//		  stmts = instantiate(pc,  "OUT.Ib.eAXow", DIS_I8);
+//		  stmts = instantiate(pc,  OP_OUT_Ib_eAXow, DIS_I8);
 
 //	  | OUT.Ib.AL(i8) =>
-//		  stmts = instantiate(pc,  "OUT.Ib.AL", DIS_I8);
+//		  stmts = instantiate(pc,  OP_OUT_Ib_AL, DIS_I8);
 
 	| NOTod(Eaddr) =>
-		stmts = instantiate(pc,	 "NOTod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_NOTod, DIS_EADDR32);
 
 	| NOTow(Eaddr) =>
-		stmts = instantiate(pc,	 "NOTow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_NOTow, DIS_EADDR16);
 
 	| NOTb(Eaddr) =>
-		stmts = instantiate(pc,	 "NOTb", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_NOTb, DIS_EADDR8);
 
 	| NEGod(Eaddr) =>
-		stmts = instantiate(pc,	 "NEGod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_NEGod, DIS_EADDR32);
 
 	| NEGow(Eaddr) =>
-		stmts = instantiate(pc,	 "NEGow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_NEGow, DIS_EADDR16);
 
 	| NEGb(Eaddr) =>
-		stmts = instantiate(pc,	 "NEGb", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_NEGb, DIS_EADDR8);
 
 	| MUL.AXod(Eaddr) =>
-		stmts = instantiate(pc,	 "MUL.AXod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_MUL_AXod, DIS_EADDR32);
 
 	| MUL.AXow(Eaddr) =>
-		stmts = instantiate(pc,	 "MUL.AXow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_MUL_AXow, DIS_EADDR16);
 
 	| MUL.AL(Eaddr) =>
-		stmts = instantiate(pc,	 "MUL.AL", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_MUL_AL, DIS_EADDR8);
 
 	| MOVZX.Gv.Ew(r32, Eaddr) =>
-		stmts = instantiate(pc,	 "MOVZX.Gv.Ew", DIS_R32, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ew, DIS_R32, DIS_EADDR16);
 
 	| MOVZX.Gv.Ebod(r32, Eaddr) =>
-		stmts = instantiate(pc,	 "MOVZX.Gv.Ebod", DIS_R32, DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebod, DIS_R32, DIS_EADDR8);
 
 	| MOVZX.Gv.Ebow(r16, Eaddr) =>
-		stmts = instantiate(pc,	 "MOVZX.Gv.Ebow", DIS_R16, DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebow, DIS_R16, DIS_EADDR8);
 
 	| MOVSX.Gv.Ew(r32, Eaddr) =>
-		stmts = instantiate(pc,	 "MOVSX.Gv.Ew", DIS_R32, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_MOVSX_Gv_Ew, DIS_R32, DIS_EADDR16);
 
 	| MOVSX.Gv.Ebod(r32, Eaddr) =>
-		stmts = instantiate(pc,	 "MOVSX.Gv.Ebod", DIS_R32, DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_MOVSX_Gv_Ebod, DIS_R32, DIS_EADDR8);
 
 	| MOVSX.Gv.Ebow(r16, Eaddr) =>
-		stmts = instantiate(pc,	 "MOVZX.Gv.Ebow", DIS_R16, DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebow, DIS_R16, DIS_EADDR8);
 
 	| MOVSvod() =>
-		stmts = instantiate(pc,	 "MOVSvod");
+		stmts = instantiate(pc,	 OP_MOVSvod);
 
 	| MOVSvow() =>
-		stmts = instantiate(pc,	 "MOVSvow");
+		stmts = instantiate(pc,	 OP_MOVSvow);
 
 	| MOVSB() =>
-		stmts = instantiate(pc,	 "MOVSB");
+		stmts = instantiate(pc,	 OP_MOVSB);
 
 //	  | MOV.Rd.Dd(reg, dr) => 
 //		  unused(reg); unused(dr);
-//		  stmts = instantiate(pc,  "UNIMP");
+//		  stmts = instantiate(pc,  OP_UNIMP);
 
 //	  | MOV.Dd.Rd(dr, reg) =>
 //		  unused(reg); unused(dr);
-//		  stmts = instantiate(pc,  "UNIMP");
+//		  stmts = instantiate(pc,  OP_UNIMP);
 
 //	  | MOV.Rd.Cd(reg, cr) =>
 //		  unused(reg); unused(cr);
-//		  stmts = instantiate(pc,  "UNIMP");
+//		  stmts = instantiate(pc,  OP_UNIMP);
 
 //	  | MOV.Cd.Rd(cr, reg) =>
 //		  unused(reg); unused(cr);
-//		  stmts = instantiate(pc,  "UNIMP");
+//		  stmts = instantiate(pc,  OP_UNIMP);
 
 	| MOV.Ed.Ivod(Eaddr, i32) =>
-		stmts = instantiate(pc,	 "MOV.Ed.Ivod", DIS_EADDR32, DIS_I32);
+		stmts = instantiate(pc,	 OP_MOV_Ed_Ivod, DIS_EADDR32, DIS_I32);
 
 	| MOV.Ew.Ivow(Eaddr, i16) =>
-		stmts = instantiate(pc,	 "MOV.Ew.Ivow", DIS_EADDR16, DIS_I16);
+		stmts = instantiate(pc,	 OP_MOV_Ew_Ivow, DIS_EADDR16, DIS_I16);
 
 	| MOV.Eb.Ib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "MOV.Eb.Ib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_MOV_Eb_Ib, DIS_EADDR8, DIS_I8);
 
 	| MOVid(r32, i32) =>
-		stmts = instantiate(pc,	 "MOVid", DIS_R32, DIS_I32);
+		stmts = instantiate(pc,	 OP_MOVid, DIS_R32, DIS_I32);
 
 	| MOViw(r16, i16) =>
-		stmts = instantiate(pc,	 "MOViw", DIS_R16, DIS_I16);  // Check!
+		stmts = instantiate(pc,	 OP_MOViw, DIS_R16, DIS_I16);  // Check!
 
 	| MOVib(r8, i8) =>
-		stmts = instantiate(pc,	 "MOVib", DIS_R8, DIS_I8);
+		stmts = instantiate(pc,	 OP_MOVib, DIS_R8, DIS_I8);
 
 	| MOV.Ov.eAXod(off) =>
-		stmts = instantiate(pc,	 "MOV.Ov.eAXod", DIS_OFF);
+		stmts = instantiate(pc,	 OP_MOV_Ov_eAXod, DIS_OFF);
 
 	| MOV.Ov.eAXow(off) =>
-		stmts = instantiate(pc,	 "MOV.Ov.eAXow", DIS_OFF);
+		stmts = instantiate(pc,	 OP_MOV_Ov_eAXow, DIS_OFF);
 
 	| MOV.Ob.AL(off) =>
-		stmts = instantiate(pc,	 "MOV.Ob.AL", DIS_OFF);
+		stmts = instantiate(pc,	 OP_MOV_Ob_AL, DIS_OFF);
 
 	| MOV.eAX.Ovod(off) =>
-		stmts = instantiate(pc,	 "MOV.eAX.Ovod", DIS_OFF);
+		stmts = instantiate(pc,	 OP_MOV_eAX_Ovod, DIS_OFF);
 
 	| MOV.eAX.Ovow(off) =>
-		stmts = instantiate(pc,	 "MOV.eAX.Ovow", DIS_OFF);
+		stmts = instantiate(pc,	 OP_MOV_eAX_Ovow, DIS_OFF);
 
 	| MOV.AL.Ob(off) =>
-		stmts = instantiate(pc,	 "MOV.AL.Ob", DIS_OFF);
+		stmts = instantiate(pc,	 OP_MOV_AL_Ob, DIS_OFF);
 
 //	  | MOV.Sw.Ew(Mem, sr16) =>
-//		  stmts = instantiate(pc,  "MOV.Sw.Ew", DIS_MEM, DIS_SR16);
+//		  stmts = instantiate(pc,  OP_MOV_Sw_Ew, DIS_MEM, DIS_SR16);
 
 //	  | MOV.Ew.Sw(Mem, sr16) =>
-//		  stmts = instantiate(pc,  "MOV.Ew.Sw", DIS_MEM, DIS_SR16);
+//		  stmts = instantiate(pc,  OP_MOV_Ew_Sw, DIS_MEM, DIS_SR16);
 
 	| MOVrmod(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "MOVrmod", DIS_REG32, DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_MOVrmod, DIS_REG32, DIS_EADDR32);
 
 	| MOVrmow(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "MOVrmow", DIS_REG16, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_MOVrmow, DIS_REG16, DIS_EADDR16);
 
 	| MOVrmb(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "MOVrmb", DIS_REG8, DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_MOVrmb, DIS_REG8, DIS_EADDR8);
 
 	| MOVmrod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "MOVmrod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_MOVmrod, DIS_EADDR32, DIS_REG32);
 
 	| MOVmrow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "MOVmrow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_MOVmrow, DIS_EADDR16, DIS_REG16);
 
 	| MOVmrb(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "MOVmrb", DIS_EADDR8, DIS_REG8);
+		stmts = instantiate(pc,	 OP_MOVmrb, DIS_EADDR8, DIS_REG8);
 
 	| LTR(Eaddr) =>
-		stmts = instantiate(pc,	 "LTR", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_LTR, DIS_EADDR32);
 
 	| LSS(reg, Mem) =>
-		stmts = instantiate(pc,	 "LSS", DIS_REG32, DIS_MEM);
+		stmts = instantiate(pc,	 OP_LSS, DIS_REG32, DIS_MEM);
 
 	| LSLod(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "LSLod", DIS_REG32, DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_LSLod, DIS_REG32, DIS_EADDR32);
 
 	| LSLow(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "LSLow", DIS_REG16, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_LSLow, DIS_REG16, DIS_EADDR16);
 
 	| LOOPNE(relocd) =>
-		stmts = instantiate(pc,	 "LOOPNE", dis_Num(relocd - hostPC - 2));
+		stmts = instantiate(pc,	 OP_LOOPNE, dis_Num(relocd - hostPC - 2));
 
 	| LOOPE(relocd) =>
-		stmts = instantiate(pc,	 "LOOPE", dis_Num(relocd-hostPC-2));
+		stmts = instantiate(pc,	 OP_LOOPE, dis_Num(relocd-hostPC-2));
 
 	| LOOP(relocd) =>
-		stmts = instantiate(pc,	 "LOOP", dis_Num(relocd-hostPC-2));
+		stmts = instantiate(pc,	 OP_LOOP, dis_Num(relocd-hostPC-2));
 
 	| LGS(reg, Mem) =>
-		stmts = instantiate(pc,	 "LGS", DIS_REG32, DIS_MEM);
+		stmts = instantiate(pc,	 OP_LGS, DIS_REG32, DIS_MEM);
 
 	| LFS(reg, Mem) =>
-		stmts = instantiate(pc,	 "LFS", DIS_REG32, DIS_MEM);
+		stmts = instantiate(pc,	 OP_LFS, DIS_REG32, DIS_MEM);
 
 	| LES(reg, Mem) =>
-		stmts = instantiate(pc,	 "LES", DIS_REG32, DIS_MEM);
+		stmts = instantiate(pc,	 OP_LES, DIS_REG32, DIS_MEM);
 
 	| LEAVE() =>
-		stmts = instantiate(pc,	 "LEAVE");
+		stmts = instantiate(pc,	 OP_LEAVE);
 
 	| LEAod(reg, Mem) =>
-		stmts = instantiate(pc,	 "LEA.od", DIS_REG32, DIS_MEM);
+		stmts = instantiate(pc,	 OP_LEA_od, DIS_REG32, DIS_MEM);
 
 	| LEAow(reg, Mem) =>
-		stmts = instantiate(pc,	 "LEA.ow", DIS_REG16, DIS_MEM);
+		stmts = instantiate(pc,	 OP_LEA_ow, DIS_REG16, DIS_MEM);
 
 	| LDS(reg, Mem) =>
-		stmts = instantiate(pc,	 "LDS", DIS_REG32, DIS_MEM);
+		stmts = instantiate(pc,	 OP_LDS, DIS_REG32, DIS_MEM);
 
 	| LARod(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "LAR.od", DIS_REG32, DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_LAR_od, DIS_REG32, DIS_EADDR32);
 
 	| LARow(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "LAR.ow", DIS_REG16, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_LAR_ow, DIS_REG16, DIS_EADDR16);
 
 	| LAHF() =>
-		stmts = instantiate(pc,	 "LAHF");
+		stmts = instantiate(pc,	 OP_LAHF);
 
 	/* Branches have been handled in decodeInstruction() now */
 	| IRET() =>
-		stmts = instantiate(pc,	 "IRET");
+		stmts = instantiate(pc,	 OP_IRET);
 
 	| INVLPG(Mem) =>
-		stmts = instantiate(pc,	 "INVLPG", DIS_MEM);
+		stmts = instantiate(pc,	 OP_INVLPG, DIS_MEM);
 
 	| INVD() =>
-		stmts = instantiate(pc,	 "INVD");
+		stmts = instantiate(pc,	 OP_INVD);
 
 	| INTO() =>
-		stmts = instantiate(pc,	 "INTO");
+		stmts = instantiate(pc,	 OP_INTO);
 
 	| INT.Ib(i8) =>
-		stmts = instantiate(pc,	 "INT.Ib", DIS_I8);
+		stmts = instantiate(pc,	 OP_INT_Ib, DIS_I8);
 
 // Removing because an invalid instruction is better than trying to
 // instantiate this. -trent
 //	  | INT3() =>
-//		  stmts = instantiate(pc,  "INT3");
+//		  stmts = instantiate(pc,  OP_INT3);
 
 //	  | INSvod() =>
-//		  stmts = instantiate(pc,  "INSvod");
+//		  stmts = instantiate(pc,  OP_INSvod);
 
 //	  | INSvow() =>
-//		  stmts = instantiate(pc,  "INSvow");
+//		  stmts = instantiate(pc,  OP_INSvow);
 
 //	  | INSB() =>
-//		  stmts = instantiate(pc,  "INSB");
+//		  stmts = instantiate(pc,  OP_INSB);
 
 	| INCod(r32) =>
-		stmts = instantiate(pc,	 "INCod", DIS_R32);
+		stmts = instantiate(pc,	 OP_INCod, DIS_R32);
 
 	| INCow(r32) =>
-		stmts = instantiate(pc,	 "INCow", DIS_R32);
+		stmts = instantiate(pc,	 OP_INCow, DIS_R32);
 
 	| INC.Evod(Eaddr) =>
-		stmts = instantiate(pc,	 "INC.Evod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_INC_Evod, DIS_EADDR32);
 
 	| INC.Evow(Eaddr) =>
-		stmts = instantiate(pc,	 "INC.Evow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_INC_Evow, DIS_EADDR16);
 
 	| INC.Eb(Eaddr) =>
-		stmts = instantiate(pc,	 "INC.Eb", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_INC_Eb, DIS_EADDR8);
 
 //	  | IN.eAX.DXod() =>
-//		  stmts = instantiate(pc,  "IN.eAX.DXod");
+//		  stmts = instantiate(pc,  OP_IN_eAX_DXod);
 
 //	  | IN.eAX.DXow() =>
-//		  stmts = instantiate(pc,  "IN.eAX.DXow");
+//		  stmts = instantiate(pc,  OP_IN_eAX_DXow);
 
 //	  | IN.AL.DX() =>
-//		  stmts = instantiate(pc,  "IN.AL.DX");
+//		  stmts = instantiate(pc,  OP_IN_AL_DX);
 
 //	  | IN.eAX.Ibod(i8) =>
-//		  stmts = instantiate(pc,  "IN.eAX.Ibod", DIS_I8);
+//		  stmts = instantiate(pc,  OP_IN_eAX_Ibod, DIS_I8);
 
 //	  | IN.eAX.Ibow(i8) =>
-//		  stmts = instantiate(pc,  "IN.eAX.Ibow", DIS_I8);
+//		  stmts = instantiate(pc,  OP_IN_eAX_Ibow, DIS_I8);
 
 //	  | IN.AL.Ib(i8) =>
-//		  stmts = instantiate(pc,  "IN.AL.Ib", DIS_I8);
+//		  stmts = instantiate(pc,  OP_IN_AL_Ib, DIS_I8);
 
 	| IMUL.Ivd(reg, Eaddr, i32) =>
-		stmts = instantiate(pc,	 "IMUL.Ivd", DIS_REG32, DIS_EADDR32, DIS_I32);
+		stmts = instantiate(pc,	 OP_IMUL_Ivd, DIS_REG32, DIS_EADDR32, DIS_I32);
 
 	| IMUL.Ivw(reg, Eaddr, i16) =>
-		stmts = instantiate(pc,	 "IMUL.Ivw", DIS_REG16, DIS_EADDR16, DIS_I16);
+		stmts = instantiate(pc,	 OP_IMUL_Ivw, DIS_REG16, DIS_EADDR16, DIS_I16);
 
 	| IMUL.Ibod(reg, Eaddr, i8) =>
-		stmts = instantiate(pc,	 "IMUL.Ibod", DIS_REG32, DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_IMUL_Ibod, DIS_REG32, DIS_EADDR32, DIS_I8);
 
 	| IMUL.Ibow(reg, Eaddr, i8) =>
-		stmts = instantiate(pc,	 "IMUL.Ibow", DIS_REG16, DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_IMUL_Ibow, DIS_REG16, DIS_EADDR16, DIS_I8);
 
 	| IMULrmod(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "IMULrmod", DIS_REG32, DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_IMULrmod, DIS_REG32, DIS_EADDR32);
 
 	| IMULrmow(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "IMULrmow", DIS_REG16, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_IMULrmow, DIS_REG16, DIS_EADDR16);
 
 	| IMULod(Eaddr) =>
-		stmts = instantiate(pc,	 "IMULod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_IMULod, DIS_EADDR32);
 
 	| IMULow(Eaddr) =>
-		stmts = instantiate(pc,	 "IMULow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_IMULow, DIS_EADDR16);
 
 	| IMULb(Eaddr) =>
-		stmts = instantiate(pc,	 "IMULb", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_IMULb, DIS_EADDR8);
 
 	| IDIVeAX(Eaddr) =>
-		stmts = instantiate(pc,	 "IDIVeAX", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_IDIVeAX, DIS_EADDR32);
 
 	| IDIVAX(Eaddr) =>
-		stmts = instantiate(pc,	 "IDIVAX", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_IDIVAX, DIS_EADDR16);
 
 	| IDIV(Eaddr) =>
-		stmts = instantiate(pc,	 "IDIV", DIS_EADDR8); /* ?? */
+		stmts = instantiate(pc,	 OP_IDIV, DIS_EADDR8); /* ?? */
 
 //	| HLT() =>
-//		stmts = instantiate(pc,	 "HLT");
+//		stmts = instantiate(pc,	 OP_HLT);
 
 	| ENTER(i16, i8) =>
-		stmts = instantiate(pc,	 "ENTER", DIS_I16, DIS_I8);
+		stmts = instantiate(pc,	 OP_ENTER, DIS_I16, DIS_I8);
 
 	| DIVeAX(Eaddr) =>
-		stmts = instantiate(pc,	 "DIVeAX", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_DIVeAX, DIS_EADDR32);
 
 	| DIVAX(Eaddr) =>
-		stmts = instantiate(pc,	 "DIVAX", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_DIVAX, DIS_EADDR16);
 
 	| DIVAL(Eaddr) =>
-		stmts = instantiate(pc,	 "DIVAL", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_DIVAL, DIS_EADDR8);
 
 	| DECod(r32) =>
-		stmts = instantiate(pc,	 "DECod", DIS_R32);
+		stmts = instantiate(pc,	 OP_DECod, DIS_R32);
 
 	| DECow(r32) =>
-		stmts = instantiate(pc,	 "DECow", DIS_R32);
+		stmts = instantiate(pc,	 OP_DECow, DIS_R32);
 
 	| DEC.Evod(Eaddr) =>
-		stmts = instantiate(pc,	 "DEC.Evod", DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_DEC_Evod, DIS_EADDR32);
 
 	| DEC.Evow(Eaddr) =>
-		stmts = instantiate(pc,	 "DEC.Evow", DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_DEC_Evow, DIS_EADDR16);
 
 	| DEC.Eb(Eaddr) =>
-		stmts = instantiate(pc,	 "DEC.Eb", DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_DEC_Eb, DIS_EADDR8);
 
 	| DAS() =>
-		stmts = instantiate(pc,	 "DAS");
+		stmts = instantiate(pc,	 OP_DAS);
 
 	| DAA() =>
-		stmts = instantiate(pc,	 "DAA");
+		stmts = instantiate(pc,	 OP_DAA);
 
 	| CDQ() =>
-		stmts = instantiate(pc,	 "CDQ");
+		stmts = instantiate(pc,	 OP_CDQ);
 
 	| CWD() =>
-		stmts = instantiate(pc,	 "CWD");
+		stmts = instantiate(pc,	 OP_CWD);
 
 	| CPUID() =>
-		stmts = instantiate(pc,	 "CPUID");
+		stmts = instantiate(pc,	 OP_CPUID);
 
 	| CMPXCHG8B(Mem) =>
-		stmts = instantiate(pc,	 "CMPXCHG8B", DIS_MEM);
+		stmts = instantiate(pc,	 OP_CMPXCHG8B, DIS_MEM);
 
 	| CMPXCHG.Ev.Gvod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "CMPXCHG.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_CMPXCHG_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
 	| CMPXCHG.Ev.Gvow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "CMPXCHG.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_CMPXCHG_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
 	| CMPXCHG.Eb.Gb(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "CMPXCHG.Eb.Gb", DIS_EADDR8, DIS_REG8);
+		stmts = instantiate(pc,	 OP_CMPXCHG_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
 	| CMPSvod() =>
-		stmts = instantiate(pc,	 "CMPSvod");
+		stmts = instantiate(pc,	 OP_CMPSvod);
 
 	| CMPSvow() =>
-		stmts = instantiate(pc,	 "CMPSvow");
+		stmts = instantiate(pc,	 OP_CMPSvow);
 
 	| CMPSB() =>
-		stmts = instantiate(pc,	 "CMPSB");
+		stmts = instantiate(pc,	 OP_CMPSB);
 
 	| CMC() =>
-		stmts = instantiate(pc,	 "CMC");
+		stmts = instantiate(pc,	 OP_CMC);
 
 	| CLTS() =>
-		stmts = instantiate(pc,	 "CLTS");
+		stmts = instantiate(pc,	 OP_CLTS);
 
 	| CLI() =>
-		stmts = instantiate(pc,	 "CLI");
+		stmts = instantiate(pc,	 OP_CLI);
 
 	| CLD() =>
-		stmts = instantiate(pc,	 "CLD");
+		stmts = instantiate(pc,	 OP_CLD);
 
 	| CLC() =>
-		stmts = instantiate(pc,	 "CLC");
+		stmts = instantiate(pc,	 OP_CLC);
 
 	| CWDE() =>
-		stmts = instantiate(pc,	 "CWDE");
+		stmts = instantiate(pc,	 OP_CWDE);
 
 	| CBW() =>
-		stmts = instantiate(pc,	 "CBW");
+		stmts = instantiate(pc,	 OP_CBW);
 
 	/* Decode the following as a NOP. We see these in startup code, and anywhere
 		that calls the OS (as lcall 7, 0) */
 	| CALL.aPod(seg, off) =>
 		unused(seg); unused(off);
-		stmts = instantiate(pc, "NOP");
+		stmts = instantiate(pc, OP_NOP);
 
 	| CALL.Jvod(relocd) =>
-		stmts = instantiate(pc,	 "CALL.Jvod", dis_Num(relocd));
+		stmts = instantiate(pc,	 OP_CALL_Jvod, dis_Num(relocd));
 		// Fix the last assignment, which is now %pc := %pc + (K + hostPC)
 		Assign* last = (Assign*)stmts->back();
 		Const* reloc = (Const*)((Binary*)last->getRight())->getSubExp2();
@@ -1302,527 +1298,525 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 			// Set the destination
 			call->setDest(nativeDest);
 			stmts->push_back(call);
-			Proc* destProc = prog->setNewProc(nativeDest);
-			if (destProc == (Proc*)-1) destProc = NULL;		// In case a deleted Proc
-			call->setDestProc(destProc);
+			setDestProc(call, nativeDest);
 		}
 		result.rtl = new RTL(pc, stmts);
 
 	| BTSiod(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "BTSiod", DIS_I8, DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_BTSiod, DIS_I8, DIS_EADDR32);
 
 	| BTSiow(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "BTSiow", DIS_I8, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_BTSiow, DIS_I8, DIS_EADDR16);
 
 	| BTSod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "BTSod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_BTSod, DIS_EADDR32, DIS_REG32);
 
 	| BTSow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "BTSow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_BTSow, DIS_EADDR16, DIS_REG16);
 
 	| BTRiod(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "BTRiod", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_BTRiod, DIS_EADDR32, DIS_I8);
 
 	| BTRiow(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "BTRiow", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_BTRiow, DIS_EADDR16, DIS_I8);
 
 	| BTRod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "BTRod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_BTRod, DIS_EADDR32, DIS_REG32);
 
 	| BTRow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "BTRow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_BTRow, DIS_EADDR16, DIS_REG16);
 
 	| BTCiod(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "BTCiod", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_BTCiod, DIS_EADDR32, DIS_I8);
 
 	| BTCiow(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "BTCiow", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_BTCiow, DIS_EADDR16, DIS_I8);
 
 	| BTCod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "BTCod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_BTCod, DIS_EADDR32, DIS_REG32);
 
 	| BTCow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "BTCow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_BTCow, DIS_EADDR16, DIS_REG16);
 
 	| BTiod(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "BTiod", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_BTiod, DIS_EADDR32, DIS_I8);
 
 	| BTiow(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "BTiow", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_BTiow, DIS_EADDR16, DIS_I8);
 
 	| BTod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "BTod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_BTod, DIS_EADDR32, DIS_REG32);
 
 	| BTow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "BTow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_BTow, DIS_EADDR16, DIS_REG16);
 
 	| BSWAP(r32) =>
-		stmts = instantiate(pc,	 "BSWAP", DIS_R32);
+		stmts = instantiate(pc,	 OP_BSWAP, DIS_R32);
 
 	| BSRod(reg, Eaddr) =>
-		//stmts = instantiate(pc,  "BSRod", DIS_REG32, DIS_EADDR32);
+		//stmts = instantiate(pc,  OP_BSRod, DIS_REG32, DIS_EADDR32);
 		// Bit Scan Forward: need helper function
 		genBSFR(pc, DIS_REG32, DIS_EADDR32, 32, 32, opMinus, nextPC-hostPC);
 		return result;
 
 	| BSRow(reg, Eaddr) =>
-		//stmts = instantiate(pc,  "BSRow", DIS_REG16, DIS_EADDR16);
+		//stmts = instantiate(pc,  OP_BSRow, DIS_REG16, DIS_EADDR16);
 		genBSFR(pc, DIS_REG16, DIS_EADDR16, 16, 16, opMinus, nextPC-hostPC);
 		return result;
 
 	| BSFod(reg, Eaddr) =>
-		//stmts = instantiate(pc,  "BSFod", DIS_REG32, DIS_EADDR32);
+		//stmts = instantiate(pc,  OP_BSFod, DIS_REG32, DIS_EADDR32);
 		genBSFR(pc, DIS_REG32, DIS_EADDR32, -1, 32, opPlus, nextPC-hostPC);
 		return result;
 
 	| BSFow(reg, Eaddr) =>
-		//stmts = instantiate(pc,  "BSFow", DIS_REG16, DIS_EADDR16);
+		//stmts = instantiate(pc,  OP_BSFow, DIS_REG16, DIS_EADDR16);
 		genBSFR(pc, DIS_REG16, DIS_EADDR16, -1, 16, opPlus, nextPC-hostPC);
 		return result;
 
 	// Not "user" instructions:
 //	| BOUNDod(reg, Mem) =>
-//		stmts = instantiate(pc,	 "BOUNDod", DIS_REG32, DIS_MEM);
+//		stmts = instantiate(pc,	 OP_BOUNDod, DIS_REG32, DIS_MEM);
 
 //	| BOUNDow(reg, Mem) =>
-//		stmts = instantiate(pc,	 "BOUNDow", DIS_REG16, DIS_MEM);
+//		stmts = instantiate(pc,	 OP_BOUNDow, DIS_REG16, DIS_MEM);
 
 //	  | ARPL(Eaddr, reg ) =>
 //		  unused(Eaddr); unused(reg);
-//		  stmts = instantiate(pc,  "UNIMP");
+//		  stmts = instantiate(pc,  OP_UNIMP);
 
 //	  | AAS() =>
-//		  stmts = instantiate(pc,  "AAS");
+//		  stmts = instantiate(pc,  OP_AAS);
 
 //	  | AAM() =>
-//		  stmts = instantiate(pc,  "AAM");
+//		  stmts = instantiate(pc,  OP_AAM);
 
 //	  | AAD() =>
-//		  stmts = instantiate(pc,  "AAD");
+//		  stmts = instantiate(pc,  OP_AAD);
 
 //	  | AAA() =>
-//		  stmts = instantiate(pc,  "AAA");
+//		  stmts = instantiate(pc,  OP_AAA);
 
 	| CMPrmod(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "CMPrmod", DIS_REG32, DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_CMPrmod, DIS_REG32, DIS_EADDR32);
 
 	| CMPrmow(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "CMPrmow", DIS_REG16, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_CMPrmow, DIS_REG16, DIS_EADDR16);
 
 	| XORrmod(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "XORrmod", DIS_REG32, DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_XORrmod, DIS_REG32, DIS_EADDR32);
 
 	| XORrmow(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "XORrmow", DIS_REG16, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_XORrmow, DIS_REG16, DIS_EADDR16);
 
 	| SUBrmod(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "SUBrmod", DIS_REG32, DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_SUBrmod, DIS_REG32, DIS_EADDR32);
 
 	| SUBrmow(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "SUBrmow", DIS_REG16, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_SUBrmow, DIS_REG16, DIS_EADDR16);
 
 	| ANDrmod(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "ANDrmod", DIS_REG32, DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_ANDrmod, DIS_REG32, DIS_EADDR32);
 
 	| ANDrmow(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "ANDrmow", DIS_REG16, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_ANDrmow, DIS_REG16, DIS_EADDR16);
 
 	| SBBrmod(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "SBBrmod", DIS_REG32, DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_SBBrmod, DIS_REG32, DIS_EADDR32);
 
 	| SBBrmow(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "SBBrmow", DIS_REG16, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_SBBrmow, DIS_REG16, DIS_EADDR16);
 
 	| ADCrmod(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "ADCrmod", DIS_REG32, DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_ADCrmod, DIS_REG32, DIS_EADDR32);
 
 	| ADCrmow(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "ADCrmow", DIS_REG16, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_ADCrmow, DIS_REG16, DIS_EADDR16);
 
 	| ORrmod(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "ORrmod", DIS_REG32, DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_ORrmod, DIS_REG32, DIS_EADDR32);
 
 	| ORrmow(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "ORrmow", DIS_REG16, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_ORrmow, DIS_REG16, DIS_EADDR16);
 
 	| ADDrmod(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "ADDrmod", DIS_REG32, DIS_EADDR32);
+		stmts = instantiate(pc,	 OP_ADDrmod, DIS_REG32, DIS_EADDR32);
 
 	| ADDrmow(reg, Eaddr) =>
-		stmts = instantiate(pc,	 "ADDrmow", DIS_REG16, DIS_EADDR16);
+		stmts = instantiate(pc,	 OP_ADDrmow, DIS_REG16, DIS_EADDR16);
 
 	| CMPrmb(r8, Eaddr) =>
-		stmts = instantiate(pc,	 "CMPrmb", DIS_R8, DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_CMPrmb, DIS_R8, DIS_EADDR8);
 
 	| XORrmb(r8, Eaddr) =>
-		stmts = instantiate(pc,	 "XORrmb", DIS_R8, DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_XORrmb, DIS_R8, DIS_EADDR8);
 
 	| SUBrmb(r8, Eaddr) =>
-		stmts = instantiate(pc,	 "SUBrmb", DIS_R8, DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_SUBrmb, DIS_R8, DIS_EADDR8);
 
 	| ANDrmb(r8, Eaddr) =>
-		stmts = instantiate(pc,	 "ANDrmb", DIS_R8, DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_ANDrmb, DIS_R8, DIS_EADDR8);
 
 	| SBBrmb(r8, Eaddr) =>
-		stmts = instantiate(pc,	 "SBBrmb", DIS_R8, DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_SBBrmb, DIS_R8, DIS_EADDR8);
 
 	| ADCrmb(r8, Eaddr) =>
-		stmts = instantiate(pc,	 "ADCrmb", DIS_R8, DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_ADCrmb, DIS_R8, DIS_EADDR8);
 
 	| ORrmb(r8, Eaddr) =>
-		stmts = instantiate(pc,	 "ORrmb", DIS_R8, DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_ORrmb, DIS_R8, DIS_EADDR8);
 
 	| ADDrmb(r8, Eaddr) =>
-		stmts = instantiate(pc,	 "ADDrmb", DIS_R8, DIS_EADDR8);
+		stmts = instantiate(pc,	 OP_ADDrmb, DIS_R8, DIS_EADDR8);
 
 	| CMPmrod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "CMPmrod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_CMPmrod, DIS_EADDR32, DIS_REG32);
 
 	| CMPmrow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "CMPmrow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_CMPmrow, DIS_EADDR16, DIS_REG16);
 
 	| XORmrod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "XORmrod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_XORmrod, DIS_EADDR32, DIS_REG32);
 
 	| XORmrow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "XORmrow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_XORmrow, DIS_EADDR16, DIS_REG16);
 
 	| SUBmrod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "SUBmrod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_SUBmrod, DIS_EADDR32, DIS_REG32);
 
 	| SUBmrow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "SUBmrow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_SUBmrow, DIS_EADDR16, DIS_REG16);
 
 	| ANDmrod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "ANDmrod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_ANDmrod, DIS_EADDR32, DIS_REG32);
 
 	| ANDmrow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "ANDmrow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_ANDmrow, DIS_EADDR16, DIS_REG16);
 
 	| SBBmrod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "SBBmrod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_SBBmrod, DIS_EADDR32, DIS_REG32);
 
 	| SBBmrow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "SBBmrow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_SBBmrow, DIS_EADDR16, DIS_REG16);
 
 	| ADCmrod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "ADCmrod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_ADCmrod, DIS_EADDR32, DIS_REG32);
 
 	| ADCmrow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "ADCmrow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_ADCmrow, DIS_EADDR16, DIS_REG16);
 
 	| ORmrod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "ORmrod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_ORmrod, DIS_EADDR32, DIS_REG32);
 
 	| ORmrow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "ORmrow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_ORmrow, DIS_EADDR16, DIS_REG16);
 
 	| ADDmrod(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "ADDmrod", DIS_EADDR32, DIS_REG32);
+		stmts = instantiate(pc,	 OP_ADDmrod, DIS_EADDR32, DIS_REG32);
 
 	| ADDmrow(Eaddr, reg) =>
-		stmts = instantiate(pc,	 "ADDmrow", DIS_EADDR16, DIS_REG16);
+		stmts = instantiate(pc,	 OP_ADDmrow, DIS_EADDR16, DIS_REG16);
 
 	| CMPmrb(Eaddr, r8) =>
-		stmts = instantiate(pc,	 "CMPmrb", DIS_EADDR8, DIS_R8);
+		stmts = instantiate(pc,	 OP_CMPmrb, DIS_EADDR8, DIS_R8);
 
 	| XORmrb(Eaddr, r8) =>
-		stmts = instantiate(pc,	 "XORmrb", DIS_EADDR8, DIS_R8);
+		stmts = instantiate(pc,	 OP_XORmrb, DIS_EADDR8, DIS_R8);
 
 	| SUBmrb(Eaddr, r8) =>
-		stmts = instantiate(pc,	 "SUBmrb", DIS_EADDR8, DIS_R8);
+		stmts = instantiate(pc,	 OP_SUBmrb, DIS_EADDR8, DIS_R8);
 
 	| ANDmrb(Eaddr, r8) =>
-		stmts = instantiate(pc,	 "ANDmrb", DIS_EADDR8, DIS_R8);
+		stmts = instantiate(pc,	 OP_ANDmrb, DIS_EADDR8, DIS_R8);
 
 	| SBBmrb(Eaddr, r8) =>
-		stmts = instantiate(pc,	 "SBBmrb", DIS_EADDR8, DIS_R8);
+		stmts = instantiate(pc,	 OP_SBBmrb, DIS_EADDR8, DIS_R8);
 
 	| ADCmrb(Eaddr, r8) =>
-		stmts = instantiate(pc,	 "ADCmrb", DIS_EADDR8, DIS_R8);
+		stmts = instantiate(pc,	 OP_ADCmrb, DIS_EADDR8, DIS_R8);
 
 	| ORmrb(Eaddr, r8) =>
-		stmts = instantiate(pc,	 "ORmrb", DIS_EADDR8, DIS_R8);
+		stmts = instantiate(pc,	 OP_ORmrb, DIS_EADDR8, DIS_R8);
 
 	| ADDmrb(Eaddr, r8) =>
-		stmts = instantiate(pc,	 "ADDmrb", DIS_EADDR8, DIS_R8);
+		stmts = instantiate(pc,	 OP_ADDmrb, DIS_EADDR8, DIS_R8);
 
 	| CMPiodb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "CMPiodb", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_CMPiodb, DIS_EADDR32, DIS_I8);
 
 	| CMPiowb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "CMPiowb", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_CMPiowb, DIS_EADDR16, DIS_I8);
 
 	| XORiodb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "XORiodb", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_XORiodb, DIS_EADDR32, DIS_I8);
 
 	| XORiowb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "XORiowb", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_XORiowb, DIS_EADDR16, DIS_I8);
 
 	| SUBiodb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SUBiodb", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_SUBiodb, DIS_EADDR32, DIS_I8);
 
 	| SUBiowb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SUBiowb", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_SUBiowb, DIS_EADDR16, DIS_I8);
 
 	| ANDiodb(Eaddr, i8) =>
 		// Special hack to ignore and $0xfffffff0, %esp
 		Exp* oper = dis_Eaddr(Eaddr, 32);
 		if (i8 != -16 || !(*oper == *Location::regOf(28)))
-			stmts = instantiate(pc,	 "ANDiodb", DIS_EADDR32, DIS_I8);
+			stmts = instantiate(pc,	 OP_ANDiodb, DIS_EADDR32, DIS_I8);
 
 	| ANDiowb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "ANDiowb", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_ANDiowb, DIS_EADDR16, DIS_I8);
 
 	| SBBiodb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SBBiodb", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_SBBiodb, DIS_EADDR32, DIS_I8);
 
 	| SBBiowb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SBBiowb", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_SBBiowb, DIS_EADDR16, DIS_I8);
 
 	| ADCiodb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "ADCiodb", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_ADCiodb, DIS_EADDR32, DIS_I8);
 
 	| ADCiowb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "ADCiowb", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_ADCiowb, DIS_EADDR16, DIS_I8);
 
 	| ORiodb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "ORiodb", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_ORiodb, DIS_EADDR32, DIS_I8);
 
 	| ORiowb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "ORiowb", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_ORiowb, DIS_EADDR16, DIS_I8);
 
 	| ADDiodb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "ADDiodb", DIS_EADDR32, DIS_I8);
+		stmts = instantiate(pc,	 OP_ADDiodb, DIS_EADDR32, DIS_I8);
 
 	| ADDiowb(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "ADDiowb", DIS_EADDR16, DIS_I8);
+		stmts = instantiate(pc,	 OP_ADDiowb, DIS_EADDR16, DIS_I8);
 
 	| CMPid(Eaddr, i32) =>
-		stmts = instantiate(pc,	 "CMPid", DIS_EADDR32, DIS_I32);
+		stmts = instantiate(pc,	 OP_CMPid, DIS_EADDR32, DIS_I32);
 
 	| XORid(Eaddr, i32) =>
-		stmts = instantiate(pc,	 "XORid", DIS_EADDR32, DIS_I32);
+		stmts = instantiate(pc,	 OP_XORid, DIS_EADDR32, DIS_I32);
 
 	| SUBid(Eaddr, i32) =>
-		stmts = instantiate(pc,	 "SUBid", DIS_EADDR32, DIS_I32);
+		stmts = instantiate(pc,	 OP_SUBid, DIS_EADDR32, DIS_I32);
 
 	| ANDid(Eaddr, i32) =>
-		stmts = instantiate(pc,	 "ANDid", DIS_EADDR32, DIS_I32);
+		stmts = instantiate(pc,	 OP_ANDid, DIS_EADDR32, DIS_I32);
 
 	| SBBid(Eaddr, i32) =>
-		stmts = instantiate(pc,	 "SBBid", DIS_EADDR32, DIS_I32);
+		stmts = instantiate(pc,	 OP_SBBid, DIS_EADDR32, DIS_I32);
 
 	| ADCid(Eaddr, i32) =>
-		stmts = instantiate(pc,	 "ADCid", DIS_EADDR32, DIS_I32);
+		stmts = instantiate(pc,	 OP_ADCid, DIS_EADDR32, DIS_I32);
 
 	| ORid(Eaddr, i32) =>
-		stmts = instantiate(pc,	 "ORid", DIS_EADDR32, DIS_I32);
+		stmts = instantiate(pc,	 OP_ORid, DIS_EADDR32, DIS_I32);
 
 	| ADDid(Eaddr, i32) =>
-		stmts = instantiate(pc,	 "ADDid", DIS_EADDR32, DIS_I32);
+		stmts = instantiate(pc,	 OP_ADDid, DIS_EADDR32, DIS_I32);
 
 	| CMPiw(Eaddr, i16) =>
-		stmts = instantiate(pc,	 "CMPiw", DIS_EADDR16, DIS_I16);
+		stmts = instantiate(pc,	 OP_CMPiw, DIS_EADDR16, DIS_I16);
 
 	| XORiw(Eaddr, i16) =>
-		stmts = instantiate(pc,	 "XORiw", DIS_EADDR16, DIS_I16);
+		stmts = instantiate(pc,	 OP_XORiw, DIS_EADDR16, DIS_I16);
 
 	| SUBiw(Eaddr, i16) =>
-		stmts = instantiate(pc,	 "SUBiw", DIS_EADDR16, DIS_I16);
+		stmts = instantiate(pc,	 OP_SUBiw, DIS_EADDR16, DIS_I16);
 
 	| ANDiw(Eaddr, i16) =>
-		stmts = instantiate(pc,	 "ANDiw", DIS_EADDR16, DIS_I16);
+		stmts = instantiate(pc,	 OP_ANDiw, DIS_EADDR16, DIS_I16);
 
 	| SBBiw(Eaddr, i16) =>
-		stmts = instantiate(pc,	 "SBBiw", DIS_EADDR16, DIS_I16);
+		stmts = instantiate(pc,	 OP_SBBiw, DIS_EADDR16, DIS_I16);
 
 	| ADCiw(Eaddr, i16) =>
-		stmts = instantiate(pc,	 "ADCiw", DIS_EADDR16, DIS_I16);
+		stmts = instantiate(pc,	 OP_ADCiw, DIS_EADDR16, DIS_I16);
 
 	| ORiw(Eaddr, i16) =>
-		stmts = instantiate(pc,	 "ORiw", DIS_EADDR16, DIS_I16);
+		stmts = instantiate(pc,	 OP_ORiw, DIS_EADDR16, DIS_I16);
 
 	| ADDiw(Eaddr, i16) =>
-		stmts = instantiate(pc,	 "ADDiw", DIS_EADDR16, DIS_I16);
+		stmts = instantiate(pc,	 OP_ADDiw, DIS_EADDR16, DIS_I16);
 
 	| CMPib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "CMPib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_CMPib, DIS_EADDR8, DIS_I8);
 
 	| XORib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "XORib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_XORib, DIS_EADDR8, DIS_I8);
 
 	| SUBib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SUBib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_SUBib, DIS_EADDR8, DIS_I8);
 
 	| ANDib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "ANDib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_ANDib, DIS_EADDR8, DIS_I8);
 
 	| SBBib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "SBBib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_SBBib, DIS_EADDR8, DIS_I8);
 
 	| ADCib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "ADCib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_ADCib, DIS_EADDR8, DIS_I8);
 
 	| ORib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "ORib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_ORib, DIS_EADDR8, DIS_I8);
 
 	| ADDib(Eaddr, i8) =>
-		stmts = instantiate(pc,	 "ADDib", DIS_EADDR8, DIS_I8);
+		stmts = instantiate(pc,	 OP_ADDib, DIS_EADDR8, DIS_I8);
 
 	| CMPiEAX(i32) =>
-		stmts = instantiate(pc,	 "CMPiEAX", DIS_I32);
+		stmts = instantiate(pc,	 OP_CMPiEAX, DIS_I32);
 
 	| XORiEAX(i32) =>
-		stmts = instantiate(pc,	 "XORiEAX", DIS_I32);
+		stmts = instantiate(pc,	 OP_XORiEAX, DIS_I32);
 
 	| SUBiEAX(i32) =>
-		stmts = instantiate(pc,	 "SUBiEAX", DIS_I32);
+		stmts = instantiate(pc,	 OP_SUBiEAX, DIS_I32);
 
 	| ANDiEAX(i32) =>
-		stmts = instantiate(pc,	 "ANDiEAX", DIS_I32);
+		stmts = instantiate(pc,	 OP_ANDiEAX, DIS_I32);
 
 	| SBBiEAX(i32) =>
-		stmts = instantiate(pc,	 "SBBiEAX", DIS_I32);
+		stmts = instantiate(pc,	 OP_SBBiEAX, DIS_I32);
 
 	| ADCiEAX(i32) =>
-		stmts = instantiate(pc,	 "ADCiEAX", DIS_I32);
+		stmts = instantiate(pc,	 OP_ADCiEAX, DIS_I32);
 
 	| ORiEAX(i32) =>
-		stmts = instantiate(pc,	 "ORiEAX", DIS_I32);
+		stmts = instantiate(pc,	 OP_ORiEAX, DIS_I32);
 
 	| ADDiEAX(i32) =>
-		stmts = instantiate(pc,	 "ADDiEAX", DIS_I32);
+		stmts = instantiate(pc,	 OP_ADDiEAX, DIS_I32);
 
 	| CMPiAX(i16) =>
-		stmts = instantiate(pc,	 "CMPiAX", DIS_I16);
+		stmts = instantiate(pc,	 OP_CMPiAX, DIS_I16);
 
 	| XORiAX(i16) =>
-		stmts = instantiate(pc,	 "XORiAX", DIS_I16);
+		stmts = instantiate(pc,	 OP_XORiAX, DIS_I16);
 
 	| SUBiAX(i16) =>
-		stmts = instantiate(pc,	 "SUBiAX", DIS_I16);
+		stmts = instantiate(pc,	 OP_SUBiAX, DIS_I16);
 
 	| ANDiAX(i16) =>
-		stmts = instantiate(pc,	 "ANDiAX", DIS_I16);
+		stmts = instantiate(pc,	 OP_ANDiAX, DIS_I16);
 
 	| SBBiAX(i16) =>
-		stmts = instantiate(pc,	 "SBBiAX", DIS_I16);
+		stmts = instantiate(pc,	 OP_SBBiAX, DIS_I16);
 
 	| ADCiAX(i16) =>
-		stmts = instantiate(pc,	 "ADCiAX", DIS_I16);
+		stmts = instantiate(pc,	 OP_ADCiAX, DIS_I16);
 
 	| ORiAX(i16) =>
-		stmts = instantiate(pc,	 "ORiAX", DIS_I16);
+		stmts = instantiate(pc,	 OP_ORiAX, DIS_I16);
 
 	| ADDiAX(i16) =>
-		stmts = instantiate(pc,	 "ADDiAX", DIS_I16);
+		stmts = instantiate(pc,	 OP_ADDiAX, DIS_I16);
 
 	| CMPiAL(i8) =>
-		stmts = instantiate(pc,	 "CMPiAL", DIS_I8);
+		stmts = instantiate(pc,	 OP_CMPiAL, DIS_I8);
 
 	| XORiAL(i8) =>
-		stmts = instantiate(pc,	 "XORiAL", DIS_I8);
+		stmts = instantiate(pc,	 OP_XORiAL, DIS_I8);
 
 	| SUBiAL(i8) =>
-		stmts = instantiate(pc,	 "SUBiAL", DIS_I8);
+		stmts = instantiate(pc,	 OP_SUBiAL, DIS_I8);
 
 	| ANDiAL(i8) =>
-		stmts = instantiate(pc,	 "ANDiAL", DIS_I8);
+		stmts = instantiate(pc,	 OP_ANDiAL, DIS_I8);
 
 	| SBBiAL(i8) =>
-		stmts = instantiate(pc,	 "SBBiAL", DIS_I8);
+		stmts = instantiate(pc,	 OP_SBBiAL, DIS_I8);
 
 	| ADCiAL(i8) =>
-		stmts = instantiate(pc,	 "ADCiAL", DIS_I8);
+		stmts = instantiate(pc,	 OP_ADCiAL, DIS_I8);
 
 	| ORiAL(i8) =>
-		stmts = instantiate(pc,	 "ORiAL", DIS_I8);
+		stmts = instantiate(pc,	 OP_ORiAL, DIS_I8);
 
 	| ADDiAL(i8) =>
-		stmts = instantiate(pc,	 "ADDiAL", DIS_I8);
+		stmts = instantiate(pc,	 OP_ADDiAL, DIS_I8);
 
 	| LODSvod() =>
-		stmts = instantiate(pc,	 "LODSvod");
+		stmts = instantiate(pc,	 OP_LODSvod);
 
 	| LODSvow() =>
-		stmts = instantiate(pc,	 "LODSvow");
+		stmts = instantiate(pc,	 OP_LODSvow);
 
 	| LODSB() =>
-		stmts = instantiate(pc,	 "LODSB");
+		stmts = instantiate(pc,	 OP_LODSB);
 
 	/* Floating point instructions */
 	| F2XM1() =>
-		stmts = instantiate(pc,	 "F2XM1");
+		stmts = instantiate(pc,	 OP_F2XM1);
 
 	| FABS() =>
-		stmts = instantiate(pc,	 "FABS");
+		stmts = instantiate(pc,	 OP_FABS);
 
 	| FADD.R32(Mem32) =>
-		stmts = instantiate(pc,	 "FADD.R32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FADD_R32, DIS_MEM32);
 
 	| FADD.R64(Mem64) =>
-		stmts = instantiate(pc,	 "FADD.R64", DIS_MEM64);
+		stmts = instantiate(pc,	 OP_FADD_R64, DIS_MEM64);
 
 	| FADD.ST.STi(idx) =>
-		stmts = instantiate(pc,	 "FADD.St.STi", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FADD_St_STi, DIS_IDX);
 
 	| FADD.STi.ST(idx) =>
-		stmts = instantiate(pc,	 "FADD.STi.ST", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FADD_STi_ST, DIS_IDX);
 
 	| FADDP.STi.ST(idx) =>
-		stmts = instantiate(pc,	 "FADDP.STi.ST", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FADDP_STi_ST, DIS_IDX);
 
 	| FIADD.I32(Mem32) =>
-		stmts = instantiate(pc,	 "FIADD.I32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FIADD_I32, DIS_MEM32);
 
 	| FIADD.I16(Mem16) =>
-		stmts = instantiate(pc,	 "FIADD.I16", DIS_MEM16);
+		stmts = instantiate(pc,	 OP_FIADD_I16, DIS_MEM16);
 
 	| FBLD(Mem80) =>
-		stmts = instantiate(pc,	 "FBLD", DIS_MEM80);
+		stmts = instantiate(pc,	 OP_FBLD, DIS_MEM80);
 
 	| FBSTP(Mem80) =>
-		stmts = instantiate(pc,	 "FBSTP", DIS_MEM80);
+		stmts = instantiate(pc,	 OP_FBSTP, DIS_MEM80);
 
 	| FCHS() =>
-		stmts = instantiate(pc,	 "FCHS");
+		stmts = instantiate(pc,	 OP_FCHS);
 
 	| FNCLEX() =>
-		stmts = instantiate(pc,	 "FNCLEX");
+		stmts = instantiate(pc,	 OP_FNCLEX);
 
 	| FCOM.R32(Mem32) =>
-		stmts = instantiate(pc,	 "FCOM.R32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FCOM_R32, DIS_MEM32);
 
 	| FCOM.R64(Mem64) =>
-		stmts = instantiate(pc,	 "FCOM.R64", DIS_MEM64);
+		stmts = instantiate(pc,	 OP_FCOM_R64, DIS_MEM64);
 
 	| FICOM.I32(Mem32) =>
-		stmts = instantiate(pc,	 "FICOM.I32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FICOM_I32, DIS_MEM32);
 
 	| FICOM.I16(Mem16) =>
-		stmts = instantiate(pc,	 "FICOM.I16", DIS_MEM16);
+		stmts = instantiate(pc,	 OP_FICOM_I16, DIS_MEM16);
 
 	| FCOMP.R32(Mem32) =>
-		stmts = instantiate(pc,	 "FCOMP.R32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FCOMP_R32, DIS_MEM32);
 
 	| FCOMP.R64(Mem64) =>
-		stmts = instantiate(pc,	 "FCOMP.R64", DIS_MEM64);
+		stmts = instantiate(pc,	 OP_FCOMP_R64, DIS_MEM64);
 
 	| FCOM.ST.STi(idx) =>
-		stmts = instantiate(pc,	 "FCOM.ST.STi", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FCOM_ST_STi, DIS_IDX);
 
 	| FCOMP.ST.STi(idx) =>
-		stmts = instantiate(pc,	 "FCOMP.ST.STi", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FCOMP_ST_STi, DIS_IDX);
 
 	| FICOMP.I32(Mem32) =>
-		stmts = instantiate(pc,	 "FICOMP.I32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FICOMP_I32, DIS_MEM32);
 
 	| FICOMP.I16(Mem16) =>
-		stmts = instantiate(pc,	 "FICOMP.I16", DIS_MEM16);
+		stmts = instantiate(pc,	 OP_FICOMP_I16, DIS_MEM16);
 
 	| FCOMPP() =>
-		stmts = instantiate(pc,	 "FCOMPP");
+		stmts = instantiate(pc,	 OP_FCOMPP);
 
 	| FCOMI.ST.STi(idx) [name] =>
 		stmts = instantiate(pc, name, DIS_IDX);
@@ -1831,91 +1825,91 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 		stmts = instantiate(pc, name, DIS_IDX);
 
 	| FCOS() =>
-		stmts = instantiate(pc,	 "FCOS");
+		stmts = instantiate(pc,	 OP_FCOS);
 
 	| FDECSTP() =>
-		stmts = instantiate(pc,	 "FDECSTP");
+		stmts = instantiate(pc,	 OP_FDECSTP);
 
 	| FDIV.R32(Mem32) =>
-		stmts = instantiate(pc,	 "FDIV.R32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FDIV_R32, DIS_MEM32);
 
 	| FDIV.R64(Mem64) =>
-		stmts = instantiate(pc,	 "FDIV.R64", DIS_MEM64);
+		stmts = instantiate(pc,	 OP_FDIV_R64, DIS_MEM64);
 
 	| FDIV.ST.STi(idx) =>
-		stmts = instantiate(pc,	 "FDIV.ST.STi", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FDIV_ST_STi, DIS_IDX);
 
 	| FDIV.STi.ST(idx) =>
-		stmts = instantiate(pc,	 "FDIV.STi.ST", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FDIV_STi_ST, DIS_IDX);
 
 	| FDIVP.STi.ST(idx) =>
-		stmts = instantiate(pc,	 "FDIVP.STi.ST", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FDIVP_STi_ST, DIS_IDX);
 
 	| FIDIV.I32(Mem32) =>
-		stmts = instantiate(pc,	 "FIDIV.I32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FIDIV_I32, DIS_MEM32);
 
 	| FIDIV.I16(Mem16) =>
-		stmts = instantiate(pc,	 "FIDIV.I16", DIS_MEM16);
+		stmts = instantiate(pc,	 OP_FIDIV_I16, DIS_MEM16);
 
 	| FDIVR.R32(Mem32) =>
-		stmts = instantiate(pc,	 "FDIVR.R32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FDIVR_R32, DIS_MEM32);
 
 	| FDIVR.R64(Mem64) =>
-		stmts = instantiate(pc,	 "FDIVR.R64", DIS_MEM64);
+		stmts = instantiate(pc,	 OP_FDIVR_R64, DIS_MEM64);
 
 	| FDIVR.ST.STi(idx) =>
-		stmts = instantiate(pc,	 "FDIVR.ST.STi", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FDIVR_ST_STi, DIS_IDX);
 
 	| FDIVR.STi.ST(idx) =>
-		stmts = instantiate(pc,	 "FDIVR.STi.ST", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FDIVR_STi_ST, DIS_IDX);
 
 	| FIDIVR.I32(Mem32) =>
-		stmts = instantiate(pc,	 "FIDIVR.I32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FIDIVR_I32, DIS_MEM32);
 
 	| FIDIVR.I16(Mem16) =>
-		stmts = instantiate(pc,	 "FIDIVR.I16", DIS_MEM16);
+		stmts = instantiate(pc,	 OP_FIDIVR_I16, DIS_MEM16);
 
 	| FDIVRP.STi.ST(idx) =>
-		stmts = instantiate(pc,	 "FDIVRP.STi.ST", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FDIVRP_STi_ST, DIS_IDX);
 
 	| FFREE(idx) =>
-		stmts = instantiate(pc,	 "FFREE", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FFREE, DIS_IDX);
 
 	| FILD.lsI16(Mem16) =>
-		stmts = instantiate(pc,	 "FILD.lsI16", DIS_MEM16);
+		stmts = instantiate(pc,	 OP_FILD_lsI16, DIS_MEM16);
 
 	| FILD.lsI32(Mem32) =>
-		stmts = instantiate(pc,	 "FILD.lsI32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FILD_lsI32, DIS_MEM32);
 
 	| FILD64(Mem64) =>
-		stmts = instantiate(pc,	 "FILD.lsI64", DIS_MEM64);
+		stmts = instantiate(pc,	 OP_FILD_lsI64, DIS_MEM64);
 
 	| FINIT() =>
-		stmts = instantiate(pc,	 "FINIT");
+		stmts = instantiate(pc,	 OP_FINIT);
 
 	| FIST.lsI16(Mem16) =>
-		stmts = instantiate(pc,	 "FIST.lsI16", DIS_MEM16);
+		stmts = instantiate(pc,	 OP_FIST_lsI16, DIS_MEM16);
 
 	| FIST.lsI32(Mem32) =>
-		stmts = instantiate(pc,	 "FIST.lsI32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FIST_lsI32, DIS_MEM32);
 
 	| FISTP.lsI16(Mem16) =>
-		stmts = instantiate(pc,	 "FISTP.lsI16", DIS_MEM16);
+		stmts = instantiate(pc,	 OP_FISTP_lsI16, DIS_MEM16);
 
 	| FISTP.lsI32(Mem32) =>
-		stmts = instantiate(pc,	 "FISTP.lsI32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FISTP_lsI32, DIS_MEM32);
 
 	| FISTP64(Mem64) =>
-		stmts = instantiate(pc,	 "FISTP64", DIS_MEM64);
+		stmts = instantiate(pc,	 OP_FISTP64, DIS_MEM64);
 
 	| FLD.lsR32(Mem32) =>
-		stmts = instantiate(pc,	 "FLD.lsR32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FLD_lsR32, DIS_MEM32);
 
 	| FLD.lsR64(Mem64) =>
-		stmts = instantiate(pc,	 "FLD.lsR64", DIS_MEM64);
+		stmts = instantiate(pc,	 OP_FLD_lsR64, DIS_MEM64);
 
 	| FLD80(Mem80) =>
-		stmts = instantiate(pc,	 "FLD80", DIS_MEM80);
+		stmts = instantiate(pc,	 OP_FLD80, DIS_MEM80);
 
 /* This is a bit tricky. The FPUSH logically comes between the read of STi and
 # the write to ST0. In particular, FLD ST0 is supposed to duplicate the TOS.
@@ -1923,178 +1917,178 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 # around here that gives us the SSL a value of i that is one more than in
 # the instruction */
 	| FLD.STi(idx) =>
-		stmts = instantiate(pc,	 "FLD.STi", DIS_IDXP1);
+		stmts = instantiate(pc,	 OP_FLD_STi, DIS_IDXP1);
 
 	| FLD1() =>
-		stmts = instantiate(pc,	 "FLD1");
+		stmts = instantiate(pc,	 OP_FLD1);
 
 	| FLDL2T() =>
-		stmts = instantiate(pc,	 "FLDL2T");
+		stmts = instantiate(pc,	 OP_FLDL2T);
 
 	| FLDL2E() =>
-		stmts = instantiate(pc,	 "FLDL2E");
+		stmts = instantiate(pc,	 OP_FLDL2E);
 
 	| FLDPI() =>
-		stmts = instantiate(pc,	 "FLDPI");
+		stmts = instantiate(pc,	 OP_FLDPI);
 
 	| FLDLG2() =>
-		stmts = instantiate(pc,	 "FLDLG2");
+		stmts = instantiate(pc,	 OP_FLDLG2);
 
 	| FLDLN2() =>
-		stmts = instantiate(pc,	 "FLDLN2");
+		stmts = instantiate(pc,	 OP_FLDLN2);
 
 	| FLDZ() =>
-		stmts = instantiate(pc,	 "FLDZ");
+		stmts = instantiate(pc,	 OP_FLDZ);
 
 	| FLDCW(Mem16) =>
-		stmts = instantiate(pc,	 "FLDCW", DIS_MEM16);
+		stmts = instantiate(pc,	 OP_FLDCW, DIS_MEM16);
 
 	| FLDENV(Mem) =>
-		stmts = instantiate(pc,	 "FLDENV", DIS_MEM);
+		stmts = instantiate(pc,	 OP_FLDENV, DIS_MEM);
 
 	| FMUL.R32(Mem32) =>
-		stmts = instantiate(pc,	 "FMUL.R32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FMUL_R32, DIS_MEM32);
 
 	| FMUL.R64(Mem64) =>
-		stmts = instantiate(pc,	 "FMUL.R64", DIS_MEM64);
+		stmts = instantiate(pc,	 OP_FMUL_R64, DIS_MEM64);
 
 	| FMUL.ST.STi(idx) =>
-		stmts = instantiate(pc,	 "FMUL.ST.STi", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FMUL_ST_STi, DIS_IDX);
 
 	| FMUL.STi.ST(idx) =>
-		stmts = instantiate(pc,	 "FMUL.STi.ST", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FMUL_STi_ST, DIS_IDX);
 
 	| FMULP.STi.ST(idx) =>
-		stmts = instantiate(pc,	 "FMULP.STi.ST", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FMULP_STi_ST, DIS_IDX);
 
 	| FIMUL.I32(Mem32) =>
-		stmts = instantiate(pc,	 "FIMUL.I32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FIMUL_I32, DIS_MEM32);
 
 	| FIMUL.I16(Mem16) =>
-		stmts = instantiate(pc,	 "FIMUL.I16", DIS_MEM16);
+		stmts = instantiate(pc,	 OP_FIMUL_I16, DIS_MEM16);
 
 	| FNOP() =>
-		stmts = instantiate(pc,	 "FNOP");
+		stmts = instantiate(pc,	 OP_FNOP);
 
 	| FPATAN() =>
-		stmts = instantiate(pc,	 "FPATAN");
+		stmts = instantiate(pc,	 OP_FPATAN);
 
 	| FPREM() =>
-		stmts = instantiate(pc,	 "FPREM");
+		stmts = instantiate(pc,	 OP_FPREM);
 
 	| FPREM1() =>
-		stmts = instantiate(pc,	 "FPREM1");
+		stmts = instantiate(pc,	 OP_FPREM1);
 
 	| FPTAN() =>
-		stmts = instantiate(pc,	 "FPTAN");
+		stmts = instantiate(pc,	 OP_FPTAN);
 
 	| FRNDINT() =>
-		stmts = instantiate(pc,	 "FRNDINT");
+		stmts = instantiate(pc,	 OP_FRNDINT);
 
 	| FRSTOR(Mem) =>
-		stmts = instantiate(pc,	 "FRSTOR", DIS_MEM);
+		stmts = instantiate(pc,	 OP_FRSTOR, DIS_MEM);
 
 	| FNSAVE(Mem) =>
-		stmts = instantiate(pc,	 "FNSAVE", DIS_MEM);
+		stmts = instantiate(pc,	 OP_FNSAVE, DIS_MEM);
 
 	| FSCALE() =>
-		stmts = instantiate(pc,	 "FSCALE");
+		stmts = instantiate(pc,	 OP_FSCALE);
 
 	| FSIN() =>
-		stmts = instantiate(pc,	 "FSIN");
+		stmts = instantiate(pc,	 OP_FSIN);
 
 	| FSINCOS() =>
-		stmts = instantiate(pc,	 "FSINCOS");
+		stmts = instantiate(pc,	 OP_FSINCOS);
 
 	| FSQRT() =>
-		stmts = instantiate(pc,	 "FSQRT");
+		stmts = instantiate(pc,	 OP_FSQRT);
 
 	| FST.lsR32(Mem32) =>
-		stmts = instantiate(pc,	 "FST.lsR32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FST_lsR32, DIS_MEM32);
 
 	| FST.lsR64(Mem64) =>
-		stmts = instantiate(pc,	 "FST.lsR64", DIS_MEM64);
+		stmts = instantiate(pc,	 OP_FST_lsR64, DIS_MEM64);
 
 	| FSTP.lsR32(Mem32) =>
-		stmts = instantiate(pc,	 "FSTP.lsR32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FSTP_lsR32, DIS_MEM32);
 
 	| FSTP.lsR64(Mem64) =>
-		stmts = instantiate(pc,	 "FSTP.lsR64", DIS_MEM64);
+		stmts = instantiate(pc,	 OP_FSTP_lsR64, DIS_MEM64);
 
 	| FSTP80(Mem80) =>
-		stmts = instantiate(pc,	 "FSTP80", DIS_MEM80);
+		stmts = instantiate(pc,	 OP_FSTP80, DIS_MEM80);
 
 	| FST.st.STi(idx) =>
-		stmts = instantiate(pc,	 "FST.st.STi", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FST_st_STi, DIS_IDX);
 
 	| FSTP.st.STi(idx) =>
-		stmts = instantiate(pc,	 "FSTP.st.STi", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FSTP_st_STi, DIS_IDX);
 
 	| FSTCW(Mem16) =>
-		stmts = instantiate(pc,	 "FSTCW", DIS_MEM16);
+		stmts = instantiate(pc,	 OP_FSTCW, DIS_MEM16);
 
 	| FSTENV(Mem) =>
-		stmts = instantiate(pc,	 "FSTENV", DIS_MEM);
+		stmts = instantiate(pc,	 OP_FSTENV, DIS_MEM);
 
 	| FSTSW(Mem16) =>
-		stmts = instantiate(pc,	 "FSTSW", DIS_MEM16);
+		stmts = instantiate(pc,	 OP_FSTSW, DIS_MEM16);
 
 	| FSTSW.AX() =>
-		stmts = instantiate(pc,	 "FSTSW.AX");
+		stmts = instantiate(pc,	 OP_FSTSW_AX);
 
 	| FSUB.R32(Mem32) =>
-		stmts = instantiate(pc,	 "FSUB.R32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FSUB_R32, DIS_MEM32);
 
 	| FSUB.R64(Mem64) =>
-		stmts = instantiate(pc,	 "FSUB.R64", DIS_MEM64);
+		stmts = instantiate(pc,	 OP_FSUB_R64, DIS_MEM64);
 
 	| FSUB.ST.STi(idx) =>
-		stmts = instantiate(pc,	 "FSUB.ST.STi", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FSUB_ST_STi, DIS_IDX);
 
 	| FSUB.STi.ST(idx) =>
-		stmts = instantiate(pc,	 "FSUB.STi.ST", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FSUB_STi_ST, DIS_IDX);
 
 	| FISUB.I32(Mem32) =>
-		stmts = instantiate(pc,	 "FISUB.I32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FISUB_I32, DIS_MEM32);
 
 	| FISUB.I16(Mem16) =>
-		stmts = instantiate(pc,	 "FISUB.I16", DIS_MEM16);
+		stmts = instantiate(pc,	 OP_FISUB_I16, DIS_MEM16);
 
 	| FSUBP.STi.ST(idx) =>
-		stmts = instantiate(pc,	 "FSUBP.STi.ST", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FSUBP_STi_ST, DIS_IDX);
 
 	| FSUBR.R32(Mem32) =>
-		stmts = instantiate(pc,	 "FSUBR.R32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FSUBR_R32, DIS_MEM32);
 
 	| FSUBR.R64(Mem64) =>
-		stmts = instantiate(pc,	 "FSUBR.R64", DIS_MEM64);
+		stmts = instantiate(pc,	 OP_FSUBR_R64, DIS_MEM64);
 
 	| FSUBR.ST.STi(idx) =>
-		stmts = instantiate(pc,	 "FSUBR.ST.STi", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FSUBR_ST_STi, DIS_IDX);
 
 	| FSUBR.STi.ST(idx) =>
-		stmts = instantiate(pc,	 "FSUBR.STi.ST", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FSUBR_STi_ST, DIS_IDX);
 
 	| FISUBR.I32(Mem32) =>
-		stmts = instantiate(pc,	 "FISUBR.I32", DIS_MEM32);
+		stmts = instantiate(pc,	 OP_FISUBR_I32, DIS_MEM32);
 
 	| FISUBR.I16(Mem16) =>
-		stmts = instantiate(pc,	 "FISUBR.I16", DIS_MEM16);
+		stmts = instantiate(pc,	 OP_FISUBR_I16, DIS_MEM16);
 
 	| FSUBRP.STi.ST(idx) =>
-		stmts = instantiate(pc,	 "FSUBRP.STi.ST", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FSUBRP_STi_ST, DIS_IDX);
 
 	| FTST() =>
-		stmts = instantiate(pc,	 "FTST");
+		stmts = instantiate(pc,	 OP_FTST);
 
 	| FUCOM(idx) =>
-		stmts = instantiate(pc,	 "FUCOM", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FUCOM, DIS_IDX);
 
 	| FUCOMP(idx) =>
-		stmts = instantiate(pc,	 "FUCOMP", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FUCOMP, DIS_IDX);
 
 	| FUCOMPP() =>
-		stmts = instantiate(pc,	 "FUCOMPP");
+		stmts = instantiate(pc,	 OP_FUCOMPP);
 
 	| FUCOMI.ST.STi(idx) [name] =>
 		stmts = instantiate(pc, name, DIS_IDX);
@@ -2103,19 +2097,19 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 		stmts = instantiate(pc, name, DIS_IDX);
 
 	| FXAM() =>
-		stmts = instantiate(pc,	 "FXAM");
+		stmts = instantiate(pc,	 OP_FXAM);
 
 	| FXCH(idx) =>
-		stmts = instantiate(pc,	 "FXCH", DIS_IDX);
+		stmts = instantiate(pc,	 OP_FXCH, DIS_IDX);
 
 	| FXTRACT() =>
-		stmts = instantiate(pc,	 "FXTRACT");
+		stmts = instantiate(pc,	 OP_FXTRACT);
 
 	| FYL2X() =>
-		stmts = instantiate(pc,	 "FYL2X");
+		stmts = instantiate(pc,	 OP_FYL2X);
 
 	| FYL2XP1() =>
-		stmts = instantiate(pc,	 "FYL2XP1");
+		stmts = instantiate(pc,	 OP_FYL2XP1);
 
 	else
 		result.valid = false;		// Invalid instruction
@@ -2319,10 +2313,11 @@ DWord PentiumDecoder::getDword (unsigned lc)
  * PARAMETERS:	   None
  * RETURNS:		   N/A
  *============================================================================*/
-PentiumDecoder::PentiumDecoder(Prog* prog) : NJMCDecoder(prog)
+PentiumDecoder::PentiumDecoder(Prog* prog) : NJMCDecoder(prog), BSFRstate(0)
 {
 	std::string file = Boomerang::get()->getProgPath() + "frontend/machine/pentium/pentium.ssl";
 	RTLDict.readSSLFile(file.c_str());
+	resolveOpcodes(opcodeNameTable, NUM_OPCODES);
 }
 
 // For now...
@@ -2330,7 +2325,7 @@ int PentiumDecoder::decodeAssemblyInstruction(unsigned, int)
 { return 0; }
 
 /*==============================================================================
- * FUNCTION:	   genBSFR
+ * FUNCTION:	   PentiumDecoder::genBSFR
  * OVERVIEW:	   Generate statements for the BSF and BSR series (Bit Scan Forward/Reverse)
  * PARAMETERS:	   pc: native PC address (start of the BSF/BSR instruction)
  *				   reg: an expression for the destination register
@@ -2341,8 +2336,7 @@ int PentiumDecoder::decodeAssemblyInstruction(unsigned, int)
  *				   numBytes: number of bytes this instruction
  * RETURNS:		   true if have to exit early (not in last state)
  *============================================================================*/
-static int BSFRstate = 0;		// State number for this state machine
-void genBSFR(ADDRESS pc, Exp* dest, Exp* modrm, int init, int size,
+void PentiumDecoder::genBSFR(ADDRESS pc, Exp* dest, Exp* modrm, int init, int size,
   OPER incdec, int numBytes) {
 	// Note the horrible hack needed here. We need initialisation code, and an extra branch, so the %SKIP/%RPT won't
 	// work. We need to emit 6 statements, but these need to be in 3 RTLs, since the destination of a branch has to be
@@ -2438,8 +2432,19 @@ void genBSFR(ADDRESS pc, Exp* dest, Exp* modrm, int init, int size,
 
 Exp *PentiumDecoder::addReloc(Exp *e)
 {
-	if (lastDwordLc != (unsigned)-1)
+	if (lastDwordLc != (unsigned)-1) {
+		if (prog->isRelocationAt(lastDwordLc)) {
+			result.reusable = false;			// addReloc may add a global
+			if (predecoding)
+				return e;
+		}
 		e = prog->addReloc(e, lastDwordLc);
+	}
 	return e;
 }
 
+const char* const PentiumDecoder::opcodeNameTable[] = {
+#define OPCODE(id, name) name,
+#include "pentiumopcodes.h"
+#undef OPCODE
+};
@@ -107,7 +107,6 @@ void unused(char* x) {}
  *					 gathered during decoding
  *============================================================================*/
 DecodeResult& PPCDecoder::decodeInstruction (ADDRESS pc, int delta) { 
-	static DecodeResult result;
 	ADDRESS hostPC = pc+delta;
 
 	// Clear the result structure;
@@ -174,11 +173,11 @@ DecodeResult& PPCDecoder::decodeInstruction (ADDRESS pc, int delta) {
 	| mtspr (uimm, rs) [name] =>
 		switch (uimm) {
 			case 1:
-				stmts = instantiate(pc, "MTXER" , DIS_RS); break;
+				stmts = instantiate(pc, OP_MTXER , DIS_RS); break;
 			case 8:
-				stmts = instantiate(pc, "MTLR" , DIS_RS); break;
+				stmts = instantiate(pc, OP_MTLR , DIS_RS); break;
 			case 9:
-				stmts = instantiate(pc, "MTCTR" , DIS_RS); break;
+				stmts = instantiate(pc, OP_MTCTR , DIS_RS); break;
 			default:
 				std::cerr << "ERROR: MTSPR instruction with invalid S field: " << uimm << "\n";
 		}
@@ -201,9 +200,7 @@ DecodeResult& PPCDecoder::decodeInstruction (ADDRESS pc, int delta) {
 		newCall->setDest(dest);
 		result.rtl = new RTL(pc, stmts);
 		result.rtl->appendStmt(newCall);
-		Proc* destProc = prog->setNewProc(reladdr-delta);
-		if (destProc == (Proc*)-1) destProc = NULL;
-		newCall->setDestProc(destProc);
+		setDestProc(newCall, reladdr-delta);
 
 	| b (reladdr) =>
 		unconditionalJump("b", 4, reladdr, delta, pc, stmts, result);
@@ -436,6 +433,7 @@ PPCDecoder::PPCDecoder(Prog* prog) : NJMCDecoder(prog)
 {
   std::string file = Boomerang::get()->getProgPath() + "frontend/machine/ppc/ppc.ssl";
   RTLDict.readSSLFile(file.c_str());
+  resolveOpcodes(opcodeNameTable, NUM_OPCODES);
 }
 
 // For now...
@@ -453,3 +451,8 @@ Exp* crBit(int bitNum) {
 		new Const(bitNum));
 }
 
+const char* const PPCDecoder::opcodeNameTable[] = {
+#define OPCODE(id, name) name,
+#include "ppcopcodes.h"
+#undef OPCODE
+};
@@ -201,7 +201,6 @@ RTL* SparcDecoder::createBranchRtl(ADDRESS pc, std::list<Statement*>* stmts, con
  * RETURNS:		   a DecodeResult structure containing all the information gathered during decoding
  *============================================================================*/
 DecodeResult& SparcDecoder::decodeInstruction (ADDRESS pc, int delta) { 
-	static DecodeResult result;
 	ADDRESS hostPC = pc+delta;
 
 	// Clear the result structure;
@@ -223,9 +222,7 @@ DecodeResult& SparcDecoder::decodeInstruction (ADDRESS pc, int delta) {
 		// Set the destination
 		ADDRESS nativeDest = addr - delta;
 		newCall->setDest(nativeDest);
-		Proc* destProc = prog->setNewProc(nativeDest);
-		if (destProc == (Proc*)-1) destProc = NULL;
-		newCall->setDestProc(destProc);
+		setDestProc(newCall, nativeDest);
 		result.rtl = new RTL(pc, stmts);
 		result.rtl->appendStmt(newCall);
 		result.type = SD;
@@ -474,18 +471,18 @@ DecodeResult& SparcDecoder::decodeInstruction (ADDRESS pc, int delta) {
 		// Decided to treat SAVE as an ordinary instruction
 		// That is, use the large list of effects from the SSL file, and
 		// hope that optimisation will vastly help the common cases
-		stmts = instantiate(pc, "SAVE", DIS_RS1, DIS_ROI, DIS_RD);
+		stmts = instantiate(pc, OP_SAVE, DIS_RS1, DIS_ROI, DIS_RD);
 
 	| RESTORE (rs1, roi, rd) =>
 		// Decided to treat RESTORE as an ordinary instruction
-		stmts = instantiate(pc, "RESTORE", DIS_RS1, DIS_ROI, DIS_RD);
+		stmts = instantiate(pc, OP_RESTORE, DIS_RS1, DIS_ROI, DIS_RD);
 
 	| NOP [name] =>
 		result.type = NOP;
 		stmts = instantiate(pc,	 name);
 
 	| sethi(imm22, rd) => 
-		stmts = instantiate(pc,	 "sethi", dis_Num(imm22), DIS_RD);
+		stmts = instantiate(pc,	 OP_sethi, dis_Num(imm22), DIS_RD);
 
 	| load_greg(addr, rd) [name] => 
 		stmts = instantiate(pc,	 name, DIS_ADDR, DIS_RD);
@@ -804,9 +801,15 @@ SparcDecoder::SparcDecoder(Prog* prog) : NJMCDecoder(prog)
 {
 	std::string file = Boomerang::get()->getProgPath() + "frontend/machine/sparc/sparc.ssl";
 	RTLDict.readSSLFile(file.c_str());
+	resolveOpcodes(opcodeNameTable, NUM_OPCODES);
 }
 
 // For now...
 int SparcDecoder::decodeAssemblyInstruction(unsigned, int)
 { return 0; }
 
+const char* const SparcDecoder::opcodeNameTable[] = {
+#define OPCODE(id, name) name,
+#include "sparcopcodes.h"
+#undef OPCODE
+};
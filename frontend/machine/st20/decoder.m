@@ -50,7 +50,6 @@ void ST20Decoder::unused(int x)
  *				   proc - the enclosing procedure
  * RETURNS:		   a DecodeResult structure containing all the information gathered during decoding
  *============================================================================*/
-static	DecodeResult result;
 DecodeResult& ST20Decoder::decodeInstruction (ADDRESS pc, int delta) {
 	result.reset();							// Clear the result structure (numBytes = 0 etc)
 	ADDRESS hostPC = pc + delta;
@@ -76,7 +75,7 @@ DecodeResult& ST20Decoder::decodeInstruction (ADDRESS pc, int delta) {
 
 		| call (oper) =>
 			total += oper;
-			stmts = instantiate(pc, "call" , new Const(total));
+			stmts = instantiate(pc, OP_call , new Const(total));
 			CallStatement* newCall = new CallStatement;
 			newCall->setIsComputed(false);
 			newCall->setDest(pc+result.numBytes+total);
@@ -344,9 +343,15 @@ ST20Decoder::ST20Decoder() : NJMCDecoder(prog)
 {
 	std::string file = Boomerang::get()->getProgPath() + "frontend/machine/st20/st20.ssl";
 	RTLDict.readSSLFile(file.c_str());
+	resolveOpcodes(opcodeNameTable, NUM_OPCODES);
 }
 
 // For now...
 int ST20Decoder::decodeAssemblyInstruction(unsigned, int)
 { return 0; }
 
+const char* const ST20Decoder::opcodeNameTable[] = {
+#define OPCODE(id, name) name,
+#include "st20opcodes.h"
+#undef OPCODE
+};
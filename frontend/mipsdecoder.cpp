@@ -85,7 +85,6 @@ int MIPSDecoder::decodeAssemblyInstruction(unsigned, int)
 // Stub from PPC...
 DecodeResult& MIPSDecoder::decodeInstruction(ADDRESS pc, int delta)
 { 
-static DecodeResult result;
 ADDRESS hostPC = pc+delta;
 
 // Clear the result structure;
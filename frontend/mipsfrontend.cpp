@@ -45,6 +45,11 @@ MIPSFrontEnd::MIPSFrontEnd(BinaryFile *pBF, Prog* prog, BinaryFileFactory* pbff)
 	decoder = new MIPSDecoder(prog);
 }
 
+// A decoder for predecoding
+NJMCDecoder* MIPSFrontEnd::newDecoder() {
+	return new MIPSDecoder(prog);
+}
+
 
 // destructor
 MIPSFrontEnd::~MIPSFrontEnd()
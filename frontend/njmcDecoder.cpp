@@ -17,6 +17,10 @@
  * $Revision: 1.21 $	// 1.19.2.3
  *
  * 27 Apr 02 - Mike: Mods for boomerang
+ * 17 Oct 26 - instantiate() takes typed operands and uses opcode ids, instead of varargs
+ * 17 Oct 26 - setDestProc, deferred when predecoding
+ * 17 Oct 26 - setDestProc always records the call in the result
+ * 17 Oct 26 - resolveOpcodes, and instantiate() by opcode index
  */
 
 #include <assert.h>
@@ -49,32 +53,65 @@
  * PARAMETERS:	   prog: Pointer to the Prog object
  * RETURNS:		   N/A
  *============================================================================*/
-NJMCDecoder::NJMCDecoder(Prog* prog) : prog(prog)
+NJMCDecoder::NJMCDecoder(Prog* prog) : prog(prog), predecoding(false), opcodeNames(NULL)
 {}
 
+/*==============================================================================
+ * FUNCTION:	   NJMCDecoder::resolveOpcodes
+ * OVERVIEW:	   Look up the opcode ids of the instructions that the decoder instantiates by index. Called from the
+ *					constructor of each decoder, after the SSL file has been read.
+ * PARAMETERS:	   names - the (static) instruction names, indexed by the decoder's opcode enum
+ *				   num - the number of names
+ * RETURNS:		   <nothing>
+ *============================================================================*/
+void NJMCDecoder::resolveOpcodes(const char* const* names, int num) {
+	opcodeNames = names;
+	opcodeIds.resize(num);
+	for (int i = 0; i < num; i++)
+		// Not every decoder instruction has semantics in the SSL file; instantiate() reports those if they are used
+		opcodeIds[i] = RTLDict.lookupOpcodeId(names[i]);
+}
+
+/*==============================================================================
+ * FUNCTION:	   NJMCDecoder::setDestProc
+ * OVERVIEW:	   Set the destination proc of a static call, creating the proc if it doesn't exist yet. The call is
+ *					 recorded in the result, so that the proc can be set again on a clone of the RTL (DecodeCache).
+ *					 When predecoding, the Prog is not changed; the proc is set by FrontEnd::decodeInstruction when the
+ *					 result is used
+ * PARAMETERS:	   call - the call statement
+ *				   dest - the native address called
+ * RETURNS:		   <nothing>
+ *============================================================================*/
+void NJMCDecoder::setDestProc(CallStatement* call, ADDRESS dest) {
+	result.newProcCall = call;
+	result.newProcDest = dest;
+	if (predecoding)
+		return;
+	Proc* destProc = prog->setNewProc(dest);
+	if (destProc == (Proc*)-1) destProc = NULL;		// In case a deleted Proc
+	call->setDestProc(destProc);
+}
+
 /*==============================================================================
  * FUNCTION:	   NJMCDecoder::instantiate
- * OVERVIEW:	   Given an instruction name and a variable list of expressions representing the actual operands of
- *					the instruction, use the RTL template dictionary to return the instantiated RTL representing the
- *					semantics of the instruction.
+ * OVERVIEW:	   Given an opcode id and a vector of expressions representing the actual operands of the instruction,
+ *					use the RTL template dictionary to return the instantiated RTL representing the semantics of the
+ *					instruction.
  * PARAMETERS:	   pc: native PC
- *				   name - instruction name
- *				   ... - Semantic String ptrs representing actual operands
- * RETURNS:		   an instantiated list of Exps
+ *				   opcode - opcode id, as returned by RTLDict.getOpcodeId()
+ *				   name - instruction name (for the disassembly only)
+ *				   actuals - Exp ptrs representing actual operands. Any more than the instruction takes are ignored
+ * RETURNS:		   an instantiated list of Exps, or NULL if the instruction is unknown
  *============================================================================*/
-std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, const char* name, ...) {
-	// Get the signature of the instruction and extract its parts
-	std::pair<std::string,unsigned> sig = RTLDict.getSignature(name);
-	std::string opcode = sig.first;
-	unsigned numOperands = sig.second;
-
-	// Put the operands into a vector
-	std::vector<Exp*> actuals(numOperands);
-	va_list args;
-	va_start(args,name);
-	for (unsigned i = 0; i < numOperands; i++)
-		actuals[i] = va_arg(args,Exp*);
-	va_end(args);
+std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, int opcode, const char* name, std::vector<Exp*>& actuals) {
+	if (opcode < 0) {
+		std::cerr << "ERROR: unknown instruction " << name << " at 0x" << std::hex << pc << std::dec << ", ignoring.\n";
+		return NULL;
+	}
+	TableEntry& entry = RTLDict.getEntry(opcode);
+	unsigned numOperands = entry.params.size();
+	assert(actuals.size() >= numOperands);
+	actuals.resize(numOperands);
 
 	if (DEBUG_DECODER) {
 		// Display a disassembly of this instruction if requested
@@ -94,9 +131,94 @@ std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, const char* name, ..
 		std::cout << std::endl;
 	}
 
-	std::list<Statement*>* instance = RTLDict.instantiateRTL(opcode, pc, actuals);
+	return RTLDict.instantiateRTL(entry, pc, actuals);
+}
+
+/*==============================================================================
+ * FUNCTION:	   NJMCDecoder::instantiate
+ * OVERVIEW:	   Forms of the above taking the decoder's index of the instruction and its operands, as used by the
+ *					generated decoders for the instructions they name
+ * PARAMETERS:	   pc: native PC
+ *				   op - index of the instruction in the names given to resolveOpcodes
+ *				   a1 .. a5 - Exp ptrs representing actual operands
+ * RETURNS:		   an instantiated list of Exps
+ *============================================================================*/
+std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, int op) {
+	std::vector<Exp*> actuals;
+	return instantiate(pc, opcodeIds[op], opcodeNames[op], actuals);
+}
+
+std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, int op, Exp* a1) {
+	std::vector<Exp*> actuals(1, a1);
+	return instantiate(pc, opcodeIds[op], opcodeNames[op], actuals);
+}
+
+std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, int op, Exp* a1, Exp* a2) {
+	std::vector<Exp*> actuals(2);
+	actuals[0] = a1; actuals[1] = a2;
+	return instantiate(pc, opcodeIds[op], opcodeNames[op], actuals);
+}
+
+std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, int op, Exp* a1, Exp* a2, Exp* a3) {
+	std::vector<Exp*> actuals(3);
+	actuals[0] = a1; actuals[1] = a2; actuals[2] = a3;
+	return instantiate(pc, opcodeIds[op], opcodeNames[op], actuals);
+}
+
+std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, int op, Exp* a1, Exp* a2, Exp* a3, Exp* a4) {
+	std::vector<Exp*> actuals(4);
+	actuals[0] = a1; actuals[1] = a2; actuals[2] = a3; actuals[3] = a4;
+	return instantiate(pc, opcodeIds[op], opcodeNames[op], actuals);
+}
+
+std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, int op, Exp* a1, Exp* a2, Exp* a3, Exp* a4, Exp* a5) {
+	std::vector<Exp*> actuals(5);
+	actuals[0] = a1; actuals[1] = a2; actuals[2] = a3; actuals[3] = a4; actuals[4] = a5;
+	return instantiate(pc, opcodeIds[op], opcodeNames[op], actuals);
+}
+
+/*==============================================================================
+ * FUNCTION:	   NJMCDecoder::instantiate
+ * OVERVIEW:	   Forms taking the instruction name and its operands, as used by the generated decoders when the name
+ *					is chosen by the matcher
+ * PARAMETERS:	   pc: native PC
+ *				   name - instruction name; must be a static string
+ *				   a1 .. a5 - Exp ptrs representing actual operands
+ * RETURNS:		   an instantiated list of Exps
+ *============================================================================*/
+std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, const char* name) {
+	std::vector<Exp*> actuals;
+	return instantiate(pc, RTLDict.getOpcodeId(name), name, actuals);
+}
+
+std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, const char* name, Exp* a1) {
+	std::vector<Exp*> actuals(1, a1);
+	return instantiate(pc, RTLDict.getOpcodeId(name), name, actuals);
+}
+
+std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, const char* name, Exp* a1, Exp* a2) {
+	std::vector<Exp*> actuals(2);
+	actuals[0] = a1; actuals[1] = a2;
+	return instantiate(pc, RTLDict.getOpcodeId(name), name, actuals);
+}
+
+std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, const char* name, Exp* a1, Exp* a2, Exp* a3) {
+	std::vector<Exp*> actuals(3);
+	actuals[0] = a1; actuals[1] = a2; actuals[2] = a3;
+	return instantiate(pc, RTLDict.getOpcodeId(name), name, actuals);
+}
+
+std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, const char* name, Exp* a1, Exp* a2, Exp* a3, Exp* a4) {
+	std::vector<Exp*> actuals(4);
+	actuals[0] = a1; actuals[1] = a2; actuals[2] = a3; actuals[3] = a4;
+	return instantiate(pc, RTLDict.getOpcodeId(name), name, actuals);
+}
 
-	return instance;
+std::list<Statement*>* NJMCDecoder::instantiate(ADDRESS pc, const char* name, Exp* a1, Exp* a2, Exp* a3, Exp* a4,
+		Exp* a5) {
+	std::vector<Exp*> actuals(5);
+	actuals[0] = a1; actuals[1] = a2; actuals[2] = a3; actuals[3] = a4; actuals[4] = a5;
+	return instantiate(pc, RTLDict.getOpcodeId(name), name, actuals);
 }
 
 /*==============================================================================
@@ -184,6 +306,9 @@ void DecodeResult::reset()
 	rtl = NULL;
 	reDecode = false;
 	forceOutEdge = 0;	
+	newProcCall = NULL;
+	newProcDest = NO_ADDRESS;
+	reusable = true;
 }
 
 /*==============================================================================
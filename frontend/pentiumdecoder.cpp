@@ -27,6 +27,8 @@
  *				that had 8 bit instead of 32 bit modrm sizes
  * 24 Oct 03 - Mike: Fixed DIS_IDXP1: did not have +32 in macro
  * 02 Sep 05 - Mike: POP.Evod/w take Eaddr now, not Mem
+ * 17 Oct 26 - The BSF/BSR state and the result are members, so that decoders can run on different threads
+ * 17 Oct 26 - An instruction with a relocated operand is not reusable (cached), as addReloc may add a global
 */
 
 #include <assert.h>
@@ -70,11 +72,6 @@
 #define DIS_OFF		(addReloc(new Const(off)))
 
 
-// Function to generate statements for the BSF/BSR series (Bit Scan Forward/
-// Reverse)
-void genBSFR(ADDRESS pc, Exp* reg, Exp* modrm, int init, int size, OPER incdec,
-	int numBytes);
-
 /**********************************
  * PentiumDecoder methods.
  **********************************/   
@@ -102,7 +99,6 @@ void PentiumDecoder::unused(int x)
  *				   proc - the enclosing procedure
  * RETURNS:		   a DecodeResult structure containing all the information gathered during decoding
  *============================================================================*/
-static DecodeResult result;
 DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 {
 	ADDRESS hostPC = pc + delta;
@@ -210,7 +206,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1543 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ORmrb", DIS_EADDR8, DIS_R8);
+                          		stmts = instantiate(pc,	 OP_ORmrb, DIS_EADDR8, DIS_R8);
 
                           
 
@@ -280,7 +276,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1513 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ORmrod", DIS_EADDR32, DIS_REG32);
+                          		stmts = instantiate(pc,	 OP_ORmrod, DIS_EADDR32, DIS_REG32);
 
                           
 
@@ -350,7 +346,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1471 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ORrmb", DIS_R8, DIS_EADDR8);
+                          		stmts = instantiate(pc,	 OP_ORrmb, DIS_R8, DIS_EADDR8);
 
                           
 
@@ -420,7 +416,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1441 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ORrmod", DIS_REG32, DIS_EADDR32);
+                          		stmts = instantiate(pc,	 OP_ORrmod, DIS_REG32, DIS_EADDR32);
 
                           
 
@@ -459,7 +455,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1738 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "ORiAL", DIS_I8);
+                    		stmts = instantiate(pc,	 OP_ORiAL, DIS_I8);
 
                     
 
@@ -478,7 +474,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1690 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "ORiEAX", DIS_I32);
+                    		stmts = instantiate(pc,	 OP_ORiEAX, DIS_I32);
 
                     
 
@@ -494,7 +490,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 817 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "PUSH.CS");
+                  		stmts = instantiate(pc,	 OP_PUSH_CS);
 
                   
 
@@ -518,7 +514,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1098 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "INVD");
+                                		stmts = instantiate(pc,	 OP_INVD);
 
                                 
 
@@ -582,7 +578,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 429 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "SLDT", DIS_EADDR32);
+                                              		stmts = instantiate(pc,	 OP_SLDT, DIS_EADDR32);
 
                                               
 
@@ -633,7 +629,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 405 "frontend/machine/pentium/decoder.m"
                                                     
 
-                                                    		stmts = instantiate(pc,	 "STR", DIS_MEM);
+                                                    		stmts = instantiate(pc,	 OP_STR, DIS_MEM);
 
                                                     
 
@@ -681,7 +677,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 405 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "STR", DIS_MEM);
+                                              		stmts = instantiate(pc,	 OP_STR, DIS_MEM);
 
                                               
 
@@ -766,7 +762,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1040 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "LTR", DIS_EADDR32);
+                                              		stmts = instantiate(pc,	 OP_LTR, DIS_EADDR32);
 
                                               
 
@@ -849,7 +845,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 375 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "VERR", DIS_EADDR32);
+                                              		stmts = instantiate(pc,	 OP_VERR, DIS_EADDR32);
 
                                               
 
@@ -932,7 +928,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 372 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "VERW", DIS_EADDR32);
+                                              		stmts = instantiate(pc,	 OP_VERW, DIS_EADDR32);
 
                                               
 
@@ -978,7 +974,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 366 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "WBINVD");
+                                		stmts = instantiate(pc,	 OP_WBINVD);
 
                                 
 
@@ -1010,7 +1006,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 459 "frontend/machine/pentium/decoder.m"
                                                     
 
-                                                    		stmts = instantiate(pc,	 "SGDT", DIS_MEM);
+                                                    		stmts = instantiate(pc,	 OP_SGDT, DIS_MEM);
 
                                                     
 
@@ -1060,7 +1056,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 459 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "SGDT", DIS_MEM);
+                                              		stmts = instantiate(pc,	 OP_SGDT, DIS_MEM);
 
                                               
 
@@ -1113,7 +1109,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 456 "frontend/machine/pentium/decoder.m"
                                                     
 
-                                                    		stmts = instantiate(pc,	 "SIDT", DIS_MEM);
+                                                    		stmts = instantiate(pc,	 OP_SIDT, DIS_MEM);
 
                                                     
 
@@ -1161,7 +1157,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 456 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "SIDT", DIS_MEM);
+                                              		stmts = instantiate(pc,	 OP_SIDT, DIS_MEM);
 
                                               
 
@@ -1246,7 +1242,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 426 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "SMSW", DIS_EADDR32);
+                                              		stmts = instantiate(pc,	 OP_SMSW, DIS_EADDR32);
 
                                               
 
@@ -1297,7 +1293,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1095 "frontend/machine/pentium/decoder.m"
                                                     
 
-                                                    		stmts = instantiate(pc,	 "INVLPG", DIS_MEM);
+                                                    		stmts = instantiate(pc,	 OP_INVLPG, DIS_MEM);
 
                                                     
 
@@ -1345,7 +1341,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1095 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "INVLPG", DIS_MEM);
+                                              		stmts = instantiate(pc,	 OP_INVLPG, DIS_MEM);
 
                                               
 
@@ -1437,7 +1433,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1082 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "LAR.od", DIS_REG32, DIS_EADDR32);
+                                        		stmts = instantiate(pc,	 OP_LAR_od, DIS_REG32, DIS_EADDR32);
 
                                         
 
@@ -1524,7 +1520,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1046 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "LSLod", DIS_REG32, DIS_EADDR32);
+                                        		stmts = instantiate(pc,	 OP_LSLod, DIS_REG32, DIS_EADDR32);
 
                                         
 
@@ -1567,7 +1563,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1259 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "CLTS");
+                                		stmts = instantiate(pc,	 OP_CLTS);
 
                                 
 
@@ -1596,7 +1592,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 363 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "WRMSR");
+                                		stmts = instantiate(pc,	 OP_WRMSR);
 
                                 
 
@@ -1618,7 +1614,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 596 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "RDMSR");
+                                		stmts = instantiate(pc,	 OP_RDMSR);
 
                                 
 
@@ -3300,7 +3296,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 802 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "PUSH.GS");
+                                		stmts = instantiate(pc,	 OP_PUSH_GS);
 
                                 
 
@@ -3314,7 +3310,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 805 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "PUSH.FS");
+                                		stmts = instantiate(pc,	 OP_PUSH_FS);
 
                                 
 
@@ -3332,7 +3328,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 856 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "POP.GS");
+                                		stmts = instantiate(pc,	 OP_POP_GS);
 
                                 
 
@@ -3346,7 +3342,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 859 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "POP.FS");
+                                		stmts = instantiate(pc,	 OP_POP_FS);
 
                                 
 
@@ -3364,7 +3360,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 475 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "RSM");
+                                		stmts = instantiate(pc,	 OP_RSM);
 
                                 
 
@@ -3378,7 +3374,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1232 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "CPUID");
+                                		stmts = instantiate(pc,	 OP_CPUID);
 
                                 
 
@@ -3440,7 +3436,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1316 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "BTSod", DIS_EADDR32, DIS_REG32);
+                                        		stmts = instantiate(pc,	 OP_BTSod, DIS_EADDR32, DIS_REG32);
 
                                         
 
@@ -3522,7 +3518,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1352 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "BTod", DIS_EADDR32, DIS_REG32);
+                                        		stmts = instantiate(pc,	 OP_BTod, DIS_EADDR32, DIS_REG32);
 
                                         
 
@@ -3628,7 +3624,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 450 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "SHRD.Ibod", DIS_EADDR32, DIS_REG32, DIS_COUNT);
+                                          		stmts = instantiate(pc,	 OP_SHRD_Ibod, DIS_EADDR32, DIS_REG32, DIS_COUNT);
 
                                           
 
@@ -3745,7 +3741,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 444 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "SHLD.Ibod", DIS_EADDR32, DIS_REG32, DIS_COUNT);
+                                          		stmts = instantiate(pc,	 OP_SHLD_Ibod, DIS_EADDR32, DIS_REG32, DIS_COUNT);
 
                                           
 
@@ -3844,7 +3840,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 438 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "SHRD.CLod", DIS_EADDR32, DIS_REG32);
+                                        		stmts = instantiate(pc,	 OP_SHRD_CLod, DIS_EADDR32, DIS_REG32);
 
                                         
 
@@ -3926,7 +3922,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 432 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "SHLD.CLod", DIS_EADDR32, DIS_REG32);
+                                        		stmts = instantiate(pc,	 OP_SHLD_CLod, DIS_EADDR32, DIS_REG32);
 
                                         
 
@@ -4013,7 +4009,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1166 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "IMULrmod", DIS_REG32, DIS_EADDR32);
+                                        		stmts = instantiate(pc,	 OP_IMULrmod, DIS_REG32, DIS_EADDR32);
 
                                         
 
@@ -4134,7 +4130,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1346 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "BTiod", DIS_EADDR32, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_BTiod, DIS_EADDR32, DIS_I8);
 
                                                 
 
@@ -4254,7 +4250,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1310 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "BTSiod", DIS_I8, DIS_EADDR32);
+                                                		stmts = instantiate(pc,	 OP_BTSiod, DIS_I8, DIS_EADDR32);
 
                                                 
 
@@ -4374,7 +4370,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1322 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "BTRiod", DIS_EADDR32, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_BTRiod, DIS_EADDR32, DIS_I8);
 
                                                 
 
@@ -4494,7 +4490,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1334 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "BTCiod", DIS_EADDR32, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_BTCiod, DIS_EADDR32, DIS_I8);
 
                                                 
 
@@ -4599,7 +4595,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1340 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "BTCod", DIS_EADDR32, DIS_REG32);
+                                        		stmts = instantiate(pc,	 OP_BTCod, DIS_EADDR32, DIS_REG32);
 
                                         
 
@@ -4681,7 +4677,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1372 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		//stmts = instantiate(pc,  "BSFod", DIS_REG32, DIS_EADDR32);
+                                        		//stmts = instantiate(pc,  OP_BSFod, DIS_REG32, DIS_EADDR32);
 
                                         		genBSFR(pc, DIS_REG32, DIS_EADDR32, -1, 32, opPlus, nextPC-hostPC);
 
@@ -4767,7 +4763,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1361 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		//stmts = instantiate(pc,  "BSRod", DIS_REG32, DIS_EADDR32);
+                                        		//stmts = instantiate(pc,  OP_BSRod, DIS_REG32, DIS_EADDR32);
 
                                         		// Bit Scan Forward: need helper function
 
@@ -4855,7 +4851,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 949 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "MOVSX.Gv.Ebod", DIS_R32, DIS_EADDR8);
+                                        		stmts = instantiate(pc,	 OP_MOVSX_Gv_Ebod, DIS_R32, DIS_EADDR8);
 
                                         
 
@@ -4937,7 +4933,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 946 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "MOVSX.Gv.Ew", DIS_R32, DIS_EADDR16);
+                                        		stmts = instantiate(pc,	 OP_MOVSX_Gv_Ew, DIS_R32, DIS_EADDR16);
 
                                         
 
@@ -5024,7 +5020,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1244 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "CMPXCHG.Eb.Gb", DIS_EADDR8, DIS_REG8);
+                                        		stmts = instantiate(pc,	 OP_CMPXCHG_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
                                         
 
@@ -5106,7 +5102,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1238 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "CMPXCHG.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+                                        		stmts = instantiate(pc,	 OP_CMPXCHG_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
                                         
 
@@ -5160,7 +5156,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1043 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "LSS", DIS_REG32, DIS_MEM);
+                                              		stmts = instantiate(pc,	 OP_LSS, DIS_REG32, DIS_MEM);
 
                                               
 
@@ -5208,7 +5204,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1043 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "LSS", DIS_REG32, DIS_MEM);
+                                        		stmts = instantiate(pc,	 OP_LSS, DIS_REG32, DIS_MEM);
 
                                         
 
@@ -5290,7 +5286,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1328 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "BTRod", DIS_EADDR32, DIS_REG32);
+                                        		stmts = instantiate(pc,	 OP_BTRod, DIS_EADDR32, DIS_REG32);
 
                                         
 
@@ -5344,7 +5340,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1064 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "LFS", DIS_REG32, DIS_MEM);
+                                              		stmts = instantiate(pc,	 OP_LFS, DIS_REG32, DIS_MEM);
 
                                               
 
@@ -5392,7 +5388,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1064 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "LFS", DIS_REG32, DIS_MEM);
+                                        		stmts = instantiate(pc,	 OP_LFS, DIS_REG32, DIS_MEM);
 
                                         
 
@@ -5446,7 +5442,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1061 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "LGS", DIS_REG32, DIS_MEM);
+                                              		stmts = instantiate(pc,	 OP_LGS, DIS_REG32, DIS_MEM);
 
                                               
 
@@ -5494,7 +5490,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1061 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "LGS", DIS_REG32, DIS_MEM);
+                                        		stmts = instantiate(pc,	 OP_LGS, DIS_REG32, DIS_MEM);
 
                                         
 
@@ -5576,7 +5572,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 940 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "MOVZX.Gv.Ebod", DIS_R32, DIS_EADDR8);
+                                        		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebod, DIS_R32, DIS_EADDR8);
 
                                         
 
@@ -5658,7 +5654,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 937 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "MOVZX.Gv.Ew", DIS_R32, DIS_EADDR16);
+                                        		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ew, DIS_R32, DIS_EADDR16);
 
                                         
 
@@ -5701,7 +5697,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1358 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "BSWAP", DIS_R32);
+                          		stmts = instantiate(pc,	 OP_BSWAP, DIS_R32);
 
                           
 
@@ -5762,7 +5758,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 360 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "XADD.Eb.Gb", DIS_EADDR8, DIS_REG8);
+                                        		stmts = instantiate(pc,	 OP_XADD_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
                                         
 
@@ -5844,7 +5840,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 354 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "XADD.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+                                        		stmts = instantiate(pc,	 OP_XADD_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
                                         
 
@@ -5899,7 +5895,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1235 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "CMPXCHG8B", DIS_MEM);
+                                                		stmts = instantiate(pc,	 OP_CMPXCHG8B, DIS_MEM);
 
                                                 
 
@@ -5944,7 +5940,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1235 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "CMPXCHG8B", DIS_MEM);
+                                          		stmts = instantiate(pc,	 OP_CMPXCHG8B, DIS_MEM);
 
                                           
 
@@ -6032,7 +6028,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1537 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "SBBmrb", DIS_EADDR8, DIS_R8);
+                          		stmts = instantiate(pc,	 OP_SBBmrb, DIS_EADDR8, DIS_R8);
 
                           
 
@@ -6102,7 +6098,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1501 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "SBBmrod", DIS_EADDR32, DIS_REG32);
+                          		stmts = instantiate(pc,	 OP_SBBmrod, DIS_EADDR32, DIS_REG32);
 
                           
 
@@ -6172,7 +6168,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1465 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "SBBrmb", DIS_R8, DIS_EADDR8);
+                          		stmts = instantiate(pc,	 OP_SBBrmb, DIS_R8, DIS_EADDR8);
 
                           
 
@@ -6242,7 +6238,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1429 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "SBBrmod", DIS_REG32, DIS_EADDR32);
+                          		stmts = instantiate(pc,	 OP_SBBrmod, DIS_REG32, DIS_EADDR32);
 
                           
 
@@ -6281,7 +6277,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1732 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "SBBiAL", DIS_I8);
+                    		stmts = instantiate(pc,	 OP_SBBiAL, DIS_I8);
 
                     
 
@@ -6300,7 +6296,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1684 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "SBBiEAX", DIS_I32);
+                    		stmts = instantiate(pc,	 OP_SBBiEAX, DIS_I32);
 
                     
 
@@ -6316,7 +6312,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 811 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "PUSH.DS");
+                  		stmts = instantiate(pc,	 OP_PUSH_DS);
 
                   
 
@@ -6331,7 +6327,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 862 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "POP.DS");
+                  		stmts = instantiate(pc,	 OP_POP_DS);
 
                   
 
@@ -6387,7 +6383,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1531 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "SUBmrb", DIS_EADDR8, DIS_R8);
+                          		stmts = instantiate(pc,	 OP_SUBmrb, DIS_EADDR8, DIS_R8);
 
                           
 
@@ -6457,7 +6453,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1489 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "SUBmrod", DIS_EADDR32, DIS_REG32);
+                          		stmts = instantiate(pc,	 OP_SUBmrod, DIS_EADDR32, DIS_REG32);
 
                           
 
@@ -6527,7 +6523,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1459 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "SUBrmb", DIS_R8, DIS_EADDR8);
+                          		stmts = instantiate(pc,	 OP_SUBrmb, DIS_R8, DIS_EADDR8);
 
                           
 
@@ -6597,7 +6593,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1417 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "SUBrmod", DIS_REG32, DIS_EADDR32);
+                          		stmts = instantiate(pc,	 OP_SUBrmod, DIS_REG32, DIS_EADDR32);
 
                           
 
@@ -6636,7 +6632,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1726 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "SUBiAL", DIS_I8);
+                    		stmts = instantiate(pc,	 OP_SUBiAL, DIS_I8);
 
                     
 
@@ -6655,7 +6651,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1678 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "SUBiEAX", DIS_I32);
+                    		stmts = instantiate(pc,	 OP_SUBiEAX, DIS_I32);
 
                     
 
@@ -6671,7 +6667,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 330 "frontend/machine/pentium/decoder.m"
                   		 // For now, treat seg.cs as a 1 byte NOP
 
-                  		stmts = instantiate(pc,	 "NOP");
+                  		stmts = instantiate(pc,	 OP_NOP);
 
                   
 
@@ -6686,7 +6682,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1220 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "DAS");
+                  		stmts = instantiate(pc,	 OP_DAS);
 
                   
 
@@ -6742,7 +6738,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1525 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "CMPmrb", DIS_EADDR8, DIS_R8);
+                          		stmts = instantiate(pc,	 OP_CMPmrb, DIS_EADDR8, DIS_R8);
 
                           
 
@@ -6812,7 +6808,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1477 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "CMPmrod", DIS_EADDR32, DIS_REG32);
+                          		stmts = instantiate(pc,	 OP_CMPmrod, DIS_EADDR32, DIS_REG32);
 
                           
 
@@ -6882,7 +6878,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1453 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "CMPrmb", DIS_R8, DIS_EADDR8);
+                          		stmts = instantiate(pc,	 OP_CMPrmb, DIS_R8, DIS_EADDR8);
 
                           
 
@@ -6952,7 +6948,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1405 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "CMPrmod", DIS_REG32, DIS_EADDR32);
+                          		stmts = instantiate(pc,	 OP_CMPrmod, DIS_REG32, DIS_EADDR32);
 
                           
 
@@ -6991,7 +6987,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1720 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "CMPiAL", DIS_I8);
+                    		stmts = instantiate(pc,	 OP_CMPiAL, DIS_I8);
 
                     
 
@@ -7010,7 +7006,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1672 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "CMPiEAX", DIS_I32);
+                    		stmts = instantiate(pc,	 OP_CMPiEAX, DIS_I32);
 
                     
 
@@ -7026,7 +7022,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 333 "frontend/machine/pentium/decoder.m"
                   		 // For now, treat seg.ds as a 1 byte NOP
 
-                  		stmts = instantiate(pc,	 "NOP");
+                  		stmts = instantiate(pc,	 OP_NOP);
 
                   
 
@@ -7048,7 +7044,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1205 "frontend/machine/pentium/decoder.m"
               
 
-              		stmts = instantiate(pc,	 "DECod", DIS_R32);
+              		stmts = instantiate(pc,	 OP_DECod, DIS_R32);
 
               
 
@@ -7066,7 +7062,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 871 "frontend/machine/pentium/decoder.m"
               
 
-              		stmts = instantiate(pc,	 "POPod", DIS_R32);
+              		stmts = instantiate(pc,	 OP_POPod, DIS_R32);
 
               
 
@@ -7088,7 +7084,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 820 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "PUSH.Ivod", DIS_I32);
+                    		stmts = instantiate(pc,	 OP_PUSH_Ivod, DIS_I32);
 
                     
 
@@ -7154,7 +7150,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1154 "frontend/machine/pentium/decoder.m"
                             
 
-                            		stmts = instantiate(pc,	 "IMUL.Ivd", DIS_REG32, DIS_EADDR32, DIS_I32);
+                            		stmts = instantiate(pc,	 OP_IMUL_Ivd, DIS_REG32, DIS_EADDR32, DIS_I32);
 
                             
 
@@ -7207,7 +7203,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 826 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "PUSH.Ixob", DIS_I8);
+                    		stmts = instantiate(pc,	 OP_PUSH_Ixob, DIS_I8);
 
                     
 
@@ -7275,7 +7271,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1160 "frontend/machine/pentium/decoder.m"
                             
 
-                            		stmts = instantiate(pc,	 "IMUL.Ibod", DIS_REG32, DIS_EADDR32, DIS_I8);
+                            		stmts = instantiate(pc,	 OP_IMUL_Ibod, DIS_REG32, DIS_EADDR32, DIS_I8);
 
                             
 
@@ -7525,7 +7521,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1037 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "MOVmrb", DIS_EADDR8, DIS_REG8);
+                          		stmts = instantiate(pc,	 OP_MOVmrb, DIS_EADDR8, DIS_REG8);
 
                           
 
@@ -7595,7 +7591,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1031 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "MOVmrod", DIS_EADDR32, DIS_REG32);
+                          		stmts = instantiate(pc,	 OP_MOVmrod, DIS_EADDR32, DIS_REG32);
 
                           
 
@@ -7665,7 +7661,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1028 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "MOVrmb", DIS_REG8, DIS_EADDR8);
+                          		stmts = instantiate(pc,	 OP_MOVrmb, DIS_REG8, DIS_EADDR8);
 
                           
 
@@ -7735,7 +7731,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1022 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "MOVrmod", DIS_REG32, DIS_EADDR32);
+                          		stmts = instantiate(pc,	 OP_MOVrmod, DIS_REG32, DIS_EADDR32);
 
                           
 
@@ -7784,7 +7780,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1073 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "LEA.od", DIS_REG32, DIS_MEM);
+                                		stmts = instantiate(pc,	 OP_LEA_od, DIS_REG32, DIS_MEM);
 
                                 
 
@@ -7826,7 +7822,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1073 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "LEA.od", DIS_REG32, DIS_MEM);
+                          		stmts = instantiate(pc,	 OP_LEA_od, DIS_REG32, DIS_MEM);
 
                           
 
@@ -7896,7 +7892,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 877 "frontend/machine/pentium/decoder.m"
                             
 
-                            		stmts = instantiate(pc,	 "POP.Evod", DIS_EADDR32);
+                            		stmts = instantiate(pc,	 OP_POP_Evod, DIS_EADDR32);
 
                             
 
@@ -7939,7 +7935,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1271 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "CWDE");
+                  		stmts = instantiate(pc,	 OP_CWDE);
 
                   
 
@@ -7954,7 +7950,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1226 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "CDQ");
+                  		stmts = instantiate(pc,	 OP_CDQ);
 
                   
 
@@ -7976,7 +7972,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
                     		unused(seg); unused(off);
 
-                    		stmts = instantiate(pc, "NOP");
+                    		stmts = instantiate(pc, OP_NOP);
 
                     
 
@@ -7992,7 +7988,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 369 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "WAIT");
+                  		stmts = instantiate(pc,	 OP_WAIT);
 
                   
 
@@ -8009,7 +8005,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 472 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "SAHF");
+                  		stmts = instantiate(pc,	 OP_SAHF);
 
                   
 
@@ -8024,7 +8020,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1088 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "LAHF");
+                  		stmts = instantiate(pc,	 OP_LAHF);
 
                   
 
@@ -8050,7 +8046,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 402 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "TEST.AL.Ib", DIS_I8);
+                    		stmts = instantiate(pc,	 OP_TEST_AL_Ib, DIS_I8);
 
                     
 
@@ -8069,7 +8065,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 396 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "TEST.eAX.Ivod", DIS_I32);
+                    		stmts = instantiate(pc,	 OP_TEST_eAX_Ivod, DIS_I32);
 
                     
 
@@ -8085,7 +8081,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 414 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "STOSB");
+                  		stmts = instantiate(pc,	 OP_STOSB);
 
                   
 
@@ -8100,7 +8096,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 408 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "STOSvod");
+                  		stmts = instantiate(pc,	 OP_STOSvod);
 
                   
 
@@ -8115,7 +8111,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1750 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "LODSB");
+                  		stmts = instantiate(pc,	 OP_LODSB);
 
                   
 
@@ -8132,7 +8128,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1744 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "LODSvod");
+                  		stmts = instantiate(pc,	 OP_LODSvod);
 
                   
 
@@ -8147,7 +8143,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 469 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "SCASB");
+                  		stmts = instantiate(pc,	 OP_SCASB);
 
                   
 
@@ -8162,7 +8158,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 463 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "SCASvod");
+                  		stmts = instantiate(pc,	 OP_SCASvod);
 
                   
 
@@ -8184,7 +8180,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 989 "frontend/machine/pentium/decoder.m"
               
 
-              		stmts = instantiate(pc,	 "MOVid", DIS_R32, DIS_I32);
+              		stmts = instantiate(pc,	 OP_MOVid, DIS_R32, DIS_I32);
 
               
 
@@ -8209,7 +8205,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1193 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "ENTER", DIS_I16, DIS_I8);
+                    		stmts = instantiate(pc,	 OP_ENTER, DIS_I16, DIS_I8);
 
                     
 
@@ -8225,7 +8221,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1070 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "LEAVE");
+                  		stmts = instantiate(pc,	 OP_LEAVE);
 
                   
 
@@ -8243,7 +8239,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 478 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "RET.far.Iw", DIS_I16);
+                    		stmts = instantiate(pc,	 OP_RET_far_Iw, DIS_I16);
 
                     		ReturnStatement *ret = new ReturnStatement;
 
@@ -8265,7 +8261,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 490 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "RET.far");
+                  		stmts = instantiate(pc,	 OP_RET_far);
 
                   		result.rtl = new RTL(pc, stmts);
 
@@ -8290,7 +8286,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1104 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "INT.Ib", DIS_I8);
+                    		stmts = instantiate(pc,	 OP_INT_Ib, DIS_I8);
 
                     
 
@@ -8300,25 +8296,25 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
                     //	  | INT3() =>
 
-                    //		  stmts = instantiate(pc,  "INT3");
+                    //		  stmts = instantiate(pc,  OP_INT3);
 
                     
 
                     //	  | INSvod() =>
 
-                    //		  stmts = instantiate(pc,  "INSvod");
+                    //		  stmts = instantiate(pc,  OP_INSvod);
 
                     
 
                     //	  | INSvow() =>
 
-                    //		  stmts = instantiate(pc,  "INSvow");
+                    //		  stmts = instantiate(pc,  OP_INSvow);
 
                     
 
                     //	  | INSB() =>
 
-                    //		  stmts = instantiate(pc,  "INSB");
+                    //		  stmts = instantiate(pc,  OP_INSB);
 
                     
 
@@ -8334,7 +8330,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1101 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "INTO");
+                  		stmts = instantiate(pc,	 OP_INTO);
 
                   
 
@@ -8349,7 +8345,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1092 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "IRET");
+                  		stmts = instantiate(pc,	 OP_IRET);
 
                   
 
@@ -8384,7 +8380,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1760 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FADD.R32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FADD_R32, DIS_MEM32);
 
                                       
 
@@ -8425,7 +8421,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1760 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FADD.R32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FADD_R32, DIS_MEM32);
 
                                 
 
@@ -8458,7 +8454,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1766 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FADD.St.STi", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FADD_St_STi, DIS_IDX);
 
                                 
 
@@ -8487,7 +8483,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1954 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FMUL.R32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FMUL_R32, DIS_MEM32);
 
                                       
 
@@ -8528,7 +8524,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1954 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FMUL.R32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FMUL_R32, DIS_MEM32);
 
                                 
 
@@ -8561,7 +8557,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1960 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FMUL.ST.STi", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FMUL_ST_STi, DIS_IDX);
 
                                 
 
@@ -8590,7 +8586,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1793 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FCOM.R32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FCOM_R32, DIS_MEM32);
 
                                       
 
@@ -8631,7 +8627,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1793 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FCOM.R32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FCOM_R32, DIS_MEM32);
 
                                 
 
@@ -8664,7 +8660,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1811 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FCOM.ST.STi", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FCOM_ST_STi, DIS_IDX);
 
                                 
 
@@ -8693,7 +8689,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1805 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FCOMP.R32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FCOMP_R32, DIS_MEM32);
 
                                       
 
@@ -8734,7 +8730,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1805 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FCOMP.R32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FCOMP_R32, DIS_MEM32);
 
                                 
 
@@ -8767,7 +8763,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1814 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FCOMP.ST.STi", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FCOMP_ST_STi, DIS_IDX);
 
                                 
 
@@ -8796,7 +8792,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2044 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FSUB.R32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FSUB_R32, DIS_MEM32);
 
                                       
 
@@ -8837,7 +8833,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2044 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSUB.R32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FSUB_R32, DIS_MEM32);
 
                                 
 
@@ -8870,7 +8866,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2050 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSUB.ST.STi", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FSUB_ST_STi, DIS_IDX);
 
                                 
 
@@ -8899,7 +8895,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2065 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FSUBR.R32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FSUBR_R32, DIS_MEM32);
 
                                       
 
@@ -8940,7 +8936,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2065 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSUBR.R32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FSUBR_R32, DIS_MEM32);
 
                                 
 
@@ -8973,7 +8969,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2071 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSUBR.ST.STi", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FSUBR_ST_STi, DIS_IDX);
 
                                 
 
@@ -9002,7 +8998,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1838 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FDIV.R32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FDIV_R32, DIS_MEM32);
 
                                       
 
@@ -9043,7 +9039,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1838 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FDIV.R32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FDIV_R32, DIS_MEM32);
 
                                 
 
@@ -9076,7 +9072,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1844 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FDIV.ST.STi", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FDIV_ST_STi, DIS_IDX);
 
                                 
 
@@ -9105,7 +9101,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1859 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FDIVR.R32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FDIVR_R32, DIS_MEM32);
 
                                       
 
@@ -9146,7 +9142,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1859 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FDIVR.R32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FDIVR_R32, DIS_MEM32);
 
                                 
 
@@ -9179,7 +9175,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1865 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FDIVR.ST.STi", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FDIVR_ST_STi, DIS_IDX);
 
                                 
 
@@ -9216,7 +9212,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1910 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FLD.lsR32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FLD_lsR32, DIS_MEM32);
 
                                       
 
@@ -9257,7 +9253,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1910 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FLD.lsR32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FLD_lsR32, DIS_MEM32);
 
                                 
 
@@ -9290,7 +9286,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1924 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FLD.STi", DIS_IDXP1);
+                                		stmts = instantiate(pc,	 OP_FLD_STi, DIS_IDXP1);
 
                                 
 
@@ -9311,7 +9307,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2107 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "FXCH", DIS_IDX);
+                          		stmts = instantiate(pc,	 OP_FXCH, DIS_IDX);
 
                           
 
@@ -9339,7 +9335,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2011 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FST.lsR32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FST_lsR32, DIS_MEM32);
 
                                       
 
@@ -9380,7 +9376,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2011 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FST.lsR32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FST_lsR32, DIS_MEM32);
 
                                 
 
@@ -9411,7 +9407,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1975 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FNOP");
+                                		stmts = instantiate(pc,	 OP_FNOP);
 
                                 
 
@@ -9442,7 +9438,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2017 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FSTP.lsR32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FSTP_lsR32, DIS_MEM32);
 
                                       
 
@@ -9483,7 +9479,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2017 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSTP.lsR32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FSTP_lsR32, DIS_MEM32);
 
                                 
 
@@ -9527,7 +9523,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1951 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FLDENV", DIS_MEM);
+                                      		stmts = instantiate(pc,	 OP_FLDENV, DIS_MEM);
 
                                       
 
@@ -9568,7 +9564,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1951 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FLDENV", DIS_MEM);
+                                		stmts = instantiate(pc,	 OP_FLDENV, DIS_MEM);
 
                                 
 
@@ -9601,7 +9597,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1787 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FCHS");
+                                    		stmts = instantiate(pc,	 OP_FCHS);
 
                                     
 
@@ -9616,7 +9612,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1757 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FABS");
+                                    		stmts = instantiate(pc,	 OP_FABS);
 
                                     
 
@@ -9633,7 +9629,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2086 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FTST");
+                                    		stmts = instantiate(pc,	 OP_FTST);
 
                                     
 
@@ -9648,7 +9644,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2104 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FXAM");
+                                    		stmts = instantiate(pc,	 OP_FXAM);
 
                                     
 
@@ -9679,7 +9675,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1948 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FLDCW", DIS_MEM16);
+                                      		stmts = instantiate(pc,	 OP_FLDCW, DIS_MEM16);
 
                                       
 
@@ -9720,7 +9716,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1948 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FLDCW", DIS_MEM16);
+                                		stmts = instantiate(pc,	 OP_FLDCW, DIS_MEM16);
 
                                 
 
@@ -9753,7 +9749,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1927 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FLD1");
+                                    		stmts = instantiate(pc,	 OP_FLD1);
 
                                     
 
@@ -9768,7 +9764,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1930 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FLDL2T");
+                                    		stmts = instantiate(pc,	 OP_FLDL2T);
 
                                     
 
@@ -9783,7 +9779,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1933 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FLDL2E");
+                                    		stmts = instantiate(pc,	 OP_FLDL2E);
 
                                     
 
@@ -9798,7 +9794,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1936 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FLDPI");
+                                    		stmts = instantiate(pc,	 OP_FLDPI);
 
                                     
 
@@ -9813,7 +9809,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1939 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FLDLG2");
+                                    		stmts = instantiate(pc,	 OP_FLDLG2);
 
                                     
 
@@ -9828,7 +9824,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1942 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FLDLN2");
+                                    		stmts = instantiate(pc,	 OP_FLDLN2);
 
                                     
 
@@ -9843,7 +9839,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1945 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FLDZ");
+                                    		stmts = instantiate(pc,	 OP_FLDZ);
 
                                     
 
@@ -9875,7 +9871,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2035 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FSTENV", DIS_MEM);
+                                      		stmts = instantiate(pc,	 OP_FSTENV, DIS_MEM);
 
                                       
 
@@ -9916,7 +9912,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2035 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSTENV", DIS_MEM);
+                                		stmts = instantiate(pc,	 OP_FSTENV, DIS_MEM);
 
                                 
 
@@ -9949,7 +9945,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1754 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "F2XM1");
+                                    		stmts = instantiate(pc,	 OP_F2XM1);
 
                                     
 
@@ -9964,7 +9960,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2113 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FYL2X");
+                                    		stmts = instantiate(pc,	 OP_FYL2X);
 
                                     
 
@@ -9979,7 +9975,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1987 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FPTAN");
+                                    		stmts = instantiate(pc,	 OP_FPTAN);
 
                                     
 
@@ -9994,7 +9990,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1978 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FPATAN");
+                                    		stmts = instantiate(pc,	 OP_FPATAN);
 
                                     
 
@@ -10009,7 +10005,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2110 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FXTRACT");
+                                    		stmts = instantiate(pc,	 OP_FXTRACT);
 
                                     
 
@@ -10024,7 +10020,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1984 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FPREM1");
+                                    		stmts = instantiate(pc,	 OP_FPREM1);
 
                                     
 
@@ -10039,7 +10035,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1835 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FDECSTP");
+                                    		stmts = instantiate(pc,	 OP_FDECSTP);
 
                                     
 
@@ -10072,7 +10068,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2032 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FSTCW", DIS_MEM16);
+                                      		stmts = instantiate(pc,	 OP_FSTCW, DIS_MEM16);
 
                                       
 
@@ -10113,7 +10109,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2032 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSTCW", DIS_MEM16);
+                                		stmts = instantiate(pc,	 OP_FSTCW, DIS_MEM16);
 
                                 
 
@@ -10146,7 +10142,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1981 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FPREM");
+                                    		stmts = instantiate(pc,	 OP_FPREM);
 
                                     
 
@@ -10161,7 +10157,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2116 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FYL2XP1");
+                                    		stmts = instantiate(pc,	 OP_FYL2XP1);
 
                                     
 
@@ -10176,7 +10172,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2008 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FSQRT");
+                                    		stmts = instantiate(pc,	 OP_FSQRT);
 
                                     
 
@@ -10191,7 +10187,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2005 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FSINCOS");
+                                    		stmts = instantiate(pc,	 OP_FSINCOS);
 
                                     
 
@@ -10206,7 +10202,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1990 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FRNDINT");
+                                    		stmts = instantiate(pc,	 OP_FRNDINT);
 
                                     
 
@@ -10221,7 +10217,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1999 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FSCALE");
+                                    		stmts = instantiate(pc,	 OP_FSCALE);
 
                                     
 
@@ -10236,7 +10232,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2002 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FSIN");
+                                    		stmts = instantiate(pc,	 OP_FSIN);
 
                                     
 
@@ -10251,7 +10247,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1832 "frontend/machine/pentium/decoder.m"
                                     
 
-                                    		stmts = instantiate(pc,	 "FCOS");
+                                    		stmts = instantiate(pc,	 OP_FCOS);
 
                                     
 
@@ -10290,7 +10286,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1775 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FIADD.I32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FIADD_I32, DIS_MEM32);
 
                                       
 
@@ -10331,7 +10327,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1775 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FIADD.I32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FIADD_I32, DIS_MEM32);
 
                                 
 
@@ -10376,7 +10372,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1969 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FIMUL.I32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FIMUL_I32, DIS_MEM32);
 
                                       
 
@@ -10417,7 +10413,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1969 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FIMUL.I32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FIMUL_I32, DIS_MEM32);
 
                                 
 
@@ -10462,7 +10458,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1799 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FICOM.I32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FICOM_I32, DIS_MEM32);
 
                                       
 
@@ -10503,7 +10499,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1799 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FICOM.I32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FICOM_I32, DIS_MEM32);
 
                                 
 
@@ -10548,7 +10544,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1817 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FICOMP.I32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FICOMP_I32, DIS_MEM32);
 
                                       
 
@@ -10589,7 +10585,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1817 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FICOMP.I32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FICOMP_I32, DIS_MEM32);
 
                                 
 
@@ -10634,7 +10630,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2056 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FISUB.I32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FISUB_I32, DIS_MEM32);
 
                                       
 
@@ -10675,7 +10671,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2056 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FISUB.I32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FISUB_I32, DIS_MEM32);
 
                                 
 
@@ -10720,7 +10716,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2077 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FISUBR.I32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FISUBR_I32, DIS_MEM32);
 
                                       
 
@@ -10761,7 +10757,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2077 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FISUBR.I32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FISUBR_I32, DIS_MEM32);
 
                                 
 
@@ -10792,7 +10788,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2095 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FUCOMPP");
+                                		stmts = instantiate(pc,	 OP_FUCOMPP);
 
                                 
 
@@ -10823,7 +10819,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1853 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FIDIV.I32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FIDIV_I32, DIS_MEM32);
 
                                       
 
@@ -10864,7 +10860,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1853 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FIDIV.I32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FIDIV_I32, DIS_MEM32);
 
                                 
 
@@ -10909,7 +10905,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1871 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FIDIVR.I32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FIDIVR_I32, DIS_MEM32);
 
                                       
 
@@ -10950,7 +10946,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1871 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FIDIVR.I32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FIDIVR_I32, DIS_MEM32);
 
                                 
 
@@ -11003,7 +10999,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1886 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FILD.lsI32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FILD_lsI32, DIS_MEM32);
 
                                       
 
@@ -11044,7 +11040,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1886 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FILD.lsI32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FILD_lsI32, DIS_MEM32);
 
                                 
 
@@ -11091,7 +11087,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1898 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FIST.lsI32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FIST_lsI32, DIS_MEM32);
 
                                       
 
@@ -11132,7 +11128,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1898 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FIST.lsI32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FIST_lsI32, DIS_MEM32);
 
                                 
 
@@ -11177,7 +11173,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1904 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FISTP.lsI32", DIS_MEM32);
+                                      		stmts = instantiate(pc,	 OP_FISTP_lsI32, DIS_MEM32);
 
                                       
 
@@ -11218,7 +11214,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1904 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FISTP.lsI32", DIS_MEM32);
+                                		stmts = instantiate(pc,	 OP_FISTP_lsI32, DIS_MEM32);
 
                                 
 
@@ -11260,7 +11256,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1790 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FNCLEX");
+                                		stmts = instantiate(pc,	 OP_FNCLEX);
 
                                 
 
@@ -11280,7 +11276,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1892 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FINIT");
+                                		stmts = instantiate(pc,	 OP_FINIT);
 
                                 
 
@@ -11311,7 +11307,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1916 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FLD80", DIS_MEM80);
+                                      		stmts = instantiate(pc,	 OP_FLD80, DIS_MEM80);
 
                                       
 
@@ -11362,7 +11358,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1916 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FLD80", DIS_MEM80);
+                                		stmts = instantiate(pc,	 OP_FLD80, DIS_MEM80);
 
                                 
 
@@ -11461,7 +11457,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2023 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FSTP80", DIS_MEM80);
+                                      		stmts = instantiate(pc,	 OP_FSTP80, DIS_MEM80);
 
                                       
 
@@ -11502,7 +11498,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2023 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSTP80", DIS_MEM80);
+                                		stmts = instantiate(pc,	 OP_FSTP80, DIS_MEM80);
 
                                 
 
@@ -11555,7 +11551,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1763 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FADD.R64", DIS_MEM64);
+                                      		stmts = instantiate(pc,	 OP_FADD_R64, DIS_MEM64);
 
                                       
 
@@ -11596,7 +11592,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1763 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FADD.R64", DIS_MEM64);
+                                		stmts = instantiate(pc,	 OP_FADD_R64, DIS_MEM64);
 
                                 
 
@@ -11629,7 +11625,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1769 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FADD.STi.ST", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FADD_STi_ST, DIS_IDX);
 
                                 
 
@@ -11658,7 +11654,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1957 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FMUL.R64", DIS_MEM64);
+                                      		stmts = instantiate(pc,	 OP_FMUL_R64, DIS_MEM64);
 
                                       
 
@@ -11699,7 +11695,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1957 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FMUL.R64", DIS_MEM64);
+                                		stmts = instantiate(pc,	 OP_FMUL_R64, DIS_MEM64);
 
                                 
 
@@ -11732,7 +11728,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1963 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FMUL.STi.ST", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FMUL_STi_ST, DIS_IDX);
 
                                 
 
@@ -11761,7 +11757,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1796 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FCOM.R64", DIS_MEM64);
+                                      		stmts = instantiate(pc,	 OP_FCOM_R64, DIS_MEM64);
 
                                       
 
@@ -11802,7 +11798,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1796 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FCOM.R64", DIS_MEM64);
+                                		stmts = instantiate(pc,	 OP_FCOM_R64, DIS_MEM64);
 
                                 
 
@@ -11847,7 +11843,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1808 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FCOMP.R64", DIS_MEM64);
+                                      		stmts = instantiate(pc,	 OP_FCOMP_R64, DIS_MEM64);
 
                                       
 
@@ -11888,7 +11884,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1808 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FCOMP.R64", DIS_MEM64);
+                                		stmts = instantiate(pc,	 OP_FCOMP_R64, DIS_MEM64);
 
                                 
 
@@ -11933,7 +11929,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2047 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FSUB.R64", DIS_MEM64);
+                                      		stmts = instantiate(pc,	 OP_FSUB_R64, DIS_MEM64);
 
                                       
 
@@ -11974,7 +11970,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2047 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSUB.R64", DIS_MEM64);
+                                		stmts = instantiate(pc,	 OP_FSUB_R64, DIS_MEM64);
 
                                 
 
@@ -12007,7 +12003,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2074 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSUBR.STi.ST", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FSUBR_STi_ST, DIS_IDX);
 
                                 
 
@@ -12036,7 +12032,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2068 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FSUBR.R64", DIS_MEM64);
+                                      		stmts = instantiate(pc,	 OP_FSUBR_R64, DIS_MEM64);
 
                                       
 
@@ -12077,7 +12073,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2068 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSUBR.R64", DIS_MEM64);
+                                		stmts = instantiate(pc,	 OP_FSUBR_R64, DIS_MEM64);
 
                                 
 
@@ -12110,7 +12106,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2053 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSUB.STi.ST", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FSUB_STi_ST, DIS_IDX);
 
                                 
 
@@ -12139,7 +12135,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1841 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FDIV.R64", DIS_MEM64);
+                                      		stmts = instantiate(pc,	 OP_FDIV_R64, DIS_MEM64);
 
                                       
 
@@ -12180,7 +12176,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1841 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FDIV.R64", DIS_MEM64);
+                                		stmts = instantiate(pc,	 OP_FDIV_R64, DIS_MEM64);
 
                                 
 
@@ -12213,7 +12209,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1868 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FDIVR.STi.ST", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FDIVR_STi_ST, DIS_IDX);
 
                                 
 
@@ -12242,7 +12238,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1862 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FDIVR.R64", DIS_MEM64);
+                                      		stmts = instantiate(pc,	 OP_FDIVR_R64, DIS_MEM64);
 
                                       
 
@@ -12283,7 +12279,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1862 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FDIVR.R64", DIS_MEM64);
+                                		stmts = instantiate(pc,	 OP_FDIVR_R64, DIS_MEM64);
 
                                 
 
@@ -12316,7 +12312,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1847 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FDIV.STi.ST", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FDIV_STi_ST, DIS_IDX);
 
                                 
 
@@ -12353,7 +12349,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1913 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FLD.lsR64", DIS_MEM64);
+                                      		stmts = instantiate(pc,	 OP_FLD_lsR64, DIS_MEM64);
 
                                       
 
@@ -12394,7 +12390,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1913 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FLD.lsR64", DIS_MEM64);
+                                		stmts = instantiate(pc,	 OP_FLD_lsR64, DIS_MEM64);
 
                                 
 
@@ -12427,7 +12423,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1880 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FFREE", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FFREE, DIS_IDX);
 
                                 
 
@@ -12458,7 +12454,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2014 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FST.lsR64", DIS_MEM64);
+                                      		stmts = instantiate(pc,	 OP_FST_lsR64, DIS_MEM64);
 
                                       
 
@@ -12499,7 +12495,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2014 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FST.lsR64", DIS_MEM64);
+                                		stmts = instantiate(pc,	 OP_FST_lsR64, DIS_MEM64);
 
                                 
 
@@ -12532,7 +12528,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2026 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FST.st.STi", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FST_st_STi, DIS_IDX);
 
                                 
 
@@ -12561,7 +12557,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2020 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FSTP.lsR64", DIS_MEM64);
+                                      		stmts = instantiate(pc,	 OP_FSTP_lsR64, DIS_MEM64);
 
                                       
 
@@ -12602,7 +12598,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2020 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSTP.lsR64", DIS_MEM64);
+                                		stmts = instantiate(pc,	 OP_FSTP_lsR64, DIS_MEM64);
 
                                 
 
@@ -12635,7 +12631,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2029 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSTP.st.STi", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FSTP_st_STi, DIS_IDX);
 
                                 
 
@@ -12663,7 +12659,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1993 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FRSTOR", DIS_MEM);
+                                      		stmts = instantiate(pc,	 OP_FRSTOR, DIS_MEM);
 
                                       
 
@@ -12704,7 +12700,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1993 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FRSTOR", DIS_MEM);
+                                		stmts = instantiate(pc,	 OP_FRSTOR, DIS_MEM);
 
                                 
 
@@ -12737,7 +12733,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2089 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FUCOM", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FUCOM, DIS_IDX);
 
                                 
 
@@ -12758,7 +12754,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2092 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "FUCOMP", DIS_IDX);
+                          		stmts = instantiate(pc,	 OP_FUCOMP, DIS_IDX);
 
                           
 
@@ -12785,7 +12781,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1996 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FNSAVE", DIS_MEM);
+                                      		stmts = instantiate(pc,	 OP_FNSAVE, DIS_MEM);
 
                                       
 
@@ -12826,7 +12822,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1996 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FNSAVE", DIS_MEM);
+                                		stmts = instantiate(pc,	 OP_FNSAVE, DIS_MEM);
 
                                 
 
@@ -12871,7 +12867,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2038 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FSTSW", DIS_MEM16);
+                                      		stmts = instantiate(pc,	 OP_FSTSW, DIS_MEM16);
 
                                       
 
@@ -12912,7 +12908,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2038 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSTSW", DIS_MEM16);
+                                		stmts = instantiate(pc,	 OP_FSTSW, DIS_MEM16);
 
                                 
 
@@ -12965,7 +12961,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1778 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FIADD.I16", DIS_MEM16);
+                                      		stmts = instantiate(pc,	 OP_FIADD_I16, DIS_MEM16);
 
                                       
 
@@ -13006,7 +13002,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1778 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FIADD.I16", DIS_MEM16);
+                                		stmts = instantiate(pc,	 OP_FIADD_I16, DIS_MEM16);
 
                                 
 
@@ -13039,7 +13035,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1772 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FADDP.STi.ST", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FADDP_STi_ST, DIS_IDX);
 
                                 
 
@@ -13068,7 +13064,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1972 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FIMUL.I16", DIS_MEM16);
+                                      		stmts = instantiate(pc,	 OP_FIMUL_I16, DIS_MEM16);
 
                                       
 
@@ -13109,7 +13105,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1972 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FIMUL.I16", DIS_MEM16);
+                                		stmts = instantiate(pc,	 OP_FIMUL_I16, DIS_MEM16);
 
                                 
 
@@ -13142,7 +13138,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1966 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FMULP.STi.ST", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FMULP_STi_ST, DIS_IDX);
 
                                 
 
@@ -13171,7 +13167,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1802 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FICOM.I16", DIS_MEM16);
+                                      		stmts = instantiate(pc,	 OP_FICOM_I16, DIS_MEM16);
 
                                       
 
@@ -13212,7 +13208,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1802 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FICOM.I16", DIS_MEM16);
+                                		stmts = instantiate(pc,	 OP_FICOM_I16, DIS_MEM16);
 
                                 
 
@@ -13257,7 +13253,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1820 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FICOMP.I16", DIS_MEM16);
+                                      		stmts = instantiate(pc,	 OP_FICOMP_I16, DIS_MEM16);
 
                                       
 
@@ -13298,7 +13294,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1820 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FICOMP.I16", DIS_MEM16);
+                                		stmts = instantiate(pc,	 OP_FICOMP_I16, DIS_MEM16);
 
                                 
 
@@ -13329,7 +13325,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1823 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FCOMPP");
+                                		stmts = instantiate(pc,	 OP_FCOMPP);
 
                                 
 
@@ -13360,7 +13356,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2059 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FISUB.I16", DIS_MEM16);
+                                      		stmts = instantiate(pc,	 OP_FISUB_I16, DIS_MEM16);
 
                                       
 
@@ -13401,7 +13397,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2059 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FISUB.I16", DIS_MEM16);
+                                		stmts = instantiate(pc,	 OP_FISUB_I16, DIS_MEM16);
 
                                 
 
@@ -13434,7 +13430,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2083 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSUBRP.STi.ST", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FSUBRP_STi_ST, DIS_IDX);
 
                                 
 
@@ -13463,7 +13459,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2080 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FISUBR.I16", DIS_MEM16);
+                                      		stmts = instantiate(pc,	 OP_FISUBR_I16, DIS_MEM16);
 
                                       
 
@@ -13504,7 +13500,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2080 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FISUBR.I16", DIS_MEM16);
+                                		stmts = instantiate(pc,	 OP_FISUBR_I16, DIS_MEM16);
 
                                 
 
@@ -13537,7 +13533,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2062 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSUBP.STi.ST", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FSUBP_STi_ST, DIS_IDX);
 
                                 
 
@@ -13566,7 +13562,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1856 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FIDIV.I16", DIS_MEM16);
+                                      		stmts = instantiate(pc,	 OP_FIDIV_I16, DIS_MEM16);
 
                                       
 
@@ -13607,7 +13603,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1856 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FIDIV.I16", DIS_MEM16);
+                                		stmts = instantiate(pc,	 OP_FIDIV_I16, DIS_MEM16);
 
                                 
 
@@ -13640,7 +13636,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1877 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FDIVRP.STi.ST", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FDIVRP_STi_ST, DIS_IDX);
 
                                 
 
@@ -13669,7 +13665,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1874 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FIDIVR.I16", DIS_MEM16);
+                                      		stmts = instantiate(pc,	 OP_FIDIVR_I16, DIS_MEM16);
 
                                       
 
@@ -13710,7 +13706,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1874 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FIDIVR.I16", DIS_MEM16);
+                                		stmts = instantiate(pc,	 OP_FIDIVR_I16, DIS_MEM16);
 
                                 
 
@@ -13743,7 +13739,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1850 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FDIVP.STi.ST", DIS_IDX);
+                                		stmts = instantiate(pc,	 OP_FDIVP_STi_ST, DIS_IDX);
 
                                 
 
@@ -13780,7 +13776,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1883 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FILD.lsI16", DIS_MEM16);
+                                      		stmts = instantiate(pc,	 OP_FILD_lsI16, DIS_MEM16);
 
                                       
 
@@ -13821,7 +13817,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1883 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FILD.lsI16", DIS_MEM16);
+                                		stmts = instantiate(pc,	 OP_FILD_lsI16, DIS_MEM16);
 
                                 
 
@@ -13868,7 +13864,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1895 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FIST.lsI16", DIS_MEM16);
+                                      		stmts = instantiate(pc,	 OP_FIST_lsI16, DIS_MEM16);
 
                                       
 
@@ -13909,7 +13905,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1895 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FIST.lsI16", DIS_MEM16);
+                                		stmts = instantiate(pc,	 OP_FIST_lsI16, DIS_MEM16);
 
                                 
 
@@ -13954,7 +13950,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1901 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FISTP.lsI16", DIS_MEM16);
+                                      		stmts = instantiate(pc,	 OP_FISTP_lsI16, DIS_MEM16);
 
                                       
 
@@ -13995,7 +13991,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1901 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FISTP.lsI16", DIS_MEM16);
+                                		stmts = instantiate(pc,	 OP_FISTP_lsI16, DIS_MEM16);
 
                                 
 
@@ -14040,7 +14036,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1781 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FBLD", DIS_MEM80);
+                                      		stmts = instantiate(pc,	 OP_FBLD, DIS_MEM80);
 
                                       
 
@@ -14081,7 +14077,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1781 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FBLD", DIS_MEM80);
+                                		stmts = instantiate(pc,	 OP_FBLD, DIS_MEM80);
 
                                 
 
@@ -14112,7 +14108,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2041 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FSTSW.AX");
+                                		stmts = instantiate(pc,	 OP_FSTSW_AX);
 
                                 
 
@@ -14143,7 +14139,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1889 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FILD.lsI64", DIS_MEM64);
+                                      		stmts = instantiate(pc,	 OP_FILD_lsI64, DIS_MEM64);
 
                                       
 
@@ -14184,7 +14180,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1889 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FILD.lsI64", DIS_MEM64);
+                                		stmts = instantiate(pc,	 OP_FILD_lsI64, DIS_MEM64);
 
                                 
 
@@ -14248,7 +14244,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1784 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FBSTP", DIS_MEM80);
+                                      		stmts = instantiate(pc,	 OP_FBSTP, DIS_MEM80);
 
                                       
 
@@ -14289,7 +14285,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1784 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FBSTP", DIS_MEM80);
+                                		stmts = instantiate(pc,	 OP_FBSTP, DIS_MEM80);
 
                                 
 
@@ -14353,7 +14349,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1907 "frontend/machine/pentium/decoder.m"
                                       
 
-                                      		stmts = instantiate(pc,	 "FISTP64", DIS_MEM64);
+                                      		stmts = instantiate(pc,	 OP_FISTP64, DIS_MEM64);
 
                                       
 
@@ -14394,7 +14390,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1907 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "FISTP64", DIS_MEM64);
+                                		stmts = instantiate(pc,	 OP_FISTP64, DIS_MEM64);
 
                                 
 
@@ -14443,7 +14439,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1283 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "CALL.Jvod", dis_Num(relocd));
+                    		stmts = instantiate(pc,	 OP_CALL_Jvod, dis_Num(relocd));
 
                     		// Fix the last assignment, which is now %pc := %pc + (K + hostPC)
 
@@ -14483,11 +14479,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
                     			stmts->push_back(call);
 
-                    			Proc* destProc = prog->setNewProc(nativeDest);
-
-                    			if (destProc == (Proc*)-1) destProc = NULL;		// In case a deleted Proc
-
-                    			call->setDestProc(destProc);
+                    			setDestProc(call, nativeDest);
 
                     		}
 
@@ -14570,7 +14562,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1268 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "CLC");
+                  		stmts = instantiate(pc,	 OP_CLC);
 
                   
 
@@ -14585,7 +14577,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 423 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "STC");
+                  		stmts = instantiate(pc,	 OP_STC);
 
                   
 
@@ -14600,7 +14592,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1262 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "CLI");
+                  		stmts = instantiate(pc,	 OP_CLI);
 
                   
 
@@ -14615,7 +14607,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 417 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "STI");
+                  		stmts = instantiate(pc,	 OP_STI);
 
                   
 
@@ -14630,7 +14622,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1265 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "CLD");
+                  		stmts = instantiate(pc,	 OP_CLD);
 
                   
 
@@ -14645,7 +14637,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 420 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "STD");
+                  		stmts = instantiate(pc,	 OP_STD);
 
                   
 
@@ -14698,43 +14690,43 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1133 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "INC.Eb", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_INC_Eb, DIS_EADDR8);
 
                                 
 
                                 //	  | IN.eAX.DXod() =>
 
-                                //		  stmts = instantiate(pc,  "IN.eAX.DXod");
+                                //		  stmts = instantiate(pc,  OP_IN_eAX_DXod);
 
                                 
 
                                 //	  | IN.eAX.DXow() =>
 
-                                //		  stmts = instantiate(pc,  "IN.eAX.DXow");
+                                //		  stmts = instantiate(pc,  OP_IN_eAX_DXow);
 
                                 
 
                                 //	  | IN.AL.DX() =>
 
-                                //		  stmts = instantiate(pc,  "IN.AL.DX");
+                                //		  stmts = instantiate(pc,  OP_IN_AL_DX);
 
                                 
 
                                 //	  | IN.eAX.Ibod(i8) =>
 
-                                //		  stmts = instantiate(pc,  "IN.eAX.Ibod", DIS_I8);
+                                //		  stmts = instantiate(pc,  OP_IN_eAX_Ibod, DIS_I8);
 
                                 
 
                                 //	  | IN.eAX.Ibow(i8) =>
 
-                                //		  stmts = instantiate(pc,  "IN.eAX.Ibow", DIS_I8);
+                                //		  stmts = instantiate(pc,  OP_IN_eAX_Ibow, DIS_I8);
 
                                 
 
                                 //	  | IN.AL.Ib(i8) =>
 
-                                //		  stmts = instantiate(pc,  "IN.AL.Ib", DIS_I8);
+                                //		  stmts = instantiate(pc,  OP_IN_AL_Ib, DIS_I8);
 
                                 
 
@@ -14803,7 +14795,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1217 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "DEC.Eb", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_DEC_Eb, DIS_EADDR8);
 
                                 
 
@@ -14882,7 +14874,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1127 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "INC.Evod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_INC_Evod, DIS_EADDR32);
 
                                 
 
@@ -14951,7 +14943,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1211 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "DEC.Evod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_DEC_Evod, DIS_EADDR32);
 
                                 
 
@@ -15028,7 +15020,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
                                 		// Mike: there should probably be a HLNwayCall class for this!
 
-                                		stmts = instantiate(pc,	 "CALL.Evod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_CALL_Evod, DIS_EADDR32);
 
                                 		CallStatement* newCall = new CallStatement;
 
@@ -15214,7 +15206,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 838 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "PUSH.Evod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_PUSH_Evod, DIS_EADDR32);
 
                                 
 
@@ -15299,7 +15291,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1546 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ADDmrb", DIS_EADDR8, DIS_R8);
+                          		stmts = instantiate(pc,	 OP_ADDmrb, DIS_EADDR8, DIS_R8);
 
                           
 
@@ -15369,7 +15361,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1519 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ADDmrod", DIS_EADDR32, DIS_REG32);
+                          		stmts = instantiate(pc,	 OP_ADDmrod, DIS_EADDR32, DIS_REG32);
 
                           
 
@@ -15439,7 +15431,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1474 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ADDrmb", DIS_R8, DIS_EADDR8);
+                          		stmts = instantiate(pc,	 OP_ADDrmb, DIS_R8, DIS_EADDR8);
 
                           
 
@@ -15509,7 +15501,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1447 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ADDrmod", DIS_REG32, DIS_EADDR32);
+                          		stmts = instantiate(pc,	 OP_ADDrmod, DIS_REG32, DIS_EADDR32);
 
                           
 
@@ -15548,7 +15540,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1741 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "ADDiAL", DIS_I8);
+                    		stmts = instantiate(pc,	 OP_ADDiAL, DIS_I8);
 
                     
 
@@ -15567,7 +15559,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1693 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "ADDiEAX", DIS_I32);
+                    		stmts = instantiate(pc,	 OP_ADDiEAX, DIS_I32);
 
                     
 
@@ -15583,7 +15575,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 808 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "PUSH.ES");
+                  		stmts = instantiate(pc,	 OP_PUSH_ES);
 
                   
 
@@ -15598,7 +15590,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 868 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "POP.ES");
+                  		stmts = instantiate(pc,	 OP_POP_ES);
 
                   
 
@@ -15654,7 +15646,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1540 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ADCmrb", DIS_EADDR8, DIS_R8);
+                          		stmts = instantiate(pc,	 OP_ADCmrb, DIS_EADDR8, DIS_R8);
 
                           
 
@@ -15724,7 +15716,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1507 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ADCmrod", DIS_EADDR32, DIS_REG32);
+                          		stmts = instantiate(pc,	 OP_ADCmrod, DIS_EADDR32, DIS_REG32);
 
                           
 
@@ -15794,7 +15786,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1468 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ADCrmb", DIS_R8, DIS_EADDR8);
+                          		stmts = instantiate(pc,	 OP_ADCrmb, DIS_R8, DIS_EADDR8);
 
                           
 
@@ -15864,7 +15856,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1435 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ADCrmod", DIS_REG32, DIS_EADDR32);
+                          		stmts = instantiate(pc,	 OP_ADCrmod, DIS_REG32, DIS_EADDR32);
 
                           
 
@@ -15903,7 +15895,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1735 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "ADCiAL", DIS_I8);
+                    		stmts = instantiate(pc,	 OP_ADCiAL, DIS_I8);
 
                     
 
@@ -15922,7 +15914,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1687 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "ADCiEAX", DIS_I32);
+                    		stmts = instantiate(pc,	 OP_ADCiEAX, DIS_I32);
 
                     
 
@@ -15938,7 +15930,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 814 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "PUSH.SS");
+                  		stmts = instantiate(pc,	 OP_PUSH_SS);
 
                   
 
@@ -15953,7 +15945,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 865 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "POP.SS");
+                  		stmts = instantiate(pc,	 OP_POP_SS);
 
                   
 
@@ -16009,7 +16001,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1534 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ANDmrb", DIS_EADDR8, DIS_R8);
+                          		stmts = instantiate(pc,	 OP_ANDmrb, DIS_EADDR8, DIS_R8);
 
                           
 
@@ -16079,7 +16071,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1495 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ANDmrod", DIS_EADDR32, DIS_REG32);
+                          		stmts = instantiate(pc,	 OP_ANDmrod, DIS_EADDR32, DIS_REG32);
 
                           
 
@@ -16149,7 +16141,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1462 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ANDrmb", DIS_R8, DIS_EADDR8);
+                          		stmts = instantiate(pc,	 OP_ANDrmb, DIS_R8, DIS_EADDR8);
 
                           
 
@@ -16219,7 +16211,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1423 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "ANDrmod", DIS_REG32, DIS_EADDR32);
+                          		stmts = instantiate(pc,	 OP_ANDrmod, DIS_REG32, DIS_EADDR32);
 
                           
 
@@ -16258,7 +16250,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1729 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "ANDiAL", DIS_I8);
+                    		stmts = instantiate(pc,	 OP_ANDiAL, DIS_I8);
 
                     
 
@@ -16277,7 +16269,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1681 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "ANDiEAX", DIS_I32);
+                    		stmts = instantiate(pc,	 OP_ANDiEAX, DIS_I32);
 
                     
 
@@ -16293,7 +16285,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 336 "frontend/machine/pentium/decoder.m"
                   		 // For now, treat seg.es as a 1 byte NOP
 
-                  		stmts = instantiate(pc,	 "NOP");
+                  		stmts = instantiate(pc,	 OP_NOP);
 
                   
 
@@ -16308,7 +16300,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1223 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "DAA");
+                  		stmts = instantiate(pc,	 OP_DAA);
 
                   
 
@@ -16364,7 +16356,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1528 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "XORmrb", DIS_EADDR8, DIS_R8);
+                          		stmts = instantiate(pc,	 OP_XORmrb, DIS_EADDR8, DIS_R8);
 
                           
 
@@ -16434,7 +16426,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1483 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "XORmrod", DIS_EADDR32, DIS_REG32);
+                          		stmts = instantiate(pc,	 OP_XORmrod, DIS_EADDR32, DIS_REG32);
 
                           
 
@@ -16504,7 +16496,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1456 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "XORrmb", DIS_R8, DIS_EADDR8);
+                          		stmts = instantiate(pc,	 OP_XORrmb, DIS_R8, DIS_EADDR8);
 
                           
 
@@ -16574,7 +16566,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1411 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "XORrmod", DIS_REG32, DIS_EADDR32);
+                          		stmts = instantiate(pc,	 OP_XORrmod, DIS_REG32, DIS_EADDR32);
 
                           
 
@@ -16613,7 +16605,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1723 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "XORiAL", DIS_I8);
+                    		stmts = instantiate(pc,	 OP_XORiAL, DIS_I8);
 
                     
 
@@ -16632,7 +16624,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1675 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "XORiEAX", DIS_I32);
+                    		stmts = instantiate(pc,	 OP_XORiEAX, DIS_I32);
 
                     
 
@@ -16648,7 +16640,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 345 "frontend/machine/pentium/decoder.m"
                   		 // For now, treat seg.ss as a 1 byte NOP
 
-                  		stmts = instantiate(pc,	 "NOP");
+                  		stmts = instantiate(pc,	 OP_NOP);
 
                   
 
@@ -16670,7 +16662,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1121 "frontend/machine/pentium/decoder.m"
               
 
-              		stmts = instantiate(pc,	 "INCod", DIS_R32);
+              		stmts = instantiate(pc,	 OP_INCod, DIS_R32);
 
               
 
@@ -16688,7 +16680,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 832 "frontend/machine/pentium/decoder.m"
               
 
-              		stmts = instantiate(pc,	 "PUSHod", DIS_R32);
+              		stmts = instantiate(pc,	 OP_PUSHod, DIS_R32);
 
               
 
@@ -16709,7 +16701,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 339 "frontend/machine/pentium/decoder.m"
                   		 // For now, treat seg.fs as a 1 byte NOP
 
-                  		stmts = instantiate(pc,	 "NOP");
+                  		stmts = instantiate(pc,	 OP_NOP);
 
                   
 
@@ -16724,7 +16716,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 342 "frontend/machine/pentium/decoder.m"
                   		 // For now, treat seg.gs as a 1 byte NOP
 
-                  		stmts = instantiate(pc,	 "NOP");
+                  		stmts = instantiate(pc,	 OP_NOP);
 
                   
 
@@ -16794,7 +16786,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1516 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "ORmrow", DIS_EADDR16, DIS_REG16);
+                                        		stmts = instantiate(pc,	 OP_ORmrow, DIS_EADDR16, DIS_REG16);
 
                                         
 
@@ -16876,7 +16868,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1522 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "ADDmrow", DIS_EADDR16, DIS_REG16);
+                                        		stmts = instantiate(pc,	 OP_ADDmrow, DIS_EADDR16, DIS_REG16);
 
                                         
 
@@ -16961,7 +16953,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1444 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "ORrmow", DIS_REG16, DIS_EADDR16);
+                                        		stmts = instantiate(pc,	 OP_ORrmow, DIS_REG16, DIS_EADDR16);
 
                                         
 
@@ -17043,7 +17035,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1450 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "ADDrmow", DIS_REG16, DIS_EADDR16);
+                                        		stmts = instantiate(pc,	 OP_ADDrmow, DIS_REG16, DIS_EADDR16);
 
                                         
 
@@ -17089,7 +17081,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1714 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ORiAX", DIS_I16);
+                                  		stmts = instantiate(pc,	 OP_ORiAX, DIS_I16);
 
                                   
 
@@ -17110,7 +17102,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1717 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ADDiAX", DIS_I16);
+                                  		stmts = instantiate(pc,	 OP_ADDiAX, DIS_I16);
 
                                   
 
@@ -17199,7 +17191,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1085 "frontend/machine/pentium/decoder.m"
                                                       
 
-                                                      		stmts = instantiate(pc,	 "LAR.ow", DIS_REG16, DIS_EADDR16);
+                                                      		stmts = instantiate(pc,	 OP_LAR_ow, DIS_REG16, DIS_EADDR16);
 
                                                       
 
@@ -17298,7 +17290,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1049 "frontend/machine/pentium/decoder.m"
                                                       
 
-                                                      		stmts = instantiate(pc,	 "LSLow", DIS_REG16, DIS_EADDR16);
+                                                      		stmts = instantiate(pc,	 OP_LSLow, DIS_REG16, DIS_EADDR16);
 
                                                       
 
@@ -17802,7 +17794,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1319 "frontend/machine/pentium/decoder.m"
                                                       
 
-                                                      		stmts = instantiate(pc,	 "BTSow", DIS_EADDR16, DIS_REG16);
+                                                      		stmts = instantiate(pc,	 OP_BTSow, DIS_EADDR16, DIS_REG16);
 
                                                       
 
@@ -17896,7 +17888,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1355 "frontend/machine/pentium/decoder.m"
                                                       
 
-                                                      		stmts = instantiate(pc,	 "BTow", DIS_EADDR16, DIS_REG16);
+                                                      		stmts = instantiate(pc,	 OP_BTow, DIS_EADDR16, DIS_REG16);
 
                                                       
 
@@ -18015,7 +18007,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 453 "frontend/machine/pentium/decoder.m"
                                                         
 
-                                                        		stmts = instantiate(pc,	 "SHRD.Ibow", DIS_EADDR16, DIS_REG16, DIS_COUNT);
+                                                        		stmts = instantiate(pc,	 OP_SHRD_Ibow, DIS_EADDR16, DIS_REG16, DIS_COUNT);
 
                                                         
 
@@ -18147,7 +18139,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 447 "frontend/machine/pentium/decoder.m"
                                                         
 
-                                                        		stmts = instantiate(pc,	 "SHLD.Ibow", DIS_EADDR16, DIS_REG16, DIS_COUNT);
+                                                        		stmts = instantiate(pc,	 OP_SHLD_Ibow, DIS_EADDR16, DIS_REG16, DIS_COUNT);
 
                                                         
 
@@ -18260,7 +18252,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 441 "frontend/machine/pentium/decoder.m"
                                                       
 
-                                                      		stmts = instantiate(pc,	 "SHRD.CLow", DIS_EADDR16, DIS_REG16);
+                                                      		stmts = instantiate(pc,	 OP_SHRD_CLow, DIS_EADDR16, DIS_REG16);
 
                                                       
 
@@ -18354,7 +18346,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 435 "frontend/machine/pentium/decoder.m"
                                                       
 
-                                                      		stmts = instantiate(pc,	 "SHLD.CLow", DIS_EADDR16, DIS_REG16);
+                                                      		stmts = instantiate(pc,	 OP_SHLD_CLow, DIS_EADDR16, DIS_REG16);
 
                                                       
 
@@ -18451,7 +18443,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1169 "frontend/machine/pentium/decoder.m"
                                                       
 
-                                                      		stmts = instantiate(pc,	 "IMULrmow", DIS_REG16, DIS_EADDR16);
+                                                      		stmts = instantiate(pc,	 OP_IMULrmow, DIS_REG16, DIS_EADDR16);
 
                                                       
 
@@ -18562,7 +18554,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1241 "frontend/machine/pentium/decoder.m"
                                                       
 
-                                                      		stmts = instantiate(pc,	 "CMPXCHG.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+                                                      		stmts = instantiate(pc,	 OP_CMPXCHG_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
                                                       
 
@@ -18691,7 +18683,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1349 "frontend/machine/pentium/decoder.m"
                                                               
 
-                                                              		stmts = instantiate(pc,	 "BTiow", DIS_EADDR16, DIS_I8);
+                                                              		stmts = instantiate(pc,	 OP_BTiow, DIS_EADDR16, DIS_I8);
 
                                                               
 
@@ -18826,7 +18818,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1313 "frontend/machine/pentium/decoder.m"
                                                               
 
-                                                              		stmts = instantiate(pc,	 "BTSiow", DIS_I8, DIS_EADDR16);
+                                                              		stmts = instantiate(pc,	 OP_BTSiow, DIS_I8, DIS_EADDR16);
 
                                                               
 
@@ -18961,7 +18953,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1325 "frontend/machine/pentium/decoder.m"
                                                               
 
-                                                              		stmts = instantiate(pc,	 "BTRiow", DIS_EADDR16, DIS_I8);
+                                                              		stmts = instantiate(pc,	 OP_BTRiow, DIS_EADDR16, DIS_I8);
 
                                                               
 
@@ -19096,7 +19088,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1337 "frontend/machine/pentium/decoder.m"
                                                               
 
-                                                              		stmts = instantiate(pc,	 "BTCiow", DIS_EADDR16, DIS_I8);
+                                                              		stmts = instantiate(pc,	 OP_BTCiow, DIS_EADDR16, DIS_I8);
 
                                                               
 
@@ -19220,7 +19212,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1343 "frontend/machine/pentium/decoder.m"
                                                       
 
-                                                      		stmts = instantiate(pc,	 "BTCow", DIS_EADDR16, DIS_REG16);
+                                                      		stmts = instantiate(pc,	 OP_BTCow, DIS_EADDR16, DIS_REG16);
 
                                                       
 
@@ -19314,7 +19306,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1331 "frontend/machine/pentium/decoder.m"
                                                       
 
-                                                      		stmts = instantiate(pc,	 "BTRow", DIS_EADDR16, DIS_REG16);
+                                                      		stmts = instantiate(pc,	 OP_BTRow, DIS_EADDR16, DIS_REG16);
 
                                                       
 
@@ -19411,7 +19403,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1377 "frontend/machine/pentium/decoder.m"
                                                       
 
-                                                      		//stmts = instantiate(pc,  "BSFow", DIS_REG16, DIS_EADDR16);
+                                                      		//stmts = instantiate(pc,  OP_BSFow, DIS_REG16, DIS_EADDR16);
 
                                                       		genBSFR(pc, DIS_REG16, DIS_EADDR16, -1, 16, opPlus, nextPC-hostPC);
 
@@ -19423,13 +19415,13 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
                                                       //	| BOUNDod(reg, Mem) =>
 
-                                                      //		stmts = instantiate(pc,	 "BOUNDod", DIS_REG32, DIS_MEM);
+                                                      //		stmts = instantiate(pc,	 OP_BOUNDod, DIS_REG32, DIS_MEM);
 
                                                       
 
                                                       //	| BOUNDow(reg, Mem) =>
 
-                                                      //		stmts = instantiate(pc,	 "BOUNDow", DIS_REG16, DIS_MEM);
+                                                      //		stmts = instantiate(pc,	 OP_BOUNDow, DIS_REG16, DIS_MEM);
 
                                                       
 
@@ -19437,31 +19429,31 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
                                                       //		  unused(Eaddr); unused(reg);
 
-                                                      //		  stmts = instantiate(pc,  "UNIMP");
+                                                      //		  stmts = instantiate(pc,  OP_UNIMP);
 
                                                       
 
                                                       //	  | AAS() =>
 
-                                                      //		  stmts = instantiate(pc,  "AAS");
+                                                      //		  stmts = instantiate(pc,  OP_AAS);
 
                                                       
 
                                                       //	  | AAM() =>
 
-                                                      //		  stmts = instantiate(pc,  "AAM");
+                                                      //		  stmts = instantiate(pc,  OP_AAM);
 
                                                       
 
                                                       //	  | AAD() =>
 
-                                                      //		  stmts = instantiate(pc,  "AAD");
+                                                      //		  stmts = instantiate(pc,  OP_AAD);
 
                                                       
 
                                                       //	  | AAA() =>
 
-                                                      //		  stmts = instantiate(pc,  "AAA");
+                                                      //		  stmts = instantiate(pc,  OP_AAA);
 
                                                       
 
@@ -19560,7 +19552,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1367 "frontend/machine/pentium/decoder.m"
                                                       
 
-                                                      		//stmts = instantiate(pc,  "BSRow", DIS_REG16, DIS_EADDR16);
+                                                      		//stmts = instantiate(pc,  OP_BSRow, DIS_REG16, DIS_EADDR16);
 
                                                       		genBSFR(pc, DIS_REG16, DIS_EADDR16, 16, 16, opMinus, nextPC-hostPC);
 
@@ -19663,7 +19655,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 952 "frontend/machine/pentium/decoder.m"
                                                       
 
-                                                      		stmts = instantiate(pc,	 "MOVZX.Gv.Ebow", DIS_R16, DIS_EADDR8);
+                                                      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebow, DIS_R16, DIS_EADDR8);
 
                                                       
 
@@ -19757,7 +19749,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 943 "frontend/machine/pentium/decoder.m"
                                                       
 
-                                                      		stmts = instantiate(pc,	 "MOVZX.Gv.Ebow", DIS_R16, DIS_EADDR8);
+                                                      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebow, DIS_R16, DIS_EADDR8);
 
                                                       
 
@@ -19859,7 +19851,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 357 "frontend/machine/pentium/decoder.m"
                                                   
 
-                                                  		stmts = instantiate(pc,	 "XADD.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+                                                  		stmts = instantiate(pc,	 OP_XADD_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
                                                   
 
@@ -19963,7 +19955,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1504 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "SBBmrow", DIS_EADDR16, DIS_REG16);
+                                        		stmts = instantiate(pc,	 OP_SBBmrow, DIS_EADDR16, DIS_REG16);
 
                                         
 
@@ -20045,7 +20037,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1510 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "ADCmrow", DIS_EADDR16, DIS_REG16);
+                                        		stmts = instantiate(pc,	 OP_ADCmrow, DIS_EADDR16, DIS_REG16);
 
                                         
 
@@ -20130,7 +20122,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1432 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "SBBrmow", DIS_REG16, DIS_EADDR16);
+                                        		stmts = instantiate(pc,	 OP_SBBrmow, DIS_REG16, DIS_EADDR16);
 
                                         
 
@@ -20212,7 +20204,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1438 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "ADCrmow", DIS_REG16, DIS_EADDR16);
+                                        		stmts = instantiate(pc,	 OP_ADCrmow, DIS_REG16, DIS_EADDR16);
 
                                         
 
@@ -20258,7 +20250,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1708 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "SBBiAX", DIS_I16);
+                                  		stmts = instantiate(pc,	 OP_SBBiAX, DIS_I16);
 
                                   
 
@@ -20279,7 +20271,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1711 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ADCiAX", DIS_I16);
+                                  		stmts = instantiate(pc,	 OP_ADCiAX, DIS_I16);
 
                                   
 
@@ -20351,7 +20343,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1492 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "SUBmrow", DIS_EADDR16, DIS_REG16);
+                                        		stmts = instantiate(pc,	 OP_SUBmrow, DIS_EADDR16, DIS_REG16);
 
                                         
 
@@ -20433,7 +20425,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1498 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "ANDmrow", DIS_EADDR16, DIS_REG16);
+                                        		stmts = instantiate(pc,	 OP_ANDmrow, DIS_EADDR16, DIS_REG16);
 
                                         
 
@@ -20518,7 +20510,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1420 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "SUBrmow", DIS_REG16, DIS_EADDR16);
+                                        		stmts = instantiate(pc,	 OP_SUBrmow, DIS_REG16, DIS_EADDR16);
 
                                         
 
@@ -20600,7 +20592,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1426 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "ANDrmow", DIS_REG16, DIS_EADDR16);
+                                        		stmts = instantiate(pc,	 OP_ANDrmow, DIS_REG16, DIS_EADDR16);
 
                                         
 
@@ -20646,7 +20638,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1702 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "SUBiAX", DIS_I16);
+                                  		stmts = instantiate(pc,	 OP_SUBiAX, DIS_I16);
 
                                   
 
@@ -20667,7 +20659,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1705 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ANDiAX", DIS_I16);
+                                  		stmts = instantiate(pc,	 OP_ANDiAX, DIS_I16);
 
                                   
 
@@ -20739,7 +20731,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1480 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "CMPmrow", DIS_EADDR16, DIS_REG16);
+                                        		stmts = instantiate(pc,	 OP_CMPmrow, DIS_EADDR16, DIS_REG16);
 
                                         
 
@@ -20821,7 +20813,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1486 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "XORmrow", DIS_EADDR16, DIS_REG16);
+                                        		stmts = instantiate(pc,	 OP_XORmrow, DIS_EADDR16, DIS_REG16);
 
                                         
 
@@ -20906,7 +20898,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1408 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "CMPrmow", DIS_REG16, DIS_EADDR16);
+                                        		stmts = instantiate(pc,	 OP_CMPrmow, DIS_REG16, DIS_EADDR16);
 
                                         
 
@@ -20988,7 +20980,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1414 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "XORrmow", DIS_REG16, DIS_EADDR16);
+                                        		stmts = instantiate(pc,	 OP_XORrmow, DIS_REG16, DIS_EADDR16);
 
                                         
 
@@ -21034,7 +21026,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1696 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "CMPiAX", DIS_I16);
+                                  		stmts = instantiate(pc,	 OP_CMPiAX, DIS_I16);
 
                                   
 
@@ -21055,7 +21047,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1699 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "XORiAX", DIS_I16);
+                                  		stmts = instantiate(pc,	 OP_XORiAX, DIS_I16);
 
                                   
 
@@ -21078,7 +21070,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1208 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "DECow", DIS_R32);
+                          		stmts = instantiate(pc,	 OP_DECow, DIS_R32);
 
                           
 
@@ -21093,7 +21085,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1124 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "INCow", DIS_R32);
+                          		stmts = instantiate(pc,	 OP_INCow, DIS_R32);
 
                           
 
@@ -21111,7 +21103,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 874 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "POPow", DIS_R32);	  // Check!
+                          		stmts = instantiate(pc,	 OP_POPow, DIS_R32);	  // Check!
 
                           
 
@@ -21126,7 +21118,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 835 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "PUSHow", DIS_R32);  // Check!
+                          		stmts = instantiate(pc,	 OP_PUSHow, DIS_R32);  // Check!
 
                           
 
@@ -21151,7 +21143,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 823 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "PUSH.Ivow", DIS_I16);
+                                  		stmts = instantiate(pc,	 OP_PUSH_Ivow, DIS_I16);
 
                                   
 
@@ -21233,7 +21225,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1157 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "IMUL.Ivw", DIS_REG16, DIS_EADDR16, DIS_I16);
+                                          		stmts = instantiate(pc,	 OP_IMUL_Ivw, DIS_REG16, DIS_EADDR16, DIS_I16);
 
                                           
 
@@ -21290,7 +21282,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 829 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "PUSH.Ixow", DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_PUSH_Ixow, DIS_I8);
 
                                   
 
@@ -21372,7 +21364,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1163 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "IMUL.Ibow", DIS_REG16, DIS_EADDR16, DIS_I8);
+                                          		stmts = instantiate(pc,	 OP_IMUL_Ibow, DIS_REG16, DIS_EADDR16, DIS_I8);
 
                                           
 
@@ -21484,7 +21476,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1034 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "MOVmrow", DIS_EADDR16, DIS_REG16);
+                                        		stmts = instantiate(pc,	 OP_MOVmrow, DIS_EADDR16, DIS_REG16);
 
                                         
 
@@ -21591,7 +21583,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1645 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "ADDiw", DIS_EADDR16, DIS_I16);
+                                                		stmts = instantiate(pc,	 OP_ADDiw, DIS_EADDR16, DIS_I16);
 
                                                 
 
@@ -21711,7 +21703,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1642 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "ORiw", DIS_EADDR16, DIS_I16);
+                                                		stmts = instantiate(pc,	 OP_ORiw, DIS_EADDR16, DIS_I16);
 
                                                 
 
@@ -21831,7 +21823,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1639 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "ADCiw", DIS_EADDR16, DIS_I16);
+                                                		stmts = instantiate(pc,	 OP_ADCiw, DIS_EADDR16, DIS_I16);
 
                                                 
 
@@ -21951,7 +21943,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1636 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "SBBiw", DIS_EADDR16, DIS_I16);
+                                                		stmts = instantiate(pc,	 OP_SBBiw, DIS_EADDR16, DIS_I16);
 
                                                 
 
@@ -22071,7 +22063,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1633 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "ANDiw", DIS_EADDR16, DIS_I16);
+                                                		stmts = instantiate(pc,	 OP_ANDiw, DIS_EADDR16, DIS_I16);
 
                                                 
 
@@ -22191,7 +22183,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1630 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "SUBiw", DIS_EADDR16, DIS_I16);
+                                                		stmts = instantiate(pc,	 OP_SUBiw, DIS_EADDR16, DIS_I16);
 
                                                 
 
@@ -22311,7 +22303,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1627 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "XORiw", DIS_EADDR16, DIS_I16);
+                                                		stmts = instantiate(pc,	 OP_XORiw, DIS_EADDR16, DIS_I16);
 
                                                 
 
@@ -22431,7 +22423,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1624 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "CMPiw", DIS_EADDR16, DIS_I16);
+                                                		stmts = instantiate(pc,	 OP_CMPiw, DIS_EADDR16, DIS_I16);
 
                                                 
 
@@ -22539,7 +22531,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1025 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "MOVrmow", DIS_REG16, DIS_EADDR16);
+                                        		stmts = instantiate(pc,	 OP_MOVrmow, DIS_REG16, DIS_EADDR16);
 
                                         
 
@@ -22646,7 +22638,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1597 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "ADDiowb", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_ADDiowb, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -22766,7 +22758,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1591 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "ORiowb", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_ORiowb, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -22886,7 +22878,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1585 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "ADCiowb", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_ADCiowb, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -23006,7 +22998,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1579 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "SBBiowb", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_SBBiowb, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -23126,7 +23118,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1573 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "ANDiowb", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_ANDiowb, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -23246,7 +23238,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1564 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "SUBiowb", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_SUBiowb, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -23366,7 +23358,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1558 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "XORiowb", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_XORiowb, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -23486,7 +23478,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1552 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "CMPiowb", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_CMPiowb, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -23566,7 +23558,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1076 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "LEA.ow", DIS_REG16, DIS_MEM);
+                                              		stmts = instantiate(pc,	 OP_LEA_ow, DIS_REG16, DIS_MEM);
 
                                               
 
@@ -23614,7 +23606,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1076 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "LEA.ow", DIS_REG16, DIS_MEM);
+                                        		stmts = instantiate(pc,	 OP_LEA_ow, DIS_REG16, DIS_MEM);
 
                                         
 
@@ -23696,7 +23688,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 381 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "TEST.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+                                        		stmts = instantiate(pc,	 OP_TEST_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
                                         
 
@@ -23780,61 +23772,61 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 880 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "POP.Evow", DIS_EADDR16);
+                                          		stmts = instantiate(pc,	 OP_POP_Evow, DIS_EADDR16);
 
                                           
 
                                           //	  | OUTSvod() =>
 
-                                          //		  stmts = instantiate(pc,  "OUTSvod");
+                                          //		  stmts = instantiate(pc,  OP_OUTSvod);
 
                                           
 
                                           //	  | OUTSvow() =>
 
-                                          //		  stmts = instantiate(pc,  "OUTSvow");
+                                          //		  stmts = instantiate(pc,  OP_OUTSvow);
 
                                           
 
                                           //	  | OUTSB() =>
 
-                                          //		  stmts = instantiate(pc,  "OUTSB");
+                                          //		  stmts = instantiate(pc,  OP_OUTSB);
 
                                           
 
                                           //	  | OUT.DX.eAXod() =>
 
-                                          //		  stmts = instantiate(pc,  "OUT.DX.eAXod");
+                                          //		  stmts = instantiate(pc,  OP_OUT_DX_eAXod);
 
                                           
 
                                           //	  | OUT.DX.eAXow() =>
 
-                                          //		  stmts = instantiate(pc,  "OUT.DX.eAXow");
+                                          //		  stmts = instantiate(pc,  OP_OUT_DX_eAXow);
 
                                           
 
                                           //	  | OUT.DX.AL() =>
 
-                                          //		  stmts = instantiate(pc,  "OUT.DX.AL");
+                                          //		  stmts = instantiate(pc,  OP_OUT_DX_AL);
 
                                           
 
                                           //	  | OUT.Ib.eAXod(i8) =>
 
-                                          //		  stmts = instantiate(pc,  "OUT.Ib.eAXod", DIS_I8);
+                                          //		  stmts = instantiate(pc,  OP_OUT_Ib_eAXod, DIS_I8);
 
                                           
 
                                           //	  | OUT.Ib.eAXow(i8) =>
 
-                                          //		  stmts = instantiate(pc,  "OUT.Ib.eAXow", DIS_I8);
+                                          //		  stmts = instantiate(pc,  OP_OUT_Ib_eAXow, DIS_I8);
 
                                           
 
                                           //	  | OUT.Ib.AL(i8) =>
 
-                                          //		  stmts = instantiate(pc,  "OUT.Ib.AL", DIS_I8);
+                                          //		  stmts = instantiate(pc,  OP_OUT_Ib_AL, DIS_I8);
 
                                           
 
@@ -23918,7 +23910,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 321 "frontend/machine/pentium/decoder.m"
                                         
 
-                                        		stmts = instantiate(pc,	 "XCHG.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+                                        		stmts = instantiate(pc,	 OP_XCHG_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
                                         
 
@@ -23964,7 +23956,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1274 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "CBW");
+                                		stmts = instantiate(pc,	 OP_CBW);
 
                                 
 
@@ -23983,7 +23975,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1229 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "CWD");
+                                		stmts = instantiate(pc,	 OP_CWD);
 
                                 
 
@@ -24003,7 +23995,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 351 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "XCHGeAXow", DIS_R32);
+                          		stmts = instantiate(pc,	 OP_XCHGeAXow, DIS_R32);
 
                           
 
@@ -24029,7 +24021,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 399 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "TEST.eAX.Ivow", DIS_I16);
+                                  		stmts = instantiate(pc,	 OP_TEST_eAX_Ivow, DIS_I16);
 
                                   
 
@@ -24049,7 +24041,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1010 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "MOV.eAX.Ovow", DIS_OFF);
+                                  		stmts = instantiate(pc,	 OP_MOV_eAX_Ovow, DIS_OFF);
 
                                   
 
@@ -24069,7 +24061,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 411 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "STOSvow");
+                                		stmts = instantiate(pc,	 OP_STOSvow);
 
                                 
 
@@ -24087,7 +24079,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1001 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "MOV.Ov.eAXow", DIS_OFF);
+                                  		stmts = instantiate(pc,	 OP_MOV_Ov_eAXow, DIS_OFF);
 
                                   
 
@@ -24107,7 +24099,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1747 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "LODSvow");
+                                		stmts = instantiate(pc,	 OP_LODSvow);
 
                                 
 
@@ -24121,7 +24113,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 958 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "MOVSvow");
+                                		stmts = instantiate(pc,	 OP_MOVSvow);
 
                                 
 
@@ -24139,7 +24131,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 466 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "SCASvow");
+                                		stmts = instantiate(pc,	 OP_SCASvow);
 
                                 
 
@@ -24153,7 +24145,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1250 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "CMPSvow");
+                                		stmts = instantiate(pc,	 OP_CMPSvow);
 
                                 
 
@@ -24179,7 +24171,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 992 "frontend/machine/pentium/decoder.m"
                             
 
-                            		stmts = instantiate(pc,	 "MOViw", DIS_R16, DIS_I16);  // Check!
+                            		stmts = instantiate(pc,	 OP_MOViw, DIS_R16, DIS_I16);  // Check!
 
                             
 
@@ -24277,7 +24269,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 638 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "ROLB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_ROLB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -24397,7 +24389,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 632 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "RORB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_RORB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -24517,7 +24509,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 626 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "RCLB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_RCLB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -24637,7 +24629,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 620 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "RCRB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_RCRB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -24757,7 +24749,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 614 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "SHLSALB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_SHLSALB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -24877,7 +24869,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 608 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "SHRB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_SHRB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -24999,7 +24991,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 602 "frontend/machine/pentium/decoder.m"
                                                 
 
-                                                		stmts = instantiate(pc,	 "SARB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+                                                		stmts = instantiate(pc,	 OP_SARB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
                                                 
 
@@ -25131,7 +25123,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 983 "frontend/machine/pentium/decoder.m"
                                             
 
-                                            		stmts = instantiate(pc,	 "MOV.Ew.Ivow", DIS_EADDR16, DIS_I16);
+                                            		stmts = instantiate(pc,	 OP_MOV_Ew_Ivow, DIS_EADDR16, DIS_I16);
 
                                             
 
@@ -25251,7 +25243,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 743 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "ROLB.Ev.1ow", DIS_EADDR16);
+                                              		stmts = instantiate(pc,	 OP_ROLB_Ev_1ow, DIS_EADDR16);
 
                                               
 
@@ -25334,7 +25326,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 731 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "ORB.Ev.1owR", DIS_EADDR16);
+                                              		stmts = instantiate(pc,	 OP_ORB_Ev_1owR, DIS_EADDR16);
 
                                               
 
@@ -25417,7 +25409,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 719 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "RCLB.Ev.1ow", DIS_EADDR16);
+                                              		stmts = instantiate(pc,	 OP_RCLB_Ev_1ow, DIS_EADDR16);
 
                                               
 
@@ -25500,7 +25492,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 707 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "RCRB.Ev.1ow", DIS_EADDR16);
+                                              		stmts = instantiate(pc,	 OP_RCRB_Ev_1ow, DIS_EADDR16);
 
                                               
 
@@ -25583,7 +25575,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 695 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "SHLSALB.Ev.1ow", DIS_EADDR16);
+                                              		stmts = instantiate(pc,	 OP_SHLSALB_Ev_1ow, DIS_EADDR16);
 
                                               
 
@@ -25666,7 +25658,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 683 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "SHRB.Ev.1ow", DIS_EADDR16);
+                                              		stmts = instantiate(pc,	 OP_SHRB_Ev_1ow, DIS_EADDR16);
 
                                               
 
@@ -25751,7 +25743,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 671 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "SARB.Ev.1ow", DIS_EADDR16);
+                                              		stmts = instantiate(pc,	 OP_SARB_Ev_1ow, DIS_EADDR16);
 
                                               
 
@@ -25849,7 +25841,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 737 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "ROLB.Ev.CLow", DIS_EADDR16);
+                                              		stmts = instantiate(pc,	 OP_ROLB_Ev_CLow, DIS_EADDR16);
 
                                               
 
@@ -25932,7 +25924,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 725 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "RORB.Ev.CLow", DIS_EADDR16);
+                                              		stmts = instantiate(pc,	 OP_RORB_Ev_CLow, DIS_EADDR16);
 
                                               
 
@@ -26015,7 +26007,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 713 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "RCLB.Ev.CLow", DIS_EADDR16);
+                                              		stmts = instantiate(pc,	 OP_RCLB_Ev_CLow, DIS_EADDR16);
 
                                               
 
@@ -26098,7 +26090,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 701 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "RCRB.Ev.CLow", DIS_EADDR16);
+                                              		stmts = instantiate(pc,	 OP_RCRB_Ev_CLow, DIS_EADDR16);
 
                                               
 
@@ -26181,7 +26173,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 689 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "SHLSALB.Ev.CLow", DIS_EADDR16);
+                                              		stmts = instantiate(pc,	 OP_SHLSALB_Ev_CLow, DIS_EADDR16);
 
                                               
 
@@ -26264,7 +26256,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 677 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "SHRB.Ev.CLow", DIS_EADDR16);
+                                              		stmts = instantiate(pc,	 OP_SHRB_Ev_CLow, DIS_EADDR16);
 
                                               
 
@@ -26349,7 +26341,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 665 "frontend/machine/pentium/decoder.m"
                                               
 
-                                              		stmts = instantiate(pc,	 "SARB.Ev.CLow", DIS_EADDR16);
+                                              		stmts = instantiate(pc,	 OP_SARB_Ev_CLow, DIS_EADDR16);
 
                                               
 
@@ -26476,7 +26468,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1130 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "INC.Evow", DIS_EADDR16);
+                                          		stmts = instantiate(pc,	 OP_INC_Evow, DIS_EADDR16);
 
                                           
 
@@ -26553,7 +26545,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1214 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "DEC.Evow", DIS_EADDR16);
+                                          		stmts = instantiate(pc,	 OP_DEC_Evow, DIS_EADDR16);
 
                                           
 
@@ -26632,31 +26624,31 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 841 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "PUSH.Evow", DIS_EADDR16);
+                                          		stmts = instantiate(pc,	 OP_PUSH_Evow, DIS_EADDR16);
 
                                           
 
                                           //	  | POPFod() =>
 
-                                          //		  stmts = instantiate(pc,  "POPFod");
+                                          //		  stmts = instantiate(pc,  OP_POPFod);
 
                                           
 
                                           //	  | POPFow() =>
 
-                                          //		  stmts = instantiate(pc,  "POPFow");
+                                          //		  stmts = instantiate(pc,  OP_POPFow);
 
                                           
 
                                           //	  | POPAod() =>
 
-                                          //		  stmts = instantiate(pc,  "POPAod");
+                                          //		  stmts = instantiate(pc,  OP_POPAod);
 
                                           
 
                                           //	  | POPAow() =>
 
-                                          //		  stmts = instantiate(pc,  "POPAow");
+                                          //		  stmts = instantiate(pc,  OP_POPAow);
 
                                           
 
@@ -26765,7 +26757,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 390 "frontend/machine/pentium/decoder.m"
                                             
 
-                                            		stmts = instantiate(pc,	 "TEST.Ew.Iw", DIS_EADDR16, DIS_I16);
+                                            		stmts = instantiate(pc,	 OP_TEST_Ew_Iw, DIS_EADDR16, DIS_I16);
 
                                             
 
@@ -26861,7 +26853,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 913 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "NOTow", DIS_EADDR16);
+                                          		stmts = instantiate(pc,	 OP_NOTow, DIS_EADDR16);
 
                                           
 
@@ -26938,7 +26930,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 922 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "NEGow", DIS_EADDR16);
+                                          		stmts = instantiate(pc,	 OP_NEGow, DIS_EADDR16);
 
                                           
 
@@ -27015,7 +27007,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 931 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "MUL.AXow", DIS_EADDR16);
+                                          		stmts = instantiate(pc,	 OP_MUL_AXow, DIS_EADDR16);
 
                                           
 
@@ -27092,7 +27084,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1175 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "IMULow", DIS_EADDR16);
+                                          		stmts = instantiate(pc,	 OP_IMULow, DIS_EADDR16);
 
                                           
 
@@ -27169,7 +27161,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1199 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "DIVAX", DIS_EADDR16);
+                                          		stmts = instantiate(pc,	 OP_DIVAX, DIS_EADDR16);
 
                                           
 
@@ -27246,7 +27238,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1184 "frontend/machine/pentium/decoder.m"
                                           
 
-                                          		stmts = instantiate(pc,	 "IDIVAX", DIS_EADDR16);
+                                          		stmts = instantiate(pc,	 OP_IDIVAX, DIS_EADDR16);
 
                                           
 
@@ -27522,7 +27514,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1669 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ADDib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_ADDib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -27622,7 +27614,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1666 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ORib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_ORib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -27722,7 +27714,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1663 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ADCib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_ADCib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -27822,7 +27814,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1660 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "SBBib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_SBBib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -27922,7 +27914,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1657 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ANDib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_ANDib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -28022,7 +28014,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1654 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "SUBib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_SUBib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -28122,7 +28114,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1651 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "XORib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_XORib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -28222,7 +28214,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1648 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "CMPib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_CMPib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -28329,7 +28321,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1621 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ADDid", DIS_EADDR32, DIS_I32);
+                                  		stmts = instantiate(pc,	 OP_ADDid, DIS_EADDR32, DIS_I32);
 
                                   
 
@@ -28428,7 +28420,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1618 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ORid", DIS_EADDR32, DIS_I32);
+                                  		stmts = instantiate(pc,	 OP_ORid, DIS_EADDR32, DIS_I32);
 
                                   
 
@@ -28527,7 +28519,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1615 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ADCid", DIS_EADDR32, DIS_I32);
+                                  		stmts = instantiate(pc,	 OP_ADCid, DIS_EADDR32, DIS_I32);
 
                                   
 
@@ -28626,7 +28618,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1612 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "SBBid", DIS_EADDR32, DIS_I32);
+                                  		stmts = instantiate(pc,	 OP_SBBid, DIS_EADDR32, DIS_I32);
 
                                   
 
@@ -28725,7 +28717,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1609 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ANDid", DIS_EADDR32, DIS_I32);
+                                  		stmts = instantiate(pc,	 OP_ANDid, DIS_EADDR32, DIS_I32);
 
                                   
 
@@ -28824,7 +28816,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1606 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "SUBid", DIS_EADDR32, DIS_I32);
+                                  		stmts = instantiate(pc,	 OP_SUBid, DIS_EADDR32, DIS_I32);
 
                                   
 
@@ -28923,7 +28915,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1603 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "XORid", DIS_EADDR32, DIS_I32);
+                                  		stmts = instantiate(pc,	 OP_XORid, DIS_EADDR32, DIS_I32);
 
                                   
 
@@ -29022,7 +29014,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1600 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "CMPid", DIS_EADDR32, DIS_I32);
+                                  		stmts = instantiate(pc,	 OP_CMPid, DIS_EADDR32, DIS_I32);
 
                                   
 
@@ -29132,7 +29124,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1594 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ADDiodb", DIS_EADDR32, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_ADDiodb, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -29232,7 +29224,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1588 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ORiodb", DIS_EADDR32, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_ORiodb, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -29332,7 +29324,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1582 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ADCiodb", DIS_EADDR32, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_ADCiodb, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -29432,7 +29424,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1576 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "SBBiodb", DIS_EADDR32, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_SBBiodb, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -29538,7 +29530,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
                                   		if (i8 != -16 || !(*oper == *Location::regOf(28)))
 
-                                  			stmts = instantiate(pc,	 "ANDiodb", DIS_EADDR32, DIS_I8);
+                                  			stmts = instantiate(pc,	 OP_ANDiodb, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -29638,7 +29630,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1561 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "SUBiodb", DIS_EADDR32, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_SUBiodb, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -29738,7 +29730,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1555 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "XORiodb", DIS_EADDR32, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_XORiodb, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -29838,7 +29830,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1549 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "CMPiodb", DIS_EADDR32, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_CMPiodb, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -29926,7 +29918,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 384 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "TEST.Eb.Gb", DIS_EADDR8, DIS_REG8);
+                          		stmts = instantiate(pc,	 OP_TEST_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
                           
 
@@ -29996,7 +29988,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 378 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "TEST.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+                          		stmts = instantiate(pc,	 OP_TEST_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
                           
 
@@ -30066,7 +30058,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 324 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "XCHG.Eb.Gb", DIS_EADDR8, DIS_REG8);
+                          		stmts = instantiate(pc,	 OP_XCHG_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
                           
 
@@ -30136,7 +30128,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 318 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "XCHG.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+                          		stmts = instantiate(pc,	 OP_XCHG_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
                           
 
@@ -30175,7 +30167,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 327 "frontend/machine/pentium/decoder.m"
               
 
-              		stmts = instantiate(pc,	 "NOP");
+              		stmts = instantiate(pc,	 OP_NOP);
 
               
 
@@ -30190,7 +30182,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 348 "frontend/machine/pentium/decoder.m"
               
 
-              		stmts = instantiate(pc,	 "XCHGeAXod", DIS_R32);
+              		stmts = instantiate(pc,	 OP_XCHGeAXod, DIS_R32);
 
               
 
@@ -30212,19 +30204,19 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1013 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "MOV.AL.Ob", DIS_OFF);
+                    		stmts = instantiate(pc,	 OP_MOV_AL_Ob, DIS_OFF);
 
                     
 
                     //	  | MOV.Sw.Ew(Mem, sr16) =>
 
-                    //		  stmts = instantiate(pc,  "MOV.Sw.Ew", DIS_MEM, DIS_SR16);
+                    //		  stmts = instantiate(pc,  OP_MOV_Sw_Ew, DIS_MEM, DIS_SR16);
 
                     
 
                     //	  | MOV.Ew.Sw(Mem, sr16) =>
 
-                    //		  stmts = instantiate(pc,  "MOV.Ew.Sw", DIS_MEM, DIS_SR16);
+                    //		  stmts = instantiate(pc,  OP_MOV_Ew_Sw, DIS_MEM, DIS_SR16);
 
                     
 
@@ -30243,7 +30235,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1007 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "MOV.eAX.Ovod", DIS_OFF);
+                    		stmts = instantiate(pc,	 OP_MOV_eAX_Ovod, DIS_OFF);
 
                     
 
@@ -30262,7 +30254,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1004 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "MOV.Ob.AL", DIS_OFF);
+                    		stmts = instantiate(pc,	 OP_MOV_Ob_AL, DIS_OFF);
 
                     
 
@@ -30281,7 +30273,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 998 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "MOV.Ov.eAXod", DIS_OFF);
+                    		stmts = instantiate(pc,	 OP_MOV_Ov_eAXod, DIS_OFF);
 
                     
 
@@ -30297,7 +30289,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 961 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "MOVSB");
+                  		stmts = instantiate(pc,	 OP_MOVSB);
 
                   
 
@@ -30305,7 +30297,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
                   //		  unused(reg); unused(dr);
 
-                  //		  stmts = instantiate(pc,  "UNIMP");
+                  //		  stmts = instantiate(pc,  OP_UNIMP);
 
                   
 
@@ -30313,7 +30305,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
                   //		  unused(reg); unused(dr);
 
-                  //		  stmts = instantiate(pc,  "UNIMP");
+                  //		  stmts = instantiate(pc,  OP_UNIMP);
 
                   
 
@@ -30321,7 +30313,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
                   //		  unused(reg); unused(cr);
 
-                  //		  stmts = instantiate(pc,  "UNIMP");
+                  //		  stmts = instantiate(pc,  OP_UNIMP);
 
                   
 
@@ -30329,7 +30321,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
                   //		  unused(reg); unused(cr);
 
-                  //		  stmts = instantiate(pc,  "UNIMP");
+                  //		  stmts = instantiate(pc,  OP_UNIMP);
 
                   
 
@@ -30344,7 +30336,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 955 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "MOVSvod");
+                  		stmts = instantiate(pc,	 OP_MOVSvod);
 
                   
 
@@ -30359,7 +30351,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1253 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "CMPSB");
+                  		stmts = instantiate(pc,	 OP_CMPSB);
 
                   
 
@@ -30374,7 +30366,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1247 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "CMPSvod");
+                  		stmts = instantiate(pc,	 OP_CMPSvod);
 
                   
 
@@ -30397,7 +30389,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 995 "frontend/machine/pentium/decoder.m"
               
 
-              		stmts = instantiate(pc,	 "MOVib", DIS_R8, DIS_I8);
+              		stmts = instantiate(pc,	 OP_MOVib, DIS_R8, DIS_I8);
 
               
 
@@ -30471,7 +30463,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 659 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ROLB.Eb.Ib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_ROLB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -30571,7 +30563,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 656 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "RORB.Eb.Ib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_RORB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -30671,7 +30663,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 653 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "RCLB.Eb.Ib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_RCLB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -30771,7 +30763,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 650 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "RCRB.Eb.Ib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_RCRB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -30871,7 +30863,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 647 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "SHLSALB.Eb.Ib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_SHLSALB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -30971,7 +30963,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 644 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "SHRB.Eb.Ib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_SHRB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -31073,7 +31065,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 641 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "SARB.Eb.Ib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_SARB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -31181,7 +31173,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 635 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "ROLB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_ROLB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -31281,7 +31273,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 629 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "RORB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_RORB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -31381,7 +31373,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 623 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "RCLB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_RCLB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -31481,7 +31473,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 617 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "RCRB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_RCRB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -31581,7 +31573,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 611 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "SHLSALB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_SHLSALB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -31681,7 +31673,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 605 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "SHRB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_SHRB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -31783,7 +31775,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 599 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "SARB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_SARB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
                                   
 
@@ -31839,7 +31831,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 484 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "RET.Iw", DIS_I16);
+                    		stmts = instantiate(pc,	 OP_RET_Iw, DIS_I16);
 
                     		ReturnStatement *ret = new ReturnStatement;
 
@@ -31861,7 +31853,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 495 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "RET");
+                  		stmts = instantiate(pc,	 OP_RET);
 
                   		result.rtl = new RTL(pc, stmts);
 
@@ -31871,13 +31863,13 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
                   //	 | REPNE() =>
 
-                  //		stmts = instantiate(pc,	 "REPNE");
+                  //		stmts = instantiate(pc,	 OP_REPNE);
 
                   
 
                   //	| REP() =>
 
-                  //		stmts = instantiate(pc,	 "REP");
+                  //		stmts = instantiate(pc,	 OP_REP);
 
                   
 
@@ -31904,7 +31896,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1067 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "LES", DIS_REG32, DIS_MEM);
+                                		stmts = instantiate(pc,	 OP_LES, DIS_REG32, DIS_MEM);
 
                                 
 
@@ -31946,7 +31938,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1067 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "LES", DIS_REG32, DIS_MEM);
+                          		stmts = instantiate(pc,	 OP_LES, DIS_REG32, DIS_MEM);
 
                           
 
@@ -31993,7 +31985,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1079 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "LDS", DIS_REG32, DIS_MEM);
+                                		stmts = instantiate(pc,	 OP_LDS, DIS_REG32, DIS_MEM);
 
                                 
 
@@ -32035,7 +32027,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1079 "frontend/machine/pentium/decoder.m"
                           
 
-                          		stmts = instantiate(pc,	 "LDS", DIS_REG32, DIS_MEM);
+                          		stmts = instantiate(pc,	 OP_LDS, DIS_REG32, DIS_MEM);
 
                           
 
@@ -32122,7 +32114,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 986 "frontend/machine/pentium/decoder.m"
                               
 
-                              		stmts = instantiate(pc,	 "MOV.Eb.Ib", DIS_EADDR8, DIS_I8);
+                              		stmts = instantiate(pc,	 OP_MOV_Eb_Ib, DIS_EADDR8, DIS_I8);
 
                               
 
@@ -32224,7 +32216,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 980 "frontend/machine/pentium/decoder.m"
                               
 
-                              		stmts = instantiate(pc,	 "MOV.Ed.Ivod", DIS_EADDR32, DIS_I32);
+                              		stmts = instantiate(pc,	 OP_MOV_Ed_Ivod, DIS_EADDR32, DIS_I32);
 
                               
 
@@ -32320,7 +32312,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 785 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "ROLB.Eb.1", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_ROLB_Eb_1, DIS_EADDR8);
 
                                 
 
@@ -32330,25 +32322,25 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
                                 //	  | PUSHFod() =>
 
-                                //		  stmts = instantiate(pc,  "PUSHFod");
+                                //		  stmts = instantiate(pc,  OP_PUSHFod);
 
                                 
 
                                 //	  | PUSHFow() =>
 
-                                //		  stmts = instantiate(pc,  "PUSHFow");
+                                //		  stmts = instantiate(pc,  OP_PUSHFow);
 
                                 
 
                                 //	  | PUSHAod() =>
 
-                                //		  stmts = instantiate(pc,  "PUSHAod");
+                                //		  stmts = instantiate(pc,  OP_PUSHAod);
 
                                 
 
                                 //	  | PUSHAow() =>
 
-                                //		  stmts = instantiate(pc,  "PUSHAow");
+                                //		  stmts = instantiate(pc,  OP_PUSHAow);
 
                                 
 
@@ -32417,7 +32409,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 779 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "RORB.Eb.1", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_RORB_Eb_1, DIS_EADDR8);
 
                                 
 
@@ -32486,7 +32478,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 773 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "RCLB.Eb.1", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_RCLB_Eb_1, DIS_EADDR8);
 
                                 
 
@@ -32555,7 +32547,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 767 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "RCRB.Eb.1", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_RCRB_Eb_1, DIS_EADDR8);
 
                                 
 
@@ -32624,7 +32616,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 761 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "SHLSALB.Eb.1", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_SHLSALB_Eb_1, DIS_EADDR8);
 
                                 
 
@@ -32693,7 +32685,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 755 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "SHRB.Eb.1", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_SHRB_Eb_1, DIS_EADDR8);
 
                                 
 
@@ -32764,7 +32756,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 749 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "SARB.Eb.1", DIS_EADDR16);
+                                		stmts = instantiate(pc,	 OP_SARB_Eb_1, DIS_EADDR16);
 
                                 
 
@@ -32841,7 +32833,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 740 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "ROLB.Ev.1od", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_ROLB_Ev_1od, DIS_EADDR32);
 
                                 
 
@@ -32910,7 +32902,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 728 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "RORB.Ev.1od", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_RORB_Ev_1od, DIS_EADDR32);
 
                                 
 
@@ -32979,7 +32971,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 716 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "RCLB.Ev.1od", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_RCLB_Ev_1od, DIS_EADDR32);
 
                                 
 
@@ -33048,7 +33040,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 704 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "RCRB.Ev.1od", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_RCRB_Ev_1od, DIS_EADDR32);
 
                                 
 
@@ -33117,7 +33109,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 692 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "SHLSALB.Ev.1od", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_SHLSALB_Ev_1od, DIS_EADDR32);
 
                                 
 
@@ -33186,7 +33178,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 680 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "SHRB.Ev.1od", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_SHRB_Ev_1od, DIS_EADDR32);
 
                                 
 
@@ -33257,7 +33249,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 668 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "SARB.Ev.1od", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_SARB_Ev_1od, DIS_EADDR32);
 
                                 
 
@@ -33334,7 +33326,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 782 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "ROLB.Eb.CL", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_ROLB_Eb_CL, DIS_EADDR8);
 
                                 
 
@@ -33403,7 +33395,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 776 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "RORB.Eb.CL", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_RORB_Eb_CL, DIS_EADDR8);
 
                                 
 
@@ -33472,7 +33464,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 770 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "RCLB.Eb.CL", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_RCLB_Eb_CL, DIS_EADDR8);
 
                                 
 
@@ -33541,7 +33533,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 764 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "RCRB.Eb.CL", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_RCRB_Eb_CL, DIS_EADDR8);
 
                                 
 
@@ -33610,7 +33602,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 758 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "SHLSALB.Eb.CL", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_SHLSALB_Eb_CL, DIS_EADDR8);
 
                                 
 
@@ -33679,7 +33671,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 752 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "SHRB.Eb.CL", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_SHRB_Eb_CL, DIS_EADDR8);
 
                                 
 
@@ -33750,7 +33742,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 746 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "SARB.Eb.CL", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_SARB_Eb_CL, DIS_EADDR32);
 
                                 
 
@@ -33827,7 +33819,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 734 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "ROLB.Ev.CLod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_ROLB_Ev_CLod, DIS_EADDR32);
 
                                 
 
@@ -33896,7 +33888,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 722 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "RORB.Ev.CLod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_RORB_Ev_CLod, DIS_EADDR32);
 
                                 
 
@@ -33965,7 +33957,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 710 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "RCLB.Ev.CLod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_RCLB_Ev_CLod, DIS_EADDR32);
 
                                 
 
@@ -34034,7 +34026,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 698 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "RCRB.Ev.CLod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_RCRB_Ev_CLod, DIS_EADDR32);
 
                                 
 
@@ -34103,7 +34095,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 686 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "SHLSALB.Ev.CLod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_SHLSALB_Ev_CLod, DIS_EADDR32);
 
                                 
 
@@ -34172,7 +34164,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 674 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "SHRB.Ev.CLod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_SHRB_Ev_CLod, DIS_EADDR32);
 
                                 
 
@@ -34243,7 +34235,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 662 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "SARB.Ev.CLod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_SARB_Ev_CLod, DIS_EADDR32);
 
                                 
 
@@ -34284,7 +34276,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 315 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "XLATB");
+                  		stmts = instantiate(pc,	 OP_XLATB);
 
                   
 
@@ -34310,7 +34302,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1052 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "LOOPNE", dis_Num(relocd - hostPC - 2));
+                    		stmts = instantiate(pc,	 OP_LOOPNE, dis_Num(relocd - hostPC - 2));
 
                     
 
@@ -34331,7 +34323,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1055 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "LOOPE", dis_Num(relocd-hostPC-2));
+                    		stmts = instantiate(pc,	 OP_LOOPE, dis_Num(relocd-hostPC-2));
 
                     
 
@@ -34352,7 +34344,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1058 "frontend/machine/pentium/decoder.m"
                     
 
-                    		stmts = instantiate(pc,	 "LOOP", dis_Num(relocd-hostPC-2));
+                    		stmts = instantiate(pc,	 OP_LOOP, dis_Num(relocd-hostPC-2));
 
                     
 
@@ -35168,7 +35160,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1256 "frontend/machine/pentium/decoder.m"
                   
 
-                  		stmts = instantiate(pc,	 "CMC");
+                  		stmts = instantiate(pc,	 OP_CMC);
 
                   
 
@@ -35237,7 +35229,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 393 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "TEST.Eb.Ib", DIS_EADDR8, DIS_I8);
+                                  		stmts = instantiate(pc,	 OP_TEST_Eb_Ib, DIS_EADDR8, DIS_I8);
 
                                   
 
@@ -35322,7 +35314,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 916 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "NOTb", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_NOTb, DIS_EADDR8);
 
                                 
 
@@ -35391,7 +35383,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 925 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "NEGb", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_NEGb, DIS_EADDR8);
 
                                 
 
@@ -35460,7 +35452,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 934 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "MUL.AL", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_MUL_AL, DIS_EADDR8);
 
                                 
 
@@ -35529,7 +35521,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1178 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "IMULb", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_IMULb, DIS_EADDR8);
 
                                 
 
@@ -35598,7 +35590,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1202 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "DIVAL", DIS_EADDR8);
+                                		stmts = instantiate(pc,	 OP_DIVAL, DIS_EADDR8);
 
                                 
 
@@ -35667,13 +35659,13 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1187 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "IDIV", DIS_EADDR8); /* ?? */
+                                		stmts = instantiate(pc,	 OP_IDIV, DIS_EADDR8); /* ?? */
 
                                 
 
                                 //	| HLT() =>
 
-                                //		stmts = instantiate(pc,	 "HLT");
+                                //		stmts = instantiate(pc,	 OP_HLT);
 
                                 
 
@@ -35766,7 +35758,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 387 "frontend/machine/pentium/decoder.m"
                                   
 
-                                  		stmts = instantiate(pc,	 "TEST.Ed.Id", DIS_EADDR32, DIS_I32);
+                                  		stmts = instantiate(pc,	 OP_TEST_Ed_Id, DIS_EADDR32, DIS_I32);
 
                                   
 
@@ -35851,7 +35843,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 910 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "NOTod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_NOTod, DIS_EADDR32);
 
                                 
 
@@ -35920,7 +35912,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 919 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "NEGod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_NEGod, DIS_EADDR32);
 
                                 
 
@@ -35989,7 +35981,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 928 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "MUL.AXod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_MUL_AXod, DIS_EADDR32);
 
                                 
 
@@ -36058,7 +36050,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1172 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "IMULod", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_IMULod, DIS_EADDR32);
 
                                 
 
@@ -36127,7 +36119,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1196 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "DIVeAX", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_DIVeAX, DIS_EADDR32);
 
                                 
 
@@ -36196,7 +36188,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1181 "frontend/machine/pentium/decoder.m"
                                 
 
-                                		stmts = instantiate(pc,	 "IDIVeAX", DIS_EADDR32);
+                                		stmts = instantiate(pc,	 OP_IDIVeAX, DIS_EADDR32);
 
                                 
 
@@ -36246,7 +36238,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1546 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ADDmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -36265,7 +36257,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1546 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ADDmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -36284,7 +36276,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1546 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ADDmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -36303,7 +36295,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1546 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ADDmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -36322,7 +36314,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1519 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ADDmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -36341,7 +36333,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1519 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ADDmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -36360,7 +36352,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1519 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ADDmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -36379,7 +36371,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1519 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ADDmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -36398,7 +36390,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1474 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ADDrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -36417,7 +36409,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1474 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ADDrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -36436,7 +36428,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1474 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ADDrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -36455,7 +36447,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1474 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ADDrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -36474,7 +36466,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1447 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ADDrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -36493,7 +36485,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1447 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ADDrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -36512,7 +36504,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1447 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ADDrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -36531,7 +36523,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1447 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ADDrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -36550,7 +36542,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1540 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ADCmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -36569,7 +36561,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1540 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ADCmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -36588,7 +36580,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1540 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ADCmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -36607,7 +36599,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1540 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ADCmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -36626,7 +36618,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1507 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ADCmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -36645,7 +36637,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1507 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ADCmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -36664,7 +36656,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1507 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ADCmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -36683,7 +36675,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1507 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ADCmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -36702,7 +36694,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1468 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ADCrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -36721,7 +36713,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1468 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ADCrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -36740,7 +36732,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1468 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ADCrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -36759,7 +36751,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1468 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ADCrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -36778,7 +36770,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1435 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ADCrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -36797,7 +36789,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1435 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ADCrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -36816,7 +36808,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1435 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ADCrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -36835,7 +36827,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1435 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ADCrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -36854,7 +36846,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1534 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ANDmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -36873,7 +36865,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1534 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ANDmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -36892,7 +36884,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1534 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ANDmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -36911,7 +36903,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1534 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ANDmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -36930,7 +36922,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1495 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ANDmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -36949,7 +36941,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1495 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ANDmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -36968,7 +36960,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1495 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ANDmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -36987,7 +36979,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1495 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ANDmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -37006,7 +36998,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1462 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ANDrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -37025,7 +37017,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1462 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ANDrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -37044,7 +37036,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1462 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ANDrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -37063,7 +37055,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1462 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ANDrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -37082,7 +37074,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1423 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ANDrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -37101,7 +37093,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1423 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ANDrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -37120,7 +37112,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1423 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ANDrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -37139,7 +37131,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1423 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ANDrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -37158,7 +37150,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1528 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_XORmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -37177,7 +37169,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1528 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_XORmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -37196,7 +37188,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1528 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_XORmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -37215,7 +37207,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1528 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_XORmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -37234,7 +37226,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1483 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_XORmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -37253,7 +37245,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1483 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_XORmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -37272,7 +37264,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1483 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_XORmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -37291,7 +37283,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1483 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_XORmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -37310,7 +37302,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1456 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_XORrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -37329,7 +37321,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1456 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_XORrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -37348,7 +37340,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1456 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_XORrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -37367,7 +37359,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1456 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_XORrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -37386,7 +37378,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1411 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_XORrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -37405,7 +37397,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1411 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_XORrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -37424,7 +37416,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1411 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_XORrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -37443,7 +37435,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1411 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_XORrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -37482,7 +37474,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1522 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ADDmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -37501,7 +37493,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1522 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ADDmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -37520,7 +37512,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1522 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ADDmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -37539,7 +37531,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1522 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ADDmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -37558,7 +37550,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1516 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ORmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -37577,7 +37569,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1516 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ORmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -37596,7 +37588,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1516 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ORmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -37615,7 +37607,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1516 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ORmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -37634,7 +37626,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1450 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ADDrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37653,7 +37645,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1450 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ADDrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37672,7 +37664,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1450 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ADDrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37691,7 +37683,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1450 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ADDrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37710,7 +37702,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1444 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ORrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37729,7 +37721,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1444 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ORrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37748,7 +37740,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1444 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ORrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37767,7 +37759,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1444 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ORrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37786,7 +37778,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1085 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LAR.ow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_LAR_ow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37805,7 +37797,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1085 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LAR.ow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_LAR_ow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37824,7 +37816,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1085 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LAR.ow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_LAR_ow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37843,7 +37835,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1085 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LAR.ow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_LAR_ow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37862,7 +37854,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1049 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LSLow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_LSLow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37881,7 +37873,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1049 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LSLow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_LSLow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37900,7 +37892,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1049 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LSLow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_LSLow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37919,7 +37911,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1049 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LSLow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_LSLow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -37938,7 +37930,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1355 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -37957,7 +37949,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1355 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -37976,7 +37968,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1355 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -37995,7 +37987,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1355 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38014,7 +38006,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1319 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTSow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38033,7 +38025,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1319 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTSow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38052,7 +38044,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1319 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTSow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38071,7 +38063,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1319 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTSow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38091,7 +38083,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 447 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.Ibow", DIS_EADDR16, DIS_REG16, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHLD_Ibow, DIS_EADDR16, DIS_REG16, DIS_COUNT);
 
       
 
@@ -38111,7 +38103,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 447 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.Ibow", DIS_EADDR16, DIS_REG16, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHLD_Ibow, DIS_EADDR16, DIS_REG16, DIS_COUNT);
 
       
 
@@ -38131,7 +38123,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 447 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.Ibow", DIS_EADDR16, DIS_REG16, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHLD_Ibow, DIS_EADDR16, DIS_REG16, DIS_COUNT);
 
       
 
@@ -38151,7 +38143,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 447 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.Ibow", DIS_EADDR16, DIS_REG16, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHLD_Ibow, DIS_EADDR16, DIS_REG16, DIS_COUNT);
 
       
 
@@ -38171,7 +38163,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 453 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.Ibow", DIS_EADDR16, DIS_REG16, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHRD_Ibow, DIS_EADDR16, DIS_REG16, DIS_COUNT);
 
       
 
@@ -38191,7 +38183,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 453 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.Ibow", DIS_EADDR16, DIS_REG16, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHRD_Ibow, DIS_EADDR16, DIS_REG16, DIS_COUNT);
 
       
 
@@ -38211,7 +38203,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 453 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.Ibow", DIS_EADDR16, DIS_REG16, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHRD_Ibow, DIS_EADDR16, DIS_REG16, DIS_COUNT);
 
       
 
@@ -38231,7 +38223,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 453 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.Ibow", DIS_EADDR16, DIS_REG16, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHRD_Ibow, DIS_EADDR16, DIS_REG16, DIS_COUNT);
 
       
 
@@ -38250,7 +38242,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 435 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.CLow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SHLD_CLow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38269,7 +38261,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 435 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.CLow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SHLD_CLow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38288,7 +38280,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 435 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.CLow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SHLD_CLow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38307,7 +38299,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 435 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.CLow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SHLD_CLow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38326,7 +38318,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 441 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.CLow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SHRD_CLow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38345,7 +38337,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 441 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.CLow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SHRD_CLow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38364,7 +38356,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 441 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.CLow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SHRD_CLow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38383,7 +38375,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 441 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.CLow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SHRD_CLow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38402,7 +38394,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1169 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_IMULrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -38421,7 +38413,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1169 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_IMULrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -38440,7 +38432,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1169 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_IMULrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -38459,7 +38451,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1169 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_IMULrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -38478,7 +38470,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1241 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_CMPXCHG_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38497,7 +38489,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1241 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_CMPXCHG_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38516,7 +38508,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1241 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_CMPXCHG_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38535,7 +38527,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1241 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_CMPXCHG_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38555,7 +38547,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1349 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTiow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTiow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -38575,7 +38567,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1349 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTiow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTiow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -38595,7 +38587,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1349 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTiow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTiow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -38615,7 +38607,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1349 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTiow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTiow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -38635,7 +38627,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1313 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSiow", DIS_I8, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_BTSiow, DIS_I8, DIS_EADDR16);
 
       
 
@@ -38655,7 +38647,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1313 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSiow", DIS_I8, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_BTSiow, DIS_I8, DIS_EADDR16);
 
       
 
@@ -38675,7 +38667,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1313 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSiow", DIS_I8, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_BTSiow, DIS_I8, DIS_EADDR16);
 
       
 
@@ -38695,7 +38687,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1313 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSiow", DIS_I8, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_BTSiow, DIS_I8, DIS_EADDR16);
 
       
 
@@ -38715,7 +38707,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1325 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRiow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTRiow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -38735,7 +38727,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1325 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRiow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTRiow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -38755,7 +38747,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1325 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRiow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTRiow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -38775,7 +38767,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1325 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRiow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTRiow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -38795,7 +38787,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1337 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCiow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTCiow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -38815,7 +38807,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1337 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCiow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTCiow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -38835,7 +38827,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1337 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCiow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTCiow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -38855,7 +38847,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1337 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCiow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTCiow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -38874,7 +38866,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1331 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTRow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38893,7 +38885,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1331 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTRow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38912,7 +38904,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1331 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTRow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38931,7 +38923,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1331 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTRow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38950,7 +38942,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1343 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTCow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38969,7 +38961,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1343 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTCow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -38988,7 +38980,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1343 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTCow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39007,7 +38999,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1343 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_BTCow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39026,7 +39018,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1377 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSFow", DIS_REG16, DIS_EADDR16);
+      		//stmts = instantiate(pc,  OP_BSFow, DIS_REG16, DIS_EADDR16);
 
       		genBSFR(pc, DIS_REG16, DIS_EADDR16, -1, 16, opPlus, nextPC-hostPC);
 
@@ -39038,13 +39030,13 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       //	| BOUNDod(reg, Mem) =>
 
-      //		stmts = instantiate(pc,	 "BOUNDod", DIS_REG32, DIS_MEM);
+      //		stmts = instantiate(pc,	 OP_BOUNDod, DIS_REG32, DIS_MEM);
 
       
 
       //	| BOUNDow(reg, Mem) =>
 
-      //		stmts = instantiate(pc,	 "BOUNDow", DIS_REG16, DIS_MEM);
+      //		stmts = instantiate(pc,	 OP_BOUNDow, DIS_REG16, DIS_MEM);
 
       
 
@@ -39052,31 +39044,31 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       //		  unused(Eaddr); unused(reg);
 
-      //		  stmts = instantiate(pc,  "UNIMP");
+      //		  stmts = instantiate(pc,  OP_UNIMP);
 
       
 
       //	  | AAS() =>
 
-      //		  stmts = instantiate(pc,  "AAS");
+      //		  stmts = instantiate(pc,  OP_AAS);
 
       
 
       //	  | AAM() =>
 
-      //		  stmts = instantiate(pc,  "AAM");
+      //		  stmts = instantiate(pc,  OP_AAM);
 
       
 
       //	  | AAD() =>
 
-      //		  stmts = instantiate(pc,  "AAD");
+      //		  stmts = instantiate(pc,  OP_AAD);
 
       
 
       //	  | AAA() =>
 
-      //		  stmts = instantiate(pc,  "AAA");
+      //		  stmts = instantiate(pc,  OP_AAA);
 
       
 
@@ -39095,7 +39087,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1377 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSFow", DIS_REG16, DIS_EADDR16);
+      		//stmts = instantiate(pc,  OP_BSFow, DIS_REG16, DIS_EADDR16);
 
       		genBSFR(pc, DIS_REG16, DIS_EADDR16, -1, 16, opPlus, nextPC-hostPC);
 
@@ -39107,13 +39099,13 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       //	| BOUNDod(reg, Mem) =>
 
-      //		stmts = instantiate(pc,	 "BOUNDod", DIS_REG32, DIS_MEM);
+      //		stmts = instantiate(pc,	 OP_BOUNDod, DIS_REG32, DIS_MEM);
 
       
 
       //	| BOUNDow(reg, Mem) =>
 
-      //		stmts = instantiate(pc,	 "BOUNDow", DIS_REG16, DIS_MEM);
+      //		stmts = instantiate(pc,	 OP_BOUNDow, DIS_REG16, DIS_MEM);
 
       
 
@@ -39121,31 +39113,31 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       //		  unused(Eaddr); unused(reg);
 
-      //		  stmts = instantiate(pc,  "UNIMP");
+      //		  stmts = instantiate(pc,  OP_UNIMP);
 
       
 
       //	  | AAS() =>
 
-      //		  stmts = instantiate(pc,  "AAS");
+      //		  stmts = instantiate(pc,  OP_AAS);
 
       
 
       //	  | AAM() =>
 
-      //		  stmts = instantiate(pc,  "AAM");
+      //		  stmts = instantiate(pc,  OP_AAM);
 
       
 
       //	  | AAD() =>
 
-      //		  stmts = instantiate(pc,  "AAD");
+      //		  stmts = instantiate(pc,  OP_AAD);
 
       
 
       //	  | AAA() =>
 
-      //		  stmts = instantiate(pc,  "AAA");
+      //		  stmts = instantiate(pc,  OP_AAA);
 
       
 
@@ -39164,7 +39156,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1377 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSFow", DIS_REG16, DIS_EADDR16);
+      		//stmts = instantiate(pc,  OP_BSFow, DIS_REG16, DIS_EADDR16);
 
       		genBSFR(pc, DIS_REG16, DIS_EADDR16, -1, 16, opPlus, nextPC-hostPC);
 
@@ -39176,13 +39168,13 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       //	| BOUNDod(reg, Mem) =>
 
-      //		stmts = instantiate(pc,	 "BOUNDod", DIS_REG32, DIS_MEM);
+      //		stmts = instantiate(pc,	 OP_BOUNDod, DIS_REG32, DIS_MEM);
 
       
 
       //	| BOUNDow(reg, Mem) =>
 
-      //		stmts = instantiate(pc,	 "BOUNDow", DIS_REG16, DIS_MEM);
+      //		stmts = instantiate(pc,	 OP_BOUNDow, DIS_REG16, DIS_MEM);
 
       
 
@@ -39190,31 +39182,31 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       //		  unused(Eaddr); unused(reg);
 
-      //		  stmts = instantiate(pc,  "UNIMP");
+      //		  stmts = instantiate(pc,  OP_UNIMP);
 
       
 
       //	  | AAS() =>
 
-      //		  stmts = instantiate(pc,  "AAS");
+      //		  stmts = instantiate(pc,  OP_AAS);
 
       
 
       //	  | AAM() =>
 
-      //		  stmts = instantiate(pc,  "AAM");
+      //		  stmts = instantiate(pc,  OP_AAM);
 
       
 
       //	  | AAD() =>
 
-      //		  stmts = instantiate(pc,  "AAD");
+      //		  stmts = instantiate(pc,  OP_AAD);
 
       
 
       //	  | AAA() =>
 
-      //		  stmts = instantiate(pc,  "AAA");
+      //		  stmts = instantiate(pc,  OP_AAA);
 
       
 
@@ -39233,7 +39225,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1377 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSFow", DIS_REG16, DIS_EADDR16);
+      		//stmts = instantiate(pc,  OP_BSFow, DIS_REG16, DIS_EADDR16);
 
       		genBSFR(pc, DIS_REG16, DIS_EADDR16, -1, 16, opPlus, nextPC-hostPC);
 
@@ -39245,13 +39237,13 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       //	| BOUNDod(reg, Mem) =>
 
-      //		stmts = instantiate(pc,	 "BOUNDod", DIS_REG32, DIS_MEM);
+      //		stmts = instantiate(pc,	 OP_BOUNDod, DIS_REG32, DIS_MEM);
 
       
 
       //	| BOUNDow(reg, Mem) =>
 
-      //		stmts = instantiate(pc,	 "BOUNDow", DIS_REG16, DIS_MEM);
+      //		stmts = instantiate(pc,	 OP_BOUNDow, DIS_REG16, DIS_MEM);
 
       
 
@@ -39259,31 +39251,31 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       //		  unused(Eaddr); unused(reg);
 
-      //		  stmts = instantiate(pc,  "UNIMP");
+      //		  stmts = instantiate(pc,  OP_UNIMP);
 
       
 
       //	  | AAS() =>
 
-      //		  stmts = instantiate(pc,  "AAS");
+      //		  stmts = instantiate(pc,  OP_AAS);
 
       
 
       //	  | AAM() =>
 
-      //		  stmts = instantiate(pc,  "AAM");
+      //		  stmts = instantiate(pc,  OP_AAM);
 
       
 
       //	  | AAD() =>
 
-      //		  stmts = instantiate(pc,  "AAD");
+      //		  stmts = instantiate(pc,  OP_AAD);
 
       
 
       //	  | AAA() =>
 
-      //		  stmts = instantiate(pc,  "AAA");
+      //		  stmts = instantiate(pc,  OP_AAA);
 
       
 
@@ -39302,7 +39294,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1367 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSRow", DIS_REG16, DIS_EADDR16);
+      		//stmts = instantiate(pc,  OP_BSRow, DIS_REG16, DIS_EADDR16);
 
       		genBSFR(pc, DIS_REG16, DIS_EADDR16, 16, 16, opMinus, nextPC-hostPC);
 
@@ -39325,7 +39317,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1367 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSRow", DIS_REG16, DIS_EADDR16);
+      		//stmts = instantiate(pc,  OP_BSRow, DIS_REG16, DIS_EADDR16);
 
       		genBSFR(pc, DIS_REG16, DIS_EADDR16, 16, 16, opMinus, nextPC-hostPC);
 
@@ -39348,7 +39340,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1367 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSRow", DIS_REG16, DIS_EADDR16);
+      		//stmts = instantiate(pc,  OP_BSRow, DIS_REG16, DIS_EADDR16);
 
       		genBSFR(pc, DIS_REG16, DIS_EADDR16, 16, 16, opMinus, nextPC-hostPC);
 
@@ -39371,7 +39363,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1367 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSRow", DIS_REG16, DIS_EADDR16);
+      		//stmts = instantiate(pc,  OP_BSRow, DIS_REG16, DIS_EADDR16);
 
       		genBSFR(pc, DIS_REG16, DIS_EADDR16, 16, 16, opMinus, nextPC-hostPC);
 
@@ -39394,7 +39386,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 943 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ebow", DIS_R16, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebow, DIS_R16, DIS_EADDR8);
 
       
 
@@ -39413,7 +39405,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 943 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ebow", DIS_R16, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebow, DIS_R16, DIS_EADDR8);
 
       
 
@@ -39432,7 +39424,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 943 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ebow", DIS_R16, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebow, DIS_R16, DIS_EADDR8);
 
       
 
@@ -39451,7 +39443,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 943 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ebow", DIS_R16, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebow, DIS_R16, DIS_EADDR8);
 
       
 
@@ -39470,7 +39462,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 952 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ebow", DIS_R16, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebow, DIS_R16, DIS_EADDR8);
 
       
 
@@ -39489,7 +39481,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 952 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ebow", DIS_R16, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebow, DIS_R16, DIS_EADDR8);
 
       
 
@@ -39508,7 +39500,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 952 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ebow", DIS_R16, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebow, DIS_R16, DIS_EADDR8);
 
       
 
@@ -39527,7 +39519,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 952 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ebow", DIS_R16, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebow, DIS_R16, DIS_EADDR8);
 
       
 
@@ -39546,7 +39538,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 357 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XADD.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_XADD_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39565,7 +39557,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 357 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XADD.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_XADD_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39584,7 +39576,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 357 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XADD.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_XADD_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39603,7 +39595,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 357 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XADD.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_XADD_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39622,7 +39614,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1510 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ADCmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39641,7 +39633,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1510 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ADCmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39660,7 +39652,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1510 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ADCmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39679,7 +39671,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1510 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ADCmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39698,7 +39690,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1504 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SBBmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39717,7 +39709,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1504 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SBBmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39736,7 +39728,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1504 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SBBmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39755,7 +39747,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1504 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SBBmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39774,7 +39766,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1438 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ADCrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -39793,7 +39785,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1438 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ADCrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -39812,7 +39804,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1438 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ADCrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -39831,7 +39823,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1438 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ADCrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -39850,7 +39842,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1432 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SBBrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -39869,7 +39861,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1432 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SBBrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -39888,7 +39880,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1432 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SBBrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -39907,7 +39899,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1432 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SBBrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -39926,7 +39918,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1498 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ANDmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39945,7 +39937,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1498 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ANDmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39964,7 +39956,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1498 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ANDmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -39983,7 +39975,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1498 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_ANDmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -40002,7 +39994,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1492 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SUBmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -40021,7 +40013,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1492 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SUBmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -40040,7 +40032,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1492 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SUBmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -40059,7 +40051,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1492 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_SUBmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -40078,7 +40070,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1426 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ANDrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40097,7 +40089,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1426 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ANDrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40116,7 +40108,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1426 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ANDrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40135,7 +40127,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1426 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ANDrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40154,7 +40146,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1420 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SUBrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40173,7 +40165,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1420 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SUBrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40192,7 +40184,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1420 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SUBrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40211,7 +40203,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1420 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SUBrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40230,7 +40222,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1486 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_XORmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -40249,7 +40241,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1486 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_XORmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -40268,7 +40260,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1486 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_XORmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -40287,7 +40279,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1486 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_XORmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -40306,7 +40298,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1480 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_CMPmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -40325,7 +40317,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1480 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_CMPmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -40344,7 +40336,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1480 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_CMPmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -40363,7 +40355,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1480 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_CMPmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -40382,7 +40374,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1414 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_XORrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40401,7 +40393,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1414 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_XORrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40420,7 +40412,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1414 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_XORrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40439,7 +40431,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1414 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_XORrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40458,7 +40450,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1408 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_CMPrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40477,7 +40469,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1408 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_CMPrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40496,7 +40488,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1408 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_CMPrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40515,7 +40507,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1408 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_CMPrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -40536,7 +40528,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1157 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ivw", DIS_REG16, DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_IMUL_Ivw, DIS_REG16, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40557,7 +40549,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1157 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ivw", DIS_REG16, DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_IMUL_Ivw, DIS_REG16, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40578,7 +40570,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1157 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ivw", DIS_REG16, DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_IMUL_Ivw, DIS_REG16, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40599,7 +40591,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1157 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ivw", DIS_REG16, DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_IMUL_Ivw, DIS_REG16, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40620,7 +40612,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1163 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ibow", DIS_REG16, DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_IMUL_Ibow, DIS_REG16, DIS_EADDR16, DIS_I8);
 
       
 
@@ -40641,7 +40633,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1163 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ibow", DIS_REG16, DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_IMUL_Ibow, DIS_REG16, DIS_EADDR16, DIS_I8);
 
       
 
@@ -40662,7 +40654,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1163 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ibow", DIS_REG16, DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_IMUL_Ibow, DIS_REG16, DIS_EADDR16, DIS_I8);
 
       
 
@@ -40683,7 +40675,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1163 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ibow", DIS_REG16, DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_IMUL_Ibow, DIS_REG16, DIS_EADDR16, DIS_I8);
 
       
 
@@ -40703,7 +40695,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1645 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ADDiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40723,7 +40715,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1645 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ADDiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40743,7 +40735,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1645 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ADDiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40763,7 +40755,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1645 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ADDiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40783,7 +40775,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1642 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ORiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40803,7 +40795,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1642 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ORiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40823,7 +40815,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1642 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ORiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40843,7 +40835,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1642 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ORiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40863,7 +40855,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1639 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ADCiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40883,7 +40875,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1639 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ADCiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40903,7 +40895,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1639 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ADCiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40923,7 +40915,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1639 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ADCiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40943,7 +40935,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1636 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_SBBiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40963,7 +40955,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1636 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_SBBiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -40983,7 +40975,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1636 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_SBBiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41003,7 +40995,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1636 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_SBBiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41023,7 +41015,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1633 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ANDiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41043,7 +41035,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1633 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ANDiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41063,7 +41055,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1633 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ANDiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41083,7 +41075,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1633 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_ANDiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41103,7 +41095,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1630 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_SUBiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41123,7 +41115,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1630 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_SUBiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41143,7 +41135,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1630 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_SUBiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41163,7 +41155,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1630 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_SUBiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41183,7 +41175,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1627 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_XORiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41203,7 +41195,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1627 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_XORiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41223,7 +41215,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1627 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_XORiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41243,7 +41235,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1627 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_XORiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41263,7 +41255,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1624 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_CMPiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41283,7 +41275,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1624 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_CMPiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41303,7 +41295,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1624 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_CMPiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41323,7 +41315,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1624 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPiw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_CMPiw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -41342,7 +41334,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1034 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_MOVmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -41361,7 +41353,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1034 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_MOVmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -41380,7 +41372,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1034 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_MOVmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -41399,7 +41391,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1034 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVmrow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_MOVmrow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -41419,7 +41411,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1597 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADDiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41439,7 +41431,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1597 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADDiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41459,7 +41451,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1597 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADDiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41479,7 +41471,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1597 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADDiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41499,7 +41491,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1591 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ORiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41519,7 +41511,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1591 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ORiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41539,7 +41531,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1591 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ORiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41559,7 +41551,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1591 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ORiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41579,7 +41571,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1585 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADCiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41599,7 +41591,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1585 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADCiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41619,7 +41611,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1585 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADCiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41639,7 +41631,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1585 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADCiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41659,7 +41651,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1579 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SBBiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41679,7 +41671,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1579 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SBBiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41699,7 +41691,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1579 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SBBiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41719,7 +41711,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1579 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SBBiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41739,7 +41731,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1573 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ANDiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41759,7 +41751,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1573 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ANDiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41779,7 +41771,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1573 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ANDiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41799,7 +41791,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1573 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ANDiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41819,7 +41811,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1564 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SUBiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41839,7 +41831,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1564 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SUBiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41859,7 +41851,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1564 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SUBiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41879,7 +41871,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1564 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SUBiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41899,7 +41891,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1558 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_XORiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41919,7 +41911,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1558 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_XORiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41939,7 +41931,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1558 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_XORiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41959,7 +41951,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1558 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_XORiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41979,7 +41971,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1552 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_CMPiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -41999,7 +41991,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1552 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_CMPiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42019,7 +42011,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1552 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_CMPiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42039,7 +42031,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1552 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPiowb", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_CMPiowb, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42058,7 +42050,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1025 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MOVrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -42077,7 +42069,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1025 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MOVrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -42096,7 +42088,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1025 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MOVrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -42115,7 +42107,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1025 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVrmow", DIS_REG16, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MOVrmow, DIS_REG16, DIS_EADDR16);
 
       
 
@@ -42134,7 +42126,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 381 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_TEST_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -42153,7 +42145,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 381 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_TEST_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -42172,7 +42164,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 381 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_TEST_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -42191,7 +42183,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 381 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_TEST_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -42210,7 +42202,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1076 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LEA.ow", DIS_REG16, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LEA_ow, DIS_REG16, DIS_MEM);
 
       
 
@@ -42229,7 +42221,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1076 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LEA.ow", DIS_REG16, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LEA_ow, DIS_REG16, DIS_MEM);
 
       
 
@@ -42248,7 +42240,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1076 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LEA.ow", DIS_REG16, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LEA_ow, DIS_REG16, DIS_MEM);
 
       
 
@@ -42267,7 +42259,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 321 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XCHG.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_XCHG_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -42286,7 +42278,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 321 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XCHG.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_XCHG_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -42305,7 +42297,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 321 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XCHG.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_XCHG_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -42324,7 +42316,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 321 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XCHG.Ev.Gvow", DIS_EADDR16, DIS_REG16);
+      		stmts = instantiate(pc,	 OP_XCHG_Ev_Gvow, DIS_EADDR16, DIS_REG16);
 
       
 
@@ -42342,61 +42334,61 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 880 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "POP.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_POP_Evow, DIS_EADDR16);
 
       
 
       //	  | OUTSvod() =>
 
-      //		  stmts = instantiate(pc,  "OUTSvod");
+      //		  stmts = instantiate(pc,  OP_OUTSvod);
 
       
 
       //	  | OUTSvow() =>
 
-      //		  stmts = instantiate(pc,  "OUTSvow");
+      //		  stmts = instantiate(pc,  OP_OUTSvow);
 
       
 
       //	  | OUTSB() =>
 
-      //		  stmts = instantiate(pc,  "OUTSB");
+      //		  stmts = instantiate(pc,  OP_OUTSB);
 
       
 
       //	  | OUT.DX.eAXod() =>
 
-      //		  stmts = instantiate(pc,  "OUT.DX.eAXod");
+      //		  stmts = instantiate(pc,  OP_OUT_DX_eAXod);
 
       
 
       //	  | OUT.DX.eAXow() =>
 
-      //		  stmts = instantiate(pc,  "OUT.DX.eAXow");
+      //		  stmts = instantiate(pc,  OP_OUT_DX_eAXow);
 
       
 
       //	  | OUT.DX.AL() =>
 
-      //		  stmts = instantiate(pc,  "OUT.DX.AL");
+      //		  stmts = instantiate(pc,  OP_OUT_DX_AL);
 
       
 
       //	  | OUT.Ib.eAXod(i8) =>
 
-      //		  stmts = instantiate(pc,  "OUT.Ib.eAXod", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_OUT_Ib_eAXod, DIS_I8);
 
       
 
       //	  | OUT.Ib.eAXow(i8) =>
 
-      //		  stmts = instantiate(pc,  "OUT.Ib.eAXow", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_OUT_Ib_eAXow, DIS_I8);
 
       
 
       //	  | OUT.Ib.AL(i8) =>
 
-      //		  stmts = instantiate(pc,  "OUT.Ib.AL", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_OUT_Ib_AL, DIS_I8);
 
       
 
@@ -42414,61 +42406,61 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 880 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "POP.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_POP_Evow, DIS_EADDR16);
 
       
 
       //	  | OUTSvod() =>
 
-      //		  stmts = instantiate(pc,  "OUTSvod");
+      //		  stmts = instantiate(pc,  OP_OUTSvod);
 
       
 
       //	  | OUTSvow() =>
 
-      //		  stmts = instantiate(pc,  "OUTSvow");
+      //		  stmts = instantiate(pc,  OP_OUTSvow);
 
       
 
       //	  | OUTSB() =>
 
-      //		  stmts = instantiate(pc,  "OUTSB");
+      //		  stmts = instantiate(pc,  OP_OUTSB);
 
       
 
       //	  | OUT.DX.eAXod() =>
 
-      //		  stmts = instantiate(pc,  "OUT.DX.eAXod");
+      //		  stmts = instantiate(pc,  OP_OUT_DX_eAXod);
 
       
 
       //	  | OUT.DX.eAXow() =>
 
-      //		  stmts = instantiate(pc,  "OUT.DX.eAXow");
+      //		  stmts = instantiate(pc,  OP_OUT_DX_eAXow);
 
       
 
       //	  | OUT.DX.AL() =>
 
-      //		  stmts = instantiate(pc,  "OUT.DX.AL");
+      //		  stmts = instantiate(pc,  OP_OUT_DX_AL);
 
       
 
       //	  | OUT.Ib.eAXod(i8) =>
 
-      //		  stmts = instantiate(pc,  "OUT.Ib.eAXod", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_OUT_Ib_eAXod, DIS_I8);
 
       
 
       //	  | OUT.Ib.eAXow(i8) =>
 
-      //		  stmts = instantiate(pc,  "OUT.Ib.eAXow", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_OUT_Ib_eAXow, DIS_I8);
 
       
 
       //	  | OUT.Ib.AL(i8) =>
 
-      //		  stmts = instantiate(pc,  "OUT.Ib.AL", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_OUT_Ib_AL, DIS_I8);
 
       
 
@@ -42486,61 +42478,61 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 880 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "POP.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_POP_Evow, DIS_EADDR16);
 
       
 
       //	  | OUTSvod() =>
 
-      //		  stmts = instantiate(pc,  "OUTSvod");
+      //		  stmts = instantiate(pc,  OP_OUTSvod);
 
       
 
       //	  | OUTSvow() =>
 
-      //		  stmts = instantiate(pc,  "OUTSvow");
+      //		  stmts = instantiate(pc,  OP_OUTSvow);
 
       
 
       //	  | OUTSB() =>
 
-      //		  stmts = instantiate(pc,  "OUTSB");
+      //		  stmts = instantiate(pc,  OP_OUTSB);
 
       
 
       //	  | OUT.DX.eAXod() =>
 
-      //		  stmts = instantiate(pc,  "OUT.DX.eAXod");
+      //		  stmts = instantiate(pc,  OP_OUT_DX_eAXod);
 
       
 
       //	  | OUT.DX.eAXow() =>
 
-      //		  stmts = instantiate(pc,  "OUT.DX.eAXow");
+      //		  stmts = instantiate(pc,  OP_OUT_DX_eAXow);
 
       
 
       //	  | OUT.DX.AL() =>
 
-      //		  stmts = instantiate(pc,  "OUT.DX.AL");
+      //		  stmts = instantiate(pc,  OP_OUT_DX_AL);
 
       
 
       //	  | OUT.Ib.eAXod(i8) =>
 
-      //		  stmts = instantiate(pc,  "OUT.Ib.eAXod", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_OUT_Ib_eAXod, DIS_I8);
 
       
 
       //	  | OUT.Ib.eAXow(i8) =>
 
-      //		  stmts = instantiate(pc,  "OUT.Ib.eAXow", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_OUT_Ib_eAXow, DIS_I8);
 
       
 
       //	  | OUT.Ib.AL(i8) =>
 
-      //		  stmts = instantiate(pc,  "OUT.Ib.AL", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_OUT_Ib_AL, DIS_I8);
 
       
 
@@ -42558,61 +42550,61 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 880 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "POP.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_POP_Evow, DIS_EADDR16);
 
       
 
       //	  | OUTSvod() =>
 
-      //		  stmts = instantiate(pc,  "OUTSvod");
+      //		  stmts = instantiate(pc,  OP_OUTSvod);
 
       
 
       //	  | OUTSvow() =>
 
-      //		  stmts = instantiate(pc,  "OUTSvow");
+      //		  stmts = instantiate(pc,  OP_OUTSvow);
 
       
 
       //	  | OUTSB() =>
 
-      //		  stmts = instantiate(pc,  "OUTSB");
+      //		  stmts = instantiate(pc,  OP_OUTSB);
 
       
 
       //	  | OUT.DX.eAXod() =>
 
-      //		  stmts = instantiate(pc,  "OUT.DX.eAXod");
+      //		  stmts = instantiate(pc,  OP_OUT_DX_eAXod);
 
       
 
       //	  | OUT.DX.eAXow() =>
 
-      //		  stmts = instantiate(pc,  "OUT.DX.eAXow");
+      //		  stmts = instantiate(pc,  OP_OUT_DX_eAXow);
 
       
 
       //	  | OUT.DX.AL() =>
 
-      //		  stmts = instantiate(pc,  "OUT.DX.AL");
+      //		  stmts = instantiate(pc,  OP_OUT_DX_AL);
 
       
 
       //	  | OUT.Ib.eAXod(i8) =>
 
-      //		  stmts = instantiate(pc,  "OUT.Ib.eAXod", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_OUT_Ib_eAXod, DIS_I8);
 
       
 
       //	  | OUT.Ib.eAXow(i8) =>
 
-      //		  stmts = instantiate(pc,  "OUT.Ib.eAXow", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_OUT_Ib_eAXow, DIS_I8);
 
       
 
       //	  | OUT.Ib.AL(i8) =>
 
-      //		  stmts = instantiate(pc,  "OUT.Ib.AL", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_OUT_Ib_AL, DIS_I8);
 
       
 
@@ -42632,7 +42624,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 638 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42652,7 +42644,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 638 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42672,7 +42664,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 638 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42692,7 +42684,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 638 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42712,7 +42704,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 632 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42732,7 +42724,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 632 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42752,7 +42744,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 632 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42772,7 +42764,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 632 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42792,7 +42784,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 626 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42812,7 +42804,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 626 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42832,7 +42824,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 626 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42852,7 +42844,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 626 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42872,7 +42864,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 620 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42892,7 +42884,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 620 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42912,7 +42904,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 620 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42932,7 +42924,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 620 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42952,7 +42944,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 614 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42972,7 +42964,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 614 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -42992,7 +42984,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 614 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -43012,7 +43004,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 614 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -43032,7 +43024,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 608 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -43052,7 +43044,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 608 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -43072,7 +43064,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 608 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -43092,7 +43084,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 608 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -43112,7 +43104,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 602 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -43132,7 +43124,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 602 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -43152,7 +43144,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 602 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -43172,7 +43164,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 602 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.Ibow", DIS_EADDR16, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_Ibow, DIS_EADDR16, DIS_I8);
 
       
 
@@ -43192,7 +43184,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 983 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOV.Ew.Ivow", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_MOV_Ew_Ivow, DIS_EADDR16, DIS_I16);
 
       
 
@@ -43212,7 +43204,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 983 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOV.Ew.Ivow", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_MOV_Ew_Ivow, DIS_EADDR16, DIS_I16);
 
       
 
@@ -43232,7 +43224,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 983 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOV.Ew.Ivow", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_MOV_Ew_Ivow, DIS_EADDR16, DIS_I16);
 
       
 
@@ -43252,7 +43244,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 983 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOV.Ew.Ivow", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_MOV_Ew_Ivow, DIS_EADDR16, DIS_I16);
 
       
 
@@ -43270,7 +43262,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 743 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43288,7 +43280,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 743 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43306,7 +43298,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 743 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43324,7 +43316,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 743 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43342,7 +43334,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 731 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORB.Ev.1owR", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ORB_Ev_1owR, DIS_EADDR16);
 
       
 
@@ -43360,7 +43352,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 731 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORB.Ev.1owR", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ORB_Ev_1owR, DIS_EADDR16);
 
       
 
@@ -43378,7 +43370,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 731 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORB.Ev.1owR", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ORB_Ev_1owR, DIS_EADDR16);
 
       
 
@@ -43396,7 +43388,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 731 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORB.Ev.1owR", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ORB_Ev_1owR, DIS_EADDR16);
 
       
 
@@ -43414,7 +43406,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 719 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43432,7 +43424,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 719 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43450,7 +43442,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 719 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43468,7 +43460,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 719 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43486,7 +43478,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 707 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43504,7 +43496,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 707 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43522,7 +43514,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 707 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43540,7 +43532,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 707 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43558,7 +43550,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 695 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43576,7 +43568,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 695 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43594,7 +43586,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 695 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43612,7 +43604,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 695 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43630,7 +43622,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 683 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43648,7 +43640,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 683 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43666,7 +43658,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 683 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43684,7 +43676,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 683 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43702,7 +43694,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 671 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43720,7 +43712,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 671 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43738,7 +43730,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 671 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43756,7 +43748,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 671 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.1ow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_1ow, DIS_EADDR16);
 
       
 
@@ -43774,7 +43766,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 737 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -43792,7 +43784,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 737 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -43810,7 +43802,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 737 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -43828,7 +43820,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 737 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -43846,7 +43838,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 725 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -43864,7 +43856,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 725 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -43882,7 +43874,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 725 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -43900,7 +43892,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 725 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -43918,7 +43910,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 713 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -43936,7 +43928,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 713 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -43954,7 +43946,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 713 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -43972,7 +43964,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 713 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -43990,7 +43982,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 701 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44008,7 +44000,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 701 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44026,7 +44018,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 701 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44044,7 +44036,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 701 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44062,7 +44054,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 689 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44080,7 +44072,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 689 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44098,7 +44090,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 689 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44116,7 +44108,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 689 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44134,7 +44126,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 677 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44152,7 +44144,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 677 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44170,7 +44162,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 677 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44188,7 +44180,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 677 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44206,7 +44198,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 665 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44224,7 +44216,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 665 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44242,7 +44234,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 665 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44260,7 +44252,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 665 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.CLow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_CLow, DIS_EADDR16);
 
       
 
@@ -44279,7 +44271,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 390 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ew.Iw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_TEST_Ew_Iw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -44298,7 +44290,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 390 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ew.Iw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_TEST_Ew_Iw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -44317,7 +44309,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 390 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ew.Iw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_TEST_Ew_Iw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -44336,7 +44328,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 390 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ew.Iw", DIS_EADDR16, DIS_I16);
+      		stmts = instantiate(pc,	 OP_TEST_Ew_Iw, DIS_EADDR16, DIS_I16);
 
       
 
@@ -44354,7 +44346,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 913 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NOTow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_NOTow, DIS_EADDR16);
 
       
 
@@ -44372,7 +44364,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 913 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NOTow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_NOTow, DIS_EADDR16);
 
       
 
@@ -44390,7 +44382,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 913 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NOTow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_NOTow, DIS_EADDR16);
 
       
 
@@ -44408,7 +44400,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 913 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NOTow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_NOTow, DIS_EADDR16);
 
       
 
@@ -44426,7 +44418,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 922 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NEGow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_NEGow, DIS_EADDR16);
 
       
 
@@ -44444,7 +44436,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 922 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NEGow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_NEGow, DIS_EADDR16);
 
       
 
@@ -44462,7 +44454,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 922 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NEGow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_NEGow, DIS_EADDR16);
 
       
 
@@ -44480,7 +44472,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 922 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NEGow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_NEGow, DIS_EADDR16);
 
       
 
@@ -44498,7 +44490,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 931 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MUL.AXow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MUL_AXow, DIS_EADDR16);
 
       
 
@@ -44516,7 +44508,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 931 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MUL.AXow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MUL_AXow, DIS_EADDR16);
 
       
 
@@ -44534,7 +44526,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 931 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MUL.AXow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MUL_AXow, DIS_EADDR16);
 
       
 
@@ -44552,7 +44544,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 931 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MUL.AXow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MUL_AXow, DIS_EADDR16);
 
       
 
@@ -44570,7 +44562,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1175 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_IMULow, DIS_EADDR16);
 
       
 
@@ -44588,7 +44580,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1175 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_IMULow, DIS_EADDR16);
 
       
 
@@ -44606,7 +44598,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1175 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_IMULow, DIS_EADDR16);
 
       
 
@@ -44624,7 +44616,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1175 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_IMULow, DIS_EADDR16);
 
       
 
@@ -44642,7 +44634,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1199 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DIVAX", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_DIVAX, DIS_EADDR16);
 
       
 
@@ -44660,7 +44652,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1199 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DIVAX", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_DIVAX, DIS_EADDR16);
 
       
 
@@ -44678,7 +44670,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1199 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DIVAX", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_DIVAX, DIS_EADDR16);
 
       
 
@@ -44696,7 +44688,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1199 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DIVAX", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_DIVAX, DIS_EADDR16);
 
       
 
@@ -44714,7 +44706,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1184 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IDIVAX", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_IDIVAX, DIS_EADDR16);
 
       
 
@@ -44732,7 +44724,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1184 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IDIVAX", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_IDIVAX, DIS_EADDR16);
 
       
 
@@ -44750,7 +44742,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1184 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IDIVAX", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_IDIVAX, DIS_EADDR16);
 
       
 
@@ -44768,7 +44760,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1184 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IDIVAX", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_IDIVAX, DIS_EADDR16);
 
       
 
@@ -44786,7 +44778,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1130 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INC.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_INC_Evow, DIS_EADDR16);
 
       
 
@@ -44804,7 +44796,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1130 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INC.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_INC_Evow, DIS_EADDR16);
 
       
 
@@ -44822,7 +44814,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1130 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INC.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_INC_Evow, DIS_EADDR16);
 
       
 
@@ -44840,7 +44832,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1130 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INC.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_INC_Evow, DIS_EADDR16);
 
       
 
@@ -44858,7 +44850,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1214 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DEC.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_DEC_Evow, DIS_EADDR16);
 
       
 
@@ -44876,7 +44868,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1214 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DEC.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_DEC_Evow, DIS_EADDR16);
 
       
 
@@ -44894,7 +44886,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1214 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DEC.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_DEC_Evow, DIS_EADDR16);
 
       
 
@@ -44912,7 +44904,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1214 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DEC.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_DEC_Evow, DIS_EADDR16);
 
       
 
@@ -44930,31 +44922,31 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 841 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "PUSH.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_PUSH_Evow, DIS_EADDR16);
 
       
 
       //	  | POPFod() =>
 
-      //		  stmts = instantiate(pc,  "POPFod");
+      //		  stmts = instantiate(pc,  OP_POPFod);
 
       
 
       //	  | POPFow() =>
 
-      //		  stmts = instantiate(pc,  "POPFow");
+      //		  stmts = instantiate(pc,  OP_POPFow);
 
       
 
       //	  | POPAod() =>
 
-      //		  stmts = instantiate(pc,  "POPAod");
+      //		  stmts = instantiate(pc,  OP_POPAod);
 
       
 
       //	  | POPAow() =>
 
-      //		  stmts = instantiate(pc,  "POPAow");
+      //		  stmts = instantiate(pc,  OP_POPAow);
 
       
 
@@ -44972,31 +44964,31 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 841 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "PUSH.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_PUSH_Evow, DIS_EADDR16);
 
       
 
       //	  | POPFod() =>
 
-      //		  stmts = instantiate(pc,  "POPFod");
+      //		  stmts = instantiate(pc,  OP_POPFod);
 
       
 
       //	  | POPFow() =>
 
-      //		  stmts = instantiate(pc,  "POPFow");
+      //		  stmts = instantiate(pc,  OP_POPFow);
 
       
 
       //	  | POPAod() =>
 
-      //		  stmts = instantiate(pc,  "POPAod");
+      //		  stmts = instantiate(pc,  OP_POPAod);
 
       
 
       //	  | POPAow() =>
 
-      //		  stmts = instantiate(pc,  "POPAow");
+      //		  stmts = instantiate(pc,  OP_POPAow);
 
       
 
@@ -45014,31 +45006,31 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 841 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "PUSH.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_PUSH_Evow, DIS_EADDR16);
 
       
 
       //	  | POPFod() =>
 
-      //		  stmts = instantiate(pc,  "POPFod");
+      //		  stmts = instantiate(pc,  OP_POPFod);
 
       
 
       //	  | POPFow() =>
 
-      //		  stmts = instantiate(pc,  "POPFow");
+      //		  stmts = instantiate(pc,  OP_POPFow);
 
       
 
       //	  | POPAod() =>
 
-      //		  stmts = instantiate(pc,  "POPAod");
+      //		  stmts = instantiate(pc,  OP_POPAod);
 
       
 
       //	  | POPAow() =>
 
-      //		  stmts = instantiate(pc,  "POPAow");
+      //		  stmts = instantiate(pc,  OP_POPAow);
 
       
 
@@ -45056,31 +45048,31 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 841 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "PUSH.Evow", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_PUSH_Evow, DIS_EADDR16);
 
       
 
       //	  | POPFod() =>
 
-      //		  stmts = instantiate(pc,  "POPFod");
+      //		  stmts = instantiate(pc,  OP_POPFod);
 
       
 
       //	  | POPFow() =>
 
-      //		  stmts = instantiate(pc,  "POPFow");
+      //		  stmts = instantiate(pc,  OP_POPFow);
 
       
 
       //	  | POPAod() =>
 
-      //		  stmts = instantiate(pc,  "POPAod");
+      //		  stmts = instantiate(pc,  OP_POPAod);
 
       
 
       //	  | POPAow() =>
 
-      //		  stmts = instantiate(pc,  "POPAow");
+      //		  stmts = instantiate(pc,  OP_POPAow);
 
       
 
@@ -45100,7 +45092,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1669 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADDib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45120,7 +45112,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1669 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADDib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45140,7 +45132,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1669 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADDib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45160,7 +45152,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1669 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADDib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45180,7 +45172,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1666 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ORib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45200,7 +45192,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1666 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ORib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45220,7 +45212,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1666 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ORib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45240,7 +45232,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1666 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ORib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45260,7 +45252,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1663 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADCib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45280,7 +45272,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1663 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADCib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45300,7 +45292,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1663 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADCib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45320,7 +45312,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1663 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADCib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45340,7 +45332,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1660 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SBBib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45360,7 +45352,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1660 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SBBib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45380,7 +45372,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1660 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SBBib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45400,7 +45392,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1660 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SBBib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45420,7 +45412,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1657 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ANDib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45440,7 +45432,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1657 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ANDib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45460,7 +45452,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1657 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ANDib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45480,7 +45472,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1657 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ANDib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45500,7 +45492,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1654 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SUBib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45520,7 +45512,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1654 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SUBib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45540,7 +45532,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1654 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SUBib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45560,7 +45552,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1654 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SUBib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45580,7 +45572,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1651 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_XORib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45600,7 +45592,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1651 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_XORib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45620,7 +45612,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1651 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_XORib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45640,7 +45632,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1651 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_XORib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45660,7 +45652,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1648 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_CMPib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45680,7 +45672,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1648 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_CMPib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45700,7 +45692,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1648 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_CMPib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45720,7 +45712,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1648 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_CMPib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -45739,7 +45731,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1621 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ADDid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -45758,7 +45750,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1621 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ADDid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -45777,7 +45769,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1621 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ADDid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -45796,7 +45788,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1621 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ADDid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -45815,7 +45807,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1618 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ORid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -45834,7 +45826,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1618 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ORid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -45853,7 +45845,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1618 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ORid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -45872,7 +45864,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1618 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ORid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -45891,7 +45883,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1615 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ADCid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -45910,7 +45902,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1615 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ADCid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -45929,7 +45921,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1615 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ADCid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -45948,7 +45940,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1615 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ADCid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -45967,7 +45959,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1612 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_SBBid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -45986,7 +45978,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1612 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_SBBid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46005,7 +45997,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1612 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_SBBid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46024,7 +46016,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1612 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_SBBid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46043,7 +46035,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1609 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ANDid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46062,7 +46054,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1609 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ANDid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46081,7 +46073,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1609 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ANDid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46100,7 +46092,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1609 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ANDid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_ANDid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46119,7 +46111,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1606 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_SUBid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46138,7 +46130,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1606 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_SUBid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46157,7 +46149,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1606 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_SUBid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46176,7 +46168,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1606 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_SUBid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46195,7 +46187,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1603 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_XORid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46214,7 +46206,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1603 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_XORid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46233,7 +46225,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1603 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_XORid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46252,7 +46244,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1603 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_XORid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46271,7 +46263,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1600 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_CMPid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46290,7 +46282,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1600 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_CMPid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46309,7 +46301,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1600 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_CMPid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46328,7 +46320,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1600 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPid", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_CMPid, DIS_EADDR32, DIS_I32);
 
       
 
@@ -46348,7 +46340,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1594 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADDiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46368,7 +46360,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1594 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADDiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46388,7 +46380,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1594 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADDiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46408,7 +46400,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1594 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADDiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADDiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46428,7 +46420,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1588 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ORiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46448,7 +46440,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1588 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ORiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46468,7 +46460,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1588 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ORiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46488,7 +46480,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1588 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ORiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46508,7 +46500,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1582 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADCiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46528,7 +46520,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1582 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADCiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46548,7 +46540,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1582 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADCiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46568,7 +46560,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1582 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ADCiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ADCiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46588,7 +46580,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1576 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SBBiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46608,7 +46600,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1576 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SBBiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46628,7 +46620,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1576 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SBBiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46648,7 +46640,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1576 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SBBiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46674,7 +46666,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       		if (i8 != -16 || !(*oper == *Location::regOf(28)))
 
-      			stmts = instantiate(pc,	 "ANDiodb", DIS_EADDR32, DIS_I8);
+      			stmts = instantiate(pc,	 OP_ANDiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46700,7 +46692,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       		if (i8 != -16 || !(*oper == *Location::regOf(28)))
 
-      			stmts = instantiate(pc,	 "ANDiodb", DIS_EADDR32, DIS_I8);
+      			stmts = instantiate(pc,	 OP_ANDiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46726,7 +46718,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       		if (i8 != -16 || !(*oper == *Location::regOf(28)))
 
-      			stmts = instantiate(pc,	 "ANDiodb", DIS_EADDR32, DIS_I8);
+      			stmts = instantiate(pc,	 OP_ANDiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46752,7 +46744,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       		if (i8 != -16 || !(*oper == *Location::regOf(28)))
 
-      			stmts = instantiate(pc,	 "ANDiodb", DIS_EADDR32, DIS_I8);
+      			stmts = instantiate(pc,	 OP_ANDiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46772,7 +46764,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1561 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SUBiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46792,7 +46784,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1561 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SUBiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46812,7 +46804,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1561 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SUBiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46832,7 +46824,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1561 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SUBiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46852,7 +46844,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1555 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_XORiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46872,7 +46864,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1555 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_XORiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46892,7 +46884,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1555 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_XORiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46912,7 +46904,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1555 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XORiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_XORiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46932,7 +46924,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1549 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_CMPiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46952,7 +46944,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1549 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_CMPiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46972,7 +46964,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1549 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_CMPiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -46992,7 +46984,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1549 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPiodb", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_CMPiodb, DIS_EADDR32, DIS_I8);
 
       
 
@@ -47011,7 +47003,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 384 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_TEST_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -47030,7 +47022,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 384 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_TEST_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -47049,7 +47041,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 384 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_TEST_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -47068,7 +47060,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 384 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_TEST_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -47087,7 +47079,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 378 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_TEST_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -47106,7 +47098,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 378 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_TEST_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -47125,7 +47117,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 378 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_TEST_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -47144,7 +47136,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 378 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_TEST_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -47163,7 +47155,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 324 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XCHG.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_XCHG_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -47182,7 +47174,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 324 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XCHG.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_XCHG_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -47201,7 +47193,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 324 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XCHG.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_XCHG_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -47220,7 +47212,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 324 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XCHG.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_XCHG_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -47239,7 +47231,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 318 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XCHG.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_XCHG_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -47258,7 +47250,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 318 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XCHG.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_XCHG_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -47277,7 +47269,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 318 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XCHG.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_XCHG_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -47296,7 +47288,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 318 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XCHG.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_XCHG_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -47316,7 +47308,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 659 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ROLB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47336,7 +47328,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 659 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ROLB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47356,7 +47348,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 659 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ROLB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47376,7 +47368,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 659 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ROLB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47396,7 +47388,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 656 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RORB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47416,7 +47408,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 656 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RORB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47436,7 +47428,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 656 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RORB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47456,7 +47448,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 656 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RORB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47476,7 +47468,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 653 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCLB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47496,7 +47488,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 653 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCLB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47516,7 +47508,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 653 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCLB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47536,7 +47528,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 653 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCLB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47556,7 +47548,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 650 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCRB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47576,7 +47568,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 650 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCRB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47596,7 +47588,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 650 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCRB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47616,7 +47608,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 650 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCRB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47636,7 +47628,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 647 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47656,7 +47648,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 647 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47676,7 +47668,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 647 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47696,7 +47688,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 647 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47716,7 +47708,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 644 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHRB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47736,7 +47728,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 644 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHRB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47756,7 +47748,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 644 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHRB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47776,7 +47768,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 644 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHRB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47796,7 +47788,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 641 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SARB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47816,7 +47808,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 641 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SARB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47836,7 +47828,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 641 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SARB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47856,7 +47848,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 641 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SARB_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -47876,7 +47868,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 635 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -47896,7 +47888,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 635 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -47916,7 +47908,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 635 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -47936,7 +47928,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 635 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -47956,7 +47948,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 629 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -47976,7 +47968,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 629 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -47996,7 +47988,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 629 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48016,7 +48008,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 629 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48036,7 +48028,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 623 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48056,7 +48048,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 623 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48076,7 +48068,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 623 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48096,7 +48088,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 623 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48116,7 +48108,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 617 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48136,7 +48128,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 617 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48156,7 +48148,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 617 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48176,7 +48168,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 617 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48196,7 +48188,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 611 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48216,7 +48208,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 611 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48236,7 +48228,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 611 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48256,7 +48248,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 611 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48276,7 +48268,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 605 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48296,7 +48288,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 605 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48316,7 +48308,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 605 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48336,7 +48328,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 605 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48356,7 +48348,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 599 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48376,7 +48368,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 599 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48396,7 +48388,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 599 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48416,7 +48408,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 599 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.Ibod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_Ibod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -48435,7 +48427,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1067 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LES", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LES, DIS_REG32, DIS_MEM);
 
       
 
@@ -48454,7 +48446,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1067 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LES", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LES, DIS_REG32, DIS_MEM);
 
       
 
@@ -48473,7 +48465,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1067 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LES", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LES, DIS_REG32, DIS_MEM);
 
       
 
@@ -48492,7 +48484,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1079 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LDS", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LDS, DIS_REG32, DIS_MEM);
 
       
 
@@ -48511,7 +48503,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1079 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LDS", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LDS, DIS_REG32, DIS_MEM);
 
       
 
@@ -48530,7 +48522,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1079 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LDS", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LDS, DIS_REG32, DIS_MEM);
 
       
 
@@ -48550,7 +48542,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 986 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOV.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_MOV_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -48570,7 +48562,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 986 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOV.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_MOV_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -48590,7 +48582,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 986 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOV.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_MOV_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -48610,7 +48602,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 986 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOV.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_MOV_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -48629,7 +48621,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 980 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOV.Ed.Ivod", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_MOV_Ed_Ivod, DIS_EADDR32, DIS_I32);
 
       
 
@@ -48648,7 +48640,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 980 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOV.Ed.Ivod", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_MOV_Ed_Ivod, DIS_EADDR32, DIS_I32);
 
       
 
@@ -48667,7 +48659,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 980 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOV.Ed.Ivod", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_MOV_Ed_Ivod, DIS_EADDR32, DIS_I32);
 
       
 
@@ -48686,7 +48678,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 980 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOV.Ed.Ivod", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_MOV_Ed_Ivod, DIS_EADDR32, DIS_I32);
 
       
 
@@ -48704,7 +48696,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 785 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ROLB_Eb_1, DIS_EADDR8);
 
       
 
@@ -48714,25 +48706,25 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       //	  | PUSHFod() =>
 
-      //		  stmts = instantiate(pc,  "PUSHFod");
+      //		  stmts = instantiate(pc,  OP_PUSHFod);
 
       
 
       //	  | PUSHFow() =>
 
-      //		  stmts = instantiate(pc,  "PUSHFow");
+      //		  stmts = instantiate(pc,  OP_PUSHFow);
 
       
 
       //	  | PUSHAod() =>
 
-      //		  stmts = instantiate(pc,  "PUSHAod");
+      //		  stmts = instantiate(pc,  OP_PUSHAod);
 
       
 
       //	  | PUSHAow() =>
 
-      //		  stmts = instantiate(pc,  "PUSHAow");
+      //		  stmts = instantiate(pc,  OP_PUSHAow);
 
       
 
@@ -48750,7 +48742,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 785 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ROLB_Eb_1, DIS_EADDR8);
 
       
 
@@ -48760,25 +48752,25 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       //	  | PUSHFod() =>
 
-      //		  stmts = instantiate(pc,  "PUSHFod");
+      //		  stmts = instantiate(pc,  OP_PUSHFod);
 
       
 
       //	  | PUSHFow() =>
 
-      //		  stmts = instantiate(pc,  "PUSHFow");
+      //		  stmts = instantiate(pc,  OP_PUSHFow);
 
       
 
       //	  | PUSHAod() =>
 
-      //		  stmts = instantiate(pc,  "PUSHAod");
+      //		  stmts = instantiate(pc,  OP_PUSHAod);
 
       
 
       //	  | PUSHAow() =>
 
-      //		  stmts = instantiate(pc,  "PUSHAow");
+      //		  stmts = instantiate(pc,  OP_PUSHAow);
 
       
 
@@ -48796,7 +48788,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 785 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ROLB_Eb_1, DIS_EADDR8);
 
       
 
@@ -48806,25 +48798,25 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       //	  | PUSHFod() =>
 
-      //		  stmts = instantiate(pc,  "PUSHFod");
+      //		  stmts = instantiate(pc,  OP_PUSHFod);
 
       
 
       //	  | PUSHFow() =>
 
-      //		  stmts = instantiate(pc,  "PUSHFow");
+      //		  stmts = instantiate(pc,  OP_PUSHFow);
 
       
 
       //	  | PUSHAod() =>
 
-      //		  stmts = instantiate(pc,  "PUSHAod");
+      //		  stmts = instantiate(pc,  OP_PUSHAod);
 
       
 
       //	  | PUSHAow() =>
 
-      //		  stmts = instantiate(pc,  "PUSHAow");
+      //		  stmts = instantiate(pc,  OP_PUSHAow);
 
       
 
@@ -48842,7 +48834,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 785 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ROLB_Eb_1, DIS_EADDR8);
 
       
 
@@ -48852,25 +48844,25 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       //	  | PUSHFod() =>
 
-      //		  stmts = instantiate(pc,  "PUSHFod");
+      //		  stmts = instantiate(pc,  OP_PUSHFod);
 
       
 
       //	  | PUSHFow() =>
 
-      //		  stmts = instantiate(pc,  "PUSHFow");
+      //		  stmts = instantiate(pc,  OP_PUSHFow);
 
       
 
       //	  | PUSHAod() =>
 
-      //		  stmts = instantiate(pc,  "PUSHAod");
+      //		  stmts = instantiate(pc,  OP_PUSHAod);
 
       
 
       //	  | PUSHAow() =>
 
-      //		  stmts = instantiate(pc,  "PUSHAow");
+      //		  stmts = instantiate(pc,  OP_PUSHAow);
 
       
 
@@ -48888,7 +48880,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 779 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RORB_Eb_1, DIS_EADDR8);
 
       
 
@@ -48906,7 +48898,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 779 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RORB_Eb_1, DIS_EADDR8);
 
       
 
@@ -48924,7 +48916,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 779 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RORB_Eb_1, DIS_EADDR8);
 
       
 
@@ -48942,7 +48934,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 779 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RORB_Eb_1, DIS_EADDR8);
 
       
 
@@ -48960,7 +48952,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 773 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCLB_Eb_1, DIS_EADDR8);
 
       
 
@@ -48978,7 +48970,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 773 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCLB_Eb_1, DIS_EADDR8);
 
       
 
@@ -48996,7 +48988,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 773 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCLB_Eb_1, DIS_EADDR8);
 
       
 
@@ -49014,7 +49006,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 773 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCLB_Eb_1, DIS_EADDR8);
 
       
 
@@ -49032,7 +49024,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 767 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCRB_Eb_1, DIS_EADDR8);
 
       
 
@@ -49050,7 +49042,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 767 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCRB_Eb_1, DIS_EADDR8);
 
       
 
@@ -49068,7 +49060,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 767 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCRB_Eb_1, DIS_EADDR8);
 
       
 
@@ -49086,7 +49078,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 767 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCRB_Eb_1, DIS_EADDR8);
 
       
 
@@ -49104,7 +49096,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 761 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Eb_1, DIS_EADDR8);
 
       
 
@@ -49122,7 +49114,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 761 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Eb_1, DIS_EADDR8);
 
       
 
@@ -49140,7 +49132,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 761 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Eb_1, DIS_EADDR8);
 
       
 
@@ -49158,7 +49150,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 761 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Eb_1, DIS_EADDR8);
 
       
 
@@ -49176,7 +49168,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 755 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHRB_Eb_1, DIS_EADDR8);
 
       
 
@@ -49194,7 +49186,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 755 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHRB_Eb_1, DIS_EADDR8);
 
       
 
@@ -49212,7 +49204,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 755 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHRB_Eb_1, DIS_EADDR8);
 
       
 
@@ -49230,7 +49222,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 755 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Eb.1", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHRB_Eb_1, DIS_EADDR8);
 
       
 
@@ -49248,7 +49240,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 749 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Eb.1", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SARB_Eb_1, DIS_EADDR16);
 
       
 
@@ -49266,7 +49258,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 749 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Eb.1", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SARB_Eb_1, DIS_EADDR16);
 
       
 
@@ -49284,7 +49276,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 749 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Eb.1", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SARB_Eb_1, DIS_EADDR16);
 
       
 
@@ -49302,7 +49294,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 749 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Eb.1", DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_SARB_Eb_1, DIS_EADDR16);
 
       
 
@@ -49320,7 +49312,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 740 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49338,7 +49330,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 740 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49356,7 +49348,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 740 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49374,7 +49366,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 740 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49392,7 +49384,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 728 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49410,7 +49402,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 728 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49428,7 +49420,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 728 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49446,7 +49438,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 728 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49464,7 +49456,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 716 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49482,7 +49474,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 716 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49500,7 +49492,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 716 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49518,7 +49510,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 716 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49536,7 +49528,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 704 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49554,7 +49546,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 704 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49572,7 +49564,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 704 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49590,7 +49582,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 704 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49608,7 +49600,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 692 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49626,7 +49618,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 692 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49644,7 +49636,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 692 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49662,7 +49654,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 692 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49680,7 +49672,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 680 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49698,7 +49690,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 680 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49716,7 +49708,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 680 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49734,7 +49726,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 680 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49752,7 +49744,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 668 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49770,7 +49762,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 668 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49788,7 +49780,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 668 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49806,7 +49798,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 668 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.1od", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_1od, DIS_EADDR32);
 
       
 
@@ -49824,7 +49816,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 782 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ROLB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -49842,7 +49834,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 782 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ROLB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -49860,7 +49852,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 782 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ROLB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -49878,7 +49870,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 782 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ROLB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -49896,7 +49888,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 776 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RORB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -49914,7 +49906,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 776 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RORB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -49932,7 +49924,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 776 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RORB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -49950,7 +49942,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 776 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RORB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -49968,7 +49960,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 770 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCLB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -49986,7 +49978,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 770 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCLB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50004,7 +49996,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 770 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCLB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50022,7 +50014,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 770 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCLB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50040,7 +50032,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 764 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCRB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50058,7 +50050,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 764 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCRB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50076,7 +50068,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 764 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCRB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50094,7 +50086,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 764 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_RCRB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50112,7 +50104,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 758 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50130,7 +50122,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 758 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50148,7 +50140,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 758 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50166,7 +50158,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 758 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50184,7 +50176,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 752 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHRB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50202,7 +50194,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 752 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHRB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50220,7 +50212,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 752 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHRB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50238,7 +50230,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 752 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Eb.CL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SHRB_Eb_CL, DIS_EADDR8);
 
       
 
@@ -50256,7 +50248,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 746 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Eb.CL", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SARB_Eb_CL, DIS_EADDR32);
 
       
 
@@ -50274,7 +50266,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 746 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Eb.CL", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SARB_Eb_CL, DIS_EADDR32);
 
       
 
@@ -50292,7 +50284,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 746 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Eb.CL", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SARB_Eb_CL, DIS_EADDR32);
 
       
 
@@ -50310,7 +50302,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 746 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Eb.CL", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SARB_Eb_CL, DIS_EADDR32);
 
       
 
@@ -50328,7 +50320,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 734 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50346,7 +50338,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 734 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50364,7 +50356,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 734 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50382,7 +50374,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 734 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ROLB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ROLB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50400,7 +50392,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 722 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50418,7 +50410,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 722 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50436,7 +50428,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 722 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50454,7 +50446,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 722 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RORB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RORB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50472,7 +50464,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 710 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50490,7 +50482,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 710 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50508,7 +50500,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 710 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50526,7 +50518,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 710 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCLB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCLB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50544,7 +50536,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 698 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50562,7 +50554,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 698 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50580,7 +50572,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 698 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50598,7 +50590,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 698 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "RCRB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_RCRB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50616,7 +50608,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 686 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50634,7 +50626,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 686 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50652,7 +50644,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 686 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50670,7 +50662,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 686 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLSALB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHLSALB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50688,7 +50680,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 674 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50706,7 +50698,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 674 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50724,7 +50716,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 674 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50742,7 +50734,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 674 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SHRB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50760,7 +50752,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 662 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50778,7 +50770,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 662 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50796,7 +50788,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 662 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50814,7 +50806,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 662 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SARB.Ev.CLod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SARB_Ev_CLod, DIS_EADDR32);
 
       
 
@@ -50833,7 +50825,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 393 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_TEST_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -50852,7 +50844,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 393 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_TEST_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -50871,7 +50863,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 393 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_TEST_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -50890,7 +50882,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 393 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Eb.Ib", DIS_EADDR8, DIS_I8);
+      		stmts = instantiate(pc,	 OP_TEST_Eb_Ib, DIS_EADDR8, DIS_I8);
 
       
 
@@ -50908,7 +50900,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 916 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NOTb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_NOTb, DIS_EADDR8);
 
       
 
@@ -50926,7 +50918,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 916 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NOTb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_NOTb, DIS_EADDR8);
 
       
 
@@ -50944,7 +50936,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 916 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NOTb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_NOTb, DIS_EADDR8);
 
       
 
@@ -50962,7 +50954,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 916 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NOTb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_NOTb, DIS_EADDR8);
 
       
 
@@ -50980,7 +50972,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 925 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NEGb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_NEGb, DIS_EADDR8);
 
       
 
@@ -50998,7 +50990,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 925 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NEGb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_NEGb, DIS_EADDR8);
 
       
 
@@ -51016,7 +51008,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 925 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NEGb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_NEGb, DIS_EADDR8);
 
       
 
@@ -51034,7 +51026,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 925 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NEGb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_NEGb, DIS_EADDR8);
 
       
 
@@ -51052,7 +51044,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 934 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MUL.AL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MUL_AL, DIS_EADDR8);
 
       
 
@@ -51070,7 +51062,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 934 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MUL.AL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MUL_AL, DIS_EADDR8);
 
       
 
@@ -51088,7 +51080,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 934 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MUL.AL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MUL_AL, DIS_EADDR8);
 
       
 
@@ -51106,7 +51098,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 934 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MUL.AL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MUL_AL, DIS_EADDR8);
 
       
 
@@ -51124,7 +51116,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1178 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_IMULb, DIS_EADDR8);
 
       
 
@@ -51142,7 +51134,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1178 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_IMULb, DIS_EADDR8);
 
       
 
@@ -51160,7 +51152,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1178 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_IMULb, DIS_EADDR8);
 
       
 
@@ -51178,7 +51170,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1178 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_IMULb, DIS_EADDR8);
 
       
 
@@ -51196,7 +51188,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1202 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DIVAL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_DIVAL, DIS_EADDR8);
 
       
 
@@ -51214,7 +51206,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1202 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DIVAL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_DIVAL, DIS_EADDR8);
 
       
 
@@ -51232,7 +51224,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1202 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DIVAL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_DIVAL, DIS_EADDR8);
 
       
 
@@ -51250,7 +51242,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1202 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DIVAL", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_DIVAL, DIS_EADDR8);
 
       
 
@@ -51268,13 +51260,13 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1187 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IDIV", DIS_EADDR8); /* ?? */
+      		stmts = instantiate(pc,	 OP_IDIV, DIS_EADDR8); /* ?? */
 
       
 
       //	| HLT() =>
 
-      //		stmts = instantiate(pc,	 "HLT");
+      //		stmts = instantiate(pc,	 OP_HLT);
 
       
 
@@ -51292,13 +51284,13 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1187 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IDIV", DIS_EADDR8); /* ?? */
+      		stmts = instantiate(pc,	 OP_IDIV, DIS_EADDR8); /* ?? */
 
       
 
       //	| HLT() =>
 
-      //		stmts = instantiate(pc,	 "HLT");
+      //		stmts = instantiate(pc,	 OP_HLT);
 
       
 
@@ -51316,13 +51308,13 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1187 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IDIV", DIS_EADDR8); /* ?? */
+      		stmts = instantiate(pc,	 OP_IDIV, DIS_EADDR8); /* ?? */
 
       
 
       //	| HLT() =>
 
-      //		stmts = instantiate(pc,	 "HLT");
+      //		stmts = instantiate(pc,	 OP_HLT);
 
       
 
@@ -51340,13 +51332,13 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1187 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IDIV", DIS_EADDR8); /* ?? */
+      		stmts = instantiate(pc,	 OP_IDIV, DIS_EADDR8); /* ?? */
 
       
 
       //	| HLT() =>
 
-      //		stmts = instantiate(pc,	 "HLT");
+      //		stmts = instantiate(pc,	 OP_HLT);
 
       
 
@@ -51365,7 +51357,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 387 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ed.Id", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_TEST_Ed_Id, DIS_EADDR32, DIS_I32);
 
       
 
@@ -51384,7 +51376,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 387 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ed.Id", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_TEST_Ed_Id, DIS_EADDR32, DIS_I32);
 
       
 
@@ -51403,7 +51395,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 387 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ed.Id", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_TEST_Ed_Id, DIS_EADDR32, DIS_I32);
 
       
 
@@ -51422,7 +51414,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 387 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "TEST.Ed.Id", DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_TEST_Ed_Id, DIS_EADDR32, DIS_I32);
 
       
 
@@ -51440,7 +51432,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 910 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NOTod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_NOTod, DIS_EADDR32);
 
       
 
@@ -51458,7 +51450,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 910 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NOTod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_NOTod, DIS_EADDR32);
 
       
 
@@ -51476,7 +51468,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 910 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NOTod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_NOTod, DIS_EADDR32);
 
       
 
@@ -51494,7 +51486,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 910 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NOTod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_NOTod, DIS_EADDR32);
 
       
 
@@ -51512,7 +51504,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 919 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NEGod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_NEGod, DIS_EADDR32);
 
       
 
@@ -51530,7 +51522,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 919 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NEGod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_NEGod, DIS_EADDR32);
 
       
 
@@ -51548,7 +51540,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 919 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NEGod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_NEGod, DIS_EADDR32);
 
       
 
@@ -51566,7 +51558,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 919 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "NEGod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_NEGod, DIS_EADDR32);
 
       
 
@@ -51584,7 +51576,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 928 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MUL.AXod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_MUL_AXod, DIS_EADDR32);
 
       
 
@@ -51602,7 +51594,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 928 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MUL.AXod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_MUL_AXod, DIS_EADDR32);
 
       
 
@@ -51620,7 +51612,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 928 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MUL.AXod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_MUL_AXod, DIS_EADDR32);
 
       
 
@@ -51638,7 +51630,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 928 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MUL.AXod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_MUL_AXod, DIS_EADDR32);
 
       
 
@@ -51656,7 +51648,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1172 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_IMULod, DIS_EADDR32);
 
       
 
@@ -51674,7 +51666,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1172 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_IMULod, DIS_EADDR32);
 
       
 
@@ -51692,7 +51684,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1172 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_IMULod, DIS_EADDR32);
 
       
 
@@ -51710,7 +51702,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1172 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_IMULod, DIS_EADDR32);
 
       
 
@@ -51728,7 +51720,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1196 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DIVeAX", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_DIVeAX, DIS_EADDR32);
 
       
 
@@ -51746,7 +51738,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1196 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DIVeAX", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_DIVeAX, DIS_EADDR32);
 
       
 
@@ -51764,7 +51756,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1196 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DIVeAX", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_DIVeAX, DIS_EADDR32);
 
       
 
@@ -51782,7 +51774,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1196 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DIVeAX", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_DIVeAX, DIS_EADDR32);
 
       
 
@@ -51800,7 +51792,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1181 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IDIVeAX", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_IDIVeAX, DIS_EADDR32);
 
       
 
@@ -51818,7 +51810,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1181 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IDIVeAX", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_IDIVeAX, DIS_EADDR32);
 
       
 
@@ -51836,7 +51828,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1181 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IDIVeAX", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_IDIVeAX, DIS_EADDR32);
 
       
 
@@ -51854,7 +51846,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1181 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IDIVeAX", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_IDIVeAX, DIS_EADDR32);
 
       
 
@@ -51873,7 +51865,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1543 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ORmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -51892,7 +51884,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1543 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ORmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -51911,7 +51903,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1543 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ORmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -51930,7 +51922,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1543 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_ORmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -51949,7 +51941,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1513 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ORmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -51968,7 +51960,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1513 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ORmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -51987,7 +51979,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1513 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ORmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -52006,7 +51998,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1513 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_ORmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -52025,7 +52017,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1471 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ORrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -52044,7 +52036,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1471 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ORrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -52063,7 +52055,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1471 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ORrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -52082,7 +52074,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1471 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_ORrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -52101,7 +52093,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1441 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ORrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -52120,7 +52112,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1441 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ORrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -52139,7 +52131,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1441 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ORrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -52158,7 +52150,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1441 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "ORrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_ORrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -52176,7 +52168,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 429 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SLDT", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SLDT, DIS_EADDR32);
 
       
 
@@ -52194,7 +52186,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 429 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SLDT", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SLDT, DIS_EADDR32);
 
       
 
@@ -52212,7 +52204,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 429 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SLDT", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SLDT, DIS_EADDR32);
 
       
 
@@ -52230,7 +52222,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 429 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SLDT", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SLDT, DIS_EADDR32);
 
       
 
@@ -52248,7 +52240,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 405 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "STR", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_STR, DIS_MEM);
 
       
 
@@ -52266,7 +52258,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 405 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "STR", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_STR, DIS_MEM);
 
       
 
@@ -52284,7 +52276,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 405 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "STR", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_STR, DIS_MEM);
 
       
 
@@ -52302,7 +52294,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1040 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LTR", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_LTR, DIS_EADDR32);
 
       
 
@@ -52320,7 +52312,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1040 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LTR", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_LTR, DIS_EADDR32);
 
       
 
@@ -52338,7 +52330,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1040 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LTR", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_LTR, DIS_EADDR32);
 
       
 
@@ -52356,7 +52348,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1040 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LTR", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_LTR, DIS_EADDR32);
 
       
 
@@ -52374,7 +52366,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 375 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "VERR", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_VERR, DIS_EADDR32);
 
       
 
@@ -52392,7 +52384,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 375 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "VERR", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_VERR, DIS_EADDR32);
 
       
 
@@ -52410,7 +52402,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 375 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "VERR", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_VERR, DIS_EADDR32);
 
       
 
@@ -52428,7 +52420,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 375 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "VERR", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_VERR, DIS_EADDR32);
 
       
 
@@ -52446,7 +52438,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 372 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "VERW", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_VERW, DIS_EADDR32);
 
       
 
@@ -52464,7 +52456,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 372 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "VERW", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_VERW, DIS_EADDR32);
 
       
 
@@ -52482,7 +52474,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 372 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "VERW", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_VERW, DIS_EADDR32);
 
       
 
@@ -52500,7 +52492,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 372 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "VERW", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_VERW, DIS_EADDR32);
 
       
 
@@ -52518,7 +52510,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 459 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SGDT", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_SGDT, DIS_MEM);
 
       
 
@@ -52538,7 +52530,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 459 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SGDT", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_SGDT, DIS_MEM);
 
       
 
@@ -52558,7 +52550,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 459 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SGDT", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_SGDT, DIS_MEM);
 
       
 
@@ -52578,7 +52570,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 456 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SIDT", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_SIDT, DIS_MEM);
 
       
 
@@ -52596,7 +52588,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 456 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SIDT", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_SIDT, DIS_MEM);
 
       
 
@@ -52614,7 +52606,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 456 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SIDT", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_SIDT, DIS_MEM);
 
       
 
@@ -52632,7 +52624,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 426 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SMSW", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SMSW, DIS_EADDR32);
 
       
 
@@ -52650,7 +52642,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 426 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SMSW", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SMSW, DIS_EADDR32);
 
       
 
@@ -52668,7 +52660,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 426 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SMSW", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SMSW, DIS_EADDR32);
 
       
 
@@ -52686,7 +52678,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 426 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SMSW", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SMSW, DIS_EADDR32);
 
       
 
@@ -52704,7 +52696,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1095 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INVLPG", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_INVLPG, DIS_MEM);
 
       
 
@@ -52722,7 +52714,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1095 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INVLPG", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_INVLPG, DIS_MEM);
 
       
 
@@ -52740,7 +52732,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1095 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INVLPG", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_INVLPG, DIS_MEM);
 
       
 
@@ -52759,7 +52751,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1082 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LAR.od", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_LAR_od, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -52778,7 +52770,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1082 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LAR.od", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_LAR_od, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -52797,7 +52789,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1082 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LAR.od", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_LAR_od, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -52816,7 +52808,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1082 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LAR.od", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_LAR_od, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -52835,7 +52827,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1046 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LSLod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_LSLod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -52854,7 +52846,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1046 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LSLod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_LSLod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -52873,7 +52865,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1046 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LSLod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_LSLod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -52892,7 +52884,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1046 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LSLod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_LSLod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -53927,7 +53919,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1352 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -53946,7 +53938,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1352 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -53965,7 +53957,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1352 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -53984,7 +53976,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1352 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54003,7 +53995,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1316 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTSod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54022,7 +54014,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1316 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTSod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54041,7 +54033,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1316 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTSod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54060,7 +54052,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1316 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTSod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54080,7 +54072,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 444 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.Ibod", DIS_EADDR32, DIS_REG32, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHLD_Ibod, DIS_EADDR32, DIS_REG32, DIS_COUNT);
 
       
 
@@ -54100,7 +54092,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 444 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.Ibod", DIS_EADDR32, DIS_REG32, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHLD_Ibod, DIS_EADDR32, DIS_REG32, DIS_COUNT);
 
       
 
@@ -54120,7 +54112,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 444 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.Ibod", DIS_EADDR32, DIS_REG32, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHLD_Ibod, DIS_EADDR32, DIS_REG32, DIS_COUNT);
 
       
 
@@ -54140,7 +54132,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 444 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.Ibod", DIS_EADDR32, DIS_REG32, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHLD_Ibod, DIS_EADDR32, DIS_REG32, DIS_COUNT);
 
       
 
@@ -54160,7 +54152,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 450 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.Ibod", DIS_EADDR32, DIS_REG32, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHRD_Ibod, DIS_EADDR32, DIS_REG32, DIS_COUNT);
 
       
 
@@ -54180,7 +54172,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 450 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.Ibod", DIS_EADDR32, DIS_REG32, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHRD_Ibod, DIS_EADDR32, DIS_REG32, DIS_COUNT);
 
       
 
@@ -54200,7 +54192,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 450 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.Ibod", DIS_EADDR32, DIS_REG32, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHRD_Ibod, DIS_EADDR32, DIS_REG32, DIS_COUNT);
 
       
 
@@ -54220,7 +54212,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 450 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.Ibod", DIS_EADDR32, DIS_REG32, DIS_COUNT);
+      		stmts = instantiate(pc,	 OP_SHRD_Ibod, DIS_EADDR32, DIS_REG32, DIS_COUNT);
 
       
 
@@ -54239,7 +54231,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 432 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.CLod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SHLD_CLod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54258,7 +54250,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 432 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.CLod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SHLD_CLod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54277,7 +54269,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 432 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.CLod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SHLD_CLod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54296,7 +54288,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 432 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHLD.CLod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SHLD_CLod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54315,7 +54307,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 438 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.CLod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SHRD_CLod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54334,7 +54326,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 438 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.CLod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SHRD_CLod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54353,7 +54345,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 438 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.CLod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SHRD_CLod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54372,7 +54364,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 438 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SHRD.CLod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SHRD_CLod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54391,7 +54383,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1166 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_IMULrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -54410,7 +54402,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1166 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_IMULrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -54429,7 +54421,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1166 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_IMULrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -54448,7 +54440,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1166 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMULrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_IMULrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -54467,7 +54459,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1244 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_CMPXCHG_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -54486,7 +54478,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1244 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_CMPXCHG_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -54505,7 +54497,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1244 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_CMPXCHG_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -54524,7 +54516,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1244 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_CMPXCHG_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -54543,7 +54535,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1238 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_CMPXCHG_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54562,7 +54554,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1238 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_CMPXCHG_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54581,7 +54573,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1238 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_CMPXCHG_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54600,7 +54592,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1238 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_CMPXCHG_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54619,7 +54611,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1043 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LSS", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LSS, DIS_REG32, DIS_MEM);
 
       
 
@@ -54638,7 +54630,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1043 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LSS", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LSS, DIS_REG32, DIS_MEM);
 
       
 
@@ -54657,7 +54649,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1043 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LSS", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LSS, DIS_REG32, DIS_MEM);
 
       
 
@@ -54676,7 +54668,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1328 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTRod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54695,7 +54687,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1328 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTRod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54714,7 +54706,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1328 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTRod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54733,7 +54725,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1328 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTRod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -54752,7 +54744,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1064 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LFS", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LFS, DIS_REG32, DIS_MEM);
 
       
 
@@ -54771,7 +54763,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1064 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LFS", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LFS, DIS_REG32, DIS_MEM);
 
       
 
@@ -54790,7 +54782,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1064 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LFS", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LFS, DIS_REG32, DIS_MEM);
 
       
 
@@ -54809,7 +54801,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1061 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LGS", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LGS, DIS_REG32, DIS_MEM);
 
       
 
@@ -54828,7 +54820,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1061 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LGS", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LGS, DIS_REG32, DIS_MEM);
 
       
 
@@ -54847,7 +54839,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1061 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LGS", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LGS, DIS_REG32, DIS_MEM);
 
       
 
@@ -54866,7 +54858,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 940 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ebod", DIS_R32, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebod, DIS_R32, DIS_EADDR8);
 
       
 
@@ -54885,7 +54877,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 940 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ebod", DIS_R32, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebod, DIS_R32, DIS_EADDR8);
 
       
 
@@ -54904,7 +54896,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 940 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ebod", DIS_R32, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebod, DIS_R32, DIS_EADDR8);
 
       
 
@@ -54923,7 +54915,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 940 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ebod", DIS_R32, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ebod, DIS_R32, DIS_EADDR8);
 
       
 
@@ -54942,7 +54934,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 937 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ew", DIS_R32, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ew, DIS_R32, DIS_EADDR16);
 
       
 
@@ -54961,7 +54953,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 937 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ew", DIS_R32, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ew, DIS_R32, DIS_EADDR16);
 
       
 
@@ -54980,7 +54972,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 937 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ew", DIS_R32, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ew, DIS_R32, DIS_EADDR16);
 
       
 
@@ -54999,7 +54991,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 937 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVZX.Gv.Ew", DIS_R32, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MOVZX_Gv_Ew, DIS_R32, DIS_EADDR16);
 
       
 
@@ -55019,7 +55011,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1346 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTiod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTiod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -55039,7 +55031,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1346 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTiod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTiod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -55059,7 +55051,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1346 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTiod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTiod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -55079,7 +55071,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1346 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTiod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTiod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -55099,7 +55091,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1310 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSiod", DIS_I8, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_BTSiod, DIS_I8, DIS_EADDR32);
 
       
 
@@ -55119,7 +55111,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1310 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSiod", DIS_I8, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_BTSiod, DIS_I8, DIS_EADDR32);
 
       
 
@@ -55139,7 +55131,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1310 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSiod", DIS_I8, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_BTSiod, DIS_I8, DIS_EADDR32);
 
       
 
@@ -55159,7 +55151,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1310 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTSiod", DIS_I8, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_BTSiod, DIS_I8, DIS_EADDR32);
 
       
 
@@ -55179,7 +55171,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1322 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRiod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTRiod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -55199,7 +55191,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1322 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRiod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTRiod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -55219,7 +55211,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1322 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRiod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTRiod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -55239,7 +55231,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1322 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTRiod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTRiod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -55259,7 +55251,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1334 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCiod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTCiod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -55279,7 +55271,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1334 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCiod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTCiod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -55299,7 +55291,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1334 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCiod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTCiod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -55319,7 +55311,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1334 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCiod", DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_BTCiod, DIS_EADDR32, DIS_I8);
 
       
 
@@ -55338,7 +55330,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1340 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTCod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -55357,7 +55349,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1340 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTCod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -55376,7 +55368,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1340 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTCod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -55395,7 +55387,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1340 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "BTCod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_BTCod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -55414,7 +55406,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1372 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSFod", DIS_REG32, DIS_EADDR32);
+      		//stmts = instantiate(pc,  OP_BSFod, DIS_REG32, DIS_EADDR32);
 
       		genBSFR(pc, DIS_REG32, DIS_EADDR32, -1, 32, opPlus, nextPC-hostPC);
 
@@ -55437,7 +55429,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1372 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSFod", DIS_REG32, DIS_EADDR32);
+      		//stmts = instantiate(pc,  OP_BSFod, DIS_REG32, DIS_EADDR32);
 
       		genBSFR(pc, DIS_REG32, DIS_EADDR32, -1, 32, opPlus, nextPC-hostPC);
 
@@ -55460,7 +55452,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1372 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSFod", DIS_REG32, DIS_EADDR32);
+      		//stmts = instantiate(pc,  OP_BSFod, DIS_REG32, DIS_EADDR32);
 
       		genBSFR(pc, DIS_REG32, DIS_EADDR32, -1, 32, opPlus, nextPC-hostPC);
 
@@ -55483,7 +55475,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1372 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSFod", DIS_REG32, DIS_EADDR32);
+      		//stmts = instantiate(pc,  OP_BSFod, DIS_REG32, DIS_EADDR32);
 
       		genBSFR(pc, DIS_REG32, DIS_EADDR32, -1, 32, opPlus, nextPC-hostPC);
 
@@ -55506,7 +55498,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1361 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSRod", DIS_REG32, DIS_EADDR32);
+      		//stmts = instantiate(pc,  OP_BSRod, DIS_REG32, DIS_EADDR32);
 
       		// Bit Scan Forward: need helper function
 
@@ -55531,7 +55523,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1361 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSRod", DIS_REG32, DIS_EADDR32);
+      		//stmts = instantiate(pc,  OP_BSRod, DIS_REG32, DIS_EADDR32);
 
       		// Bit Scan Forward: need helper function
 
@@ -55556,7 +55548,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1361 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSRod", DIS_REG32, DIS_EADDR32);
+      		//stmts = instantiate(pc,  OP_BSRod, DIS_REG32, DIS_EADDR32);
 
       		// Bit Scan Forward: need helper function
 
@@ -55581,7 +55573,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1361 "frontend/machine/pentium/decoder.m"
       
 
-      		//stmts = instantiate(pc,  "BSRod", DIS_REG32, DIS_EADDR32);
+      		//stmts = instantiate(pc,  OP_BSRod, DIS_REG32, DIS_EADDR32);
 
       		// Bit Scan Forward: need helper function
 
@@ -55606,7 +55598,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 949 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVSX.Gv.Ebod", DIS_R32, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVSX_Gv_Ebod, DIS_R32, DIS_EADDR8);
 
       
 
@@ -55625,7 +55617,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 949 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVSX.Gv.Ebod", DIS_R32, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVSX_Gv_Ebod, DIS_R32, DIS_EADDR8);
 
       
 
@@ -55644,7 +55636,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 949 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVSX.Gv.Ebod", DIS_R32, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVSX_Gv_Ebod, DIS_R32, DIS_EADDR8);
 
       
 
@@ -55663,7 +55655,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 949 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVSX.Gv.Ebod", DIS_R32, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVSX_Gv_Ebod, DIS_R32, DIS_EADDR8);
 
       
 
@@ -55682,7 +55674,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 946 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVSX.Gv.Ew", DIS_R32, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MOVSX_Gv_Ew, DIS_R32, DIS_EADDR16);
 
       
 
@@ -55701,7 +55693,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 946 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVSX.Gv.Ew", DIS_R32, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MOVSX_Gv_Ew, DIS_R32, DIS_EADDR16);
 
       
 
@@ -55720,7 +55712,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 946 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVSX.Gv.Ew", DIS_R32, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MOVSX_Gv_Ew, DIS_R32, DIS_EADDR16);
 
       
 
@@ -55739,7 +55731,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 946 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVSX.Gv.Ew", DIS_R32, DIS_EADDR16);
+      		stmts = instantiate(pc,	 OP_MOVSX_Gv_Ew, DIS_R32, DIS_EADDR16);
 
       
 
@@ -55758,7 +55750,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 360 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XADD.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_XADD_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -55777,7 +55769,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 360 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XADD.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_XADD_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -55796,7 +55788,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 360 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XADD.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_XADD_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -55815,7 +55807,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 360 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XADD.Eb.Gb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_XADD_Eb_Gb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -55834,7 +55826,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 354 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XADD.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_XADD_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -55853,7 +55845,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 354 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XADD.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_XADD_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -55872,7 +55864,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 354 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XADD.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_XADD_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -55891,7 +55883,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 354 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "XADD.Ev.Gvod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_XADD_Ev_Gvod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -55909,7 +55901,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1235 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG8B", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_CMPXCHG8B, DIS_MEM);
 
       
 
@@ -55927,7 +55919,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1235 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG8B", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_CMPXCHG8B, DIS_MEM);
 
       
 
@@ -55945,7 +55937,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1235 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPXCHG8B", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_CMPXCHG8B, DIS_MEM);
 
       
 
@@ -55964,7 +55956,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1537 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_SBBmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -55983,7 +55975,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1537 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_SBBmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -56002,7 +55994,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1537 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_SBBmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -56021,7 +56013,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1537 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_SBBmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -56040,7 +56032,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1501 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SBBmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -56059,7 +56051,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1501 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SBBmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -56078,7 +56070,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1501 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SBBmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -56097,7 +56089,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1501 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SBBmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -56116,7 +56108,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1465 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SBBrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -56135,7 +56127,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1465 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SBBrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -56154,7 +56146,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1465 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SBBrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -56173,7 +56165,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1465 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SBBrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -56192,7 +56184,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1429 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SBBrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -56211,7 +56203,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1429 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SBBrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -56230,7 +56222,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1429 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SBBrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -56249,7 +56241,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1429 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SBBrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SBBrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -56268,7 +56260,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1531 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_SUBmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -56287,7 +56279,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1531 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_SUBmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -56306,7 +56298,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1531 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_SUBmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -56325,7 +56317,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1531 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_SUBmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -56344,7 +56336,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1489 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SUBmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -56363,7 +56355,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1489 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SUBmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -56382,7 +56374,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1489 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SUBmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -56401,7 +56393,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1489 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_SUBmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -56420,7 +56412,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1459 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SUBrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -56439,7 +56431,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1459 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SUBrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -56458,7 +56450,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1459 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SUBrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -56477,7 +56469,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1459 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_SUBrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -56496,7 +56488,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1417 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SUBrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -56515,7 +56507,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1417 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SUBrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -56534,7 +56526,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1417 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SUBrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -56553,7 +56545,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1417 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "SUBrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_SUBrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -56572,7 +56564,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1525 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_CMPmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -56591,7 +56583,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1525 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_CMPmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -56610,7 +56602,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1525 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_CMPmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -56629,7 +56621,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1525 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPmrb", DIS_EADDR8, DIS_R8);
+      		stmts = instantiate(pc,	 OP_CMPmrb, DIS_EADDR8, DIS_R8);
 
       
 
@@ -56648,7 +56640,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1477 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_CMPmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -56667,7 +56659,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1477 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_CMPmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -56686,7 +56678,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1477 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_CMPmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -56705,7 +56697,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1477 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_CMPmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -56724,7 +56716,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1453 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_CMPrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -56743,7 +56735,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1453 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_CMPrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -56762,7 +56754,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1453 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_CMPrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -56781,7 +56773,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1453 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPrmb", DIS_R8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_CMPrmb, DIS_R8, DIS_EADDR8);
 
       
 
@@ -56800,7 +56792,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1405 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_CMPrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -56819,7 +56811,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1405 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_CMPrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -56838,7 +56830,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1405 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_CMPrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -56857,7 +56849,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1405 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "CMPrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_CMPrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -56877,7 +56869,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1154 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ivd", DIS_REG32, DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_IMUL_Ivd, DIS_REG32, DIS_EADDR32, DIS_I32);
 
       
 
@@ -56897,7 +56889,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1154 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ivd", DIS_REG32, DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_IMUL_Ivd, DIS_REG32, DIS_EADDR32, DIS_I32);
 
       
 
@@ -56917,7 +56909,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1154 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ivd", DIS_REG32, DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_IMUL_Ivd, DIS_REG32, DIS_EADDR32, DIS_I32);
 
       
 
@@ -56937,7 +56929,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1154 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ivd", DIS_REG32, DIS_EADDR32, DIS_I32);
+      		stmts = instantiate(pc,	 OP_IMUL_Ivd, DIS_REG32, DIS_EADDR32, DIS_I32);
 
       
 
@@ -56958,7 +56950,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1160 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ibod", DIS_REG32, DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_IMUL_Ibod, DIS_REG32, DIS_EADDR32, DIS_I8);
 
       
 
@@ -56979,7 +56971,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1160 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ibod", DIS_REG32, DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_IMUL_Ibod, DIS_REG32, DIS_EADDR32, DIS_I8);
 
       
 
@@ -57000,7 +56992,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1160 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ibod", DIS_REG32, DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_IMUL_Ibod, DIS_REG32, DIS_EADDR32, DIS_I8);
 
       
 
@@ -57021,7 +57013,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1160 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "IMUL.Ibod", DIS_REG32, DIS_EADDR32, DIS_I8);
+      		stmts = instantiate(pc,	 OP_IMUL_Ibod, DIS_REG32, DIS_EADDR32, DIS_I8);
 
       
 
@@ -57040,7 +57032,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1037 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVmrb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_MOVmrb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -57059,7 +57051,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1037 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVmrb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_MOVmrb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -57078,7 +57070,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1037 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVmrb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_MOVmrb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -57097,7 +57089,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1037 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVmrb", DIS_EADDR8, DIS_REG8);
+      		stmts = instantiate(pc,	 OP_MOVmrb, DIS_EADDR8, DIS_REG8);
 
       
 
@@ -57116,7 +57108,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1031 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_MOVmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -57135,7 +57127,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1031 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_MOVmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -57154,7 +57146,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1031 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_MOVmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -57173,7 +57165,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1031 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVmrod", DIS_EADDR32, DIS_REG32);
+      		stmts = instantiate(pc,	 OP_MOVmrod, DIS_EADDR32, DIS_REG32);
 
       
 
@@ -57192,7 +57184,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1028 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVrmb", DIS_REG8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVrmb, DIS_REG8, DIS_EADDR8);
 
       
 
@@ -57211,7 +57203,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1028 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVrmb", DIS_REG8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVrmb, DIS_REG8, DIS_EADDR8);
 
       
 
@@ -57230,7 +57222,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1028 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVrmb", DIS_REG8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVrmb, DIS_REG8, DIS_EADDR8);
 
       
 
@@ -57249,7 +57241,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1028 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVrmb", DIS_REG8, DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_MOVrmb, DIS_REG8, DIS_EADDR8);
 
       
 
@@ -57268,7 +57260,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1022 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_MOVrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -57287,7 +57279,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1022 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_MOVrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -57306,7 +57298,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1022 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_MOVrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -57325,7 +57317,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1022 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "MOVrmod", DIS_REG32, DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_MOVrmod, DIS_REG32, DIS_EADDR32);
 
       
 
@@ -57344,7 +57336,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1073 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LEA.od", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LEA_od, DIS_REG32, DIS_MEM);
 
       
 
@@ -57363,7 +57355,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1073 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LEA.od", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LEA_od, DIS_REG32, DIS_MEM);
 
       
 
@@ -57382,7 +57374,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1073 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "LEA.od", DIS_REG32, DIS_MEM);
+      		stmts = instantiate(pc,	 OP_LEA_od, DIS_REG32, DIS_MEM);
 
       
 
@@ -57400,7 +57392,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 877 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "POP.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_POP_Evod, DIS_EADDR32);
 
       
 
@@ -57418,7 +57410,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 877 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "POP.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_POP_Evod, DIS_EADDR32);
 
       
 
@@ -57436,7 +57428,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 877 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "POP.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_POP_Evod, DIS_EADDR32);
 
       
 
@@ -57454,7 +57446,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 877 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "POP.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_POP_Evod, DIS_EADDR32);
 
       
 
@@ -57472,7 +57464,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1760 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FADD.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FADD_R32, DIS_MEM32);
 
       
 
@@ -57490,7 +57482,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1760 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FADD.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FADD_R32, DIS_MEM32);
 
       
 
@@ -57508,7 +57500,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1760 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FADD.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FADD_R32, DIS_MEM32);
 
       
 
@@ -57526,7 +57518,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1954 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FMUL.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FMUL_R32, DIS_MEM32);
 
       
 
@@ -57544,7 +57536,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1954 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FMUL.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FMUL_R32, DIS_MEM32);
 
       
 
@@ -57562,7 +57554,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1954 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FMUL.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FMUL_R32, DIS_MEM32);
 
       
 
@@ -57580,7 +57572,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1793 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FCOM.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FCOM_R32, DIS_MEM32);
 
       
 
@@ -57598,7 +57590,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1793 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FCOM.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FCOM_R32, DIS_MEM32);
 
       
 
@@ -57616,7 +57608,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1793 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FCOM.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FCOM_R32, DIS_MEM32);
 
       
 
@@ -57634,7 +57626,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1805 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FCOMP.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FCOMP_R32, DIS_MEM32);
 
       
 
@@ -57652,7 +57644,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1805 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FCOMP.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FCOMP_R32, DIS_MEM32);
 
       
 
@@ -57670,7 +57662,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1805 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FCOMP.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FCOMP_R32, DIS_MEM32);
 
       
 
@@ -57688,7 +57680,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2044 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSUB.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FSUB_R32, DIS_MEM32);
 
       
 
@@ -57706,7 +57698,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2044 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSUB.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FSUB_R32, DIS_MEM32);
 
       
 
@@ -57724,7 +57716,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2044 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSUB.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FSUB_R32, DIS_MEM32);
 
       
 
@@ -57742,7 +57734,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2065 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSUBR.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FSUBR_R32, DIS_MEM32);
 
       
 
@@ -57760,7 +57752,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2065 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSUBR.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FSUBR_R32, DIS_MEM32);
 
       
 
@@ -57778,7 +57770,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2065 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSUBR.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FSUBR_R32, DIS_MEM32);
 
       
 
@@ -57796,7 +57788,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1838 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FDIV.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FDIV_R32, DIS_MEM32);
 
       
 
@@ -57814,7 +57806,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1838 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FDIV.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FDIV_R32, DIS_MEM32);
 
       
 
@@ -57832,7 +57824,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1838 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FDIV.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FDIV_R32, DIS_MEM32);
 
       
 
@@ -57850,7 +57842,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1859 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FDIVR.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FDIVR_R32, DIS_MEM32);
 
       
 
@@ -57868,7 +57860,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1859 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FDIVR.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FDIVR_R32, DIS_MEM32);
 
       
 
@@ -57886,7 +57878,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1859 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FDIVR.R32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FDIVR_R32, DIS_MEM32);
 
       
 
@@ -57904,7 +57896,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1910 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLD.lsR32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FLD_lsR32, DIS_MEM32);
 
       
 
@@ -57922,7 +57914,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1910 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLD.lsR32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FLD_lsR32, DIS_MEM32);
 
       
 
@@ -57940,7 +57932,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1910 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLD.lsR32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FLD_lsR32, DIS_MEM32);
 
       
 
@@ -57958,7 +57950,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2011 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FST.lsR32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FST_lsR32, DIS_MEM32);
 
       
 
@@ -57976,7 +57968,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2011 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FST.lsR32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FST_lsR32, DIS_MEM32);
 
       
 
@@ -57994,7 +57986,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2011 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FST.lsR32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FST_lsR32, DIS_MEM32);
 
       
 
@@ -58012,7 +58004,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2017 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTP.lsR32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FSTP_lsR32, DIS_MEM32);
 
       
 
@@ -58030,7 +58022,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2017 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTP.lsR32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FSTP_lsR32, DIS_MEM32);
 
       
 
@@ -58048,7 +58040,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2017 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTP.lsR32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FSTP_lsR32, DIS_MEM32);
 
       
 
@@ -58066,7 +58058,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1951 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLDENV", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_FLDENV, DIS_MEM);
 
       
 
@@ -58084,7 +58076,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1951 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLDENV", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_FLDENV, DIS_MEM);
 
       
 
@@ -58102,7 +58094,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1951 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLDENV", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_FLDENV, DIS_MEM);
 
       
 
@@ -58120,7 +58112,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1948 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLDCW", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FLDCW, DIS_MEM16);
 
       
 
@@ -58138,7 +58130,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1948 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLDCW", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FLDCW, DIS_MEM16);
 
       
 
@@ -58156,7 +58148,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1948 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLDCW", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FLDCW, DIS_MEM16);
 
       
 
@@ -58174,7 +58166,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2035 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTENV", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_FSTENV, DIS_MEM);
 
       
 
@@ -58192,7 +58184,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2035 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTENV", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_FSTENV, DIS_MEM);
 
       
 
@@ -58210,7 +58202,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2035 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTENV", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_FSTENV, DIS_MEM);
 
       
 
@@ -58228,7 +58220,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2032 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTCW", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FSTCW, DIS_MEM16);
 
       
 
@@ -58246,7 +58238,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2032 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTCW", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FSTCW, DIS_MEM16);
 
       
 
@@ -58264,7 +58256,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2032 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTCW", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FSTCW, DIS_MEM16);
 
       
 
@@ -58282,7 +58274,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1775 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIADD.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIADD_I32, DIS_MEM32);
 
       
 
@@ -58300,7 +58292,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1775 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIADD.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIADD_I32, DIS_MEM32);
 
       
 
@@ -58318,7 +58310,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1775 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIADD.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIADD_I32, DIS_MEM32);
 
       
 
@@ -58336,7 +58328,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1969 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIMUL.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIMUL_I32, DIS_MEM32);
 
       
 
@@ -58354,7 +58346,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1969 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIMUL.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIMUL_I32, DIS_MEM32);
 
       
 
@@ -58372,7 +58364,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1969 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIMUL.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIMUL_I32, DIS_MEM32);
 
       
 
@@ -58390,7 +58382,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1799 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FICOM.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FICOM_I32, DIS_MEM32);
 
       
 
@@ -58408,7 +58400,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1799 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FICOM.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FICOM_I32, DIS_MEM32);
 
       
 
@@ -58426,7 +58418,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1799 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FICOM.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FICOM_I32, DIS_MEM32);
 
       
 
@@ -58444,7 +58436,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1817 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FICOMP.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FICOMP_I32, DIS_MEM32);
 
       
 
@@ -58462,7 +58454,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1817 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FICOMP.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FICOMP_I32, DIS_MEM32);
 
       
 
@@ -58480,7 +58472,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1817 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FICOMP.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FICOMP_I32, DIS_MEM32);
 
       
 
@@ -58498,7 +58490,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2056 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISUB.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FISUB_I32, DIS_MEM32);
 
       
 
@@ -58516,7 +58508,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2056 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISUB.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FISUB_I32, DIS_MEM32);
 
       
 
@@ -58534,7 +58526,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2056 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISUB.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FISUB_I32, DIS_MEM32);
 
       
 
@@ -58552,7 +58544,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2077 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISUBR.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FISUBR_I32, DIS_MEM32);
 
       
 
@@ -58570,7 +58562,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2077 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISUBR.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FISUBR_I32, DIS_MEM32);
 
       
 
@@ -58588,7 +58580,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2077 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISUBR.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FISUBR_I32, DIS_MEM32);
 
       
 
@@ -58606,7 +58598,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1853 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIDIV.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIDIV_I32, DIS_MEM32);
 
       
 
@@ -58624,7 +58616,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1853 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIDIV.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIDIV_I32, DIS_MEM32);
 
       
 
@@ -58642,7 +58634,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1853 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIDIV.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIDIV_I32, DIS_MEM32);
 
       
 
@@ -58660,7 +58652,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1871 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIDIVR.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIDIVR_I32, DIS_MEM32);
 
       
 
@@ -58678,7 +58670,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1871 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIDIVR.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIDIVR_I32, DIS_MEM32);
 
       
 
@@ -58696,7 +58688,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1871 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIDIVR.I32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIDIVR_I32, DIS_MEM32);
 
       
 
@@ -58714,7 +58706,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1886 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FILD.lsI32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FILD_lsI32, DIS_MEM32);
 
       
 
@@ -58732,7 +58724,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1886 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FILD.lsI32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FILD_lsI32, DIS_MEM32);
 
       
 
@@ -58750,7 +58742,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1886 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FILD.lsI32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FILD_lsI32, DIS_MEM32);
 
       
 
@@ -58768,7 +58760,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1898 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIST.lsI32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIST_lsI32, DIS_MEM32);
 
       
 
@@ -58786,7 +58778,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1898 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIST.lsI32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIST_lsI32, DIS_MEM32);
 
       
 
@@ -58804,7 +58796,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1898 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIST.lsI32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FIST_lsI32, DIS_MEM32);
 
       
 
@@ -58822,7 +58814,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1904 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISTP.lsI32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FISTP_lsI32, DIS_MEM32);
 
       
 
@@ -58840,7 +58832,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1904 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISTP.lsI32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FISTP_lsI32, DIS_MEM32);
 
       
 
@@ -58858,7 +58850,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1904 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISTP.lsI32", DIS_MEM32);
+      		stmts = instantiate(pc,	 OP_FISTP_lsI32, DIS_MEM32);
 
       
 
@@ -58876,7 +58868,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1916 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLD80", DIS_MEM80);
+      		stmts = instantiate(pc,	 OP_FLD80, DIS_MEM80);
 
       
 
@@ -58904,7 +58896,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1916 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLD80", DIS_MEM80);
+      		stmts = instantiate(pc,	 OP_FLD80, DIS_MEM80);
 
       
 
@@ -58932,7 +58924,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1916 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLD80", DIS_MEM80);
+      		stmts = instantiate(pc,	 OP_FLD80, DIS_MEM80);
 
       
 
@@ -58960,7 +58952,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2023 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTP80", DIS_MEM80);
+      		stmts = instantiate(pc,	 OP_FSTP80, DIS_MEM80);
 
       
 
@@ -58978,7 +58970,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2023 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTP80", DIS_MEM80);
+      		stmts = instantiate(pc,	 OP_FSTP80, DIS_MEM80);
 
       
 
@@ -58996,7 +58988,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2023 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTP80", DIS_MEM80);
+      		stmts = instantiate(pc,	 OP_FSTP80, DIS_MEM80);
 
       
 
@@ -59014,7 +59006,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1763 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FADD.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FADD_R64, DIS_MEM64);
 
       
 
@@ -59032,7 +59024,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1763 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FADD.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FADD_R64, DIS_MEM64);
 
       
 
@@ -59050,7 +59042,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1763 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FADD.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FADD_R64, DIS_MEM64);
 
       
 
@@ -59068,7 +59060,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1957 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FMUL.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FMUL_R64, DIS_MEM64);
 
       
 
@@ -59086,7 +59078,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1957 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FMUL.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FMUL_R64, DIS_MEM64);
 
       
 
@@ -59104,7 +59096,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1957 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FMUL.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FMUL_R64, DIS_MEM64);
 
       
 
@@ -59122,7 +59114,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1796 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FCOM.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FCOM_R64, DIS_MEM64);
 
       
 
@@ -59140,7 +59132,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1796 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FCOM.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FCOM_R64, DIS_MEM64);
 
       
 
@@ -59158,7 +59150,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1796 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FCOM.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FCOM_R64, DIS_MEM64);
 
       
 
@@ -59176,7 +59168,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1808 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FCOMP.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FCOMP_R64, DIS_MEM64);
 
       
 
@@ -59194,7 +59186,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1808 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FCOMP.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FCOMP_R64, DIS_MEM64);
 
       
 
@@ -59212,7 +59204,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1808 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FCOMP.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FCOMP_R64, DIS_MEM64);
 
       
 
@@ -59230,7 +59222,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2047 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSUB.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FSUB_R64, DIS_MEM64);
 
       
 
@@ -59248,7 +59240,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2047 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSUB.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FSUB_R64, DIS_MEM64);
 
       
 
@@ -59266,7 +59258,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2047 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSUB.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FSUB_R64, DIS_MEM64);
 
       
 
@@ -59284,7 +59276,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2068 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSUBR.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FSUBR_R64, DIS_MEM64);
 
       
 
@@ -59302,7 +59294,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2068 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSUBR.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FSUBR_R64, DIS_MEM64);
 
       
 
@@ -59320,7 +59312,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2068 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSUBR.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FSUBR_R64, DIS_MEM64);
 
       
 
@@ -59338,7 +59330,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1841 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FDIV.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FDIV_R64, DIS_MEM64);
 
       
 
@@ -59356,7 +59348,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1841 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FDIV.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FDIV_R64, DIS_MEM64);
 
       
 
@@ -59374,7 +59366,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1841 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FDIV.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FDIV_R64, DIS_MEM64);
 
       
 
@@ -59392,7 +59384,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1862 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FDIVR.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FDIVR_R64, DIS_MEM64);
 
       
 
@@ -59410,7 +59402,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1862 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FDIVR.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FDIVR_R64, DIS_MEM64);
 
       
 
@@ -59428,7 +59420,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1862 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FDIVR.R64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FDIVR_R64, DIS_MEM64);
 
       
 
@@ -59446,7 +59438,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1913 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLD.lsR64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FLD_lsR64, DIS_MEM64);
 
       
 
@@ -59464,7 +59456,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1913 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLD.lsR64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FLD_lsR64, DIS_MEM64);
 
       
 
@@ -59482,7 +59474,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1913 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FLD.lsR64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FLD_lsR64, DIS_MEM64);
 
       
 
@@ -59500,7 +59492,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2014 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FST.lsR64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FST_lsR64, DIS_MEM64);
 
       
 
@@ -59518,7 +59510,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2014 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FST.lsR64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FST_lsR64, DIS_MEM64);
 
       
 
@@ -59536,7 +59528,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2014 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FST.lsR64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FST_lsR64, DIS_MEM64);
 
       
 
@@ -59554,7 +59546,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2020 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTP.lsR64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FSTP_lsR64, DIS_MEM64);
 
       
 
@@ -59572,7 +59564,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2020 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTP.lsR64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FSTP_lsR64, DIS_MEM64);
 
       
 
@@ -59590,7 +59582,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2020 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTP.lsR64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FSTP_lsR64, DIS_MEM64);
 
       
 
@@ -59608,7 +59600,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1993 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FRSTOR", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_FRSTOR, DIS_MEM);
 
       
 
@@ -59626,7 +59618,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1993 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FRSTOR", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_FRSTOR, DIS_MEM);
 
       
 
@@ -59644,7 +59636,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1993 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FRSTOR", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_FRSTOR, DIS_MEM);
 
       
 
@@ -59662,7 +59654,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1996 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FNSAVE", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_FNSAVE, DIS_MEM);
 
       
 
@@ -59680,7 +59672,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1996 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FNSAVE", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_FNSAVE, DIS_MEM);
 
       
 
@@ -59698,7 +59690,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1996 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FNSAVE", DIS_MEM);
+      		stmts = instantiate(pc,	 OP_FNSAVE, DIS_MEM);
 
       
 
@@ -59716,7 +59708,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2038 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTSW", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FSTSW, DIS_MEM16);
 
       
 
@@ -59734,7 +59726,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2038 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTSW", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FSTSW, DIS_MEM16);
 
       
 
@@ -59752,7 +59744,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2038 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FSTSW", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FSTSW, DIS_MEM16);
 
       
 
@@ -59770,7 +59762,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1778 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIADD.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIADD_I16, DIS_MEM16);
 
       
 
@@ -59788,7 +59780,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1778 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIADD.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIADD_I16, DIS_MEM16);
 
       
 
@@ -59806,7 +59798,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1778 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIADD.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIADD_I16, DIS_MEM16);
 
       
 
@@ -59824,7 +59816,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1972 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIMUL.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIMUL_I16, DIS_MEM16);
 
       
 
@@ -59842,7 +59834,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1972 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIMUL.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIMUL_I16, DIS_MEM16);
 
       
 
@@ -59860,7 +59852,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1972 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIMUL.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIMUL_I16, DIS_MEM16);
 
       
 
@@ -59878,7 +59870,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1802 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FICOM.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FICOM_I16, DIS_MEM16);
 
       
 
@@ -59896,7 +59888,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1802 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FICOM.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FICOM_I16, DIS_MEM16);
 
       
 
@@ -59914,7 +59906,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1802 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FICOM.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FICOM_I16, DIS_MEM16);
 
       
 
@@ -59932,7 +59924,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1820 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FICOMP.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FICOMP_I16, DIS_MEM16);
 
       
 
@@ -59950,7 +59942,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1820 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FICOMP.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FICOMP_I16, DIS_MEM16);
 
       
 
@@ -59968,7 +59960,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1820 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FICOMP.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FICOMP_I16, DIS_MEM16);
 
       
 
@@ -59986,7 +59978,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2059 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISUB.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FISUB_I16, DIS_MEM16);
 
       
 
@@ -60004,7 +59996,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2059 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISUB.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FISUB_I16, DIS_MEM16);
 
       
 
@@ -60022,7 +60014,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2059 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISUB.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FISUB_I16, DIS_MEM16);
 
       
 
@@ -60040,7 +60032,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2080 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISUBR.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FISUBR_I16, DIS_MEM16);
 
       
 
@@ -60058,7 +60050,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2080 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISUBR.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FISUBR_I16, DIS_MEM16);
 
       
 
@@ -60076,7 +60068,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 2080 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISUBR.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FISUBR_I16, DIS_MEM16);
 
       
 
@@ -60094,7 +60086,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1856 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIDIV.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIDIV_I16, DIS_MEM16);
 
       
 
@@ -60112,7 +60104,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1856 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIDIV.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIDIV_I16, DIS_MEM16);
 
       
 
@@ -60130,7 +60122,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1856 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIDIV.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIDIV_I16, DIS_MEM16);
 
       
 
@@ -60148,7 +60140,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1874 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIDIVR.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIDIVR_I16, DIS_MEM16);
 
       
 
@@ -60166,7 +60158,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1874 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIDIVR.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIDIVR_I16, DIS_MEM16);
 
       
 
@@ -60184,7 +60176,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1874 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIDIVR.I16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIDIVR_I16, DIS_MEM16);
 
       
 
@@ -60202,7 +60194,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1883 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FILD.lsI16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FILD_lsI16, DIS_MEM16);
 
       
 
@@ -60220,7 +60212,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1883 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FILD.lsI16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FILD_lsI16, DIS_MEM16);
 
       
 
@@ -60238,7 +60230,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1883 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FILD.lsI16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FILD_lsI16, DIS_MEM16);
 
       
 
@@ -60256,7 +60248,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1895 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIST.lsI16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIST_lsI16, DIS_MEM16);
 
       
 
@@ -60274,7 +60266,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1895 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIST.lsI16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIST_lsI16, DIS_MEM16);
 
       
 
@@ -60292,7 +60284,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1895 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FIST.lsI16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FIST_lsI16, DIS_MEM16);
 
       
 
@@ -60310,7 +60302,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1901 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISTP.lsI16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FISTP_lsI16, DIS_MEM16);
 
       
 
@@ -60328,7 +60320,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1901 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISTP.lsI16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FISTP_lsI16, DIS_MEM16);
 
       
 
@@ -60346,7 +60338,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1901 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISTP.lsI16", DIS_MEM16);
+      		stmts = instantiate(pc,	 OP_FISTP_lsI16, DIS_MEM16);
 
       
 
@@ -60364,7 +60356,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1781 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FBLD", DIS_MEM80);
+      		stmts = instantiate(pc,	 OP_FBLD, DIS_MEM80);
 
       
 
@@ -60382,7 +60374,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1781 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FBLD", DIS_MEM80);
+      		stmts = instantiate(pc,	 OP_FBLD, DIS_MEM80);
 
       
 
@@ -60400,7 +60392,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1781 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FBLD", DIS_MEM80);
+      		stmts = instantiate(pc,	 OP_FBLD, DIS_MEM80);
 
       
 
@@ -60418,7 +60410,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1889 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FILD.lsI64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FILD_lsI64, DIS_MEM64);
 
       
 
@@ -60436,7 +60428,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1889 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FILD.lsI64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FILD_lsI64, DIS_MEM64);
 
       
 
@@ -60454,7 +60446,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1889 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FILD.lsI64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FILD_lsI64, DIS_MEM64);
 
       
 
@@ -60472,7 +60464,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1784 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FBSTP", DIS_MEM80);
+      		stmts = instantiate(pc,	 OP_FBSTP, DIS_MEM80);
 
       
 
@@ -60490,7 +60482,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1784 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FBSTP", DIS_MEM80);
+      		stmts = instantiate(pc,	 OP_FBSTP, DIS_MEM80);
 
       
 
@@ -60508,7 +60500,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1784 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FBSTP", DIS_MEM80);
+      		stmts = instantiate(pc,	 OP_FBSTP, DIS_MEM80);
 
       
 
@@ -60526,7 +60518,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1907 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISTP64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FISTP64, DIS_MEM64);
 
       
 
@@ -60544,7 +60536,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1907 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISTP64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FISTP64, DIS_MEM64);
 
       
 
@@ -60562,7 +60554,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1907 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "FISTP64", DIS_MEM64);
+      		stmts = instantiate(pc,	 OP_FISTP64, DIS_MEM64);
 
       
 
@@ -60580,43 +60572,43 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1133 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INC.Eb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_INC_Eb, DIS_EADDR8);
 
       
 
       //	  | IN.eAX.DXod() =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.DXod");
+      //		  stmts = instantiate(pc,  OP_IN_eAX_DXod);
 
       
 
       //	  | IN.eAX.DXow() =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.DXow");
+      //		  stmts = instantiate(pc,  OP_IN_eAX_DXow);
 
       
 
       //	  | IN.AL.DX() =>
 
-      //		  stmts = instantiate(pc,  "IN.AL.DX");
+      //		  stmts = instantiate(pc,  OP_IN_AL_DX);
 
       
 
       //	  | IN.eAX.Ibod(i8) =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.Ibod", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_IN_eAX_Ibod, DIS_I8);
 
       
 
       //	  | IN.eAX.Ibow(i8) =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.Ibow", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_IN_eAX_Ibow, DIS_I8);
 
       
 
       //	  | IN.AL.Ib(i8) =>
 
-      //		  stmts = instantiate(pc,  "IN.AL.Ib", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_IN_AL_Ib, DIS_I8);
 
       
 
@@ -60634,43 +60626,43 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1133 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INC.Eb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_INC_Eb, DIS_EADDR8);
 
       
 
       //	  | IN.eAX.DXod() =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.DXod");
+      //		  stmts = instantiate(pc,  OP_IN_eAX_DXod);
 
       
 
       //	  | IN.eAX.DXow() =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.DXow");
+      //		  stmts = instantiate(pc,  OP_IN_eAX_DXow);
 
       
 
       //	  | IN.AL.DX() =>
 
-      //		  stmts = instantiate(pc,  "IN.AL.DX");
+      //		  stmts = instantiate(pc,  OP_IN_AL_DX);
 
       
 
       //	  | IN.eAX.Ibod(i8) =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.Ibod", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_IN_eAX_Ibod, DIS_I8);
 
       
 
       //	  | IN.eAX.Ibow(i8) =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.Ibow", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_IN_eAX_Ibow, DIS_I8);
 
       
 
       //	  | IN.AL.Ib(i8) =>
 
-      //		  stmts = instantiate(pc,  "IN.AL.Ib", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_IN_AL_Ib, DIS_I8);
 
       
 
@@ -60688,43 +60680,43 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1133 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INC.Eb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_INC_Eb, DIS_EADDR8);
 
       
 
       //	  | IN.eAX.DXod() =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.DXod");
+      //		  stmts = instantiate(pc,  OP_IN_eAX_DXod);
 
       
 
       //	  | IN.eAX.DXow() =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.DXow");
+      //		  stmts = instantiate(pc,  OP_IN_eAX_DXow);
 
       
 
       //	  | IN.AL.DX() =>
 
-      //		  stmts = instantiate(pc,  "IN.AL.DX");
+      //		  stmts = instantiate(pc,  OP_IN_AL_DX);
 
       
 
       //	  | IN.eAX.Ibod(i8) =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.Ibod", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_IN_eAX_Ibod, DIS_I8);
 
       
 
       //	  | IN.eAX.Ibow(i8) =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.Ibow", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_IN_eAX_Ibow, DIS_I8);
 
       
 
       //	  | IN.AL.Ib(i8) =>
 
-      //		  stmts = instantiate(pc,  "IN.AL.Ib", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_IN_AL_Ib, DIS_I8);
 
       
 
@@ -60742,43 +60734,43 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1133 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INC.Eb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_INC_Eb, DIS_EADDR8);
 
       
 
       //	  | IN.eAX.DXod() =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.DXod");
+      //		  stmts = instantiate(pc,  OP_IN_eAX_DXod);
 
       
 
       //	  | IN.eAX.DXow() =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.DXow");
+      //		  stmts = instantiate(pc,  OP_IN_eAX_DXow);
 
       
 
       //	  | IN.AL.DX() =>
 
-      //		  stmts = instantiate(pc,  "IN.AL.DX");
+      //		  stmts = instantiate(pc,  OP_IN_AL_DX);
 
       
 
       //	  | IN.eAX.Ibod(i8) =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.Ibod", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_IN_eAX_Ibod, DIS_I8);
 
       
 
       //	  | IN.eAX.Ibow(i8) =>
 
-      //		  stmts = instantiate(pc,  "IN.eAX.Ibow", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_IN_eAX_Ibow, DIS_I8);
 
       
 
       //	  | IN.AL.Ib(i8) =>
 
-      //		  stmts = instantiate(pc,  "IN.AL.Ib", DIS_I8);
+      //		  stmts = instantiate(pc,  OP_IN_AL_Ib, DIS_I8);
 
       
 
@@ -60796,7 +60788,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1217 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DEC.Eb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_DEC_Eb, DIS_EADDR8);
 
       
 
@@ -60814,7 +60806,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1217 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DEC.Eb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_DEC_Eb, DIS_EADDR8);
 
       
 
@@ -60832,7 +60824,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1217 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DEC.Eb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_DEC_Eb, DIS_EADDR8);
 
       
 
@@ -60850,7 +60842,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1217 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DEC.Eb", DIS_EADDR8);
+      		stmts = instantiate(pc,	 OP_DEC_Eb, DIS_EADDR8);
 
       
 
@@ -60868,7 +60860,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1127 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INC.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_INC_Evod, DIS_EADDR32);
 
       
 
@@ -60886,7 +60878,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1127 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INC.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_INC_Evod, DIS_EADDR32);
 
       
 
@@ -60904,7 +60896,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1127 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INC.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_INC_Evod, DIS_EADDR32);
 
       
 
@@ -60922,7 +60914,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1127 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "INC.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_INC_Evod, DIS_EADDR32);
 
       
 
@@ -60940,7 +60932,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1211 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DEC.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_DEC_Evod, DIS_EADDR32);
 
       
 
@@ -60958,7 +60950,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1211 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DEC.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_DEC_Evod, DIS_EADDR32);
 
       
 
@@ -60976,7 +60968,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1211 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DEC.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_DEC_Evod, DIS_EADDR32);
 
       
 
@@ -60994,7 +60986,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 1211 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "DEC.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_DEC_Evod, DIS_EADDR32);
 
       
 
@@ -61020,7 +61012,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       		// Mike: there should probably be a HLNwayCall class for this!
 
-      		stmts = instantiate(pc,	 "CALL.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_CALL_Evod, DIS_EADDR32);
 
       		CallStatement* newCall = new CallStatement;
 
@@ -61064,7 +61056,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       		// Mike: there should probably be a HLNwayCall class for this!
 
-      		stmts = instantiate(pc,	 "CALL.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_CALL_Evod, DIS_EADDR32);
 
       		CallStatement* newCall = new CallStatement;
 
@@ -61108,7 +61100,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       		// Mike: there should probably be a HLNwayCall class for this!
 
-      		stmts = instantiate(pc,	 "CALL.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_CALL_Evod, DIS_EADDR32);
 
       		CallStatement* newCall = new CallStatement;
 
@@ -61152,7 +61144,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 
       		// Mike: there should probably be a HLNwayCall class for this!
 
-      		stmts = instantiate(pc,	 "CALL.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_CALL_Evod, DIS_EADDR32);
 
       		CallStatement* newCall = new CallStatement;
 
@@ -61372,7 +61364,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 838 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "PUSH.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_PUSH_Evod, DIS_EADDR32);
 
       
 
@@ -61390,7 +61382,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 838 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "PUSH.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_PUSH_Evod, DIS_EADDR32);
 
       
 
@@ -61408,7 +61400,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 838 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "PUSH.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_PUSH_Evod, DIS_EADDR32);
 
       
 
@@ -61426,7 +61418,7 @@ DecodeResult& PentiumDecoder::decodeInstruction (ADDRESS pc, int delta)
 #line 838 "frontend/machine/pentium/decoder.m"
       
 
-      		stmts = instantiate(pc,	 "PUSH.Evod", DIS_EADDR32);
+      		stmts = instantiate(pc,	 OP_PUSH_Evod, DIS_EADDR32);
 
       
 
@@ -61959,10 +61951,11 @@ DWord PentiumDecoder::getDword (unsigned lc)
  * PARAMETERS:	   None
  * RETURNS:		   N/A
  *============================================================================*/
-PentiumDecoder::PentiumDecoder(Prog* prog) : NJMCDecoder(prog)
+PentiumDecoder::PentiumDecoder(Prog* prog) : NJMCDecoder(prog), BSFRstate(0)
 {
 	std::string file = Boomerang::get()->getProgPath() + "frontend/machine/pentium/pentium.ssl";
 	RTLDict.readSSLFile(file.c_str());
+	resolveOpcodes(opcodeNameTable, NUM_OPCODES);
 }
 
 // For now...
@@ -61970,7 +61963,7 @@ int PentiumDecoder::decodeAssemblyInstruction(unsigned, int)
 { return 0; }
 
 /*==============================================================================
- * FUNCTION:	   genBSFR
+ * FUNCTION:	   PentiumDecoder::genBSFR
  * OVERVIEW:	   Generate statements for the BSF and BSR series (Bit Scan Forward/Reverse)
  * PARAMETERS:	   pc: native PC address (start of the BSF/BSR instruction)
  *				   reg: an expression for the destination register
@@ -61981,8 +61974,7 @@ int PentiumDecoder::decodeAssemblyInstruction(unsigned, int)
  *				   numBytes: number of bytes this instruction
  * RETURNS:		   true if have to exit early (not in last state)
  *============================================================================*/
-static int BSFRstate = 0;		// State number for this state machine
-void genBSFR(ADDRESS pc, Exp* dest, Exp* modrm, int init, int size,
+void PentiumDecoder::genBSFR(ADDRESS pc, Exp* dest, Exp* modrm, int init, int size,
   OPER incdec, int numBytes) {
 	// Note the horrible hack needed here. We need initialisation code, and an extra branch, so the %SKIP/%RPT won't
 	// work. We need to emit 6 statements, but these need to be in 3 RTLs, since the destination of a branch has to be
@@ -62078,10 +62070,19 @@ void genBSFR(ADDRESS pc, Exp* dest, Exp* modrm, int init, int size,
 
 Exp *PentiumDecoder::addReloc(Exp *e)
 {
-	if (lastDwordLc != (unsigned)-1)
+	if (lastDwordLc != (unsigned)-1) {
+		if (prog->isRelocationAt(lastDwordLc)) {
+			result.reusable = false;			// addReloc may add a global
+			if (predecoding)
+				return e;
+		}
 		e = prog->addReloc(e, lastDwordLc);
+	}
 	return e;
 }
 
-
-
+const char* const PentiumDecoder::opcodeNameTable[] = {
+#define OPCODE(id, name) name,
+#include "pentiumopcodes.h"
+#undef OPCODE
+};
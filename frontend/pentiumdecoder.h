@@ -16,6 +16,8 @@
 /* 
  * $Revision: 1.6 $
  * 06 Jun 02 - Trent: Created.
+ * 17 Oct 26 - genBSFR and its state are members
+ * 17 Oct 26 - Opcodes of the instructions instantiated by a fixed name
  *
  */
 
@@ -61,7 +63,20 @@ private:
 	SWord	getWord(unsigned lc);
 	DWord	getDword(unsigned lc);
 
+	// Generate statements for the BSF/BSR series (Bit Scan Forward/Reverse)
+	void	genBSFR(ADDRESS pc, Exp* reg, Exp* modrm, int init, int size, OPER incdec, int numBytes);
+
 	unsigned lastDwordLc;
+	int		BSFRstate;		// State number for the genBSFR state machine
+
+	// The instructions that decoder.m instantiates by a fixed name, and their names (see NJMCDecoder::resolveOpcodes)
+	enum {
+#define OPCODE(id, name) id,
+#include "pentiumopcodes.h"
+#undef OPCODE
+		NUM_OPCODES
+	};
+	static const char* const opcodeNameTable[];
 };
 
 #endif
@@ -24,8 +24,12 @@
  *				Also more JE cases
  * 04 Aug 04 - Mike: Quick and dirty hack for overlapped registers (X86 only)
  * 31 Jul 06 - Tamlin: Fixed overlapped register processing for esi/edi/ebp plus a bug in ah/bh/ch/dh processing
+ * 17 Oct 26 - canDecodeFragment: not with x87 stack code
+ * 17 Oct 26 - LOG statements are in the LCAT_DECODE log category
 */
 
+#define LOG_CATEGORY LCAT_DECODE		// The category of this file's LOG statements (see boomerang.h)
+
 #include <assert.h>
 #include <cstring>
 #if defined(_MSC_VER) && _MSC_VER <= 1200
@@ -195,6 +199,30 @@ bool PentiumFrontEnd::processProc(ADDRESS uAddr, UserProc* pProc, std::ofstream
 	return true;
 }
 
+/*==============================================================================
+ * FUNCTION:	  PentiumFrontEnd::canDecodeFragment
+ * OVERVIEW:	  Check whether code can be decoded into a proc with decodeFragment. Not if the proc has x87 stack code:
+ *				  processProc processes the FPUSH and FPOP of a fragment as if the stack were empty at its start, as
+ *				  the code that leads to it has no FPUSH or FPOP left. The proc has to be decoded again in full
+ * PARAMETERS:	  proc - the procedure
+ * RETURNS:		  False if an assignment of proc defines one of the stack registers (st0 to st7)
+ *============================================================================*/
+bool PentiumFrontEnd::canDecodeFragment(UserProc* proc) {
+	StatementList stmts;
+	proc->getStatements(stmts);
+	for (StatementList::iterator it = stmts.begin(); it != stmts.end(); it++) {
+		if (!(*it)->isAssign())
+			continue;			// Calls and returns define st0 to st7 whether or not the proc has any x87 code
+		Exp* lhs = ((Assign*)*it)->getLeft();
+		if (lhs->isRegOfK()) {
+			int n = ((Const*)lhs->getSubExp1())->getInt();
+			if (n >= 32 && n <= 39)
+				return false;
+		}
+	}
+	return true;
+}
+
 std::vector<Exp*> &PentiumFrontEnd::getDefaultParams()
 {
 	static std::vector<Exp*> params;
@@ -573,6 +601,11 @@ PentiumFrontEnd::PentiumFrontEnd(BinaryFile *pBF, Prog* prog, BinaryFileFactory*
 	decoder = new PentiumDecoder(prog);
 }
 
+// A decoder for predecoding
+NJMCDecoder* PentiumFrontEnd::newDecoder() {
+	return new PentiumDecoder(prog);
+}
+
 // destructor
 PentiumFrontEnd::~PentiumFrontEnd()
 {
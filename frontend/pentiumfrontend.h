@@ -36,11 +36,18 @@ virtual platform	getFrontEndId() { return PLAT_PENTIUM; }
 virtual bool		processProc(ADDRESS uAddr, UserProc* pProc, std::ofstream &os, bool frag = false,
 						bool spec = false);
 
+	/*
+	 * Not if the proc has x87 stack code: the stack top at the start of each fragment is not known
+	 */
+virtual bool		canDecodeFragment(UserProc* proc);
+
 virtual std::vector<Exp*> &getDefaultParams();
 virtual std::vector<Exp*> &getDefaultReturns();
 
 virtual ADDRESS		getMainEntryPoint( bool &gotMain );
 
+virtual NJMCDecoder* newDecoder();
+
 private:
 
 	/*
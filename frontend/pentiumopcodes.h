@@ -0,0 +1,544 @@
+/*==============================================================================
+ * FILE:	   pentiumopcodes.h
+ * OVERVIEW:   The instructions that the Pentium decoder (machine/pentium/decoder.m) instantiates by a fixed name. Each
+ *				OPCODE(id, name) line gives an enumerator of PentiumDecoder and its name; the ids in the dictionary are looked
+ *				up once, when the decoder is set up (see NJMCDecoder::resolveOpcodes)
+ *============================================================================*/
+/*
+ * 17 Oct 26 - Created
+ */
+
+OPCODE(OP_CALL_Evod, "CALL.Evod")
+OPCODE(OP_XLATB, "XLATB")
+OPCODE(OP_XCHG_Ev_Gvod, "XCHG.Ev.Gvod")
+OPCODE(OP_XCHG_Ev_Gvow, "XCHG.Ev.Gvow")
+OPCODE(OP_XCHG_Eb_Gb, "XCHG.Eb.Gb")
+OPCODE(OP_NOP, "NOP")
+OPCODE(OP_XCHGeAXod, "XCHGeAXod")
+OPCODE(OP_XCHGeAXow, "XCHGeAXow")
+OPCODE(OP_XADD_Ev_Gvod, "XADD.Ev.Gvod")
+OPCODE(OP_XADD_Ev_Gvow, "XADD.Ev.Gvow")
+OPCODE(OP_XADD_Eb_Gb, "XADD.Eb.Gb")
+OPCODE(OP_WRMSR, "WRMSR")
+OPCODE(OP_WBINVD, "WBINVD")
+OPCODE(OP_WAIT, "WAIT")
+OPCODE(OP_VERW, "VERW")
+OPCODE(OP_VERR, "VERR")
+OPCODE(OP_TEST_Ev_Gvod, "TEST.Ev.Gvod")
+OPCODE(OP_TEST_Ev_Gvow, "TEST.Ev.Gvow")
+OPCODE(OP_TEST_Eb_Gb, "TEST.Eb.Gb")
+OPCODE(OP_TEST_Ed_Id, "TEST.Ed.Id")
+OPCODE(OP_TEST_Ew_Iw, "TEST.Ew.Iw")
+OPCODE(OP_TEST_Eb_Ib, "TEST.Eb.Ib")
+OPCODE(OP_TEST_eAX_Ivod, "TEST.eAX.Ivod")
+OPCODE(OP_TEST_eAX_Ivow, "TEST.eAX.Ivow")
+OPCODE(OP_TEST_AL_Ib, "TEST.AL.Ib")
+OPCODE(OP_STR, "STR")
+OPCODE(OP_STOSvod, "STOSvod")
+OPCODE(OP_STOSvow, "STOSvow")
+OPCODE(OP_STOSB, "STOSB")
+OPCODE(OP_STI, "STI")
+OPCODE(OP_STD, "STD")
+OPCODE(OP_STC, "STC")
+OPCODE(OP_SMSW, "SMSW")
+OPCODE(OP_SLDT, "SLDT")
+OPCODE(OP_SHLD_CLod, "SHLD.CLod")
+OPCODE(OP_SHLD_CLow, "SHLD.CLow")
+OPCODE(OP_SHRD_CLod, "SHRD.CLod")
+OPCODE(OP_SHRD_CLow, "SHRD.CLow")
+OPCODE(OP_SHLD_Ibod, "SHLD.Ibod")
+OPCODE(OP_SHLD_Ibow, "SHLD.Ibow")
+OPCODE(OP_SHRD_Ibod, "SHRD.Ibod")
+OPCODE(OP_SHRD_Ibow, "SHRD.Ibow")
+OPCODE(OP_SIDT, "SIDT")
+OPCODE(OP_SGDT, "SGDT")
+OPCODE(OP_SCASvod, "SCASvod")
+OPCODE(OP_SCASvow, "SCASvow")
+OPCODE(OP_SCASB, "SCASB")
+OPCODE(OP_SAHF, "SAHF")
+OPCODE(OP_RSM, "RSM")
+OPCODE(OP_RET_far_Iw, "RET.far.Iw")
+OPCODE(OP_RET_Iw, "RET.Iw")
+OPCODE(OP_RET_far, "RET.far")
+OPCODE(OP_RET, "RET")
+OPCODE(OP_REPNE, "REPNE")
+OPCODE(OP_REP, "REP")
+OPCODE(OP_RDMSR, "RDMSR")
+OPCODE(OP_SARB_Ev_Ibod, "SARB.Ev.Ibod")
+OPCODE(OP_SARB_Ev_Ibow, "SARB.Ev.Ibow")
+OPCODE(OP_SHRB_Ev_Ibod, "SHRB.Ev.Ibod")
+OPCODE(OP_SHRB_Ev_Ibow, "SHRB.Ev.Ibow")
+OPCODE(OP_SHLSALB_Ev_Ibod, "SHLSALB.Ev.Ibod")
+OPCODE(OP_SHLSALB_Ev_Ibow, "SHLSALB.Ev.Ibow")
+OPCODE(OP_RCRB_Ev_Ibod, "RCRB.Ev.Ibod")
+OPCODE(OP_RCRB_Ev_Ibow, "RCRB.Ev.Ibow")
+OPCODE(OP_RCLB_Ev_Ibod, "RCLB.Ev.Ibod")
+OPCODE(OP_RCLB_Ev_Ibow, "RCLB.Ev.Ibow")
+OPCODE(OP_RORB_Ev_Ibod, "RORB.Ev.Ibod")
+OPCODE(OP_RORB_Ev_Ibow, "RORB.Ev.Ibow")
+OPCODE(OP_ROLB_Ev_Ibod, "ROLB.Ev.Ibod")
+OPCODE(OP_ROLB_Ev_Ibow, "ROLB.Ev.Ibow")
+OPCODE(OP_SARB_Eb_Ib, "SARB.Eb.Ib")
+OPCODE(OP_SHRB_Eb_Ib, "SHRB.Eb.Ib")
+OPCODE(OP_SHLSALB_Eb_Ib, "SHLSALB.Eb.Ib")
+OPCODE(OP_RCRB_Eb_Ib, "RCRB.Eb.Ib")
+OPCODE(OP_RCLB_Eb_Ib, "RCLB.Eb.Ib")
+OPCODE(OP_RORB_Eb_Ib, "RORB.Eb.Ib")
+OPCODE(OP_ROLB_Eb_Ib, "ROLB.Eb.Ib")
+OPCODE(OP_SARB_Ev_CLod, "SARB.Ev.CLod")
+OPCODE(OP_SARB_Ev_CLow, "SARB.Ev.CLow")
+OPCODE(OP_SARB_Ev_1od, "SARB.Ev.1od")
+OPCODE(OP_SARB_Ev_1ow, "SARB.Ev.1ow")
+OPCODE(OP_SHRB_Ev_CLod, "SHRB.Ev.CLod")
+OPCODE(OP_SHRB_Ev_CLow, "SHRB.Ev.CLow")
+OPCODE(OP_SHRB_Ev_1od, "SHRB.Ev.1od")
+OPCODE(OP_SHRB_Ev_1ow, "SHRB.Ev.1ow")
+OPCODE(OP_SHLSALB_Ev_CLod, "SHLSALB.Ev.CLod")
+OPCODE(OP_SHLSALB_Ev_CLow, "SHLSALB.Ev.CLow")
+OPCODE(OP_SHLSALB_Ev_1od, "SHLSALB.Ev.1od")
+OPCODE(OP_SHLSALB_Ev_1ow, "SHLSALB.Ev.1ow")
+OPCODE(OP_RCRB_Ev_CLod, "RCRB.Ev.CLod")
+OPCODE(OP_RCRB_Ev_CLow, "RCRB.Ev.CLow")
+OPCODE(OP_RCRB_Ev_1od, "RCRB.Ev.1od")
+OPCODE(OP_RCRB_Ev_1ow, "RCRB.Ev.1ow")
+OPCODE(OP_RCLB_Ev_CLod, "RCLB.Ev.CLod")
+OPCODE(OP_RCLB_Ev_CLow, "RCLB.Ev.CLow")
+OPCODE(OP_RCLB_Ev_1od, "RCLB.Ev.1od")
+OPCODE(OP_RCLB_Ev_1ow, "RCLB.Ev.1ow")
+OPCODE(OP_RORB_Ev_CLod, "RORB.Ev.CLod")
+OPCODE(OP_RORB_Ev_CLow, "RORB.Ev.CLow")
+OPCODE(OP_RORB_Ev_1od, "RORB.Ev.1od")
+OPCODE(OP_ORB_Ev_1owR, "ORB.Ev.1owR")
+OPCODE(OP_ROLB_Ev_CLod, "ROLB.Ev.CLod")
+OPCODE(OP_ROLB_Ev_CLow, "ROLB.Ev.CLow")
+OPCODE(OP_ROLB_Ev_1od, "ROLB.Ev.1od")
+OPCODE(OP_ROLB_Ev_1ow, "ROLB.Ev.1ow")
+OPCODE(OP_SARB_Eb_CL, "SARB.Eb.CL")
+OPCODE(OP_SARB_Eb_1, "SARB.Eb.1")
+OPCODE(OP_SHRB_Eb_CL, "SHRB.Eb.CL")
+OPCODE(OP_SHRB_Eb_1, "SHRB.Eb.1")
+OPCODE(OP_SHLSALB_Eb_CL, "SHLSALB.Eb.CL")
+OPCODE(OP_SHLSALB_Eb_1, "SHLSALB.Eb.1")
+OPCODE(OP_RCRB_Eb_CL, "RCRB.Eb.CL")
+OPCODE(OP_RCRB_Eb_1, "RCRB.Eb.1")
+OPCODE(OP_RCLB_Eb_CL, "RCLB.Eb.CL")
+OPCODE(OP_RCLB_Eb_1, "RCLB.Eb.1")
+OPCODE(OP_RORB_Eb_CL, "RORB.Eb.CL")
+OPCODE(OP_RORB_Eb_1, "RORB.Eb.1")
+OPCODE(OP_ROLB_Eb_CL, "ROLB.Eb.CL")
+OPCODE(OP_ROLB_Eb_1, "ROLB.Eb.1")
+OPCODE(OP_PUSHFod, "PUSHFod")
+OPCODE(OP_PUSHFow, "PUSHFow")
+OPCODE(OP_PUSHAod, "PUSHAod")
+OPCODE(OP_PUSHAow, "PUSHAow")
+OPCODE(OP_PUSH_GS, "PUSH.GS")
+OPCODE(OP_PUSH_FS, "PUSH.FS")
+OPCODE(OP_PUSH_ES, "PUSH.ES")
+OPCODE(OP_PUSH_DS, "PUSH.DS")
+OPCODE(OP_PUSH_SS, "PUSH.SS")
+OPCODE(OP_PUSH_CS, "PUSH.CS")
+OPCODE(OP_PUSH_Ivod, "PUSH.Ivod")
+OPCODE(OP_PUSH_Ivow, "PUSH.Ivow")
+OPCODE(OP_PUSH_Ixob, "PUSH.Ixob")
+OPCODE(OP_PUSH_Ixow, "PUSH.Ixow")
+OPCODE(OP_PUSHod, "PUSHod")
+OPCODE(OP_PUSHow, "PUSHow")
+OPCODE(OP_PUSH_Evod, "PUSH.Evod")
+OPCODE(OP_PUSH_Evow, "PUSH.Evow")
+OPCODE(OP_POPFod, "POPFod")
+OPCODE(OP_POPFow, "POPFow")
+OPCODE(OP_POPAod, "POPAod")
+OPCODE(OP_POPAow, "POPAow")
+OPCODE(OP_POP_GS, "POP.GS")
+OPCODE(OP_POP_FS, "POP.FS")
+OPCODE(OP_POP_DS, "POP.DS")
+OPCODE(OP_POP_SS, "POP.SS")
+OPCODE(OP_POP_ES, "POP.ES")
+OPCODE(OP_POPod, "POPod")
+OPCODE(OP_POPow, "POPow")
+OPCODE(OP_POP_Evod, "POP.Evod")
+OPCODE(OP_POP_Evow, "POP.Evow")
+OPCODE(OP_OUTSvod, "OUTSvod")
+OPCODE(OP_OUTSvow, "OUTSvow")
+OPCODE(OP_OUTSB, "OUTSB")
+OPCODE(OP_OUT_DX_eAXod, "OUT.DX.eAXod")
+OPCODE(OP_OUT_DX_eAXow, "OUT.DX.eAXow")
+OPCODE(OP_OUT_DX_AL, "OUT.DX.AL")
+OPCODE(OP_OUT_Ib_eAXod, "OUT.Ib.eAXod")
+OPCODE(OP_OUT_Ib_eAXow, "OUT.Ib.eAXow")
+OPCODE(OP_OUT_Ib_AL, "OUT.Ib.AL")
+OPCODE(OP_NOTod, "NOTod")
+OPCODE(OP_NOTow, "NOTow")
+OPCODE(OP_NOTb, "NOTb")
+OPCODE(OP_NEGod, "NEGod")
+OPCODE(OP_NEGow, "NEGow")
+OPCODE(OP_NEGb, "NEGb")
+OPCODE(OP_MUL_AXod, "MUL.AXod")
+OPCODE(OP_MUL_AXow, "MUL.AXow")
+OPCODE(OP_MUL_AL, "MUL.AL")
+OPCODE(OP_MOVZX_Gv_Ew, "MOVZX.Gv.Ew")
+OPCODE(OP_MOVZX_Gv_Ebod, "MOVZX.Gv.Ebod")
+OPCODE(OP_MOVZX_Gv_Ebow, "MOVZX.Gv.Ebow")
+OPCODE(OP_MOVSX_Gv_Ew, "MOVSX.Gv.Ew")
+OPCODE(OP_MOVSX_Gv_Ebod, "MOVSX.Gv.Ebod")
+OPCODE(OP_MOVSvod, "MOVSvod")
+OPCODE(OP_MOVSvow, "MOVSvow")
+OPCODE(OP_MOVSB, "MOVSB")
+OPCODE(OP_UNIMP, "UNIMP")
+OPCODE(OP_MOV_Ed_Ivod, "MOV.Ed.Ivod")
+OPCODE(OP_MOV_Ew_Ivow, "MOV.Ew.Ivow")
+OPCODE(OP_MOV_Eb_Ib, "MOV.Eb.Ib")
+OPCODE(OP_MOVid, "MOVid")
+OPCODE(OP_MOViw, "MOViw")
+OPCODE(OP_MOVib, "MOVib")
+OPCODE(OP_MOV_Ov_eAXod, "MOV.Ov.eAXod")
+OPCODE(OP_MOV_Ov_eAXow, "MOV.Ov.eAXow")
+OPCODE(OP_MOV_Ob_AL, "MOV.Ob.AL")
+OPCODE(OP_MOV_eAX_Ovod, "MOV.eAX.Ovod")
+OPCODE(OP_MOV_eAX_Ovow, "MOV.eAX.Ovow")
+OPCODE(OP_MOV_AL_Ob, "MOV.AL.Ob")
+OPCODE(OP_MOV_Sw_Ew, "MOV.Sw.Ew")
+OPCODE(OP_MOV_Ew_Sw, "MOV.Ew.Sw")
+OPCODE(OP_MOVrmod, "MOVrmod")
+OPCODE(OP_MOVrmow, "MOVrmow")
+OPCODE(OP_MOVrmb, "MOVrmb")
+OPCODE(OP_MOVmrod, "MOVmrod")
+OPCODE(OP_MOVmrow, "MOVmrow")
+OPCODE(OP_MOVmrb, "MOVmrb")
+OPCODE(OP_LTR, "LTR")
+OPCODE(OP_LSS, "LSS")
+OPCODE(OP_LSLod, "LSLod")
+OPCODE(OP_LSLow, "LSLow")
+OPCODE(OP_LOOPNE, "LOOPNE")
+OPCODE(OP_LOOPE, "LOOPE")
+OPCODE(OP_LOOP, "LOOP")
+OPCODE(OP_LGS, "LGS")
+OPCODE(OP_LFS, "LFS")
+OPCODE(OP_LES, "LES")
+OPCODE(OP_LEAVE, "LEAVE")
+OPCODE(OP_LEA_od, "LEA.od")
+OPCODE(OP_LEA_ow, "LEA.ow")
+OPCODE(OP_LDS, "LDS")
+OPCODE(OP_LAR_od, "LAR.od")
+OPCODE(OP_LAR_ow, "LAR.ow")
+OPCODE(OP_LAHF, "LAHF")
+OPCODE(OP_IRET, "IRET")
+OPCODE(OP_INVLPG, "INVLPG")
+OPCODE(OP_INVD, "INVD")
+OPCODE(OP_INTO, "INTO")
+OPCODE(OP_INT_Ib, "INT.Ib")
+OPCODE(OP_INT3, "INT3")
+OPCODE(OP_INSvod, "INSvod")
+OPCODE(OP_INSvow, "INSvow")
+OPCODE(OP_INSB, "INSB")
+OPCODE(OP_INCod, "INCod")
+OPCODE(OP_INCow, "INCow")
+OPCODE(OP_INC_Evod, "INC.Evod")
+OPCODE(OP_INC_Evow, "INC.Evow")
+OPCODE(OP_INC_Eb, "INC.Eb")
+OPCODE(OP_IN_eAX_DXod, "IN.eAX.DXod")
+OPCODE(OP_IN_eAX_DXow, "IN.eAX.DXow")
+OPCODE(OP_IN_AL_DX, "IN.AL.DX")
+OPCODE(OP_IN_eAX_Ibod, "IN.eAX.Ibod")
+OPCODE(OP_IN_eAX_Ibow, "IN.eAX.Ibow")
+OPCODE(OP_IN_AL_Ib, "IN.AL.Ib")
+OPCODE(OP_IMUL_Ivd, "IMUL.Ivd")
+OPCODE(OP_IMUL_Ivw, "IMUL.Ivw")
+OPCODE(OP_IMUL_Ibod, "IMUL.Ibod")
+OPCODE(OP_IMUL_Ibow, "IMUL.Ibow")
+OPCODE(OP_IMULrmod, "IMULrmod")
+OPCODE(OP_IMULrmow, "IMULrmow")
+OPCODE(OP_IMULod, "IMULod")
+OPCODE(OP_IMULow, "IMULow")
+OPCODE(OP_IMULb, "IMULb")
+OPCODE(OP_IDIVeAX, "IDIVeAX")
+OPCODE(OP_IDIVAX, "IDIVAX")
+OPCODE(OP_IDIV, "IDIV")
+OPCODE(OP_HLT, "HLT")
+OPCODE(OP_ENTER, "ENTER")
+OPCODE(OP_DIVeAX, "DIVeAX")
+OPCODE(OP_DIVAX, "DIVAX")
+OPCODE(OP_DIVAL, "DIVAL")
+OPCODE(OP_DECod, "DECod")
+OPCODE(OP_DECow, "DECow")
+OPCODE(OP_DEC_Evod, "DEC.Evod")
+OPCODE(OP_DEC_Evow, "DEC.Evow")
+OPCODE(OP_DEC_Eb, "DEC.Eb")
+OPCODE(OP_DAS, "DAS")
+OPCODE(OP_DAA, "DAA")
+OPCODE(OP_CDQ, "CDQ")
+OPCODE(OP_CWD, "CWD")
+OPCODE(OP_CPUID, "CPUID")
+OPCODE(OP_CMPXCHG8B, "CMPXCHG8B")
+OPCODE(OP_CMPXCHG_Ev_Gvod, "CMPXCHG.Ev.Gvod")
+OPCODE(OP_CMPXCHG_Ev_Gvow, "CMPXCHG.Ev.Gvow")
+OPCODE(OP_CMPXCHG_Eb_Gb, "CMPXCHG.Eb.Gb")
+OPCODE(OP_CMPSvod, "CMPSvod")
+OPCODE(OP_CMPSvow, "CMPSvow")
+OPCODE(OP_CMPSB, "CMPSB")
+OPCODE(OP_CMC, "CMC")
+OPCODE(OP_CLTS, "CLTS")
+OPCODE(OP_CLI, "CLI")
+OPCODE(OP_CLD, "CLD")
+OPCODE(OP_CLC, "CLC")
+OPCODE(OP_CWDE, "CWDE")
+OPCODE(OP_CBW, "CBW")
+OPCODE(OP_CALL_Jvod, "CALL.Jvod")
+OPCODE(OP_BTSiod, "BTSiod")
+OPCODE(OP_BTSiow, "BTSiow")
+OPCODE(OP_BTSod, "BTSod")
+OPCODE(OP_BTSow, "BTSow")
+OPCODE(OP_BTRiod, "BTRiod")
+OPCODE(OP_BTRiow, "BTRiow")
+OPCODE(OP_BTRod, "BTRod")
+OPCODE(OP_BTRow, "BTRow")
+OPCODE(OP_BTCiod, "BTCiod")
+OPCODE(OP_BTCiow, "BTCiow")
+OPCODE(OP_BTCod, "BTCod")
+OPCODE(OP_BTCow, "BTCow")
+OPCODE(OP_BTiod, "BTiod")
+OPCODE(OP_BTiow, "BTiow")
+OPCODE(OP_BTod, "BTod")
+OPCODE(OP_BTow, "BTow")
+OPCODE(OP_BSWAP, "BSWAP")
+OPCODE(OP_BSRod, "BSRod")
+OPCODE(OP_BSRow, "BSRow")
+OPCODE(OP_BSFod, "BSFod")
+OPCODE(OP_BSFow, "BSFow")
+OPCODE(OP_BOUNDod, "BOUNDod")
+OPCODE(OP_BOUNDow, "BOUNDow")
+OPCODE(OP_AAS, "AAS")
+OPCODE(OP_AAM, "AAM")
+OPCODE(OP_AAD, "AAD")
+OPCODE(OP_AAA, "AAA")
+OPCODE(OP_CMPrmod, "CMPrmod")
+OPCODE(OP_CMPrmow, "CMPrmow")
+OPCODE(OP_XORrmod, "XORrmod")
+OPCODE(OP_XORrmow, "XORrmow")
+OPCODE(OP_SUBrmod, "SUBrmod")
+OPCODE(OP_SUBrmow, "SUBrmow")
+OPCODE(OP_ANDrmod, "ANDrmod")
+OPCODE(OP_ANDrmow, "ANDrmow")
+OPCODE(OP_SBBrmod, "SBBrmod")
+OPCODE(OP_SBBrmow, "SBBrmow")
+OPCODE(OP_ADCrmod, "ADCrmod")
+OPCODE(OP_ADCrmow, "ADCrmow")
+OPCODE(OP_ORrmod, "ORrmod")
+OPCODE(OP_ORrmow, "ORrmow")
+OPCODE(OP_ADDrmod, "ADDrmod")
+OPCODE(OP_ADDrmow, "ADDrmow")
+OPCODE(OP_CMPrmb, "CMPrmb")
+OPCODE(OP_XORrmb, "XORrmb")
+OPCODE(OP_SUBrmb, "SUBrmb")
+OPCODE(OP_ANDrmb, "ANDrmb")
+OPCODE(OP_SBBrmb, "SBBrmb")
+OPCODE(OP_ADCrmb, "ADCrmb")
+OPCODE(OP_ORrmb, "ORrmb")
+OPCODE(OP_ADDrmb, "ADDrmb")
+OPCODE(OP_CMPmrod, "CMPmrod")
+OPCODE(OP_CMPmrow, "CMPmrow")
+OPCODE(OP_XORmrod, "XORmrod")
+OPCODE(OP_XORmrow, "XORmrow")
+OPCODE(OP_SUBmrod, "SUBmrod")
+OPCODE(OP_SUBmrow, "SUBmrow")
+OPCODE(OP_ANDmrod, "ANDmrod")
+OPCODE(OP_ANDmrow, "ANDmrow")
+OPCODE(OP_SBBmrod, "SBBmrod")
+OPCODE(OP_SBBmrow, "SBBmrow")
+OPCODE(OP_ADCmrod, "ADCmrod")
+OPCODE(OP_ADCmrow, "ADCmrow")
+OPCODE(OP_ORmrod, "ORmrod")
+OPCODE(OP_ORmrow, "ORmrow")
+OPCODE(OP_ADDmrod, "ADDmrod")
+OPCODE(OP_ADDmrow, "ADDmrow")
+OPCODE(OP_CMPmrb, "CMPmrb")
+OPCODE(OP_XORmrb, "XORmrb")
+OPCODE(OP_SUBmrb, "SUBmrb")
+OPCODE(OP_ANDmrb, "ANDmrb")
+OPCODE(OP_SBBmrb, "SBBmrb")
+OPCODE(OP_ADCmrb, "ADCmrb")
+OPCODE(OP_ORmrb, "ORmrb")
+OPCODE(OP_ADDmrb, "ADDmrb")
+OPCODE(OP_CMPiodb, "CMPiodb")
+OPCODE(OP_CMPiowb, "CMPiowb")
+OPCODE(OP_XORiodb, "XORiodb")
+OPCODE(OP_XORiowb, "XORiowb")
+OPCODE(OP_SUBiodb, "SUBiodb")
+OPCODE(OP_SUBiowb, "SUBiowb")
+OPCODE(OP_ANDiodb, "ANDiodb")
+OPCODE(OP_ANDiowb, "ANDiowb")
+OPCODE(OP_SBBiodb, "SBBiodb")
+OPCODE(OP_SBBiowb, "SBBiowb")
+OPCODE(OP_ADCiodb, "ADCiodb")
+OPCODE(OP_ADCiowb, "ADCiowb")
+OPCODE(OP_ORiodb, "ORiodb")
+OPCODE(OP_ORiowb, "ORiowb")
+OPCODE(OP_ADDiodb, "ADDiodb")
+OPCODE(OP_ADDiowb, "ADDiowb")
+OPCODE(OP_CMPid, "CMPid")
+OPCODE(OP_XORid, "XORid")
+OPCODE(OP_SUBid, "SUBid")
+OPCODE(OP_ANDid, "ANDid")
+OPCODE(OP_SBBid, "SBBid")
+OPCODE(OP_ADCid, "ADCid")
+OPCODE(OP_ORid, "ORid")
+OPCODE(OP_ADDid, "ADDid")
+OPCODE(OP_CMPiw, "CMPiw")
+OPCODE(OP_XORiw, "XORiw")
+OPCODE(OP_SUBiw, "SUBiw")
+OPCODE(OP_ANDiw, "ANDiw")
+OPCODE(OP_SBBiw, "SBBiw")
+OPCODE(OP_ADCiw, "ADCiw")
+OPCODE(OP_ORiw, "ORiw")
+OPCODE(OP_ADDiw, "ADDiw")
+OPCODE(OP_CMPib, "CMPib")
+OPCODE(OP_XORib, "XORib")
+OPCODE(OP_SUBib, "SUBib")
+OPCODE(OP_ANDib, "ANDib")
+OPCODE(OP_SBBib, "SBBib")
+OPCODE(OP_ADCib, "ADCib")
+OPCODE(OP_ORib, "ORib")
+OPCODE(OP_ADDib, "ADDib")
+OPCODE(OP_CMPiEAX, "CMPiEAX")
+OPCODE(OP_XORiEAX, "XORiEAX")
+OPCODE(OP_SUBiEAX, "SUBiEAX")
+OPCODE(OP_ANDiEAX, "ANDiEAX")
+OPCODE(OP_SBBiEAX, "SBBiEAX")
+OPCODE(OP_ADCiEAX, "ADCiEAX")
+OPCODE(OP_ORiEAX, "ORiEAX")
+OPCODE(OP_ADDiEAX, "ADDiEAX")
+OPCODE(OP_CMPiAX, "CMPiAX")
+OPCODE(OP_XORiAX, "XORiAX")
+OPCODE(OP_SUBiAX, "SUBiAX")
+OPCODE(OP_ANDiAX, "ANDiAX")
+OPCODE(OP_SBBiAX, "SBBiAX")
+OPCODE(OP_ADCiAX, "ADCiAX")
+OPCODE(OP_ORiAX, "ORiAX")
+OPCODE(OP_ADDiAX, "ADDiAX")
+OPCODE(OP_CMPiAL, "CMPiAL")
+OPCODE(OP_XORiAL, "XORiAL")
+OPCODE(OP_SUBiAL, "SUBiAL")
+OPCODE(OP_ANDiAL, "ANDiAL")
+OPCODE(OP_SBBiAL, "SBBiAL")
+OPCODE(OP_ADCiAL, "ADCiAL")
+OPCODE(OP_ORiAL, "ORiAL")
+OPCODE(OP_ADDiAL, "ADDiAL")
+OPCODE(OP_LODSvod, "LODSvod")
+OPCODE(OP_LODSvow, "LODSvow")
+OPCODE(OP_LODSB, "LODSB")
+OPCODE(OP_F2XM1, "F2XM1")
+OPCODE(OP_FABS, "FABS")
+OPCODE(OP_FADD_R32, "FADD.R32")
+OPCODE(OP_FADD_R64, "FADD.R64")
+OPCODE(OP_FADD_St_STi, "FADD.St.STi")
+OPCODE(OP_FADD_STi_ST, "FADD.STi.ST")
+OPCODE(OP_FADDP_STi_ST, "FADDP.STi.ST")
+OPCODE(OP_FIADD_I32, "FIADD.I32")
+OPCODE(OP_FIADD_I16, "FIADD.I16")
+OPCODE(OP_FBLD, "FBLD")
+OPCODE(OP_FBSTP, "FBSTP")
+OPCODE(OP_FCHS, "FCHS")
+OPCODE(OP_FNCLEX, "FNCLEX")
+OPCODE(OP_FCOM_R32, "FCOM.R32")
+OPCODE(OP_FCOM_R64, "FCOM.R64")
+OPCODE(OP_FICOM_I32, "FICOM.I32")
+OPCODE(OP_FICOM_I16, "FICOM.I16")
+OPCODE(OP_FCOMP_R32, "FCOMP.R32")
+OPCODE(OP_FCOMP_R64, "FCOMP.R64")
+OPCODE(OP_FCOM_ST_STi, "FCOM.ST.STi")
+OPCODE(OP_FCOMP_ST_STi, "FCOMP.ST.STi")
+OPCODE(OP_FICOMP_I32, "FICOMP.I32")
+OPCODE(OP_FICOMP_I16, "FICOMP.I16")
+OPCODE(OP_FCOMPP, "FCOMPP")
+OPCODE(OP_FCOS, "FCOS")
+OPCODE(OP_FDECSTP, "FDECSTP")
+OPCODE(OP_FDIV_R32, "FDIV.R32")
+OPCODE(OP_FDIV_R64, "FDIV.R64")
+OPCODE(OP_FDIV_ST_STi, "FDIV.ST.STi")
+OPCODE(OP_FDIV_STi_ST, "FDIV.STi.ST")
+OPCODE(OP_FDIVP_STi_ST, "FDIVP.STi.ST")
+OPCODE(OP_FIDIV_I32, "FIDIV.I32")
+OPCODE(OP_FIDIV_I16, "FIDIV.I16")
+OPCODE(OP_FDIVR_R32, "FDIVR.R32")
+OPCODE(OP_FDIVR_R64, "FDIVR.R64")
+OPCODE(OP_FDIVR_ST_STi, "FDIVR.ST.STi")
+OPCODE(OP_FDIVR_STi_ST, "FDIVR.STi.ST")
+OPCODE(OP_FIDIVR_I32, "FIDIVR.I32")
+OPCODE(OP_FIDIVR_I16, "FIDIVR.I16")
+OPCODE(OP_FDIVRP_STi_ST, "FDIVRP.STi.ST")
+OPCODE(OP_FFREE, "FFREE")
+OPCODE(OP_FILD_lsI16, "FILD.lsI16")
+OPCODE(OP_FILD_lsI32, "FILD.lsI32")
+OPCODE(OP_FILD_lsI64, "FILD.lsI64")
+OPCODE(OP_FINIT, "FINIT")
+OPCODE(OP_FIST_lsI16, "FIST.lsI16")
+OPCODE(OP_FIST_lsI32, "FIST.lsI32")
+OPCODE(OP_FISTP_lsI16, "FISTP.lsI16")
+OPCODE(OP_FISTP_lsI32, "FISTP.lsI32")
+OPCODE(OP_FISTP64, "FISTP64")
+OPCODE(OP_FLD_lsR32, "FLD.lsR32")
+OPCODE(OP_FLD_lsR64, "FLD.lsR64")
+OPCODE(OP_FLD80, "FLD80")
+OPCODE(OP_FLD_STi, "FLD.STi")
+OPCODE(OP_FLD1, "FLD1")
+OPCODE(OP_FLDL2T, "FLDL2T")
+OPCODE(OP_FLDL2E, "FLDL2E")
+OPCODE(OP_FLDPI, "FLDPI")
+OPCODE(OP_FLDLG2, "FLDLG2")
+OPCODE(OP_FLDLN2, "FLDLN2")
+OPCODE(OP_FLDZ, "FLDZ")
+OPCODE(OP_FLDCW, "FLDCW")
+OPCODE(OP_FLDENV, "FLDENV")
+OPCODE(OP_FMUL_R32, "FMUL.R32")
+OPCODE(OP_FMUL_R64, "FMUL.R64")
+OPCODE(OP_FMUL_ST_STi, "FMUL.ST.STi")
+OPCODE(OP_FMUL_STi_ST, "FMUL.STi.ST")
+OPCODE(OP_FMULP_STi_ST, "FMULP.STi.ST")
+OPCODE(OP_FIMUL_I32, "FIMUL.I32")
+OPCODE(OP_FIMUL_I16, "FIMUL.I16")
+OPCODE(OP_FNOP, "FNOP")
+OPCODE(OP_FPATAN, "FPATAN")
+OPCODE(OP_FPREM, "FPREM")
+OPCODE(OP_FPREM1, "FPREM1")
+OPCODE(OP_FPTAN, "FPTAN")
+OPCODE(OP_FRNDINT, "FRNDINT")
+OPCODE(OP_FRSTOR, "FRSTOR")
+OPCODE(OP_FNSAVE, "FNSAVE")
+OPCODE(OP_FSCALE, "FSCALE")
+OPCODE(OP_FSIN, "FSIN")
+OPCODE(OP_FSINCOS, "FSINCOS")
+OPCODE(OP_FSQRT, "FSQRT")
+OPCODE(OP_FST_lsR32, "FST.lsR32")
+OPCODE(OP_FST_lsR64, "FST.lsR64")
+OPCODE(OP_FSTP_lsR32, "FSTP.lsR32")
+OPCODE(OP_FSTP_lsR64, "FSTP.lsR64")
+OPCODE(OP_FSTP80, "FSTP80")
+OPCODE(OP_FST_st_STi, "FST.st.STi")
+OPCODE(OP_FSTP_st_STi, "FSTP.st.STi")
+OPCODE(OP_FSTCW, "FSTCW")
+OPCODE(OP_FSTENV, "FSTENV")
+OPCODE(OP_FSTSW, "FSTSW")
+OPCODE(OP_FSTSW_AX, "FSTSW.AX")
+OPCODE(OP_FSUB_R32, "FSUB.R32")
+OPCODE(OP_FSUB_R64, "FSUB.R64")
+OPCODE(OP_FSUB_ST_STi, "FSUB.ST.STi")
+OPCODE(OP_FSUB_STi_ST, "FSUB.STi.ST")
+OPCODE(OP_FISUB_I32, "FISUB.I32")
+OPCODE(OP_FISUB_I16, "FISUB.I16")
+OPCODE(OP_FSUBP_STi_ST, "FSUBP.STi.ST")
+OPCODE(OP_FSUBR_R32, "FSUBR.R32")
+OPCODE(OP_FSUBR_R64, "FSUBR.R64")
+OPCODE(OP_FSUBR_ST_STi, "FSUBR.ST.STi")
+OPCODE(OP_FSUBR_STi_ST, "FSUBR.STi.ST")
+OPCODE(OP_FISUBR_I32, "FISUBR.I32")
+OPCODE(OP_FISUBR_I16, "FISUBR.I16")
+OPCODE(OP_FSUBRP_STi_ST, "FSUBRP.STi.ST")
+OPCODE(OP_FTST, "FTST")
+OPCODE(OP_FUCOM, "FUCOM")
+OPCODE(OP_FUCOMP, "FUCOMP")
+OPCODE(OP_FUCOMPP, "FUCOMPP")
+OPCODE(OP_FXAM, "FXAM")
+OPCODE(OP_FXCH, "FXCH")
+OPCODE(OP_FXTRACT, "FXTRACT")
+OPCODE(OP_FYL2X, "FYL2X")
+OPCODE(OP_FYL2XP1, "FYL2XP1")
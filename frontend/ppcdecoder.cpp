@@ -112,7 +112,6 @@ void unused(const char* x) {}
  *					 gathered during decoding
  *============================================================================*/
 DecodeResult& PPCDecoder::decodeInstruction (ADDRESS pc, int delta) { 
-	static DecodeResult result;
 	ADDRESS hostPC = pc+delta;
 
 	// Clear the result structure;
@@ -1050,11 +1049,7 @@ DecodeResult& PPCDecoder::decodeInstruction (ADDRESS pc, int delta) {
 
                 		result.rtl->appendStmt(newCall);
 
-                		Proc* destProc = prog->setNewProc(reladdr-delta);
-
-                		if (destProc == (Proc*)-1) destProc = NULL;
-
-                		newCall->setDestProc(destProc);
+                		setDestProc(newCall, reladdr-delta);
 
                 
 
@@ -4369,15 +4364,15 @@ DecodeResult& PPCDecoder::decodeInstruction (ADDRESS pc, int delta) {
 
       			case 1:
 
-      				stmts = instantiate(pc, "MTXER" , DIS_RS); break;
+      				stmts = instantiate(pc, OP_MTXER , DIS_RS); break;
 
       			case 8:
 
-      				stmts = instantiate(pc, "MTLR" , DIS_RS); break;
+      				stmts = instantiate(pc, OP_MTLR , DIS_RS); break;
 
       			case 9:
 
-      				stmts = instantiate(pc, "MTCTR" , DIS_RS); break;
+      				stmts = instantiate(pc, OP_MTCTR , DIS_RS); break;
 
       			default:
 
@@ -4634,6 +4629,7 @@ PPCDecoder::PPCDecoder(Prog* prog) : NJMCDecoder(prog)
 {
   std::string file = Boomerang::get()->getProgPath() + "frontend/machine/ppc/ppc.ssl";
   RTLDict.readSSLFile(file.c_str());
+  resolveOpcodes(opcodeNameTable, NUM_OPCODES);
 }
 
 // For now...
@@ -4651,5 +4647,8 @@ Exp* crBit(int bitNum) {
 		new Const(bitNum));
 }
 
-
-
+const char* const PPCDecoder::opcodeNameTable[] = {
+#define OPCODE(id, name) name,
+#include "ppcopcodes.h"
+#undef OPCODE
+};
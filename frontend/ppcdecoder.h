@@ -17,6 +17,7 @@
  * $Revision: 1.4 $	// 1.3.2.1
  *
  * 23 Nov 04 - Jay Sweeney and Alejandro Dubrovsky: Created.
+ * 17 Oct 26 - Opcodes of the instructions instantiated by a fixed name
  */
 
 #ifndef PPCDECODER
@@ -60,6 +61,14 @@ private:
 		bool		isFuncPrologue(ADDRESS hostPC);
 		DWord		getDword(ADDRESS lc);
 
+		// The instructions that decoder.m instantiates by a fixed name, and their names (see NJMCDecoder::resolveOpcodes)
+		enum {
+#define OPCODE(id, name) id,
+#include "ppcopcodes.h"
+#undef OPCODE
+			NUM_OPCODES
+		};
+		static const char* const opcodeNameTable[];
 };
 
 #endif
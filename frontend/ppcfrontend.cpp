@@ -47,6 +47,11 @@ PPCFrontEnd::PPCFrontEnd(BinaryFile *pBF, Prog* prog, BinaryFileFactory* pbff) :
 	decoder = new PPCDecoder(prog);
 }
 
+// A decoder for predecoding
+NJMCDecoder* PPCFrontEnd::newDecoder() {
+	return new PPCDecoder(prog);
+}
+
 
 // destructor
 PPCFrontEnd::~PPCFrontEnd()
@@ -36,6 +36,8 @@ virtual std::vector<Exp*> &getDefaultParams();
 virtual std::vector<Exp*> &getDefaultReturns();
 
 virtual ADDRESS getMainEntryPoint( bool &gotMain );
+
+virtual NJMCDecoder* newDecoder();
 	
 };
 
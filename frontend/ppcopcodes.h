@@ -0,0 +1,13 @@
+/*==============================================================================
+ * FILE:	   ppcopcodes.h
+ * OVERVIEW:   The instructions that the PPC decoder (machine/ppc/decoder.m) instantiates by a fixed name. Each
+ *				OPCODE(id, name) line gives an enumerator of PPCDecoder and its name; the ids in the dictionary are looked
+ *				up once, when the decoder is set up (see NJMCDecoder::resolveOpcodes)
+ *============================================================================*/
+/*
+ * 17 Oct 26 - Created
+ */
+
+OPCODE(OP_MTXER, "MTXER")
+OPCODE(OP_MTLR, "MTLR")
+OPCODE(OP_MTCTR, "MTCTR")
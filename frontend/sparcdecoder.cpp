@@ -205,7 +205,6 @@ RTL* SparcDecoder::createBranchRtl(ADDRESS pc, std::list<Statement*>* stmts, con
  * RETURNS:		   a DecodeResult structure containing all the information gathered during decoding
  *============================================================================*/
 DecodeResult& SparcDecoder::decodeInstruction (ADDRESS pc, int delta) { 
-	static DecodeResult result;
 	ADDRESS hostPC = pc+delta;
 
 	// Clear the result structure;
@@ -639,11 +638,7 @@ DecodeResult& SparcDecoder::decodeInstruction (ADDRESS pc, int delta) {
 
             		newCall->setDest(nativeDest);
 
-            		Proc* destProc = prog->setNewProc(nativeDest);
-
-            		if (destProc == (Proc*)-1) destProc = NULL;
-
-            		newCall->setDestProc(destProc);
+            		setDestProc(newCall, nativeDest);
 
             		result.rtl = new RTL(pc, stmts);
 
@@ -1601,7 +1596,7 @@ DecodeResult& SparcDecoder::decodeInstruction (ADDRESS pc, int delta) {
 
                   		// hope that optimisation will vastly help the common cases
 
-                  		stmts = instantiate(pc, "SAVE", DIS_RS1, DIS_ROI, DIS_RD);
+                  		stmts = instantiate(pc, OP_SAVE, DIS_RS1, DIS_ROI, DIS_RD);
 
                   
 
@@ -1623,7 +1618,7 @@ DecodeResult& SparcDecoder::decodeInstruction (ADDRESS pc, int delta) {
 
                   		// Decided to treat RESTORE as an ordinary instruction
 
-                  		stmts = instantiate(pc, "RESTORE", DIS_RS1, DIS_ROI, DIS_RD);
+                  		stmts = instantiate(pc, OP_RESTORE, DIS_RS1, DIS_ROI, DIS_RD);
 
                   
 
@@ -2282,7 +2277,7 @@ DecodeResult& SparcDecoder::decodeInstruction (ADDRESS pc, int delta) {
 #line 485 "frontend/machine/sparc/decoder.m"
        
 
-      		stmts = instantiate(pc,	 "sethi", dis_Num(imm22), DIS_RD);
+      		stmts = instantiate(pc,	 OP_sethi, dis_Num(imm22), DIS_RD);
 
       
 
@@ -3027,11 +3022,15 @@ SparcDecoder::SparcDecoder(Prog* prog) : NJMCDecoder(prog)
 {
 	std::string file = Boomerang::get()->getProgPath() + "frontend/machine/sparc/sparc.ssl";
 	RTLDict.readSSLFile(file.c_str());
+	resolveOpcodes(opcodeNameTable, NUM_OPCODES);
 }
 
 // For now...
 int SparcDecoder::decodeAssemblyInstruction(unsigned, int)
 { return 0; }
 
-
-
+const char* const SparcDecoder::opcodeNameTable[] = {
+#define OPCODE(id, name) name,
+#include "sparcopcodes.h"
+#undef OPCODE
+};
@@ -18,6 +18,7 @@
  *
  * 06 Jun 02 - Trent: Created.
  * 04 Dec 02 - Mike: Added dis_RegLhs() and dis_RegRhs()
+ * 17 Oct 26 - Opcodes of the instructions instantiated by a fixed name
  */
 
 #ifndef SPARCDECODER
@@ -68,6 +69,14 @@ private:
 	bool	isFuncPrologue(ADDRESS hostPC);
 	DWord	getDword(ADDRESS lc);
 
+	// The instructions that decoder.m instantiates by a fixed name, and their names (see NJMCDecoder::resolveOpcodes)
+	enum {
+#define OPCODE(id, name) id,
+#include "sparcopcodes.h"
+#undef OPCODE
+		NUM_OPCODES
+	};
+	static const char* const opcodeNameTable[];
 };
 
 #endif
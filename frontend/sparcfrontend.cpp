@@ -22,12 +22,15 @@
  * 17 May 02 - Mike: Mods for boomerang
  * 22 Nov 02 - Mike: Added check for invalid instructions; prints opcode
  * 12 Dec 02 - Mike: Fixed various bugs in move/call/move (etc) pattern handling
+ * 17 Oct 26 - LOG statements are in the LCAT_DECODE log category
  */
 
 /*==============================================================================
  * Dependencies.
  *============================================================================*/
 
+#define LOG_CATEGORY LCAT_DECODE		// The category of this file's LOG statements (see boomerang.h)
+
 #include <assert.h>
 #include <cstring>
 #include <iomanip>			// For setfill etc
@@ -1501,6 +1504,11 @@ SparcFrontEnd::SparcFrontEnd(BinaryFile *pBF, Prog* prog, BinaryFileFactory* pbf
 	nop_inst.rtl = new RTL();
 }
 
+// A decoder for predecoding
+NJMCDecoder* SparcFrontEnd::newDecoder() {
+	return new SparcDecoder(prog);
+}
+
 // destructor
 SparcFrontEnd::~SparcFrontEnd()
 {
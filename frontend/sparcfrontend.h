@@ -48,6 +48,8 @@ virtual std::vector<Exp*> &getDefaultReturns();
 
 virtual ADDRESS getMainEntryPoint( bool &gotMain );
 
+virtual NJMCDecoder* newDecoder();
+
 private:
 
 	void	warnDCTcouple(ADDRESS uAt, ADDRESS uDest);
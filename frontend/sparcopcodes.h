@@ -0,0 +1,13 @@
+/*==============================================================================
+ * FILE:	   sparcopcodes.h
+ * OVERVIEW:   The instructions that the SPARC decoder (machine/sparc/decoder.m) instantiates by a fixed name. Each
+ *				OPCODE(id, name) line gives an enumerator of SparcDecoder and its name; the ids in the dictionary are looked
+ *				up once, when the decoder is set up (see NJMCDecoder::resolveOpcodes)
+ *============================================================================*/
+/*
+ * 17 Oct 26 - Created
+ */
+
+OPCODE(OP_SAVE, "SAVE")
+OPCODE(OP_RESTORE, "RESTORE")
+OPCODE(OP_sethi, "sethi")
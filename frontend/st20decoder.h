@@ -15,6 +15,7 @@
 /* 
  * $Revision: 1.1 $
  * 10/Mar/05 MVE and Dr Aus: Created.
+ * 17 Oct 26 - Opcodes of the instructions instantiated by a fixed name
  */
 
 #ifndef ST20DECODER
@@ -62,6 +63,14 @@ private:
 	SWord	getWord(ADDRESS lc);
 	Byte	getByte(ADDRESS lc);
 
+	// The instructions that decoder.m instantiates by a fixed name, and their names (see NJMCDecoder::resolveOpcodes)
+	enum {
+#define OPCODE(id, name) id,
+#include "st20opcodes.h"
+#undef OPCODE
+		NUM_OPCODES
+	};
+	static const char* const opcodeNameTable[];
 };
 
 #endif
@@ -49,6 +49,11 @@ ST20FrontEnd::ST20FrontEnd(BinaryFile *pBF, Prog* prog, BinaryFileFactory* pbff)
 	decoder = new ST20Decoder();
 }
 
+// A decoder for predecoding
+NJMCDecoder* ST20FrontEnd::newDecoder() {
+	return new ST20Decoder();
+}
+
 
 // destructor
 ST20FrontEnd::~ST20FrontEnd()
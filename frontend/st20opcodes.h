@@ -0,0 +1,11 @@
+/*==============================================================================
+ * FILE:	   st20opcodes.h
+ * OVERVIEW:   The instructions that the ST20 decoder (machine/st20/decoder.m) instantiates by a fixed name. Each
+ *				OPCODE(id, name) line gives an enumerator of ST20Decoder and its name; the ids in the dictionary are looked
+ *				up once, when the decoder is set up (see NJMCDecoder::resolveOpcodes)
+ *============================================================================*/
+/*
+ * 17 Oct 26 - Created
+ */
+
+OPCODE(OP_call, "call")
@@ -18,6 +18,8 @@
  * Created by Mike, 97
  * 01 Aug 01 - Mike: Changed the definition of GetGlobalPointerInfo()
  * 10 Aug 01 - Mike: Added GetDynamicGlobalMap()
+ * 17 Oct 26 - Sorted section index (with a last hit cache) for GetSectionInfoByAddr; readRange; mapFile etc
+ * 17 Oct 26 - The last hit cache is atomic
  */
 
 #ifndef __BINARYFILE_H__
@@ -185,6 +187,12 @@ virtual size_t	getImageSize() = 0;
 		PSectionInfo GetSectionInfoByName(const char* sName);
 		// Find the end of a section, given an address in the section
 		PSectionInfo GetSectionInfoByAddr(ADDRESS uEntry) const;
+		// Build the index of sections by address, used by GetSectionInfoByAddr. Until this is called (and after the
+		// section array is replaced), GetSectionInfoByAddr searches the sections one at a time
+		void		buildSectionIndex();
+		// Return a pointer to the host copy of the bytes at native address a, or NULL if a is not in a section with
+		// data. len gets the number of bytes that can be read there (to the end of the section)
+		const char*	readRange(ADDRESS a, size_t& len) const;
 
 		// returns true if the given address is in a read only section
 		bool isReadOnly(ADDRESS uEntry) {
@@ -279,6 +287,14 @@ virtual std::map<std::string, ObjcModule> &getObjcModules() { return *new std::m
 
 virtual bool		hasDebugInfo() { return false; }
 
+		// Map the whole of file sName into memory. The mapping is private (copy on write), so that the loader can
+		// patch the image, e.g. to apply relocations. Returns NULL on failure; size gets the size of the file
+static	char*		mapFile(const char* sName, size_t& size);
+		// Get size bytes of zeroed memory for an image, committed only as it is touched
+static	char*		allocImage(size_t size);
+		// Release the memory from mapFile or allocImage
+static	void		unmapImage(char* image, size_t size);
+
 //
 //	--	--	--	--	--	--	--	--	--	--	--
 //
@@ -306,6 +322,16 @@ virtual bool		PostLoad(void* handle) = 0;		// Called after loading archive membe
 		// text sections of the BinaryFile image
 		int			textDelta;
 
+		// The index of sections by address. The address space is split into intervals at the start and end of each
+		// section; m_sectStarts has the (sorted) start address of each interval, and m_sectOf the section that
+		// contains it (the lowest numbered, as a search in section order would find), or -1
+		std::vector<ADDRESS> m_sectStarts;
+		std::vector<int> m_sectOf;
+		PSectionInfo m_indexedSections;			// The section array that the index is for
+		int			m_indexedNum;
+		// The interval of the last hit. Several threads (e.g. the predecode workers) may read the image, so it is read
+		// and written atomically (see atomicLoad); a stale or lost update only costs a binary search
+mutable volatile int m_lastInterval;
 };
 
 #endif		// #ifndef __BINARYFILE_H__
@@ -18,6 +18,7 @@
  * $Revision: 1.13 $	// 1.1.2.2
  *
  * 28 Jun 05 - Mike: Split off from cfg.h
+ * 17 Oct 26 - Removed calcLiveness and getLiveOut; see Cfg::findInterferences. Added getLiveIn
  */
 
 #ifndef __BASIC_BLOCK_H__
@@ -398,6 +399,9 @@ protected:
 
 public:
 
+		// The locations live at the start of this BB, as found by Cfg::findInterferences
+		LocationSet& getLiveIn() {return liveIn;}
+
 		bool		isPostCall();
 static void			doAvail(StatementSet& s, PBB inEdge);
 		Proc*		getDestProc();
@@ -521,10 +525,6 @@ public:
 		// For prepending phi functions
 		void		prependStmt(Statement* s, UserProc* proc);
 
-		// Liveness
-		bool		calcLiveness(ConnectionGraph& ig, UserProc* proc);
-		void		getLiveOut(LocationSet& live, LocationSet& phiLocs);
-
 		// Find indirect jumps and calls
 		bool		decodeIndirectJmp(UserProc* proc);
 		void		processSwitch(UserProc* proc);
@@ -541,6 +541,7 @@ public:
 
 protected:
 		friend class XMLProgParser;
+		friend class Checkpoint;
 		void		addOutEdge(PBB bb) { m_OutEdges.push_back(bb); }
 		void		addRTL(RTL *rtl) {
 						if (m_pRtls == NULL) 
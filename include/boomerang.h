@@ -12,6 +12,18 @@
  *
  * $Revision: 1.77 $	// 1.61.2.2
  * 04 Dec 2002: Trent: Created
+ * 17 Oct 2026: Watcher alerts are serialised, for parallel decompilation (-j)
+ * 17 Oct 2026: Added memStats (-M)
+ * 17 Oct 2026: LOG statements are skipped (before formatting anything) with -nL; flushLog
+ * 17 Oct 2026: Added traceFile (-gt)
+ * 17 Oct 2026: Added freeAfterCode (-F)
+ * 17 Oct 2026: numThreads is also for decoding
+ * 17 Oct 2026: numThreads: only instruction predecode is parallel, not the building of procs and BBs
+ * 17 Oct 2026: Added decodeCacheBytes (-C)
+ * 17 Oct 2026: Added prunedSSA (-pp)
+ * 17 Oct 2026: Added noSplice (-ns)
+ * 17 Oct 2026: LOG is a for statement, which gives no -Wdangling-else warnings
+ * 17 Oct 2026: Log categories and levels (LOGC, -Lc and -Ll), filtered before formatting; flushLogOnSignal
  */
 
 /** \mainpage Introduction
@@ -44,6 +56,7 @@
 #include <stdint.h>//remove this later - should only include where needed.
 
 #include "types.h"
+#include "threads.h"
 
 class Log;
 class Prog;
@@ -52,7 +65,27 @@ class UserProc;
 class HLLCode;
 class ObjcModule;
 
-#define LOG Boomerang::get()->log()
+// Log categories (a bit each, selected with -Lc) and levels (the most detailed wanted is given with -Ll)
+enum LogCategory {
+	LCAT_GENERAL = 1, LCAT_DECODE = 2, LCAT_DATAFLOW = 4, LCAT_TYPES = 8, LCAT_CODEGEN = 16,
+	LCAT_ALL = 0xFF
+};
+enum LogLevel {
+	LL_ERROR, LL_WARN, LL_INFO, LL_DEBUG			// LL_DEBUG is for the dumps of whole procs
+};
+
+// The category of the plain LOG statements of a file. A file can define it (before any #include) to log under its
+// own category
+#ifndef LOG_CATEGORY
+#define LOG_CATEGORY LCAT_GENERAL
+#endif
+
+// The for form makes LOGC(c, l) << a << b; skip all the formatting when the log is disabled, or category c or level l
+// is not wanted. Unlike an if/else, it is safe inside an if statement with an else without a -Wdangling-else warning
+// at every use
+#define LOGC(cat, level) for (bool logOn_ = Boomerang::get()->logging(cat, level); logOn_; logOn_ = false) \
+	Boomerang::get()->log()
+#define LOG LOGC(LOG_CATEGORY, LL_INFO)
 #define LOGTAIL Boomerang::get()->logTail()
 
 #define DEBUG_RANGE_ANALYSIS 0
@@ -100,6 +133,8 @@ static Boomerang *boomerang;
 		Log			*logger;
 		/// The watchers which are interested in this decompilation.
 		std::set<Watcher*> watchers;
+		/// Serialises the alerts to the watchers, which may come from several decompiling threads at once.
+		Mutex		alertLock;
 		
 		
 		/* Documentation about a function should be at one place only
@@ -128,7 +163,15 @@ static Boomerang *get() {
 
 static	char*		getVersionStr();
 		Log			&log();
-		void		setLogger(Log *l) { logger = l; }
+		void		setLogger(Log *l);
+		/// Write any output that the logger is holding (e.g. before a crash).
+		void		flushLog();
+		/// As flushLog(), but safe in a signal handler.
+		void		flushLogOnSignal();
+		/// \return True if LOG statements of category cat (a LogCategory) and level level (a LogLevel) are wanted.
+		bool		logging(unsigned cat, int level) {
+						return !noLog && (logCategories & cat) && level <= logLevel;
+					}
 		bool		setOutputDirectory(const char *path);
 
 		/// \return The HLLCode for the specified UserProc.
@@ -146,6 +189,7 @@ static	char*		getVersionStr();
 
 		Prog		*loadAndDecode(const char *fname, const char *pname = NULL);
 		int			decompile(const char *fname, const char *pname = NULL);
+		int			benchDecode(const char *fname, int passes);
 		/// Add a Watcher to the set of Watchers for this Boomerang object.
 		void		addWatcher(Watcher *watcher) { watchers.insert(watcher); }
 		void		persistToXML(Prog *prog);
@@ -155,87 +199,106 @@ static	char*		getVersionStr();
 
 		/// Alert the watchers that decompilation has completed.
 		void		alert_complete() {
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_complete();
 					}
 		/// Alert the watchers we have found a new %Proc.
 		void		alert_new(Proc *p) {
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_new(p);
 					}
 		/// Alert the watchers we have removed a %Proc.
 		void		alert_remove(Proc *p) {
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_remove(p);
 					}
 		/// Alert the watchers we have updated this Procs signature
 		void		alert_update_signature(Proc *p) { 
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_update_signature(p);
 					}
 		/// Alert the watchers we are currently decoding \a nBytes bytes at address \a pc.
 		void		alert_decode(ADDRESS pc, int nBytes) {
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_decode(pc, nBytes);
 					}
 		/// Alert the watchers of a bad decode of an instruction at \a pc.
 		void		alert_baddecode(ADDRESS pc) {
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_baddecode(pc);
 					}
 		/// Alert the watchers we have succesfully decoded this function
 		void		alert_decode(Proc *p, ADDRESS pc, ADDRESS last, int nBytes) {
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_decode(p, pc, last, nBytes);
 					}
 		/// Alert the watchers we have loaded the Proc.
 		void		alert_load(Proc *p) {
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_load(p);
 			}
 		/// Alert the watchers we are starting to decode.
 		void		alert_start_decode(ADDRESS start, int nBytes) { 
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_start_decode(start, nBytes);
 					}
 		/// Alert the watchers we finished decoding.
 		void		alert_end_decode() { 
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_end_decode();
 					}
 virtual	void		alert_start_decompile(UserProc *p) { 
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_start_decompile(p);
 					}
 virtual void		alert_proc_status_change(UserProc *p) {
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_proc_status_change(p);
 					}
 virtual	void		alert_decompile_SSADepth(UserProc *p, int depth) {
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_decompile_SSADepth(p, depth);
 			}
 virtual	void		alert_decompile_beforePropagate(UserProc *p, int depth) {
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_decompile_beforePropagate(p, depth);
 					}
 virtual void		alert_decompile_afterPropagate(UserProc *p, int depth) {
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_decompile_afterPropagate(p, depth);
 					}
 virtual void		alert_decompile_afterRemoveStmts(UserProc *p, int depth) {
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_decompile_afterRemoveStmts(p, depth);
 					}
 virtual void		alert_end_decompile(UserProc *p) { 
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_end_decompile(p);
 					}
 virtual void		alert_considering(Proc *parent, Proc *p) { 
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_considering(parent, p);
 					}
 virtual void		alert_decompiling(UserProc *p) { 
+						MutexLock ml(alertLock);
 						for (std::set<Watcher*>::iterator it = watchers.begin(); it != watchers.end(); it++)
 							(*it)->alert_decompiling(p);
 					}
@@ -297,6 +360,17 @@ virtual void		alert_decompile_debug_point(UserProc *p, const char *description);
 		bool		assumeABI;			///< Assume ABI compliance
 		bool		experimental;		///< Activate experimental code. Caution!
 		int			minsToStopAfter;
+		int			decodeBenchPasses;	///< If non zero, just benchmark the decoder with this many passes (-B)
+		int			numThreads;			///< Number of threads to decompile, and to predecode instructions, with (-j)
+		bool		memStats;			///< Report the time and allocations of each phase (-M)
+		bool		noLog;				///< No log: LOG statements do nothing (-nL)
+		unsigned	logCategories;		///< The LogCategory bits wanted in the log (-Lc)
+		int			logLevel;			///< The most detailed LogLevel wanted in the log (-Ll)
+		const char*	traceFile;			///< If not NULL, write a Chrome trace of the phases to this file (-gt)
+		bool		freeAfterCode;		///< Free the body of each proc once its code is written (-F)
+		size_t		decodeCacheBytes;	///< Limit on the size of the cache of decoded instructions, 0 for none (-C)
+		bool		prunedSSA;			///< Only place phi functions where the location is live (-pp)
+		bool		noSplice;			///< Decompile a proc again after analysing switches, don't splice the arms (-ns)
 };
 
 #define VERBOSE				(Boomerang::get()->vFlag)
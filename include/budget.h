@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   budget.h
+ * OVERVIEW:   Declaration of class Budget, the time and memory limits of a decompilation (-S, -Sm) and of each of its
+ *			   procedures (-St, -Sa). A procedure over its budget is decompiled in a cheaper way (see Budget::Level),
+ *			   rather than the whole run being stopped; the procedures cut back are reported at the end.
+ * CLASSES:	   Budget
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created
+ */
+
+#ifndef __BUDGET_H__
+#define __BUDGET_H__
+
+#include <stddef.h>
+#include <iostream>
+
+class UserProc;
+
+class Budget {
+static	double		start;						// When the decompilation started (wall clock, microseconds)
+static	volatile bool exceeded;					// Set when the global budget is first exceeded
+
+public:
+		// How far the decompilation of a procedure has been cut back, in increasing order
+		enum Level {
+			FULL = 0,							// Not cut back
+			FEWER_PASSES,						// No more passes of the middleDecompile loop
+			NO_PROVER,							// Also nothing is proved (so nothing is preserved)
+			DECODED								// Not analysed at all: code is generated from the decoded RTLs
+		};
+
+		// The limits, 0 for none. A procedure over its own limit gets FEWER_PASSES, and NO_PROVER at twice the limit.
+		// Once over the global limit, the procedures being analysed get NO_PROVER, and those not yet started DECODED
+static	double		globalSecs;					// -S (in minutes on the command line)
+static	size_t		globalBytes;				// The size of the heap (-Sm)
+static	double		procSecs;					// -St
+static	size_t		procBytes;					// Bytes allocated while decompiling the proc (-Sa)
+
+static	bool		enabled() {return globalSecs || globalBytes || procSecs || procBytes;}
+
+		// Start the global budget (at the start of decoding)
+static	void		startGlobal();
+
+		// True if the global budget is exceeded. Once it is, it stays so
+static	bool		globalExceeded();
+
+		// The bytes allocated on the heap so far (by all threads), for the budget of a procedure
+static	size_t		heapAllocated();
+
+		// The level that a procedure should be at, when its budget started at procStart (wall clock, microseconds)
+		// with heap0 bytes allocated. why is set to the budget exceeded, if any
+static	int			level(double procStart, size_t heap0, const char*& why);
+
+		// Record that proc has been cut back to level (for the report)
+static	void		degrade(UserProc* proc, int level, const char* why);
+
+static	const char*	levelName(int level);
+
+		// Print the procedures cut back, if any. Returns their number
+static	int			report(std::ostream& os);
+};
+
+#endif	// __BUDGET_H__
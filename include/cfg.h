@@ -18,6 +18,8 @@
  * $Revision: 1.76 $	// 1.69.2.7
  * 18 Apr 02 - Mike: Mods for boomerang
  * 04 Dec 02 - Mike: Added isJmpZ
+ * 17 Oct 26 - removeForRedecode; decodeIndirectJmp can return the BBs analysed
+ * 17 Oct 26 - getProc
  */
  
 #ifndef _CFG_H_
@@ -139,6 +141,7 @@ public:
 		 * Set the pointer to the owning UserProc object
 		 */
 		void		setProc(UserProc* proc);
+		UserProc*	getProc() {return myProc;}
 
 		/*
 		 * clear this CFG of all basic blocks, ready for decode
@@ -345,6 +348,13 @@ public:
 		 */
 		void		removeBB( PBB bb);
 
+		/*
+		 * Remove the BBs in bbs from the CFG, so that their code can be decoded again. Edges into them from the other
+		 * BBs go to new incomplete BBs at the same addresses, which are added to entries; edges out of them are
+		 * dropped. Returns false (and changes nothing) if one of them has no address to decode from.
+		 */
+		bool		removeForRedecode(std::set<PBB>& bbs, std::set<ADDRESS>& entries);
+
 		/*
 		 * Resets the DFA sets of all the BBs.
 		 */
@@ -484,9 +494,10 @@ public:
 		void		dumpImplicitMap();	// Dump the implicit map to std::cerr
 
 		/*
-		 * Check for indirect jumps and calls. If any found, decode the extra code and return true
+		 * Check for indirect jumps and calls. If any found, decode the extra code and return true. The BBs whose jumps
+		 * or calls were analysed are appended to decoded, if given
 		 */
-		bool decodeIndirectJmp(UserProc* proc);
+		bool decodeIndirectJmp(UserProc* proc, std::list<PBB>* decoded = NULL);
 
 		/*
 		 * Implicit assignments
@@ -508,6 +519,7 @@ public:
 protected:
 		void	addBB(PBB bb) { m_listBB.push_back(bb); }
 		friend class XMLProgParser;
+		friend class Checkpoint;
 };				/* Cfg */
 
 #endif
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   checkpoint.h
+ * OVERVIEW:   Declaration of class Checkpoint, the binary save file of a decoded program (-SD and -LD). Pointers
+ *			   between objects are saved as indexes into tables (of procs, clusters, types, statements and BBs). The
+ *			   body of each UserProc (its CFG, RTLs, locals, symbols and callees) is a separate record; loading a
+ *			   checkpoint reads only the program, its globals and the procs' signatures, and reads a body the first
+ *			   time that something asks for it. The XML persistence (XMLProgParser) is still there for debugging.
+ * CLASSES:	   Checkpoint
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created
+ * 17 Oct 26 - saveTypes and loadTypes, for the signature databases
+ */
+
+#ifndef __CHECKPOINT_H__
+#define __CHECKPOINT_H__
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <list>
+#include <map>
+#include <set>
+#include "types.h"
+#include "threads.h"
+
+class Prog;
+class Proc;
+class UserProc;
+class Cluster;
+class Type;
+class Exp;
+class Statement;
+class StatementList;
+class CallStatement;
+class RTL;
+class Cfg;
+class BasicBlock;
+typedef BasicBlock* PBB;
+class Signature;
+
+class Checkpoint {
+		// Where a proc's body is in the file, and the address ranges of its BBs (for Prog::findContainingProc)
+		struct Body {
+			unsigned	offset;
+			unsigned	size;
+			std::vector<std::pair<ADDRESS, ADDRESS> > ranges;
+		};
+
+		/* Writing */
+		FILE*		out;
+		std::vector<char> buf;					// The record being written
+		bool		ok;							// Cleared if something can't be written
+		std::map<Proc*, unsigned> procIds;		// Indexes of the procs, clusters, etc. Zero is NULL
+		std::map<Cluster*, unsigned> clusterIds;
+		std::map<Type*, unsigned> typeIds;		// Per record
+		std::map<Statement*, unsigned> stmtIds;	// Per body
+		std::set<Statement*> written;			// The statements of this body written so far
+		std::map<PBB, unsigned> bbIds;			// Per body
+
+		void		word(unsigned w) { buf.insert(buf.end(), (char*)&w, (char*)(&w+1)); }
+		void		bytes(const void* p, unsigned n) { buf.insert(buf.end(), (const char*)p, (const char*)p + n); }
+		void		str(const std::string& s) { word(s.size()); bytes(s.data(), s.size()); }
+		void		addr(ADDRESS a) { bytes(&a, sizeof(a)); }
+		void		flush();					// Write buf to the file, and clear it
+		void		procRef(Proc* p);
+		unsigned	stmtId(Statement* s);
+		void		stmtRef(Statement* s) { word(s ? stmtId(s) : 0); }
+		unsigned	bbRef(PBB bb);
+		void		writeType(Type* ty);
+		void		writeExp(Exp* e);
+		void		writeStmt(Statement* s);
+		void		writeStmtList(StatementList& sl);
+		void		writeRTL(RTL* r);
+		void		writeSignature(Signature* sig);
+		void		writeCluster(Cluster* c);
+		void		writeCfg(Cfg* cfg);
+		void		writeBB(PBB bb);
+		void		writeBody(UserProc* p);
+		bool		write(Prog* prog, const char* fname);
+
+		/* Reading */
+		std::string	path;
+		FILE*		in;
+		Prog*		prog;
+		Mutex		mutex;						// Bodies may be loaded from any thread
+		std::vector<char> rec;					// The record being read
+		const char*	p;
+		const char*	end;
+		std::vector<Proc*> procs;
+		std::vector<Cluster*> clusters;
+		std::vector<Type*> types;				// Per record
+		std::vector<Statement*> stmts;			// Per body
+		std::vector<PBB> bbs;					// Per body
+		std::list<std::pair<Statement**, unsigned> > stmtFixups;	// Pointers to statements not yet read
+		std::map<UserProc*, Body> bodies;		// Of the procs not yet loaded
+		std::map<UserProc*, std::list<CallStatement*> > pendingReturns;	// Calls to each, whose callee return is
+												// that proc's return statement
+		std::map<Proc*, std::vector<UserProc*> > callers;	// Procs not yet read that call each proc
+
+		unsigned	readWord();
+		void		readBytes(void* dest, unsigned n);
+		std::string	readStr();
+		ADDRESS		readAddr() { ADDRESS a; readBytes(&a, sizeof(a)); return a; }
+		unsigned	readCount();				// A count of things that follow; checked against the record size
+		bool		readRecord(unsigned offset, unsigned size);
+		Proc*		readProcRef();
+		Statement*	stmtAt(unsigned id);
+		void		resolveStmt(Statement*& s, unsigned id);	// Set s now, or when statement id has been read
+		PBB			bbAt(unsigned id);
+		Type*		readType();
+		Exp*		readExp();
+		Statement*	readStmt();
+		void		readStmtList(StatementList& sl);
+		RTL*		readRTL();
+		Signature*	readSignature();
+		Cluster*	readCluster();
+		void		readCfg(UserProc* proc);
+		void		readBB(PBB bb);
+		void		readBody(UserProc* proc);
+		Prog*		read(const char* fname);
+
+					Checkpoint();
+public:
+					~Checkpoint();
+
+		// Save prog to the file fname. Returns false (and says why) if it can't
+static	bool		save(Prog* prog, const char* fname);
+
+		// Load a program from the checkpoint fname. Returns NULL if fname is not a checkpoint, or was written by a
+		// different build, or the program can't be loaded
+static	Prog*		load(const char* fname);
+
+		// True if fname starts like a checkpoint (of any version)
+static	bool		isCheckpoint(const char* fname);
+
+		// Save types (e.g. named types, by name) to data, in the same form as a checkpoint. Types that are shared stay
+		// shared when they are loaded. Returns false if one of them can't be saved
+static	bool		saveTypes(std::map<std::string, Type*>& types, std::string& data);
+
+		// Load the types saved by saveTypes from the size bytes at data into types. Returns false if they can't be
+		// loaded (then types is not changed)
+static	bool		loadTypes(const char* data, size_t size, std::map<std::string, Type*>& types);
+
+		// Read the body of proc, if it has not been read already. Called by UserProc::loadBody()
+		void		loadProc(UserProc* proc);
+
+		// Read the bodies of the procs that call p, so that p's set of callers is complete. Called by
+		// Proc::loadCallers()
+		void		loadCallers(Proc* p);
+
+		// Read the bodies of all procs not yet read, and close the file
+		void		loadAll();
+
+		// The address ranges of the BBs of proc, which has not been read yet
+		std::vector<std::pair<ADDRESS, ADDRESS> >& getProcRanges(UserProc* proc) { return bodies[proc].ranges; }
+};
+
+#endif	// __CHECKPOINT_H__
@@ -16,6 +16,10 @@
  * $Revision: 1.47 $	// 1.39.2.19
  *
  * 15 Mar 05 - Mike: Separated from cfg.h
+ * 17 Oct 26 - Dominators on flat arrays (the CFG in compressed rows, buckets as linked lists, the dominance frontiers
+ *				as sorted vectors); updateDominators for a CFG that has only grown
+ * 17 Oct 26 - Pruned SSA (-pp): phi functions only where the location is live; phisPlaced and phisAvoided
+ * 17 Oct 26 - The renaming stacks are vectors, by location ID (locIds, idLocs, defStacks, pushed)
  */
 
 #ifndef _DATAFLOW_H_
@@ -47,12 +51,16 @@ class DataFlow {
 		/* These first two are not from Appel; they map PBBs to indices */
 		std::vector<PBB> BBs;				// Pointers to BBs from indices
 		std::map<PBB, int> indices;			// Indices from pointers to BBs
+		// The CFG as of the last dominators() or updateDominators(), by index, in compressed rows: the successors of
+		// n are succs[succStart[n]] .. succs[succStart[n+1]-1], in the order of the out edges. Likewise preds
+		std::vector<int> succStart, succs;
+		std::vector<int> predStart, preds;
 		/*
 		 * Calculating the dominance frontier
 		 */
 		// If there is a path from a to b in the cfg, then a is an ancestor of b
 		// if dfnum[a] < denum[b]
-		std::vector<int> dfnum;				// Number set in depth first search
+		std::vector<int> dfnum;				// Number set in depth first search; -1 if not reached
 		std::vector<int> semi;				// Semi dominators
 		std::vector<int> ancestor;			// Defines the forest that becomes the spanning tree
 		std::vector<int> idom;				// Immediate dominator
@@ -60,9 +68,16 @@ class DataFlow {
 		std::vector<int> vertex;			// ?
 		std::vector<int> parent;			// Parent in the dominator tree?
 		std::vector<int> best;				// Improves ancestorWithLowestSemi
-		std::vector<std::set<int> > bucket; // Deferred calculation?
+		std::vector<int> bucketHead;		// Deferred calculation: the first node of each bucket, or -1
+		std::vector<int> bucketNext;		// The next node in the same bucket, or -1 (a node is in one bucket at most)
+		std::vector<int> path;				// Scratch for ancestorWithLowestSemi
 		int			N;						// Current node number in algorithm
-		std::vector<std::set<int> > DF;		// The dominance frontiers
+		// The dominator tree: the children of n are domChildren[domChildStart[n]] .. [domChildStart[n+1]-1], in
+		// index order. domPre and domPost number the nodes in a depth first walk of the tree, so that n dominates w iff
+		// domPre[n] <= domPre[w] and domPost[w] <= domPost[n]; -1 for nodes not reached. depth is 0 for the entry
+		std::vector<int> domChildStart, domChildren;
+		std::vector<int> domPre, domPost, depth;
+		std::vector<std::vector<int> > DF;	// The dominance frontiers, each sorted
 
 		/*
 		 * Inserting phi-functions
@@ -77,13 +92,25 @@ class DataFlow {
 		std::map<Exp*, std::set<int>, lessExpStar> A_phi;
 		// A Boomerang requirement: Statements defining particular subscripted locations
 		std::map<Exp*, Statement*, lessExpStar> defStmts;
+		// For pruned SSA (-pp), the locations live at the start of each BB: bit i of liveIn[n * liveWords + i / 32]
+		// is set if the i'th location of defsites is live at the start of BB n
+		std::vector<unsigned> liveIn;
+		int			liveWords;
+		// The phi functions placed, and those not placed because the location is not live there. Summed over all the
+		// calls to placePhiFunctions, so a phi avoided in more than one pass is counted each time
+		int			phisPlaced, phisAvoided;
 
 		/*
 		 * Renaming variables
 		 */
-		// The stack which remembers the last definition of an expression.
-		// A map from expression (Exp*) to a stack of (pointers to) Statements
-		std::map<Exp*, std::stack<Statement*>, lessExpStar> Stacks;
+		// Each location defined (and defineAll) has an ID, given when it is first pushed and kept until renameBlockVars
+		// is called with clearStacks. locIds finds the ID of a location; idLocs[id] is the location (a key owned here)
+		std::map<Exp*, int, lessExpStar> locIds;
+		std::vector<Exp*> idLocs;
+		// The stacks which remember the last definition of each location, by ID; the top is at the back
+		std::vector<std::vector<Statement*> > defStacks;
+		// The IDs pushed, in order, so that the definitions of a block can be popped when the walk is done with it
+		std::vector<int> pushed;
 
 		// Initially false, meaning that locals and parameters are not renamed and hence not propagated.
 		// When true, locals and parameters can be renamed if their address does not escape the local procedure.
@@ -91,18 +118,23 @@ class DataFlow {
 		bool		renameLocalsAndParams;
 
 public:
-					DataFlow() : renameLocalsAndParams(false) {}		// Constructor
+					DataFlow() : liveWords(0), phisPlaced(0), phisAvoided(0), renameLocalsAndParams(false) {}
 		/*
 	 	 * Dominance frontier and SSA code
 	 	 */
 		void		DFS(int p, int n);
+		// Compute the dominators and the dominance frontiers of the CFG from scratch
 		void		dominators(Cfg* cfg);
+		// The same, when the CFG has only gained BBs and edges since the last dominators() or updateDominators(), by
+		// updating them incrementally. False if the CFG has lost any, or the dominator tree changes in a way that needs
+		// them computed again; dominators() must then be called (before anything else that uses them)
+		bool		updateDominators(Cfg* cfg);
 		int			ancestorWithLowestSemi(int v);
 		void		Link(int p, int n);
-		void		computeDF(int n);
+		void		computeDF();
 		// Place phi functions. Return true if any change
 		bool		placePhiFunctions(UserProc* proc);
-		// Rename variables in basicblock n. Return true if any change made
+		// Rename variables in basicblock n and the blocks that it dominates. Return true if any change made
 		bool		renameBlockVars(UserProc* proc, int n, bool clearStacks = false);
 		bool		doesDominate(int n, int w);
 		void		setRenameLocalsParams(bool b) {renameLocalsAndParams = b;}
@@ -116,13 +148,15 @@ public:
 		void		setDominanceNums(int n, int& currNum);		// Set the dominance statement number
 #endif
 		void		clearA_phi() {A_phi.clear();}
+		int			getPhisPlaced() {return phisPlaced;}
+		int			getPhisAvoided() {return phisAvoided;}
 
 		// For testing:
 		int			pbbToNode(PBB bb) {return indices[bb];}
-		std::set<int>& getDF(int node) {return DF[node];}
+		std::vector<int>& getDF(int node) {return DF[node];}
 		PBB			nodeToBB(int node) {return BBs[node];} 
 		int			getIdom(int node) {return idom[node];}
-		int			getSemi(int node) {return semi[node];}
+		int			getSemi(int node) {return semi[node];}		// Only after dominators()
 		std::set<int>& getA_phi(Exp* e) {return A_phi[e];}
 
 		// For debugging:
@@ -131,6 +165,19 @@ public:
 		void		dumpA_orig();
 		void		dumpA_phi();
 
+private:
+		void		numberBBs(Cfg* cfg);		// Set BBs, indices and the compressed rows of the CFG
+		void		renumberA_phi(std::vector<PBB>& oldBBs);
+		void		buildDomTree();				// Set domChildStart, domChildren, domPre, domPost and depth from idom
+		void		addNode(PBB bb);
+		bool		addEdge(int x, int y);
+		void		addDF(int n, int y);
+		void		computeLiveIn(UserProc* proc);	// Set liveIn and liveWords, for the locations in defsites
+		bool		isLiveIn(int i, int n) {return (liveIn[n * liveWords + i / 32] >> (i % 32)) & 1;}
+		int			findLocId(Exp* e);
+		int			getLocId(Exp* e);
+		void		pushDef(int id, Statement* s);
+		bool		renameBlock(UserProc* proc, int n);
 };
 
 /*	*	*	*	*	*	*\
@@ -201,7 +248,7 @@ Assign* dumpAddrOfFourth();
 		 * Update the definitions with the current set of reaching definitions
 		 * proc is the enclosing procedure
 		 */
-		void		updateDefs(std::map<Exp*, std::stack<Statement*>, lessExpStar>& Stacks, UserProc* proc);
+		void		updateDefs(std::vector<Exp*>& locs, std::vector<std::vector<Statement*> >& stacks, UserProc* proc);
 
 		/**
 		 * Find the definition for a location. If not found, return NULL
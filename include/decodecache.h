@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   decodecache.h
+ * OVERVIEW:   Declaration of class DecodeCache, the instructions already decoded, by native address. Procs are
+ *			   decoded again (Prog::reDecode, Prog::decodeFragment, and when middleDecompile restarts), and each
+ *			   instruction decoded again is then just a clone of the pristine RTL kept here. The cache has a limit on
+ *			   its size (-C); the least recently used instructions are dropped first.
+ * CLASSES:	   DecodeCache
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created
+ */
+
+#ifndef __DECODECACHE_H__
+#define __DECODECACHE_H__
+
+#include <stddef.h>
+#include <iostream>
+#include <list>
+#include <map>
+#include "types.h"
+#include "decoder.h"
+#include "threads.h"
+
+class RTL;
+
+class DecodeCache {
+		struct Entry {
+			DecodeResult result;			// result.rtl is the pristine RTL, owned by the cache
+			int			callIndex;			// The index in rtl of result.newProcCall, or -1 if none
+			size_t		bytes;				// Estimated size of the RTL
+			std::list<ADDRESS>::iterator lru;	// Where in lru
+		};
+		std::map<ADDRESS, Entry> entries;
+		std::list<ADDRESS> lru;				// The addresses of entries, most recently used first
+		size_t		bytes;					// Estimated size of all the entries
+		size_t		maxBytes;				// 0 for no cache
+		unsigned long hits, misses, evictions;
+		Mutex		mutex;					// For all the above
+
+		void		evict(std::map<ADDRESS, Entry>::iterator it);
+
+public:
+					DecodeCache(size_t maxBytes);
+					~DecodeCache();
+
+		/*
+		 * If the instruction at pc is cached, set r to a copy of its result, with a clone of its RTL, and return true.
+		 * r.newProcCall is the clone's call whose destination proc is still to be set, if any
+		 */
+		bool		lookup(ADDRESS pc, DecodeResult& r);
+
+		/*
+		 * Add the result of decoding the instruction at pc, which must be valid and reusable. A clone of its RTL is
+		 * kept, so r can be changed afterwards
+		 */
+		void		add(ADDRESS pc, DecodeResult& r);
+
+		// Drop everything (e.g. when the binary is patched or unloaded)
+		void		clear();
+
+		size_t		getBytes() {return bytes;}
+		size_t		getMaxBytes() {return maxBytes;}
+		unsigned long getHits() {return hits;}
+		unsigned long getMisses() {return misses;}
+
+		// Print the hits, misses, evictions and size (for -M)
+		void		report(std::ostream& os);
+
+		// An estimate of the bytes taken by rtl and its statements and expressions
+static	size_t		estimateSize(RTL* rtl);
+};
+
+#endif	// __DECODECACHE_H__
@@ -18,6 +18,10 @@
  * $Revision: 1.18 $	// 1.16.2.2
  *
  * 08 Apr 02 - Mike: Mods for boomerang
+ * 17 Oct 26 - instantiate() takes typed operands and uses opcode ids, instead of varargs
+ * 17 Oct 26 - Each decoder has its own DecodeResult; predecoding (decoding on a worker thread)
+ * 17 Oct 26 - DecodeResult::predecodable is now reusable, and newProcCall is always set (for the DecodeCache)
+ * 17 Oct 26 - resolveOpcodes(), and instantiate() by the decoder's own opcode index
  */
 
 #ifndef _DECODER_H_
@@ -30,6 +34,7 @@
 
 class Exp;
 class RTL;
+class CallStatement;
 class BinaryFile;
 class Prog;
 
@@ -96,6 +101,20 @@ struct DecodeResult {
 		 */
 		ADDRESS forceOutEdge;
 
+		/*
+		 * If not NULL, the call in rtl whose destination proc is at newProcDest. When predecoding (see
+		 * NJMCDecoder::setPredecoding), its proc is still to be found or created, with Prog::setNewProc, when the
+		 * result is used; the same is done for a clone of the RTL from the DecodeCache
+		 */
+		CallStatement* newProcCall;
+		ADDRESS		newProcDest;
+
+		/*
+		 * False if decoding the instruction changes (or would have changed, when predecoding) the Prog in some other
+		 * way, so that the result can't be reused: it is neither predecoded nor cached, and the instruction has to be
+		 * decoded again when it is needed
+		 */
+		bool		reusable;
 };
 
 /*==============================================================================
@@ -104,6 +123,11 @@ struct DecodeResult {
 class NJMCDecoder {
 protected:
 		Prog*		prog;
+		DecodeResult result;			// Returned by decodeInstruction. Each decoder has its own, so that
+										// decoders can run on different threads
+		bool		predecoding;		// See setPredecoding()
+		const char* const* opcodeNames;	// The names of the instructions instantiated by index (see resolveOpcodes)
+		std::vector<int> opcodeIds;		// Their opcode ids, -1 for those not in the RTL dictionary
 public:
 		/*
 		 * Constructor and destructor
@@ -132,15 +156,59 @@ virtual int decodeAssemblyInstruction (ADDRESS pc, int delta) = 0;
 
 		Prog*		getProg() {return prog;}
 
+		/*
+		 * When predecoding, the decoder runs on a worker thread (see FrontEnd::predecode), and must not change the
+		 * Prog: the procs called are left to be set when the result is used (DecodeResult::newProcCall), and an
+		 * instruction that would change the Prog otherwise is marked as not reusable
+		 */
+		void		setPredecoding(bool b) {predecoding = b;}
+
 protected:
 
 		/*
-		 * Given an instruction name and a variable list of Exps representing the actual operands of the instruction,
-		 * use the RTL template dictionary to return the list of Statements representing the semantics of the
-		 * instruction. This method also displays a disassembly of the instruction if the relevant compilation flag
-		 * has been set.
+		 * Given an opcode id (see RTLInstDict::getOpcodeId) and a vector of Exps representing the actual operands of
+		 * the instruction, use the RTL template dictionary to return the list of Statements representing the
+		 * semantics of the instruction. This method also displays a disassembly of the instruction if the relevant
+		 * compilation flag has been set. The name is only used for that display.
+		 */
+		std::list<Statement*>* instantiate(ADDRESS pc, int opcode, const char* name, std::vector<Exp*>& actuals);
+
+		/*
+		 * Set the destination proc of the (static) call to dest, creating the proc if needed, and record the call in
+		 * the result; when predecoding, just record it
+		 */
+		void		setDestProc(CallStatement* call, ADDRESS dest);
+
+		/*
+		 * Look up the opcode ids of the num instructions named in names once, when the decoder is set up (after the
+		 * SSL file is read), so that the decoder can instantiate them by their index in names. The names must be
+		 * static.
+		 */
+		void		resolveOpcodes(const char* const* names, int num);
+
+		/*
+		 * As above, but given the index of the instruction in the names passed to resolveOpcodes, and zero to five
+		 * operands; these are the forms used by the generated decoders for instructions with a fixed name.
+		 */
+		std::list<Statement*>* instantiate(ADDRESS pc, int op);
+		std::list<Statement*>* instantiate(ADDRESS pc, int op, Exp* a1);
+		std::list<Statement*>* instantiate(ADDRESS pc, int op, Exp* a1, Exp* a2);
+		std::list<Statement*>* instantiate(ADDRESS pc, int op, Exp* a1, Exp* a2, Exp* a3);
+		std::list<Statement*>* instantiate(ADDRESS pc, int op, Exp* a1, Exp* a2, Exp* a3, Exp* a4);
+		std::list<Statement*>* instantiate(ADDRESS pc, int op, Exp* a1, Exp* a2, Exp* a3, Exp* a4, Exp* a5);
+
+		/*
+		 * As above, but given the instruction name; these are the forms used by the generated decoders when the name
+		 * is chosen by the matcher ([name] in the .m files). The name must be a string literal or other static
+		 * string, since it is mapped to its opcode id by address.
 		 */
-		std::list<Statement*>* instantiate(ADDRESS pc, const char* name, ...);
+		std::list<Statement*>* instantiate(ADDRESS pc, const char* name);
+		std::list<Statement*>* instantiate(ADDRESS pc, const char* name, Exp* a1);
+		std::list<Statement*>* instantiate(ADDRESS pc, const char* name, Exp* a1, Exp* a2);
+		std::list<Statement*>* instantiate(ADDRESS pc, const char* name, Exp* a1, Exp* a2, Exp* a3);
+		std::list<Statement*>* instantiate(ADDRESS pc, const char* name, Exp* a1, Exp* a2, Exp* a3, Exp* a4);
+		std::list<Statement*>* instantiate(ADDRESS pc, const char* name, Exp* a1, Exp* a2, Exp* a3, Exp* a4,
+						Exp* a5);
 
 		/*
 		 * Similarly, given a parameter name and a list of Exp*'s
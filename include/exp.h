@@ -17,6 +17,9 @@
  * 21 May 02 - Mike: Mods for gcc 3.1
  * 02 Aug 04 - Mike: Removed PhiExp (PhiAssign replaces it) 
  * 05 Aug 04 - Mike: Removed the withUses/withDF parameter from print() funcs
+ * 17 Oct 26 - Added structural hashing and interning (hash consing) of expressions
+ * 17 Oct 26 - releaseInterned, numInternedLive
+ * 17 Oct 26 - releaseAllInterned
  */
 
 #ifndef __EXP_H_
@@ -79,8 +82,13 @@ protected:
 
 		unsigned	lexBegin, lexEnd;
 
+		// Interning (hash consing). internId is 0 for ordinary (private, mutable) expressions. Interned expressions
+		// are canonical and shared, have a unique positive internId, and cache their structural hash in hashVal
+		int			internId;
+		unsigned	hashVal;
+
 		// Constructor, with ID
-					Exp(OPER op) : op(op) {}
+					Exp(OPER op) : op(op), internId(0), hashVal(0) {}
 
 public:
 		// Virtual destructor
@@ -89,7 +97,7 @@ virtual				~Exp() {}
 		// Return the operator. Note: I'd like to make this protected, but then subclasses don't seem to be able to use
 		// it (at least, for subexpressions)
 		OPER		getOper() const {return op;}
-		void		setOper(OPER x) {op = x;}	  // A few simplifications use this
+		void		setOper(OPER x) {assert(!internId); op = x;}	  // A few simplifications use this
 
 		void		setLexBegin(unsigned int n) { lexBegin = n; }
 		void		setLexEnd(unsigned int n) { lexEnd = n; }
@@ -126,6 +134,40 @@ virtual bool		operator<<(const Exp& o) const
 // Comparison ignoring subscripts
 virtual bool		operator*=(Exp& o) = 0;
 
+			//	//	//	//	//	//	//	//
+			//	Hashing and interning	//
+			//	//	//	//	//	//	//	//
+
+// Structural hash. Expressions that are equal (operator==, ignoring wildcards) have equal hashes. The hash ignores
+// types, the definitions of subscripts and the procs of Locations, so it is also consistent with operator<<.
+// Cached (O(1)) for interned expressions; otherwise computed recursively
+		unsigned	hash() const {return internId ? hashVal : computeHash();}
+virtual unsigned	computeHash() const;
+// Return the canonical copy of this expression. Structurally identical expressions (including subscript
+// definitions, Location procs and types) intern to the same pointer. The result is shared and must not be modified
+// in place: interned expressions follow copy-on-write rules, see unshare()
+		Exp*		intern();
+		bool		isInterned() const {return internId != 0;}
+		int			getInternId() const {return internId;}
+// Copy on write: return this if this can be modified in place, otherwise a private (uninterned) copy
+		Exp*		unshare() {return internId ? clone() : this;}
+// Return a copy of this expression to use as a long lived key in a lessExpStar ordered container: the interned copy
+// if interning is enabled (-I switch), else a clone
+		Exp*		cloneKey() {return interning ? intern() : clone();}
+// True if interning is enabled (-I switch)
+static	bool		interning;
+// Number of distinct expressions interned so far
+static	int			numInterned();
+// Drop the interned expressions that refer to proc (through the definitions of subscripts or the procs of Locations),
+// so they don't pin its statements. They stay valid, but are no longer canonical: interning an equal expression gives
+// a new copy. Called as proc reaches PROC_FINAL (and after)
+static	void		releaseInterned(UserProc* proc);
+// Empty the intern table, including the expressions that are not owned by any proc. Called when the dataflow of the
+// whole program is done
+static	void		releaseAllInterned();
+// Number of expressions in the intern table
+static	int			numInternedLive();
+
 // Return the number of subexpressions. This is only needed in rare cases.
 // Could use polymorphism for all those cases, but this is easier
 virtual int getArity() {return 0;}		// Overridden for Unary, Binary, etc
@@ -405,6 +447,9 @@ virtual Exp*		clone();
 virtual bool		operator==(const Exp& o) const;
 virtual bool		operator< (const Exp& o) const;
 virtual bool		operator*=(Exp& o);
+virtual unsigned	computeHash() const;
+		// True if o is the very same constant (unlike operator==, no wildcards and no assert on unusual constants)
+		bool		isSameConst(Const& o);
 
 		// Get the constant
 		int			getInt() {return u.i;}
@@ -448,6 +493,7 @@ virtual void		descendType(Type* parentType, bool& ch, Statement* s);
 
 protected:
 		friend class XMLProgParser;
+		friend class Checkpoint;
 };		// class Const
 
 /*==============================================================================
@@ -508,6 +554,7 @@ virtual Exp*		clone();
 virtual bool		operator==(const Exp& o) const;
 virtual bool		operator< (const Exp& o) const;
 virtual bool		operator*=(Exp& o);
+virtual unsigned	computeHash() const;
 
 		// Destructor
 virtual				~Unary();
@@ -577,6 +624,7 @@ virtual Exp* clone();
 virtual bool		 operator==(const Exp& o) const ;
 virtual bool		 operator< (const Exp& o) const ;
 virtual bool		 operator*=(Exp& o);
+virtual unsigned	 computeHash() const;
 
 		// Destructor
 virtual				~Binary();
@@ -650,6 +698,7 @@ virtual Exp*		clone();
 virtual bool		 operator==(const Exp& o) const ;
 virtual bool		 operator< (const Exp& o) const ;
 virtual bool		 operator*=(Exp& o);
+virtual unsigned	 computeHash() const;
 
 		// Destructor
 virtual				~Ternary();
@@ -807,6 +856,7 @@ virtual void		descendType(Type* parentType, bool& ch, Statement* s);
 protected:
 					RefExp() : Unary(opSubscript), def(NULL) { }
 		friend class XMLProgParser;
+		friend class Checkpoint;
 };		// class RefExp
 
 
@@ -875,6 +925,7 @@ virtual bool 		match(const char *pattern, std::map<std::string, Exp*> &bindings)
 
 protected:
 		friend class XMLProgParser;
+		friend class Checkpoint;
 					Location(OPER op) : Unary(op), proc(NULL) { }
 };	// class Location
 	
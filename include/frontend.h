@@ -21,6 +21,10 @@
  *
  * 17 Apr 02 - Mike: Mods to adapt UQBT code to boomerang
  * 28 Jun 05 - Mike: Added a map of previously decoded indirect jumps and calls needed when restarting the cfg
+ * 17 Oct 26 - Library signatures come from precompiled signature databases (libraryDBs)
+ * 17 Oct 26 - predecode(): instructions decoded in advance on worker threads (-j)
+ * 17 Oct 26 - decodeCache: the instructions already decoded, for decoding procs again
+ * 17 Oct 26 - canDecodeFragment
  */
 
 
@@ -29,6 +33,7 @@
 
 #include <list>
 #include <map>
+#include <vector>
 #include <queue>
 #include <fstream>
 #include "types.h"
@@ -46,7 +51,9 @@ class TypedExp;
 class Cfg;
 class Prog;
 struct DecodeResult;
+class DecodeCache;
 class Signature;
+class SignatureDB;
 class Statement;
 class CallStatement;
 
@@ -115,12 +122,22 @@ protected:
 		Prog*		prog;			// The Prog object
 		// The queue of addresses still to be processed
 		TargetQueue	targetQueue;
-		// Public map from function name (string) to signature.
+		// Public map from function name (string) to signature. Filled from libraryDBs as signatures are looked up
 		std::map<std::string, Signature*> librarySignatures;
+		// The precompiled signature databases, one per catalog, in the order read (later ones take precedence)
+		std::vector<SignatureDB*> libraryDBs;
 		// Map from address to meaningful name
 		std::map<ADDRESS, std::string> refHints;
 		// Map from address to previously decoded RTLs for decoded indirect control transfer instructions
 		std::map<ADDRESS, RTL*> previouslyDecoded;
+		// The instructions decoded in advance by predecode(), not yet used, by address
+		std::map<ADDRESS, DecodeResult*> predecoded;
+		DecodeResult* predecodedResult;		// The one of those last returned by decodeInstruction
+		std::vector<NJMCDecoder*> workerDecoders;	// The decoders of predecode()'s threads
+		// The instructions decoded so far, to be cloned when they are decoded again
+		DecodeCache* decodeCache;
+		DecodeResult* cachedResult;			// The one of those last returned by decodeInstruction
+		ADDRESS		reDecodeAt;				// The instruction being decoded in several steps (reDecode), if any
 public:
 		/*
 		 * Constructor. Takes some parameters to save passing these around a lot
@@ -165,6 +182,26 @@ virtual	int			getInst(int addr);
 
 virtual DecodeResult& decodeInstruction(ADDRESS pc);
 
+		/*
+		 * A new decoder for this front end, or NULL if instructions can't be predecoded
+		 */
+virtual NJMCDecoder* newDecoder() {return NULL;}
+
+		/*
+		 * Decode the instructions of the procs at entries, and of the procs they call if callees is set, on several
+		 * threads (-j), each with its own decoder. The procs, and the CFGs, are still built by the decode functions
+		 * below, on this thread and in the usual order; decodeInstruction just returns the instructions decoded in
+		 * advance, instead of decoding them. So the result is the same as without this
+		 */
+		void		predecode(std::vector<ADDRESS>& entries, bool callees);
+
+		/*
+		 * Forget the instructions predecoded but not used
+		 */
+		void		dropPredecoded();
+
+		DecodeCache* getDecodeCache() {return decodeCache;}
+
 virtual void extraProcessCall(CallStatement *call, std::list<RTL*> *BB_rtls) { }
 
 		/*
@@ -176,7 +213,7 @@ virtual void extraProcessCall(CallStatement *call, std::list<RTL*> *BB_rtls) { }
 		 * Read library signatures from a file.
 		 */
 		void		readLibrarySignatures(const char *sPath, callconv cc);
-		// read from a catalog
+		// read from a catalog (through its precompiled database)
 		void		readLibraryCatalog(const char *sPath);
 		// read from default catalog
 		void		readLibraryCatalog();
@@ -204,6 +241,10 @@ virtual std::vector<Exp*> &getDefaultReturns() = 0;
 		/* Decode a fragment of a procedure, e.g. for each destination of a switch statement */
 		void		decodeFragment(UserProc* proc, ADDRESS a);
 
+		/* True if fragments decoded into proc by decodeFragment get the same code as when the whole proc is decoded
+		 * again (see UserProc::spliceSwitches) */
+virtual bool		canDecodeFragment(UserProc* proc) {return true;}
+
 		/*
 		 * processProc. This is the main function for decoding a procedure. It is usually overridden in the derived
 		 * class to do source machine specific things.  If frag is set, we are decoding just a fragment of the proc
@@ -1,9 +1,17 @@
 
+/*
+ * 17 Oct 26 - FileLogger buffers its output, and writes it on a background thread
+ * 17 Oct 26 - flushOnSignal; FileLogger resets the format of its stream for each piece of output
+ */
+
 #ifndef LOG_H
 #define LOG_H
 
 #include "types.h"
 #include <fstream>
+#include <string>
+#include <streambuf>
+#include "threads.h"
 
 class Statement;
 class Exp;
@@ -33,19 +41,78 @@ public:
 			Log &operator<<(std::string& s) {return operator<<(s.c_str());}
 	virtual ~Log() {};
 	virtual void tail();
+	virtual void flush() {}		// Write any buffered output
+	virtual void flushOnSignal() {}	// As flush(), but from a signal handler: no locks, no allocation
+};
+
+// A stream buffer that appends to a string
+class StringAppendBuf : public std::streambuf {
+	std::string& s;
+public:
+			StringAppendBuf(std::string& s) : s(s) {}
+protected:
+	virtual int_type overflow(int_type c) {
+		if (c != traits_type::eof())
+			s += traits_type::to_char_type(c);
+		return traits_type::not_eof(c);
+	}
+	virtual std::streamsize xsputn(const char* p, std::streamsize n) {
+		s.append(p, n);
+		return n;
+	}
 };
 
+// The log file (output/log). Output is formatted straight into a buffer (no temporary string streams), and a
+// background thread writes the buffer to the file in batches: when it reaches BATCH bytes, or every WAIT_MS
+// milliseconds. Without threads, the buffer is written when it is full. flush() writes everything at once; the
+// current log is flushed at exit, when it is replaced, and (as far as possible, see flushOnSignal) when boomerang
+// crashes
 class FileLogger : public Log {
 protected:
+	enum {BATCH = 64 * 1024, MAX_PENDING = 16 * 1024 * 1024, WAIT_MS = 250};
 	std::ofstream out;
+	Mutex	mutex;				// Each piece of output is appended whole, even with several decompiling threads
+	Mutex	fileMutex;			// Held while writing to out; taken after mutex
+	std::string pending;		// Output not yet written
+	std::string writing;		// The batch being written by the writer thread
+	StringAppendBuf buf;		// Appends to pending
+	std::ostream os;
+	std::ios_base::fmtflags osFlags;	// The initial format of os
+	std::ostream& fresh();		// os, with the initial format (with mutex held)
+	int		fd;					// The log file again, for flushOnSignal (-1 if none)
+	Condition ready;			// Signalled when a batch is ready, or when stopping
+	bool	stopping;
+#if HAVE_THREADS
+	pthread_t writer;
+	bool	haveWriter;
+static void* writerMain(void* arg);
+#endif
+	void	startWriter();		// Called by the constructor
+	void	appended();			// Call after appending to pending, with mutex held
 public:
 			FileLogger();		// Implemented in boomerang.cpp
 	void	tail();
+	void	flush();
+	void	flushOnSignal();
 	virtual Log &operator<<(const char *str) { 
-		out << str << std::flush;  
+		MutexLock ml(mutex);
+		pending += str;
+		appended();
 		return *this; 
 	}
-	virtual ~FileLogger() {};
+	virtual Log &operator<<(Statement *s);
+	virtual Log &operator<<(Exp *e);
+	virtual Log &operator<<(Type *ty);
+	virtual Log &operator<<(RTL *r);
+	virtual Log &operator<<(Range *r);
+	virtual Log &operator<<(Range &r);
+	virtual Log &operator<<(RangeMap &r);
+	virtual Log &operator<<(int i);
+	virtual Log &operator<<(char c);
+	virtual Log &operator<<(double d);
+	virtual Log &operator<<(ADDRESS a);
+	virtual Log &operator<<(LocationSet *l);
+	virtual ~FileLogger();
 };
 
 // For older MSVC compilers
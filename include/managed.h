@@ -16,6 +16,8 @@
  *				StatementVec
  *				LocationSet
  *				//LocationList
+ *				BitSet
+ *				LocationNumbering
  *				ConnectionGraph
  *==============================================================================================*/
 
@@ -23,6 +25,8 @@
  * $Revision: 1.22 $	// 1.11.2.15
  *
  * 26/Aug/03 - Mike: Split off from statement.h
+ * 17 Oct 26 - Added BitSet and LocationNumbering, for liveness as bit vectors
+ * 17 Oct 26 - A LocationSet can be allocated in a Region
  */
 
 #ifndef __MANAGED_H__
@@ -30,9 +34,11 @@
 
 #include <list>
 #include <set>
+#include <map>
 #include <vector>
 
 #include "exphelp.h"		// For lessExpStar
+#include "region.h"
 
 class Statement;
 class Assign;
@@ -184,10 +190,15 @@ class LocationSet {
 		// by expression value. If this is not done, then two expressions with the same value (say r[10])
 		// but that happen to have different addresses (because they came from different statements)
 		// would both be stored in the set (instead of the required set behaviour, where only one is stored)
-		std::set<Exp*, lessExpStar> lset; 
+		// The set can be allocated in a region (e.g. for the short lived sets used by propagation); copies are always
+		// on the heap
+typedef std::set<Exp*, lessExpStar, RegionAllocator<Exp*> > Set;
+		Set			lset;
 public:
-typedef std::set<Exp*, lessExpStar>::iterator iterator;
+typedef Set::iterator iterator;
+typedef Set::const_iterator const_iterator;
 					LocationSet() {}						// Default constructor
+					LocationSet(Region* r) : lset(lessExpStar(), r) {}	// In region r, or on the heap if r is NULL
 					~LocationSet() {}						// virtual destructor kills warning
 					LocationSet(const LocationSet& o);		// Copy constructor
 					LocationSet& operator=(const LocationSet& o); // Assignment
@@ -218,6 +229,49 @@ typedef std::set<Exp*, lessExpStar>::iterator iterator;
 		void		addSubscript(Statement* def /* , Cfg* cfg */);		// Add a subscript to all elements
 };	// class LocationSet
 
+/// A set of small non negative integers (e.g. the numbers given by a LocationNumbering), as a bit vector. The set
+/// operations work a whole word at a time, over contiguous words, so that the compiler can vectorise them
+class BitSet {
+		typedef unsigned long Word;
+		enum {BITS = sizeof(Word) * 8};
+		std::vector<Word> words;
+public:
+					BitSet(int n = 0) : words((n + BITS - 1) / BITS, 0) {}
+		void		resize(int n) {words.assign((n + BITS - 1) / BITS, 0);}		// Also clears the set
+		void		clear() {words.assign(words.size(), 0);}
+		void		set(int i) {words[i / BITS] |= (Word)1 << (i % BITS);}
+		void		reset(int i) {words[i / BITS] &= ~((Word)1 << (i % BITS));}
+		bool		test(int i) const {return (words[i / BITS] >> (i % BITS)) & 1;}
+		void		makeUnion(const BitSet& other);				// Set union
+		void		makeDiff(const BitSet& other);				// Set difference
+		bool		operator==(const BitSet& other) const {return words == other.words;}
+		// Return the lowest member in the range [lo, hi), other than except, or -1 if none
+		int			findFirst(int lo, int hi, int except = -1) const;
+};	// class BitSet
+
+/// A dense numbering (0, 1, 2...) of a set of locations, e.g. all the subscripted locations of a procedure. The
+/// numbers follow the LocationSet order, so the locations with the same base expression but different references
+/// (e.g. r24{10} and r24{20}) have consecutive numbers, and LocationSet::findDifferentRef becomes a search of a range
+/// of bits
+class LocationNumbering {
+		std::map<Exp*, int, lessExpStar> nums;		// The number of each location
+		std::vector<Exp*> locs;						// The location with each number
+		// For a subscripted location, the numbers of its base expression are [first, last); otherwise first is the
+		// location's own number, and last is one more
+		std::vector<int> first;
+		std::vector<int> last;
+public:
+		void		add(Exp* loc) {nums.insert(std::pair<Exp*, int>(loc, 0));}
+		void		add(LocationSet& ls);
+		void		number();								// Call after the last add, before the below
+		int			size() {return locs.size();}
+		int			find(Exp* loc);							// The number of loc, or -1 if not numbered
+		Exp*		getLoc(int n) {return locs[n];}
+		int			getFirst(int n) {return first[n];}
+		int			getLast(int n) {return last[n];}
+		void		getLocs(const BitSet& bs, LocationSet& ls);	// Get the locations whose numbers are in bs
+};	// class LocationNumbering
+
 class Range {
 protected:
 	int stride, lowerBound, upperBound;
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   phase.h
+ * OVERVIEW:   Declaration of class Phase, which measures a named phase of the decompilation (e.g. propagateStatements
+ *			   for one proc at one pass): its wall time, and the bytes and objects allocated during it. The totals of
+ *			   each phase are reported with -M; each phase is also an event in the Chrome trace written with -gt
+ *			   (load it in chrome://tracing or ui.perfetto.dev). When neither is given, a Phase does nothing but test
+ *			   a flag.
+ * CLASSES:	   Phase
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created, from PhaseMemory (was in region.h)
+ */
+
+#ifndef __PHASE_H__
+#define __PHASE_H__
+
+#include <stddef.h>
+#include <iostream>
+
+class UserProc;
+
+// Measures from its construction to its destruction. The totals of a phase (-M) do not include the phases nested in
+// it (e.g. a callee decompiled during the middle phase of its caller); its trace event does. With -j, the heap bytes
+// and objects allocated by other threads are counted in this thread's phase too
+class Phase {
+		const char*	name;						// NULL if not measuring
+		UserProc*	proc;
+		int			pass;
+		double		start;						// Microseconds
+		size_t		heap0, region0, objects0;	// The counts when the phase began
+		size_t		nestedHeap, nestedRegion, nestedObjects;	// Counted by nested phases
+		Phase*		outer;						// The enclosing phase in this thread
+
+		void		begin();
+		void		end();
+
+public:
+					Phase(const char* name, UserProc* proc = NULL, int pass = -1) : name(NULL) {
+						if (active) {
+							this->name = name;
+							this->proc = proc;
+							this->pass = pass;
+							begin();
+						}
+					}
+					~Phase() {if (name) end();}
+
+		// True if phases are measured (-M or -gt)
+static	bool		active;
+
+		// The number of objects allocated with operator new; counted when active, if the garbage collector is used
+static	volatile long objects;
+
+		// Print the totals of each phase (-M)
+static	void		report(std::ostream& os);
+
+		// Write the trace events of the phases so far to fname, in the Chrome trace event format (-gt). Returns
+		// false if the file can't be written
+static	bool		writeTrace(const char* fname);
+
+private:
+					Phase(const Phase&);		// Not copyable
+		Phase&		operator=(const Phase&);
+};
+
+#endif	// __PHASE_H__
@@ -17,6 +17,17 @@
 
 /*
  *	$Revision: 1.154 $	// 1.115.2.27
+ *
+ * 17 Oct 26 - Counters and change tracking for the worklist data flow type analysis
+ * 17 Oct 26 - Def-use chains for propagation
+ * 17 Oct 26 - setName and setSignature keep Prog's index of proc names up to date
+ * 17 Oct 26 - A UserProc loaded from a checkpoint reads its body when first needed (loadBody)
+ * 17 Oct 26 - spliceSwitches; removeCaller
+ * 17 Oct 26 - Each UserProc has a scratch region, for the short lived sets of the prover and propagation
+ * 17 Oct 26 - Time and memory budgets: overBudget, getDegraded
+ * 17 Oct 26 - releaseBody
+ * 17 Oct 26 - The def-use chains are kept up to date between propagation passes; stmtChanged, stmtRemoved and
+ *				invalidateDefUse
  */
 
 #ifndef _PROC_H_
@@ -35,6 +46,7 @@
 #include "dataflow.h"			// For class UseCollector
 #include "statement.h"			// For embedded ReturnStatement pointer, etc
 #include "boomerang.h"			// For USE_DOMINANCE_NUMS etc
+#include "region.h"
 
 class Prog;
 class UserProc;
@@ -105,7 +117,7 @@ virtual				~Proc();
 		 * Returns a pointer to the Signature
 		 */
 		Signature	*getSignature() { return signature; }
-		void		setSignature(Signature *sig) { signature = sig; }
+		void		setSignature(Signature *sig);
 
 virtual void		renameParam(const char *oldName, const char *newName);
 
@@ -194,12 +206,23 @@ virtual	bool		isPreserved(Exp* e) = 0;		///< Return whether e is preserved by th
 		 * Get the callers
 		 * Note: the callers will be in a random order (determined by memory allocation)
 		 */
-		std::set<CallStatement*>& getCallers() { return callerSet; }
+		std::set<CallStatement*>& getCallers() { loadCallers(); return callerSet; }
+
+		/**
+		 * If the program was loaded from a checkpoint, read the procs that call this one (so that the set of callers
+		 * is complete)
+		 */
+		void		loadCallers();
 
 		/**
 		 * Add to the set of callers
 		 */
-		void		addCaller(CallStatement* caller) { callerSet.insert(caller); }
+		void		addCaller(CallStatement* caller);
+
+		/**
+		 * Remove from the set of callers (e.g. a call in code that is being decoded again)
+		 */
+		void		removeCaller(CallStatement* caller);
 
 		/**
 		 * Add to a set of caller Procs
@@ -253,6 +276,7 @@ protected:
 		Cluster		*cluster;						///< Cluster this procedure is contained within.
 
 		friend class XMLProgParser;
+		friend class Checkpoint;
 		Proc() : visited(false), prog(NULL), signature(NULL), address(0), m_firstCaller(NULL), m_firstCallerAddr(0),
 			cluster(NULL) { }
 
@@ -287,6 +311,7 @@ virtual	bool		isPreserved(Exp* e);					///< Return whether e is preserved by thi
 protected:
 
 		friend class XMLProgParser;
+		friend class Checkpoint;
 					LibProc() : Proc() { }
 };		// class LibProc
 
@@ -310,6 +335,11 @@ typedef std::list<UserProc*> ProcList;
  * UserProc class.
  *============================================================================*/
 
+// The sets of the prover, in the scratch region of the proc
+typedef std::set<PhiAssign*, std::less<PhiAssign*>, RegionAllocator<PhiAssign*> > ProverPhiSet;
+typedef std::map<PhiAssign*, Exp*, std::less<PhiAssign*>, RegionAllocator<std::pair<PhiAssign* const, Exp*> > >
+	ProverCache;
+
 class UserProc : public Proc {
 
 		/**
@@ -410,6 +440,13 @@ private:
 		/// function to do safe adding.
 		void addToStackMap(int c, Type *ty);
 
+		/**
+		 * A region for the short lived objects of the analyses of this procedure, e.g. the sets of locations used by
+		 * propagation. It is released at the end of each pass, and when the status changes. Only the thread that
+		 * decompiles this procedure may use it.
+		 */
+		Region		scratch;
+
 public:
 
 					UserProc(Prog *prog, std::string& name, ADDRESS address);
@@ -428,19 +465,37 @@ virtual				~UserProc();
 		/**
 		 * Returns a pointer to the CFG object.
 		 */
-		Cfg*		getCFG() { return cfg; }
+		Cfg*		getCFG() { loadBody(); return cfg; }
+
+		/**
+		 * If this proc was loaded from a checkpoint (-LD), read its body (CFG, locals, symbols, callees etc) if that
+		 * has not been done yet. isLoaded() is false until then
+		 */
+		void		loadBody() { if (inCheckpoint) readBody(); }
+		bool		isLoaded() { return !inCheckpoint; }
 
 		/**
 		 * Returns a pointer to the DataFlow object.
 		 */
 		DataFlow*	getDataFlow() {return &df;}
 
+		/**
+		 * Returns the scratch region. Containers allocated in it must not outlive the current pass.
+		 */
+		Region*		getScratch() {return &scratch;}
+
 		/**
 		 * Deletes the whole CFG and all the RTLs and Exps associated with it. Also nulls the internal cfg
 		 * pointer (to prevent strange errors)
 		 */
 		void		deleteCFG();
 
+		/**
+		 * Free what is only needed to generate the code of this procedure: the BBs (and so the statements) and the
+		 * dataflow information. The signature, parameters and return statement stay, for the callers (-F)
+		 */
+		void		releaseBody();
+
 virtual bool		isNoReturn();
 
 		/**
@@ -598,6 +653,7 @@ typedef std::map<Statement*, int> RefCounter;
 		/// Remove unused statements.
 		void		remUnusedStmtEtc();
 		void		remUnusedStmtEtc(RefCounter& refCounts /* , int depth*/);
+		bool		isRemovableIfUnused(Statement* s);
 		void		removeUnusedLocals();
 		void		mapTempsToLocals();
 		void		removeCallLiveness();			// Remove all liveness info in UseCollectors in calls
@@ -605,6 +661,16 @@ typedef std::map<Statement*, int> RefCounter;
 		/// Propagate statemtents; return true if change; set convert if an indirect call is converted to direct
 		/// (else clear)
 		bool		propagateStatements(bool& convert, int pass);
+		/// (Re)build the def-use chains of the given statements (all the statements of this proc). Once built, the
+		/// chains are kept up to date by renaming, call bypass, simplification and statement removal (through
+		/// stmtChanged() and stmtRemoved()); transformations that rewrite the proc wholesale call invalidateDefUse(),
+		/// and the next propagateStatements() builds them again
+		void		buildDefUse(StatementList& stmts);
+		/// The references of s have changed: update its def-use chains, and mark s and its users for propagation
+		void		stmtChanged(Statement* s);
+		/// s is about to be removed from this proc: take it out of the def-use chains
+		void		stmtRemoved(Statement* s);
+		void		invalidateDefUse() {defUseValid = false; dirty.clear();}
 		void		findLiveAtDomPhi(LocationSet& usedByDomPhi);
 #if		USE_DOMINANCE_NUMS
 		void		setDominanceNumbers();
@@ -656,8 +722,8 @@ typedef std::map<Statement*, int> RefCounter;
 		/// be conditional on premises stored in other procedures
 		bool		prove(Exp *query, bool conditional = false);
 		/// helper function, should be private
-		bool		prover(Exp *query, std::set<PhiAssign*> &lastPhis, std::map<PhiAssign*, Exp*> &cache,
-						Exp* original, PhiAssign *lastPhi = NULL);	  
+		bool		prover(Exp *query, ProverPhiSet &lastPhis, ProverCache &cache, Exp* original,
+						PhiAssign *lastPhi = NULL);	  
 
 		/// promote the signature if possible
 		void		promoteSignature();
@@ -681,8 +747,8 @@ virtual	void		removeReturn(Exp *e);
 		void		addImplicitAssigns();
 		void		makeSymbolsImplicit();
 		void		makeParamsImplicit();
-		StatementList& getParameters() { return parameters; }
-		StatementList& getModifieds() { return theReturnStatement->getModifieds(); }
+		StatementList& getParameters() { loadBody(); return parameters; }
+		StatementList& getModifieds() { loadBody(); return theReturnStatement->getModifieds(); }
 
 private:
 		/**
@@ -790,7 +856,7 @@ virtual void		renameParam(const char *oldName, const char *newName);
 		/**
 		 * Get the callees.
 		 */
-		std::list<Proc*>& getCallees() { return calleeList; }
+		std::list<Proc*>& getCallees() { loadBody(); return calleeList; }
 
 		/**
 		 * Add to the set of callees.
@@ -847,20 +913,56 @@ virtual void		printCallGraphXML(std::ostream &os, int depth,
 		/// Copy the decoded indirect control transfer instructions' RTLs to the front end's map, and decode any new
 		/// targets for this CFG
 		void		processDecodedICTs();
+
+		/// Decode the arms of the switch statements just analysed (in BBs switches) into this CFG, and bring the new
+		/// code up to the state of the rest of the proc. Returns false if the proc has to be decompiled again instead
+		bool		spliceSwitches(std::list<PBB>& switches);
  
 private:
 		/// We ensure that there is only one return statement now. See code in frontend/frontend.cpp handling case
 		/// STMT_RET. If no return statement, this will be NULL.
 		ReturnStatement* theReturnStatement;
 		int			DFGcount;
+		/// Worklist data flow type analysis: statements changed by Statement::meetWithFor() during the current visit
+		/// (NULL when not in dfaTypeAnalysis()), and counters for the last dfaTypeAnalysis() of this proc
+		std::list<Statement*>* dfaTouched;
+		int			dfaVisits, dfaMeets, dfaChanges;
+		/// True if the body of this proc is still in the checkpoint that the program was loaded from
+		bool		inCheckpoint;
+		void		readBody();
+		/// For the budgets (see budget.h): when decompilation of this proc started (wall clock, microseconds; 0 if
+		/// not yet), the heap bytes allocated by then, and how far it has been cut back (a Budget::Level)
+		double		budgetStart;
+		size_t		budgetHeap;
+		int			degraded;
+		/// True if the def-use chains of the statements are up to date. dirty has the statements that propagation
+		/// has to look at again: those whose references or definitions have changed since they were last looked at
+		bool		defUseValid;
+		StatementSet dirty;
+		void		updateUses(Statement* s);
+		void		noteFewerUses(std::vector<Statement*>& defs);
+		void		markUsersDirty(Statement* s);
 public:
+		/// Check the budgets, and cut back the decompilation of this proc if it or the whole decompilation is over
+		/// budget. The first call starts the budget of this proc. Returns true if there should be no more passes
+		bool		overBudget();
+		int			getDegraded() {return degraded;}
+		/// Called by Statement::meetWithFor() for a meet with the type of s (a statement of this proc)
+		void		dfaNoteMeet(Statement* s, bool changed) {
+						dfaMeets++;
+						if (changed && dfaTouched) dfaTouched->push_back(s);}
+		/// Get the counters from the last data flow type analysis: statement visits, meets with the types of
+		/// definitions, and visits that changed a type
+		void		getDfaCounts(int& visits, int& meets, int& changes) {
+						visits = dfaVisits; meets = dfaMeets; changes = dfaChanges;}
 		ADDRESS		getTheReturnAddr() {
+						loadBody();
 						return theReturnStatement == NULL ? NO_ADDRESS : theReturnStatement->getRetAddr();}
 		void		setTheReturnAddr(ReturnStatement* s, ADDRESS r) {
 						assert(theReturnStatement == NULL);
 						theReturnStatement = s;
 						theReturnStatement->setRetAddr(r);}
-		ReturnStatement* getTheReturnStatement() {return theReturnStatement;}
+		ReturnStatement* getTheReturnStatement() {loadBody(); return theReturnStatement;}
 		bool		filterReturns(Exp* e);			///< Decide whether to filter out e (return true) or keep it
 		bool		filterParams(Exp* e);			///< As above but for parameters and arguments
 
@@ -869,6 +971,7 @@ public:
 
 protected:
 		friend class XMLProgParser;
+		friend class Checkpoint;
 					UserProc();
 		void		setCFG(Cfg *c) { cfg = c; }
 };		// class UserProc
@@ -16,6 +16,14 @@
 /*
  * $Revision: 1.93 $	// 1.73.2.5
  * 16 Apr 01 - Mike: Mods for boomerang
+ * 17 Oct 26 - Lock for the shared state, and the scheduler for parallel decompilation
+ * 17 Oct 26 - Indexes of the globals by address and by name
+ * 17 Oct 26 - Indexes of the procs by position, by name, and by the address ranges that they cover
+ * 17 Oct 26 - The checkpoint that the program was loaded from (-LD), if any
+ * 17 Oct 26 - generateUnit: the code of one output file
+ * 17 Oct 26 - isRelocationAt
+ * 17 Oct 26 - getDecodeCache
+ * 17 Oct 26 - canDecodeFragment
  */
 
 #ifndef _PROG_H_
@@ -26,8 +34,11 @@
 #include "frontend.h"
 #include "type.h"
 #include "cluster.h"
+#include "threads.h"
 
 class RTLInstDict;
+class DecompileScheduler;
+class Checkpoint;
 class Proc;
 class UserProc;
 class LibProc;
@@ -87,6 +98,10 @@ virtual				~Prog();
 		Proc*		findProc(const char *name) const;
 		// Find the Proc that contains the given address
 		Proc*		findContainingProc(ADDRESS uAddr) const;
+		// Update the address ranges of proc p, after (more of) it has been decoded
+		void		updateProcRanges(UserProc* p);
+		// Proc p was renamed from oldName; called by Proc::setName and Proc::setSignature
+		void		procRenamed(Proc* p, const char* oldName);
 		bool		isProcLabel (ADDRESS addr); 	// Checks if addr is a label or not
 		// Create a dot file for all CFGs
 		bool		createDotFile(const char*, bool bMainOnly = false) const;
@@ -120,6 +135,7 @@ virtual				~Prog();
 		void		setEntryPoint(ADDRESS a);			// As per the above, but don't decode
 		void		decodeEverythingUndecoded();
 		void		decodeFragment(UserProc* proc, ADDRESS a);
+		bool		canDecodeFragment(UserProc* proc);
 
 		// Re-decode this proc from scratch
 		void		reDecode(UserProc* proc);
@@ -139,6 +155,14 @@ virtual				~Prog();
 		// Do the main non-global decompilation steps
 		void		decompile();
 
+		// The scheduler decompiling this program in parallel, if any (else NULL)
+		DecompileScheduler* getScheduler() {return scheduler;}
+		// The lock for the procedures, globals and front end, which are shared by all the decompiling threads
+		Mutex&		getLock() {return lock;}
+
+		// The checkpoint that this program was loaded from (-LD), which procs read their bodies from; else NULL
+		Checkpoint*	getCheckpoint() {return checkpoint;}
+
 		// All that used to be done in UserProc::decompile, but now done globally: propagation, recalc DFA, remove null
 		// and unused statements, compressCfg, process constants, promote signature, simplify a[m[]].
 		void		decompileProcs();
@@ -207,6 +231,13 @@ virtual				~Prog();
 		const char	*getGlobalName(ADDRESS uaddr);
 		ADDRESS		getGlobalAddr(char *nam);
 		Global*		getGlobal(char *nam);
+		// Find the global that starts at uaddr, or else contains it (according to the size of its type); NULL if none
+		Global*		findGlobalContaining(ADDRESS uaddr);
+
+		// Add a new global. All new globals must be added with this, to keep the indexes of the globals
+		void		addGlobal(Global* global);
+		// Call after changing the type (and so perhaps the size) of a global
+		void		globalTypeChanged(Global* global);
 
 		// Make up a name for a new global at address uaddr (or return an existing name if address already used)
 		const char	*newGlobalName(ADDRESS uaddr);
@@ -243,6 +274,7 @@ virtual				~Prog();
 		ADDRESS		getLimitTextLow() {return pBF->getLimitTextLow();}
 		ADDRESS		getLimitTextHigh() {return pBF->getLimitTextHigh();}
 		bool		isReadOnly(ADDRESS a) { return pBF->isReadOnly(a); }
+		bool		isRelocationAt(ADDRESS a) {return pBF->IsRelocationAt(a);}
 		// Read 2, 4, or 8 bytes given a native address
 		int			readNative1(ADDRESS a) {return pBF->readNative1(a);}
 		int			readNative2(ADDRESS a) {return pBF->readNative2(a);}
@@ -277,6 +309,9 @@ virtual				~Prog();
 		Cluster		*getDefaultCluster(const char *name);
 		bool		clusterUsed(Cluster *c);
 
+		// The front end's cache of decoded instructions
+		DecodeCache* getDecodeCache() { return pFE->getDecodeCache(); }
+
 		// Add the given RTL to the front end's map from address to aldready-decoded-RTL
 		void		addDecodedRtl(ADDRESS a, RTL* rtl) {
 						pFE->addDecodedRtl(a, rtl); }
@@ -293,14 +328,50 @@ protected:
 		std::string	m_name, m_path;			// name of the program and its full path
 		std::list<Proc*> m_procs;			// list of procedures
 		PROGMAP		m_procLabels;			// map from address to Proc*
-		// FIXME: is a set of Globals the most appropriate data structure? Surely not.
+		// Indexes of the procs: m_procs as a vector (for getProc(i)), and by a hash of the name. procRanges maps the
+		// low address of each decoded BB of each UserProc to its high address and the proc; as for the globals, ranges
+		// longer than BIG_PROC_RANGE are kept apart, in bigProcRanges, so that a search need only look maxProcRange
+		// below the address. procRangeStarts has the low addresses of each proc's ranges, for removing them
+		std::vector<Proc*> procIndex;
+		std::multimap<unsigned, Proc*> procsByName;
+		std::multimap<ADDRESS, std::pair<ADDRESS, UserProc*> > procRanges;
+		std::multimap<ADDRESS, std::pair<ADDRESS, UserProc*> > bigProcRanges;
+		std::map<UserProc*, std::vector<ADDRESS> > procRangeStarts;
+		ADDRESS		maxProcRange;			// The longest range in procRanges
+		void		registerProc(Proc* p);	// Add p to m_procs, m_procLabels and the indexes
+		void		unregisterProc(Proc* p);	// Remove p from m_procs and the indexes
+		void		removeProcRanges(UserProc* p);
+		void		addProcRange(UserProc* p, ADDRESS lo, ADDRESS hi);
+		void		indexProcs();			// Rebuild the indexes from m_procs
 		std::set<Global*> globals;			// globals to print at code generation time
+		// Indexes of the globals: by start address, and by a hash of the name. Globals bigger than BIG_GLOBAL bytes
+		// (e.g. unbounded arrays) are also in bigGlobals; then a search for the global containing an address need
+		// only look maxGlobalSize bytes below it in globalsByAddr, and at the few big globals
+		std::multimap<ADDRESS, Global*> globalsByAddr;
+		std::multimap<unsigned, Global*> globalsByName;
+		std::set<Global*> bigGlobals;
+		unsigned	maxGlobalSize;			// The size in bytes of the biggest global not in bigGlobals
+		void		indexGlobals();			// Rebuild the above from globals
 		//std::map<ADDRESS, const char*> *globalMap; // Map of addresses to global symbols
 		DataIntervalMap globalMap;			// Map from address to DataInterval (has size, name, type)
 		int			m_iNumberedProc;		// Next numbered proc will use this
 		Cluster		*m_rootCluster;			// Root of the cluster tree
 
+		/* Parallel decompilation */
+		DecompileScheduler* scheduler;		// Set while decompiling in parallel (-j)
+
+		/* Code generation: the procs written to one output file (os; NULL if not wanted), in order */
+		struct CodeUnit {
+			std::ostream* os;
+			std::vector<UserProc*> procs;
+		};
+static	void		generateUnit(void* arg, int i);
+
+		Checkpoint*	checkpoint;				// See getCheckpoint()
+mutable	Mutex		lock;					// See getLock()
+
 		friend class XMLProgParser;
+		friend class Checkpoint;
 };	// class Prog
 
 #endif
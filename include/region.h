@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   region.h
+ * OVERVIEW:   Declaration of class Region, an arena for the short lived objects of an analysis (e.g. the nodes of the
+ *			   sets of locations used during propagation), which are all freed at once when the region is released.
+ *			   Each UserProc has one (its scratch region), released at the end of each pass and when its status
+ *			   changes. RegionAllocator lets the standard containers allocate their nodes in a region.
+ * CLASSES:	   Region
+ *			   RegionAllocator
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created
+ * 17 Oct 26 - PhaseMemory moved to phase.h (as Phase)
+ */
+
+#ifndef __REGION_H__
+#define __REGION_H__
+
+#include <stddef.h>
+#include <new>
+
+class Region {
+		struct Chunk {
+			Chunk*	next;
+			size_t	size;						// Of the data, which follows
+		};
+		enum {ALIGN = 2 * sizeof(void*), CHUNK_SIZE = 64 * 1024 - sizeof(Chunk)};
+
+		Chunk*		chunks;						// The chunk being allocated from is first
+		char*		next;						// The next free byte in it
+		char*		limit;						// The end of it
+		size_t		allocated;					// Bytes allocated since the last release
+
+		void*		allocSlow(size_t n);		// alloc(), when the first chunk is full
+
+public:
+					Region() : chunks(NULL), next(NULL), limit(NULL), allocated(0) {}
+					~Region();
+
+		// Allocate n bytes, aligned for any type. They are freed by release(); objects in them are not destroyed
+		void*		alloc(size_t n) {
+						n = (n + ALIGN - 1) & ~(size_t)(ALIGN - 1);
+						if (n > (size_t)(limit - next))
+							return allocSlow(n);
+						void* p = next;
+						next += n;
+						allocated += n;
+						if (counting)
+							count(n);
+						return p;
+					}
+
+		// Free everything allocated in this region. One chunk is kept for reuse
+		void		release();
+
+		size_t		getAllocated() {return allocated;}
+
+		// True if the bytes allocated in all regions are counted (for Phase)
+static	bool		counting;
+static	void		count(size_t n);
+static	size_t		getTotalAllocated();		// Bytes allocated in all regions, when counting
+
+private:
+					Region(const Region&);		// Not copyable
+		Region&		operator=(const Region&);
+};
+
+// An allocator for the standard containers that allocates in a region, or on the heap if the region is NULL. Freeing
+// an element in a region does nothing. A container using a region must not outlive the region's next release()
+template <class T> class RegionAllocator {
+public:
+typedef size_t			size_type;
+typedef ptrdiff_t		difference_type;
+typedef T*				pointer;
+typedef const T*		const_pointer;
+typedef T&				reference;
+typedef const T&		const_reference;
+typedef T				value_type;
+template <class U> struct rebind {typedef RegionAllocator<U> other;};
+
+		Region*		region;
+
+					RegionAllocator(Region* region = NULL) throw() : region(region) {}
+template <class U>	RegionAllocator(const RegionAllocator<U>& o) throw() : region(o.region) {}
+
+		pointer		address(reference x) const {return &x;}
+		const_pointer address(const_reference x) const {return &x;}
+		pointer		allocate(size_type n, const void* = 0) {
+						return (pointer)(region ? region->alloc(n * sizeof(T)) : ::operator new(n * sizeof(T)));
+					}
+		void		deallocate(pointer p, size_type) {if (region == NULL) ::operator delete(p);}
+		size_type	max_size() const throw() {return (size_t)-1 / sizeof(T);}
+		void		construct(pointer p, const T& val) {new((void*)p) T(val);}
+		void		destroy(pointer p) {p->~T();}
+};
+
+template <class T, class U> inline bool operator==(const RegionAllocator<T>& a, const RegionAllocator<U>& b) {
+	return a.region == b.region;
+}
+template <class T, class U> inline bool operator!=(const RegionAllocator<T>& a, const RegionAllocator<U>& b) {
+	return a.region != b.region;
+}
+
+#endif	// __REGION_H__
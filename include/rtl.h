@@ -26,6 +26,8 @@
  * 08 Apr 02 - Mike: Mods for boomerang
  * 13 May 02 - Mike: expList is no longer a pointer
  * 25 Jul 03 - Mike: RTL now a list of Statements
+ * 17 Oct 26 - TableEntry keeps a compiled form of its template, and a cache of constant operand instances
+ * 17 Oct 26 - Dictionary entries have dense opcode ids
  */
 
 #ifndef __RTL_H__
@@ -188,6 +190,12 @@ protected:
  * This class plus ParamEntry and RTLInstDict should be moved to a separate
  * header file...
  *============================================================================*/
+// Orders vectors of actual operands (element by element, with lessExpStar), for the instance cache below
+class lessActuals : public std::binary_function<std::vector<Exp*>, std::vector<Exp*>, bool> {
+public:
+	bool operator()(const std::vector<Exp*>& x, const std::vector<Exp*>& y) const;
+};
+
 class TableEntry {
 public:
 	TableEntry();
@@ -200,6 +208,17 @@ public:
 	
 	// non-zero return indicates failure
 	int appendRTL(std::list<std::string>& p, RTL& rtl);
+
+	// Precompute the facts about the template that instantiation would otherwise rediscover for every decoded
+	// instruction. Called once the whole SSL file has been read
+	void compile();
+
+	// Find a cached instance for these actuals, or NULL if none. The result belongs to the cache
+	std::list<Statement*>* findInstance(std::vector<Exp*>& actuals);
+	// Remember an instance for these actuals, if they are all constant and there is room
+	void	addInstance(std::vector<Exp*>& actuals, std::list<Statement*>* stmts);
+	// Delete all the cached instances
+	void	clearCache();
 	
 public:
 	std::list<std::string> params;
@@ -207,6 +226,17 @@ public:
 
 #define TEF_NEXTPC 1		
 	int flags;					// aka required capabilities. Init. to 0 
+
+	int		id;						// Dense opcode id; index into RTLInstDict::idTable. -1 until the SSL file is read
+
+	// The compiled form of the template; only valid if compiled is set
+	bool	compiled;
+	bool	hasPostVars;			// True if some statement may assign to a post-variable
+	bool	hasSuccessor;			// True if some statement contains succ(...)
+	std::vector<bool> usesParams;	// For each statement of rtl, true if it refers to any formal parameter
+
+	// Instances already made for actuals that are all integer constants or r[K], keyed by clones of the actuals
+	std::map<std::vector<Exp*>, std::list<Statement*>*, lessActuals> instCache;
 };
 
 
@@ -262,9 +292,22 @@ public:
 		// Reset the object to "undo" a readSSLFile()
 		void	reset();
 
+		// Read the dictionary from the binary cache of an SSL file, if it is up to date (see sslcache.cpp), or write
+		// the cache after reading the SSL file
+		bool	readCache(const std::string& cacheName, const std::string& SSLFileName);
+		void	writeCache(const std::string& cacheName, const std::string& SSLFileName);
+
 		// Return the signature of the given instruction.
 		std::pair<std::string,unsigned> getSignature(const char* name);
 
+		// Return the opcode id of the given instruction, or -1 if there is none. The name is normalised as for
+		// getSignature the first time it is seen; after that it is found by address, so it must not be a temporary
+		int		getOpcodeId(const char* name);
+		// As above, but any string will do, nothing is printed for a name that is not found, and nothing is cached
+		int		lookupOpcodeId(const char* name);
+		// Return the dictionary entry for an opcode id
+		TableEntry&	getEntry(int id) {return *idTable[id];}
+
 		// Appends an RTL to an idict entry, or Adds it to idict if an entry does not already exist. A non-zero return
 		// indicates failure.
 		int appendToDict(std::string &n, std::list<std::string>& p, RTL& rtl);
@@ -275,6 +318,8 @@ public:
 		// As above, but takes an RTL & param list directly rather than doing a table lookup by name.
 		std::list<Statement*>* instantiateRTL(RTL& rtls, ADDRESS natPC, std::list<std::string> &params,
 			std::vector<Exp*>& actuals);
+		// As above, but uses the compiled form of a dictionary entry, and its cache of constant operand instances
+		std::list<Statement*>* instantiateRTL(TableEntry& entry, ADDRESS natPC, std::vector<Exp*>& actuals);
 
 		// Transform the given list into another list which doesn't have post-variables, by either adding temporaries or
 		// just removing them where possible. Modifies the list passed, and also returns a pointer to it. Second
@@ -324,6 +369,12 @@ public:
 	// The actual dictionary.
 	std::map<std::string, TableEntry, std::less<std::string> > idict;
 
+	// The dictionary entries, indexed by opcode id
+	std::vector<TableEntry*> idTable;
+
+	// Instruction names (by address, e.g. the string literals in the decoders) already resolved to opcode ids
+	std::map<const char*, int> nameIds;
+
 	// An RTL describing the machine's basic fetch-execute cycle
 	RTL *fetchExecCycle;
 
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   scheduler.h
+ * OVERVIEW:   Declaration of class DecompileScheduler, which decompiles the procedures of a program on several
+ *			   threads (-j). The call graph is split into its strongly connected components ("groups"); a group is
+ *			   decompiled by one thread, once all the groups that it calls are final. Independent groups are
+ *			   decompiled in parallel. parallelFor runs independent tasks (e.g. the code generation of clusters) on
+ *			   several threads.
+ * CLASSES:	   DecompileScheduler
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created
+ * 17 Oct 26 - parallelFor
+ * 17 Oct 26 - awaitFinal orders the waits by group number
+ */
+
+#ifndef __SCHEDULER_H__
+#define __SCHEDULER_H__
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <set>
+#include "threads.h"
+
+class Prog;
+class UserProc;
+
+class DecompileScheduler {
+		// A strongly connected component of the call graph
+		struct Group {
+			std::vector<UserProc*> procs;		// The members; procs[0] is the one to decompile first
+			std::vector<int> callers;			// Indexes of the groups that call this one
+			std::vector<int> callees;			// Indexes of the groups that this one calls
+			int			pending;				// Number of callee groups not yet done
+			bool		started;				// Taken by a worker
+			bool		done;					// All members are final
+			int			worker;					// The worker decompiling this group, or -1
+						Group() : pending(0), started(false), done(false), worker(-1) {}
+		};
+
+		Prog*		prog;
+		int			numThreads;
+		std::vector<Group> groups;
+		std::map<UserProc*, int> groupOf;		// The group index of each proc
+		std::vector<std::deque<int> > queues;	// Ready groups, per worker
+		int			remaining;					// Number of groups not yet done
+		Mutex		mutex;						// Guards all of the above (after construction)
+		Condition	changed;					// Signalled when a group is done, or becomes ready
+
+		// Tarjan's algorithm state, only used by the constructor
+		std::map<UserProc*, int> index;
+		std::map<UserProc*, int> lowlink;
+		std::vector<UserProc*> stack;
+		std::set<UserProc*> onStack;
+		int			nextIndex;
+
+		void		strongConnect(UserProc* p);
+		void		addEdges();
+		int			nextGroup(int w);
+		void		runGroup(int w, int g);
+		void		decompileGroup(int g);
+		void		finish(int w, int g);
+		void		work(int w);
+static	void*		threadMain(void* arg);
+
+public:
+					DecompileScheduler(Prog* prog, int numThreads);
+
+		// Decompile every group, returning when all are final
+		void		run();
+
+		// Called by caller's thread before it decompiles callee. Returns true if the caller's thread should decompile
+		// callee itself (it is in the caller's group, or was not known when the groups were found, and is now)
+		bool		claim(UserProc* caller, UserProc* callee);
+
+		// Wait until callee (claimed by another group) is final. Returns false, without waiting, if callee's group
+		// comes after caller's (the call may close a cycle of groups)
+		bool		awaitFinal(UserProc* caller, UserProc* callee);
+
+		// True if callee is final or in a group numbered no higher than caller's: the calls that awaitFinal waits for
+		bool		mayWaitFor(UserProc* caller, UserProc* callee);
+
+		int			getNumGroups() {return groups.size();}
+};
+
+// Call body(arg, i) for each i from 0 to n-1, on up to numThreads threads (the calling thread is one of them), in no
+// particular order. Returns when all the calls have returned
+void		parallelFor(int n, int numThreads, void (*body)(void* arg, int i), void* arg);
+
+#endif	// __SCHEDULER_H__
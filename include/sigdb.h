@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   sigdb.h
+ * OVERVIEW:   Declaration of class SignatureDB, a precompiled form of the library signature headers named in a
+ *			   catalog (.hs file). The database is built from the headers the first time that it is needed (and again
+ *			   when any of the headers changes), and is then memory mapped. The named types that the headers declare are
+ *			   saved already parsed, and defined when the database is opened; each function signature is parsed only
+ *			   when it is first looked up.
+ * CLASSES:	   SignatureDB
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created
+ * 17 Oct 26 - The named types are saved in the database; parseTypes
+ */
+
+#ifndef __SIGDB_H__
+#define __SIGDB_H__
+
+#include <string>
+#include <vector>
+#include "sigenum.h"
+
+class Signature;
+
+class SignatureDB {
+public:
+		// A header named in a catalog, and the calling convention assumed for its functions
+		struct Source {
+			std::string	name;					// As in the catalog, e.g. "windows.h"
+			std::string	path;					// The full path of the header
+			callconv	cc;
+						Source(const std::string& name, const std::string& path, callconv cc) :
+							name(name), path(path), cc(cc) {}
+		};
+
+private:
+		const char*	image;						// The database, mapped from the file or in buf
+		size_t		size;
+		bool		mapped;						// True if image is mapped from the file
+		std::vector<char> buf;					// The database, if it could not be written to the file
+		platform	plat;
+		std::vector<Source> sources;
+
+		bool		valid();					// Is image a database of sources for plat, newer than the sources?
+		void		build(const char* dbPath);	// Build the database from the sources, and write it to dbPath
+		void		parseTypes(const char* decls, unsigned len, callconv cc);
+		void		close();
+
+public:
+					SignatureDB();
+					~SignatureDB();
+
+		// Open (building it if missing or out of date) the database at dbPath for the given headers and platform
+		void		open(const char* dbPath, const std::vector<Source>& sources, platform plat);
+
+		// Define the named types declared (by typedefs and structs) in the headers. They are saved in the database,
+		// so this does not parse them again
+		void		readTypes();
+
+		// Parse and return the signature of the named function, or NULL if it is not in the database
+		Signature*	lookup(const char* name);
+
+		int			getNumSignatures();
+};
+
+#endif	// __SIGDB_H__
@@ -258,6 +258,7 @@ virtual	bool		returnCompare(Assignment& a, Assignment& b);
 
 protected:
 		friend class XMLProgParser;
+		friend class Checkpoint;
 					Signature() : name(""), rettype(NULL), ellipsis(false), preferedReturn(NULL), preferedName("") { }
 		void		appendParameter(Parameter *p) { params.push_back(p); }
 		//void		appendImplicitParameter(ImplicitParameter *p) { implicitParams.push_back(p); }
@@ -267,6 +268,7 @@ protected:
 class CustomSignature : public Signature {
 protected:
 		int			sp;
+		friend class Checkpoint;
 public:
 	CustomSignature(const char *nam);
 virtual ~CustomSignature() { }
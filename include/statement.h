@@ -28,6 +28,8 @@
  * 11 Apr 05 - Mike: Added RetStatement, DefineAll
  * 26 Apr 05 - Mike: Moved class Return here from signature.h
  * 12 Aug 05 - Mike: Added ImpRefStatement
+ * 17 Oct 26 - Def-use chains (users and usedDefs)
+ * 17 Oct 26 - bypass returns true if it changed anything
  */
 
 #ifndef _STATEMENT_H_
@@ -152,6 +154,11 @@ protected:
 
 		unsigned int lexBegin, lexEnd;
 
+		// Def-use chains (see UserProc::buildDefUse()). users has the statements whose expressions refer to this
+		// definition, once per reference; usedDefs has the definitions referred to by this statement's expressions
+		std::multiset<Statement*> users;
+		std::vector<Statement*> usedDefs;
+
 public:
 
 					Statement() : pbb(NULL), proc(NULL), number(0), parent(NULL) { }
@@ -268,14 +275,27 @@ virtual bool		searchAndReplace(Exp *search, Exp *replace, bool cc = false) = 0;
 		// True if can propagate to expression e in this Statement.
 static	bool		canPropagateToExp(Exp* e);
 		// Propagate to this statement. Return true if a change
-		// destCounts is a map that indicates how may times a statement's definition is used
-		// dnp is a StatementSet with statements that should not be propagated
+		// Set limit to respect the -l limit, using the number of uses of each definition from the def-use chains
 		// Set convert if an indirect call is changed to direct (otherwise, no change)
 		// Set force to true to propagate even memofs (for switch analysis)
-		bool		propagateTo(bool& convert, std::map<Exp*, int, lessExpStar>* destCounts = NULL,
-						LocationSet* usedByDomPhi = NULL, bool force = false);
+		bool		propagateTo(bool& convert, bool limit = false, LocationSet* usedByDomPhi = NULL,
+						bool force = false);
 		bool		propagateFlagsTo();
 
+		// Def-use chains. findUsedDefs() recomputes usedDefs; addDefUses() and removeDefUses() enter this statement into,
+		// or remove it from, the chains of the definitions in usedDefs
+		void		findUsedDefs();
+		void		addDefUses();
+		void		removeDefUses();
+		void		updateDefUses() {removeDefUses(); findUsedDefs(); addDefUses();}
+		void		clearUsers() {users.clear();}
+		std::vector<Statement*>& getUsedDefs() {return usedDefs;}
+		// Number of references to this definition (including those in phi operands, but not those in collectors)
+		int			getNumUses() {return users.size();}
+		std::multiset<Statement*>& getUsers() {return users;}
+		// True if any expression of this statement refers to an ordinary assignment (i.e. might be propagated to)
+		bool		usesAssign();
+
 		// code generation
 virtual void		generateCode(HLLCode *hll, BasicBlock *pbb, int indLevel) = 0;
 
@@ -333,7 +353,7 @@ virtual void		rangeAnalysis(std::list<Statement*> &execution_paths);
 		// Special version of the above for finding used locations. Returns true if defineAll was found
 		bool		addUsedLocals(LocationSet& used);
 		// Bypass calls for references in this statement
-		void		bypass();
+		bool		bypass();
 
 
 		// replaces a use in this statement with an expression from an ordinary assignment
@@ -376,6 +396,7 @@ virtual	void		setTypeFor(Exp* e, Type* ty) {assert(0);}
 		bool		mayAlias(Exp *e1, Exp *e2, int size);
 
 	friend class XMLProgParser;
+	friend class Checkpoint;
 };		// class Statement
 
 // Print the Statement (etc) poited to by p
@@ -472,6 +493,7 @@ virtual void		genConstraints(LocationSet& cons);
 		void		dfaTypeAnalysis(bool& ch);
 
 		friend class XMLProgParser;
+		friend class Checkpoint;
 };		// class Assignment
 
 
@@ -555,6 +577,7 @@ virtual void		genConstraints(LocationSet& cons);
 		bool match(const char *pattern, std::map<std::string, Exp*> &bindings);
 
 	friend class XMLProgParser;
+	friend class Checkpoint;
 };	// class Assign
 
 /*==============================================================================
@@ -650,6 +673,7 @@ virtual	int			getNumDefs() {return defVec.size();}
 
 protected:
 		friend class XMLProgParser;
+		friend class Checkpoint;
 };		// class PhiAssign
 
 // An implicit assignment has only a left hand side. It is a placeholder for storing the types of parameters and
@@ -753,6 +777,7 @@ virtual bool		searchAndReplace(Exp *search, Exp *replace, bool cc = false);
 virtual void		dfaTypeAnalysis(bool& ch);
 
 		friend class XMLProgParser;
+		friend class Checkpoint;
 };	// class BoolAssign
 
 // An implicit reference has only an expression. It holds the type information that results from taking the address
@@ -857,6 +882,7 @@ virtual bool		isDefinition() { return false;}
 virtual bool		usesExp(Exp*);
 
 		friend class XMLProgParser;
+		friend class Checkpoint;
 };		// class GotoStatement
 
 class JunctionStatement: public Statement {
@@ -977,6 +1003,7 @@ virtual void		genConstraints(LocationSet& cons);
 		void		dfaTypeAnalysis(bool& ch);
 
 		friend class XMLProgParser;
+		friend class Checkpoint;
 };		// class BranchStatement
 
 /*==============================================================================
@@ -1033,6 +1060,7 @@ public:
 virtual void		simplify();
 
 		friend class XMLProgParser;
+		friend class Checkpoint;
 };		// class CaseStatement
 
 /*==============================================================================
@@ -1212,6 +1240,7 @@ protected:
 		void		updateDefineWithType(int n);
 		void		appendArgument(Assignment* as) {arguments.append(as);}
 friend	class		XMLProgParser;
+friend	class		Checkpoint;
 };		// class CallStatement
 
 
@@ -1331,6 +1360,7 @@ virtual void		dfaTypeAnalysis(bool& ch);
 		// void		specialProcessing();
 
 	friend class XMLProgParser;
+	friend class Checkpoint;
 };	// class ReturnStatement
 
 
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026, The Boomerang project
+ *
+ * See the file "LICENSE.TERMS" for information on usage and
+ * redistribution of this file, and for a DISCLAIMER OF ALL
+ * WARRANTIES.
+ *
+ */
+
+/*==============================================================================
+ * FILE:	   threads.h
+ * OVERVIEW:   Minimal threading primitives (mutexes, conditions, atomic counters) for parallel decompilation.
+ *			   Parallel decompilation (-j) is only supported where POSIX threads are available; elsewhere (i.e.
+ *			   native Windows) everything runs on one thread and these classes do nothing.
+ * CLASSES:	   Mutex
+ *			   MutexLock
+ *			   Condition
+ *			   ThreadLocal
+ *============================================================================*/
+
+/*
+ * $Revision: 1.1 $
+ *
+ * 17 Oct 26 - Created
+ * 17 Oct 26 - atomicAdd and ThreadLocal, for counting the bytes allocated in each phase
+ * 17 Oct 26 - Condition::timedWait
+ * 17 Oct 26 - atomicLoad and atomicStore
+ */
+
+#ifndef __THREADS_H__
+#define __THREADS_H__
+
+#if !defined(_WIN32)
+#define HAVE_THREADS 1
+#include <pthread.h>
+#include <sys/time.h>
+#endif
+
+// A recursive mutex: the thread that holds it may lock it again
+class Mutex {
+#if HAVE_THREADS
+		pthread_mutex_t	m;
+#endif
+public:
+#if HAVE_THREADS
+				Mutex() {
+					pthread_mutexattr_t attr;
+					pthread_mutexattr_init(&attr);
+					pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+					pthread_mutex_init(&m, &attr);
+					pthread_mutexattr_destroy(&attr);
+				}
+				~Mutex() {pthread_mutex_destroy(&m);}
+		void	lock() {pthread_mutex_lock(&m);}
+		void	unlock() {pthread_mutex_unlock(&m);}
+#else
+		void	lock() {}
+		void	unlock() {}
+#endif
+private:
+				Mutex(const Mutex&);			// Not copyable
+		Mutex&	operator=(const Mutex&);
+		friend class Condition;
+};
+
+// Holds a Mutex for the lifetime of this object
+class MutexLock {
+		Mutex&	m;
+public:
+				MutexLock(Mutex& m) : m(m) {m.lock();}
+				~MutexLock() {m.unlock();}
+};
+
+// A condition variable. The mutex passed to wait() must be held exactly once by the caller
+class Condition {
+#if HAVE_THREADS
+		pthread_cond_t	c;
+public:
+				Condition() {pthread_cond_init(&c, NULL);}
+				~Condition() {pthread_cond_destroy(&c);}
+		void	wait(Mutex& mutex) {pthread_cond_wait(&c, &mutex.m);}
+		// As wait(), but return after ms milliseconds if not signalled
+		void	timedWait(Mutex& mutex, int ms) {
+					struct timeval now;
+					gettimeofday(&now, NULL);
+					struct timespec t;
+					t.tv_sec = now.tv_sec + ms / 1000;
+					t.tv_nsec = (now.tv_usec + (ms % 1000) * 1000L) * 1000L;
+					if (t.tv_nsec >= 1000000000L) {
+						t.tv_sec++;
+						t.tv_nsec -= 1000000000L;
+					}
+					pthread_cond_timedwait(&c, &mutex.m, &t);
+				}
+		void	broadcast() {pthread_cond_broadcast(&c);}
+#else
+public:
+		void	wait(Mutex& mutex) {}
+		void	timedWait(Mutex& mutex, int ms) {}
+		void	broadcast() {}
+#endif
+};
+
+// Increment *p atomically, and return the new value
+inline int atomicIncrement(volatile int* p) {
+#if HAVE_THREADS && defined(__GNUC__)
+	return __sync_add_and_fetch(p, 1);
+#else
+	return ++*p;
+#endif
+}
+
+// Add n to *p atomically, and return the new value
+inline long atomicAdd(volatile long* p, long n) {
+#if HAVE_THREADS && defined(__GNUC__)
+	return __sync_add_and_fetch(p, n);
+#else
+	return *p += n;
+#endif
+}
+
+// Read or write *p atomically. No ordering with other memory is implied: these are for hints that any thread may
+// update, and that are valid whatever the value read
+inline int atomicLoad(const volatile int* p) {
+#if HAVE_THREADS && defined(__ATOMIC_RELAXED)
+	return __atomic_load_n(p, __ATOMIC_RELAXED);
+#else
+	return *p;
+#endif
+}
+
+inline void atomicStore(volatile int* p, int v) {
+#if HAVE_THREADS && defined(__ATOMIC_RELAXED)
+	__atomic_store_n(p, v, __ATOMIC_RELAXED);
+#else
+	*p = v;
+#endif
+}
+
+// A pointer with a separate value in each thread (initially NULL)
+template <class T> class ThreadLocal {
+#if HAVE_THREADS
+		pthread_key_t key;
+public:
+				ThreadLocal() {pthread_key_create(&key, NULL);}
+				~ThreadLocal() {pthread_key_delete(key);}
+		T*		get() {return (T*)pthread_getspecific(key);}
+		void	set(T* p) {pthread_setspecific(key, p);}
+#else
+		T*		p;
+public:
+				ThreadLocal() : p(NULL) {}
+		T*		get() {return p;}
+		void	set(T* p) {this->p = p;}
+#endif
+private:
+				ThreadLocal(const ThreadLocal&);
+		ThreadLocal& operator=(const ThreadLocal&);
+};
+
+#endif	// __THREADS_H__
@@ -22,6 +22,8 @@
  * 08 Apr 02 - Mike: Changes for boomerang
  * 25 Sep 04 - Mike: Added UnionType; beginnings of data-flow based type analysis
  * 26 Oct 04 - Mike: Added UpperType and LowerType; isCompatible()
+ * 17 Oct 26 - UnionType::newMemberName: member names per union, for -j
+ * 17 Oct 26 - getNamedTypes
  */
 
 #ifndef __TYPE_H__
@@ -175,6 +177,8 @@ virtual std::string getTempName() const; // Get a temporary name for the type
 					// Clear the named type map. This is necessary when testing; the
 					// type for the first parameter to 'main' is different for sparc and pentium
 static	void		clearNamedTypes() { namedTypes.clear(); }
+					// The named type map itself, e.g. to see which types a parse defines (see SignatureDB::build)
+static	std::map<std::string, Type*>& getNamedTypes() { return namedTypes; }
 
 		bool		isPointerToAlpha();
 
@@ -539,6 +543,7 @@ virtual bool		isCompatible(Type* other, bool all);
 
 protected:
 	friend class XMLProgParser;
+	friend class Checkpoint;
 };	// class CompoundType
 
 // The union type represents the union of any number of any other types
@@ -558,6 +563,9 @@ virtual				~UnionType();
 virtual bool		isUnion() const { return true; }
 
 		void		addType(Type *n, const char *str);
+		// A name for a new member, x<n>, not yet used in this union. With -j, members are numbered per union, so the
+		// names don't depend on the order in which the threads create unions
+		std::string	newMemberName();
 		int			getNumTypes() const { return li.size(); }
 		bool		findType(Type* ty);				// Return true if ty is already in the union
 		//Type		*getType(int n) { assert(n < getNumTypes()); return types[n]; }
@@ -583,6 +591,7 @@ virtual bool		isCompatible(Type* other, bool all);
 
 protected:
 	friend class XMLProgParser;
+	friend class Checkpoint;
 };	// class UnionType
 
 // This class is for before type analysis. Typically, you have no info at all, or only know the size (e.g.
@@ -7,6 +7,7 @@
  * $Revision: 1.10 $
  *
  * 10 Apr 02 - Mike: Created
+ * 17 Oct 26 - wallClock
  */
 
 #ifndef __UTIL_H__
@@ -29,4 +30,7 @@ int lockFileRead(const char *fname);
 int lockFileWrite(const char *fname);
 void unlockFile(int n);
 
+// The wall clock time in microseconds, from some fixed time; for measuring intervals
+double wallClock();
+
 #endif
@@ -21,6 +21,7 @@
  * $Revision: 1.39 $	// 1.13.2.11
  *
  * 14 Jun 04 - Mike: Created, from work started by Trent in 2003
+ * 17 Oct 26 - DefUseFinder replaces ExpDestCounter and StmtDestCounter
  *
  * There are separate Visitor and Modifier classes. Visitors are more suited for searching: they have the capability of
  * stopping the recursion, but can't change the class of a top level expression. Visitors can also override (prevent)
@@ -610,23 +611,14 @@ public:
 virtual Exp*		preVisit(RefExp		*e, bool& recur);
 };
 
-// Count the number of times a reference expression is used. Increments the count multiple times if the same reference
-// expression appears multiple times (so can't use UsedLocsFinder for this)
-class ExpDestCounter : public ExpVisitor {
-		std::map<Exp*, int, lessExpStar>& destCounts;
+// Find the definitions referred to by an expression, once per reference (so can't use UsedLocsFinder for this)
+class DefUseFinder : public ExpVisitor {
+		std::vector<Statement*>& defs;
 public:
-					ExpDestCounter(std::map<Exp*, int, lessExpStar>& dc) : destCounts(dc) {}
+					DefUseFinder(std::vector<Statement*>& defs) : defs(defs) {}
 		bool	 	visit(RefExp *e, bool& override);
 };
 
-// FIXME: do I need to count collectors? All the visitors and modifiers should be refactored to conditionally visit
-// or modify collectors, or not
-class StmtDestCounter : public StmtExpVisitor {
-public:
-					StmtDestCounter(ExpDestCounter* edc) : StmtExpVisitor(edc) {}
-		bool		visit(      PhiAssign *stmt, bool& override);
-};
-
 // Search an expression for flags calls, e.g. SETFFLAGS(...) & 0x45
 class FlagsFinder : public ExpVisitor {
 		bool		found;
@@ -22,6 +22,8 @@
  * 21 Apr 02 - Mike: mods for boomerang
  * 03 Jun 02 - Trent: if WIN32, no dynamic linking
  * 14 Jun 02 - Mike: Fixed a bug where Windows programs chose the Exe loader
+ * 17 Oct 26 - GetSectionInfoByAddr uses a sorted index of the sections; added readRange, mapFile etc
+ * 17 Oct 26 - The last hit of the section index is read and written atomically
 */
 
 /*==============================================================================
@@ -33,9 +35,22 @@
 #endif
 
 #include "BinaryFile.h"
+#include "threads.h"			// For atomicLoad(), atomicStore()
 #include <iostream>
+#include <algorithm>		// For sort(), upper_bound()
+#include <set>
 #include <cstring>
 #include <stdio.h>
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
 
 
 BinaryFile::BinaryFile(bool bArch /*= false*/)
@@ -43,6 +58,9 @@ BinaryFile::BinaryFile(bool bArch /*= false*/)
 	m_bArchive = bArch;			// Remember whether an archive member
 	m_iNumSections = 0;			// No sections yet
 	m_pSections = 0;			// No section data yet
+	m_indexedSections = 0;		// No index yet
+	m_indexedNum = 0;
+	m_lastInterval = 0;
 }
 
 // This struct used to be initialised with a memset, but now that overwrites the virtual table (if compiled under gcc
@@ -79,19 +97,86 @@ int BinaryFile::GetSectionIndexByName(const char* sName)
 
 PSectionInfo BinaryFile::GetSectionInfoByAddr(ADDRESS uEntry) const
 {
-	PSectionInfo pSect;
-	for (int i=0; i < m_iNumSections; i++)
-	{
-		pSect = &m_pSections[i];
-		if ((uEntry >= pSect->uNativeAddr) &&
-			(uEntry < pSect->uNativeAddr + pSect->uSectionSize))
+	if (m_indexedSections != m_pSections || m_indexedNum != m_iNumSections || m_sectStarts.empty()) {
+		// No index (yet), or it is out of date
+		PSectionInfo pSect;
+		for (int i=0; i < m_iNumSections; i++)
 		{
-			// We have the right section
-			return pSect;
+			pSect = &m_pSections[i];
+			if ((uEntry >= pSect->uNativeAddr) &&
+				(uEntry < pSect->uNativeAddr + pSect->uSectionSize))
+			{
+				// We have the right section
+				return pSect;
+			}
 		}
+		// Failed to find the address
+		return NULL;
 	}
-	// Failed to find the address
-	return NULL;
+	// Most lookups are near the last one (e.g. reading a switch table, or a string)
+	int n = m_sectStarts.size();
+	int k = atomicLoad(&m_lastInterval);
+	if (k >= n) k = 0;
+	if (uEntry < m_sectStarts[k] || (k+1 < n && uEntry >= m_sectStarts[k+1])) {
+		k = std::upper_bound(m_sectStarts.begin(), m_sectStarts.end(), uEntry) - m_sectStarts.begin() - 1;
+		if (k < 0)
+			return NULL;			// Below all sections
+		atomicStore(&m_lastInterval, k);
+	}
+	int i = m_sectOf[k];
+	if (i == -1)
+		return NULL;				// In a gap between sections
+	return &m_pSections[i];
+}
+
+// Build the index of the sections by address. Sections may overlap (e.g. .tbss); where they do, the index gives the
+// first section in section order, as a linear search does
+void BinaryFile::buildSectionIndex()
+{
+	m_sectStarts.clear();
+	m_sectOf.clear();
+	m_lastInterval = 0;
+	m_indexedSections = m_pSections;
+	m_indexedNum = m_iNumSections;
+	// The events: section i starts (i) or ends (-1-i) at an address. Ends sort first, since the ranges are half open
+	std::vector<std::pair<ADDRESS, int> > events;
+	for (int i=0; i < m_iNumSections; i++) {
+		ADDRESS lo = m_pSections[i].uNativeAddr;
+		ADDRESS hi = lo + m_pSections[i].uSectionSize;
+		if (hi <= lo) continue;		// Empty (or wraps around); a linear search would never find it
+		events.push_back(std::pair<ADDRESS, int>(lo, i));
+		events.push_back(std::pair<ADDRESS, int>(hi, -1-i));
+	}
+	std::sort(events.begin(), events.end());
+	std::set<int> active;			// The sections containing the current interval
+	unsigned e = 0;
+	while (e < events.size()) {
+		ADDRESS a = events[e].first;
+		for (; e < events.size() && events[e].first == a; e++) {
+			if (events[e].second < 0)
+				active.erase(-1-events[e].second);
+			else
+				active.insert(events[e].second);
+		}
+		int sect = active.empty() ? -1 : *active.begin();
+		if (m_sectOf.size() && m_sectOf.back() == sect)
+			continue;				// Same section as the previous interval; merge
+		m_sectStarts.push_back(a);
+		m_sectOf.push_back(sect);
+	}
+}
+
+// Get the host copy of the image at native address a, for reading many bytes at once (instead of one readNative call
+// each). len gets the number of bytes that can be read, to the end of the section. Returns NULL if a is not in a
+// section with data (e.g. it is in the BSS)
+const char* BinaryFile::readRange(ADDRESS a, size_t& len) const
+{
+	PSectionInfo si = GetSectionInfoByAddr(a);
+	len = 0;
+	if (si == NULL || si->uHostAddr == 0 || si->isAddressBss(a))
+		return NULL;
+	len = si->uNativeAddr + si->uSectionSize - a;
+	return (const char*)(si->uHostAddr - si->uNativeAddr + a);
 }
 
 PSectionInfo BinaryFile::GetSectionInfoByName(const char* sName)
@@ -174,6 +259,65 @@ ADDRESS* BinaryFile::GetImportStubs(int& numExports)
 	return NULL;
 }
 
+char* BinaryFile::mapFile(const char* sName, size_t& size)
+{
+	size = 0;
+#ifdef _WIN32
+	FILE* f = fopen(sName, "rb");
+	if (f == NULL) return NULL;
+	fseek(f, 0, SEEK_END);
+	size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	char* image = new char[size];
+	if (fread(image, 1, size, f) != size)
+		fprintf(stderr, "WARNING! Only read part of binary file %s!\n", sName);
+	fclose(f);
+	return image;
+#else
+	int fd = open(sName, O_RDONLY);
+	if (fd == -1) return NULL;
+	struct stat st;
+	if (fstat(fd, &st) == -1 || st.st_size == 0) {
+		close(fd);
+		return NULL;
+	}
+	size = st.st_size;
+	// Private, so that writes (e.g. relocations) go to a copy of the page, not the file. Pages that are never written
+	// stay shared with the page cache, and pages that are never read are never read from the disk
+	void* image = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);					// The mapping keeps the file open
+	if (image == MAP_FAILED) {
+		size = 0;
+		return NULL;
+	}
+	return (char*)image;
+#endif
+}
+
+char* BinaryFile::allocImage(size_t size)
+{
+#ifdef _WIN32
+	char* image = new char[size];
+	memset(image, 0, size);
+	return image;
+#else
+	void* image = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (image == MAP_FAILED)
+		return NULL;
+	return (char*)image;
+#endif
+}
+
+void BinaryFile::unmapImage(char* image, size_t size)
+{
+	if (image == NULL) return;
+#ifdef _WIN32
+	delete [] image;
+#else
+	munmap(image, size);
+#endif
+}
+
 void BinaryFile::getTextLimits()
 {
 	int n = GetNumSections();
@@ -34,7 +34,8 @@ BinaryFile *BinaryFileFactory::Load( const char *sName )
 		delete pBF;
 		return NULL;
 	}
-pBF->getTextLimits();
+	pBF->buildSectionIndex();		// The sections are final now; index them for GetSectionInfoByAddr
+	pBF->getTextLimits();
 	return pBF;
 }
 
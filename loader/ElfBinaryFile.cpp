@@ -25,6 +25,8 @@
  * 02 Oct 02 - Mike: Fixed some more endianness issues
  * 24 Mar 03 - Mike: GetAddressByName returns NO_ADDRESS on failure now
  * 12 Jul 05 - Mike: fixed an endless loop in findRelPltOffset for pre-3.3.3 gcc compiled input files
+ * 17 Oct 26 - The image is mapped (BinaryFile::mapFile), not read into memory; build the section index
+ * 17 Oct 26 - RealLoad unmaps the image when it fails
 */
 
 /*==============================================================================
@@ -49,7 +51,6 @@ ElfBinaryFile::ElfBinaryFile(bool bArchive /* = false */)
 	: BinaryFile(bArchive),	// Initialise base class
 	  next_extern(0)
 {
-	m_fd = 0;
 	m_pFileName = 0;
 	Init();					// Initialise all the common stuff
 }
@@ -110,39 +111,26 @@ bool ElfBinaryFile::RealLoad(const char* sName)
     }
 
     m_pFileName = sName;
-    m_fd = fopen (sName, "rb");
-    if (m_fd == NULL) return 0;
-
-    // Determine file size
-    if (fseek(m_fd, 0, SEEK_END)) {
-        fprintf(stderr, "Error seeking to end of binary file\n");
-        return false;
-    }
-    m_lImageSize = ftell(m_fd);
-
-    // Allocate memory to hold the file
-    m_pImage = new char[m_lImageSize];
+    size_t size;
+    m_pImage = mapFile(sName, size);
     if (m_pImage == 0) {
-        fprintf(stderr, "Could not allocate %ld bytes for program image\n", m_lImageSize);
+        fprintf(stderr, "Could not map binary file %s\n", sName);
         return false;
     }
+    m_lImageSize = size;
     Elf32_Ehdr* pHeader = (Elf32_Ehdr*)m_pImage;    // Save a lot of casts
 
-    // Read the whole file in
-    fseek(m_fd, 0, SEEK_SET);
-    size_t size = fread(m_pImage, 1, m_lImageSize, m_fd);
-    if (size != (size_t)m_lImageSize)
-        fprintf(stderr, "WARNING! Only read %ud of %ld bytes of binary file!\n", size, m_lImageSize);
-
     // Basic checks
     if (strncmp(m_pImage, "\x7F""ELF", 4) != 0) {
         fprintf(stderr, "Incorrect header: %02X %02X %02X %02X\n",
           pHeader->e_ident[0], pHeader->e_ident[1], pHeader->e_ident[2],
           pHeader->e_ident[3]);
+        UnLoad();
         return 0;
     }
     if ((pHeader->endianness != 1) && (pHeader->endianness != 2)) {
         fprintf(stderr, "Unknown endianness %02X\n", pHeader->endianness);
+        UnLoad();
         return 0;
     }
     // Needed for elfRead4 to work:
@@ -170,7 +158,10 @@ bool ElfBinaryFile::RealLoad(const char* sName)
 
     // Allocate room for all the Elf sections (including the silly first one)
     m_pSections = new SectionInfo[m_iNumSections];
-    if (m_pSections == 0) return false;     // Failed!
+    if (m_pSections == 0) {
+        UnLoad();
+        return false;     // Failed!
+    }
 
 	// Set up the m_sh_link and m_sh_info arrays
 	m_sh_link = new int[m_iNumSections];
@@ -184,11 +175,13 @@ bool ElfBinaryFile::RealLoad(const char* sName)
         Elf32_Shdr* pShdr = m_pShdrs + i;
 		if ((char*)pShdr > m_pImage + m_lImageSize) {
 			std::cerr << "section " << i << " header is outside the image size\n";
+			UnLoad();
 			return false;
 		}
         pName = m_pStrings + elfRead4(&pShdr->sh_name);
 		if (pName > m_pImage + m_lImageSize) {
 			std::cerr << "name for section " << i << " is outside the image size\n";
+			UnLoad();
 			return false;
 		}
         m_pSections[i].pSectionName = pName;
@@ -242,6 +235,9 @@ bool ElfBinaryFile::RealLoad(const char* sName)
 			arbitaryLoadAddr += m_pSections[i].uSectionSize;
 		}
 
+	// The sections are now final. Index them, since applying relocations looks up a section for each one
+	buildSectionIndex();
+
     // Add symbol info. Note that some symbols will be in the main table only, and others in the dynamic table only.
 	// So the best idea is to add symbols for all sections of the appropriate type
 	for (i=1; i < m_iNumSections; ++i) {
@@ -286,8 +282,7 @@ bool ElfBinaryFile::RealLoad(const char* sName)
 // Clean up and unload the binary image
 void ElfBinaryFile::UnLoad()
 {
-	if (m_pImage) delete [] m_pImage;
-	fclose (m_fd);
+	unmapImage(m_pImage, m_lImageSize);
 	Init();						// Set all internal state to 0
 } 
 
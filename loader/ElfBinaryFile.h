@@ -16,6 +16,7 @@
  * 09 Mar 02 - Mike: Changes for stand alone compilation
  * 01 Oct 02 - Mike: Removed elf library (and include file) dependencies
  * 02 Oct 02 - Mike: elfRead2 and elfRead4 are const now
+ * 17 Oct 26 - Removed m_fd; the image is mapped
 */
 
 #ifndef __ELFBINARYFILE_H__
@@ -265,9 +266,8 @@ private:
 		int         elfRead4(int*   pi) const;		// Read an int with endianness care
 		void		elfWrite4(int*	pi, int val);	// Write an int with endianness care
 
-		FILE*		m_fd;							// File stream
 		long		m_lImageSize;					// Size of image in bytes
-		char*       m_pImage;						// Pointer to the loaded image
+		char*       m_pImage;						// Pointer to the loaded (mapped) image
 		Elf32_Phdr* m_pPhdrs;						// Pointer to program headers
 		Elf32_Shdr* m_pShdrs;						// Array of section header structs
 		char*       m_pStrings;						// Pointer to the string section
@@ -13,6 +13,7 @@
  * 30 Sep 02 - Trent: split microDis tests
  * 30 Sep 02 - Trent: remove dependancy between microDis test1 and Elf loader
  * 05 Aug 05 - Mike: added borland test; check address of main (not just != NO_ADDRESS)
+ * 17 Oct 26 - Added testSectionIndex
  */
 
 #define HELLO_SPARC     "test/sparc/hello"
@@ -57,6 +58,7 @@ void LoaderTest::registerTests(CppUnit::TestSuite* suite) {
     MYTEST(testMicroDis2);
 
 	MYTEST(testElfHash);
+	MYTEST(testSectionIndex);
 }
 
 int LoaderTest::countTestCases () const
@@ -614,3 +616,41 @@ void LoaderTest::testElfHash () {
 	CPPUNIT_ASSERT_EQUAL(exp, act);
 #endif
 }
+
+/*==============================================================================
+ * FUNCTION:        LoaderTest::testSectionIndex
+ * OVERVIEW:        Test finding sections by address (with the section index), and readRange
+ *============================================================================*/
+void LoaderTest::testSectionIndex () {
+	BinaryFileFactory bff;
+	BinaryFile* pBF = bff.Load(HELLO_PENTIUM);
+	CPPUNIT_ASSERT(pBF != NULL);
+	int n = pBF->GetNumSections();
+	for (int i=0; i < n; i++) {
+		SectionInfo* si = pBF->GetSectionInfo(i);
+		if (si->uSectionSize == 0) continue;
+		// The first section (in section order) that contains each end of si
+		ADDRESS ends[2] = {si->uNativeAddr, si->uNativeAddr + si->uSectionSize - 1};
+		for (int e=0; e < 2; e++) {
+			SectionInfo* first = NULL;
+			for (int j=0; j < n && first == NULL; j++) {
+				SectionInfo* sj = pBF->GetSectionInfo(j);
+				if (ends[e] >= sj->uNativeAddr && ends[e] < sj->uNativeAddr + sj->uSectionSize)
+					first = sj;
+			}
+			CPPUNIT_ASSERT(pBF->GetSectionInfoByAddr(ends[e]) == first);
+		}
+	}
+	SectionInfo* text = pBF->GetSectionInfoByName(".text");
+	CPPUNIT_ASSERT(text != NULL);
+	CPPUNIT_ASSERT(pBF->GetSectionInfoByAddr(text->uNativeAddr + 4) == text);
+	size_t len;
+	const char* p = pBF->readRange(text->uNativeAddr + 4, len);
+	CPPUNIT_ASSERT(p == (const char*)text->uHostAddr + 4);
+	CPPUNIT_ASSERT_EQUAL((size_t)text->uSectionSize - 4, len);
+	SectionInfo* bss = pBF->GetSectionInfoByName(".bss");
+	CPPUNIT_ASSERT(bss != NULL);
+	CPPUNIT_ASSERT(pBF->readRange(bss->uNativeAddr, len) == NULL);
+	pBF->UnLoad();
+	bff.UnLoad();
+}
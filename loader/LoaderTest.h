@@ -28,5 +28,6 @@ class LoaderTest : public CppUnit::TestCase {
     void testMicroDis2();
 
 	void testElfHash();
+	void testSectionIndex();
 };
 
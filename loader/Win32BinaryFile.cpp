@@ -23,6 +23,10 @@
  * 08 Jul 02 - Mike: Changed algorithm to find main; now looks for ordinary
  *				 call up to 10 instructions before an indirect call to exit
  * 24 Jul 05 - Mike: State machine to recognise main in Borland Builder files
+ * 17 Oct 26 - The file is mapped, not read; the image is copied from the mapping into lazily zeroed memory
+ * 17 Oct 26 - The mapping and the image are released when the magic numbers are bad; files shorter than a PE
+ *				header are rejected
+ * 17 Oct 26 - The image is released by UnLoad and the destructor
  */
 
 #if defined(_MSC_VER) && _MSC_VER <= 1200
@@ -49,6 +53,7 @@ namespace dbghelp {
 #include <cstring>
 #include <stdlib.h>
 #include <assert.h>
+#include <algorithm>		// For min()
 
 extern "C" {
 	int microX86Dis(void* p);			// From microX86dis.c
@@ -116,11 +121,13 @@ typedef char ct_failure[sizeof(SectionInfo) == sizeof(PESectionInfo)];
 }
 
 
-Win32BinaryFile::Win32BinaryFile() : m_pFileName(0), mingw_main(false)
+Win32BinaryFile::Win32BinaryFile() : m_pHeader(0), m_pPEHeader(0), m_cbImage(0), base(0), m_pFileName(0),
+	mingw_main(false)
 { }
 
 Win32BinaryFile::~Win32BinaryFile()
 {
+	UnLoad();
 	for (int i=0; i < m_iNumSections; i++) {
 		if (m_pSections[i].pSectionName)
 			delete [] m_pSections[i].pSectionName;
@@ -412,39 +419,54 @@ BOOL CALLBACK lookforsource(
 bool Win32BinaryFile::RealLoad(const char* sName)
 {
 	m_pFileName = sName;
-	FILE *fp = fopen(sName,"rb");
+	size_t fileSize;
+	char* file = mapFile(sName, fileSize);
+	if (file == NULL || fileSize < 0x40) {
+		fprintf(stderr,"Cannot map file %s\n", sName);
+		unmapImage(file, fileSize);
+		return false;
+	}
 
 	uint32_t peoffLE, peoff;
-	fseek(fp, 0x3c, SEEK_SET);
-	fread(&peoffLE, 4, 1, fp);		// Note: peoffLE will be in Little Endian
+	memcpy(&peoffLE, file + 0x3c, 4);	// Note: peoffLE will be in Little Endian
 	peoff = LMMH(peoffLE);
 
 	PEHeader tmphdr;
-
-	fseek(fp, peoff, SEEK_SET);
-	fread(&tmphdr, sizeof(tmphdr), 1, fp);
+	if (fileSize < sizeof(tmphdr) || peoff > fileSize - sizeof(tmphdr)) {
+		fprintf(stderr,"error loading file %s, bad PE header offset\n", sName);
+		unmapImage(file, fileSize);
+		return false;
+	}
+	memcpy(&tmphdr, file + peoff, sizeof(tmphdr));
 	// Note: all tmphdr fields will be little endian
 
-	base = (char *)malloc(LMMH(tmphdr.ImageSize));
+	// The sections are laid out in memory by RVA, not as in the file, so the image has to be a copy. But the parts of
+	// it that are never written (gaps, bss) cost nothing
+	size_t imageSize = LMMH(tmphdr.ImageSize);
+	base = allocImage(imageSize);
+	m_cbImage = imageSize;
 
 	if (!base) {
 		fprintf(stderr,"Cannot allocate memory for copy of image\n");
+		unmapImage(file, fileSize);
 		return false;
 	}
 
-	fseek(fp, 0, SEEK_SET);
-
-	fread(base, LMMH(tmphdr.HeaderSize), 1, fp);
+	memcpy(base, file, std::min((size_t)LMMH(tmphdr.HeaderSize), fileSize));
 
 	m_pHeader = (Header *)base;
-	if (m_pHeader->sigLo!='M' || m_pHeader->sigHi!='Z') {
-		fprintf(stderr,"error loading file %s, bad magic\n", sName);
-		return false;
-	}
-
 	m_pPEHeader = (PEHeader *)(base+peoff);
-	if (m_pPEHeader->sigLo!='P' || m_pPEHeader->sigHi!='E') {
-		fprintf(stderr,"error loading file %s, bad PE magic\n", sName);
+	const char* bad = NULL;
+	if (m_pHeader->sigLo!='M' || m_pHeader->sigHi!='Z')
+		bad = "bad magic";
+	else if (peoff + sizeof(PEHeader) > imageSize)
+		bad = "PE header outside the image";
+	else if (m_pPEHeader->sigLo!='P' || m_pPEHeader->sigHi!='E')
+		bad = "bad PE magic";
+	if (bad) {
+		fprintf(stderr,"error loading file %s, %s\n", sName, bad);
+		UnLoad();
+		unmapImage(file, fileSize);
 		return false;
 	}
 
@@ -471,11 +493,13 @@ bool Win32BinaryFile::RealLoad(const char* sName)
 		sect.bData     = (Flags&IMAGE_SCN_CNT_INITIALIZED_DATA)?1:0;
 		sect.bReadOnly = (Flags&IMAGE_SCN_MEM_WRITE)?0:1;
 		// TODO: Check for unreadable sections (!IMAGE_SCN_MEM_READ)?
-		fseek(fp, LMMH(o->PhysicalOffset), SEEK_SET);
-		memset(base + LMMH(o->RVA), 0, LMMH(o->VirtualSize));
-		fread(base + LMMH(o->RVA), LMMH(o->PhysicalSize), 1, fp);
+		// The image is already zeroed, so only the raw data need be copied (as much of it as the file has)
+		size_t off = LMMH(o->PhysicalOffset);
+		if (off < fileSize)
+			memcpy(base + LMMH(o->RVA), file + off, std::min((size_t)LMMH(o->PhysicalSize), fileSize - off));
 		s_sectionObjects[static_cast<const PESectionInfo*>(&sect)] = o;
 	}
+	buildSectionIndex();
 
 	// Add the Import Address Table entries to the symbol table
 	PEImportDtor* id = (PEImportDtor*) (LMMH(m_pPEHeader->ImportTableRVA) + base);
@@ -536,7 +560,7 @@ bool Win32BinaryFile::RealLoad(const char* sName)
 	ADDRESS start = GetEntryPoint();
 	findJumps(start);
 
-	fclose(fp);
+	unmapImage(file, fileSize);
 
 #if defined(_WIN32) && !defined(__MINGW32__)
 	// attempt to load symbols for the exe or dll
@@ -616,6 +640,11 @@ void Win32BinaryFile::findJumps(ADDRESS curr) {
 // Clean up and unload the binary image
 void Win32BinaryFile::UnLoad()
 {
+	unmapImage(base, m_cbImage);
+	base = NULL;
+	m_cbImage = 0;
+	m_pHeader = NULL;
+	m_pPEHeader = NULL;
 } 
 
 bool Win32BinaryFile::PostLoad(void* handle)
@@ -1,5 +1,9 @@
 /*
  *$Revision: 1.11 $	// 1.6.6.1
+ *
+ * 17 Oct 26 - FileLogger formats into a buffer, which a background thread writes to the file
+ * 17 Oct 26 - FileLogger::flushOnSignal writes with write(2), without locks; each piece of output starts with the
+ *				initial format
  */
 #include "log.h"
 #include <sstream>
@@ -7,6 +11,15 @@
 #include "rtl.h"
 #include "exp.h"
 #include "managed.h"
+#if HAVE_THREADS
+#include <unistd.h>			// For write, close
+#endif
+
+#if HAVE_THREADS && !defined(NO_GARBAGE_COLLECTOR)
+// Have the collector see the writer thread (this makes pthread_create go through the collector)
+#define GC_THREADS 1
+#include "gc.h"
+#endif
 
 Log &Log::operator<<(Statement *s)
 {
@@ -116,7 +129,195 @@ Log &Log::operator<<(size_t s)
 void Log::tail() {
 }
 
+void FileLogger::startWriter() {
+	stopping = false;
+#if HAVE_THREADS
+	haveWriter = pthread_create(&writer, NULL, writerMain, this) == 0;
+#endif
+}
+
+FileLogger::~FileLogger() {
+#if HAVE_THREADS
+	if (haveWriter) {
+		mutex.lock();
+		stopping = true;
+		ready.broadcast();
+		mutex.unlock();
+		pthread_join(writer, NULL);
+	}
+#endif
+	flush();
+#if HAVE_THREADS
+	if (fd != -1)
+		close(fd);
+#endif
+}
+
+// Called with mutex held, after appending to pending. Hand a full batch to the writer thread; if there is none, or
+// it can't keep up, write it here
+void FileLogger::appended() {
+	if (pending.size() < BATCH)
+		return;
+#if HAVE_THREADS
+	if (haveWriter && pending.size() < MAX_PENDING) {
+		ready.broadcast();
+		return;
+	}
+#endif
+	flush();
+}
+
+#if HAVE_THREADS
+void* FileLogger::writerMain(void* arg) {
+	FileLogger* l = (FileLogger*)arg;
+	l->mutex.lock();
+	while (!l->stopping) {
+		l->ready.timedWait(l->mutex, WAIT_MS);
+		if (l->pending.empty())
+			continue;
+		// Take the batch, and let the other threads append again while it is written
+		l->fileMutex.lock();
+		l->writing.swap(l->pending);
+		l->mutex.unlock();
+		l->out.write(l->writing.data(), l->writing.size());
+		l->out.flush();
+		l->writing.clear();
+		l->fileMutex.unlock();
+		l->mutex.lock();
+	}
+	l->mutex.unlock();
+	return NULL;
+}
+#endif
+
+void FileLogger::flush() {
+	MutexLock ml(mutex);
+	MutexLock fl(fileMutex);			// Wait for the batch being written, so that the output stays in order
+	out.write(pending.data(), pending.size());
+	out.flush();
+	pending.clear();
+}
+
+// Write what is pending from a signal handler (e.g. on a crash). The thread that crashed may hold mutex, so this takes
+// no locks: it writes a snapshot (the data and size read on entry) of pending with write(2), at the end of the file.
+// Another thread may be appending to pending meanwhile, so the snapshot may be cut short or lost, and a batch that the
+// writer thread is writing may be cut short
+void FileLogger::flushOnSignal() {
+#if HAVE_THREADS
+	if (fd == -1)
+		return;
+	const char* p = pending.data();
+	size_t n = pending.size();
+	while (n) {
+		ssize_t w = write(fd, p, n);
+		if (w <= 0)
+			break;
+		p += w;
+		n -= w;
+	}
+#else
+	// Single threaded: nothing else can hold the (no-op) mutexes
+	flush();
+#endif
+}
+
+// The stream that formats into pending, with the format reset: Exp::print etc may leave it in hex, or with a width or
+// precision set
+std::ostream& FileLogger::fresh() {
+	os.flags(osFlags);
+	os.width(0);
+	os.precision(6);
+	os.fill(' ');
+	return os;
+}
+
 void FileLogger::tail() {
+	flush();
 	out.seekp(-200, std::ios::end);
 	std::cerr << out;
 }
+
+// These format straight into the buffer, each with the initial format
+Log &FileLogger::operator<<(Statement *s) {
+	MutexLock ml(mutex);
+	s->print(fresh());
+	appended();
+	return *this;
+}
+
+Log &FileLogger::operator<<(Exp *e) {
+	MutexLock ml(mutex);
+	e->print(fresh());
+	appended();
+	return *this;
+}
+
+Log &FileLogger::operator<<(Type *ty) {
+	MutexLock ml(mutex);
+	fresh() << ty;
+	appended();
+	return *this;
+}
+
+Log &FileLogger::operator<<(RTL *r) {
+	MutexLock ml(mutex);
+	r->print(fresh());
+	appended();
+	return *this;
+}
+
+Log &FileLogger::operator<<(Range *r) {
+	MutexLock ml(mutex);
+	r->print(fresh());
+	appended();
+	return *this;
+}
+
+Log &FileLogger::operator<<(Range &r) {
+	MutexLock ml(mutex);
+	r.print(fresh());
+	appended();
+	return *this;
+}
+
+Log &FileLogger::operator<<(RangeMap &r) {
+	MutexLock ml(mutex);
+	r.print(fresh());
+	appended();
+	return *this;
+}
+
+Log &FileLogger::operator<<(LocationSet *l) {
+	MutexLock ml(mutex);
+	fresh() << l;
+	appended();
+	return *this;
+}
+
+Log &FileLogger::operator<<(int i) {
+	MutexLock ml(mutex);
+	fresh() << i;
+	appended();
+	return *this;
+}
+
+Log &FileLogger::operator<<(char c) {
+	MutexLock ml(mutex);
+	pending += c;
+	appended();
+	return *this;
+}
+
+Log &FileLogger::operator<<(double d) {
+	MutexLock ml(mutex);
+	fresh() << d;
+	appended();
+	return *this;
+}
+
+Log &FileLogger::operator<<(ADDRESS a) {
+	MutexLock ml(mutex);
+	fresh() << "0x" << std::hex << a;
+	appended();
+	return *this;
+}
@@ -8,9 +8,11 @@
  * 09 Apr 02 - Mike: Created
  * 22 Aug 03 - Mike: Extended for Constraint tests
  * 25 Juk 05 - Mike: DataIntervalMap tests
+ * 17 Oct 26 - Worklist data flow type analysis test
  */
 
 #define HELLO_WINDOWS		"test/windows/hello.exe"
+#define HELLO_PENTIUM		"test/pentium/hello"
 
 #include <iostream>
 #include "TypeTest.h"
@@ -40,6 +42,7 @@ void TypeTest::registerTests(CppUnit::TestSuite* suite) {
 	MYTEST(testCompound);
 	MYTEST(testDataInterval);
 	MYTEST(testDataIntervalOverlaps);
+	MYTEST(testDfaWorklist);
 }
 
 int TypeTest::countTestCases () const
@@ -331,3 +334,40 @@ void TypeTest::testDataIntervalOverlaps() {
 	unsigned ua = (unsigned)pdie;
 	CPPUNIT_ASSERT_EQUAL(ue, ua);
 }
+
+/*==============================================================================
+ * FUNCTION:		TypeTest::testDfaWorklist
+ * OVERVIEW:		Test the counters of the worklist data flow type analysis. Every statement is visited at least once
+ *					  by the worklist and once by the checking pass, and only some visits change anything
+ *============================================================================*/
+void TypeTest::testDfaWorklist() {
+	BinaryFileFactory bff;
+	BinaryFile *pBF = bff.Load(HELLO_PENTIUM);
+	CPPUNIT_ASSERT(pBF != 0);
+	Prog* prog = new Prog;
+	FrontEnd *pFE = new PentiumFrontEnd(pBF, prog, &bff);
+	Type::clearNamedTypes();
+	prog->setFrontEnd(pFE);
+	pFE->decode(prog);
+
+	Boomerang* boo = Boomerang::get();
+	bool oldDfa = boo->dfaTypeAnalysis;
+	boo->dfaTypeAnalysis = true;
+	UserProc* proc = (UserProc*)prog->findProc("main");
+	CPPUNIT_ASSERT(proc);
+	int indent = 0;
+	proc->decompile(new ProcList, indent);
+	boo->dfaTypeAnalysis = oldDfa;
+
+	StatementList stmts;
+	proc->getStatements(stmts);
+	int visits, meets, changes;
+	proc->getDfaCounts(visits, meets, changes);
+	CPPUNIT_ASSERT(visits >= (int)stmts.size());	// Unused statements are removed after type analysis
+	CPPUNIT_ASSERT(changes > 0);
+	CPPUNIT_ASSERT(changes < visits);
+	CPPUNIT_ASSERT(meets > 0);
+
+	pBF->UnLoad();
+	delete pFE;
+}
@@ -25,5 +25,6 @@ class TypeTest : public CppUnit::TestCase {
 
 	void testDataInterval();
 	void testDataIntervalOverlaps();
+	void testDfaWorklist();
 };
 
@@ -16,8 +16,11 @@
  * $Revision: 1.20 $	// 1.16.6.1
  *
  * 22 Aug 03 - Mike: Created
+ * 17 Oct 26 - LOG statements are in the LCAT_TYPES log category
  */
 
+#define LOG_CATEGORY LCAT_TYPES		// The category of this file's LOG statements (see boomerang.h)
+
 #include "constraint.h"
 #include "managed.h"
 #include "exp.h"
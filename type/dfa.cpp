@@ -18,8 +18,14 @@
  * 24 Sep 04 - Mike: Created
  * 25 Aug 05 - Mike: Switch from Mycroft style "pointer to alpha plus integer equals pointer to another alpha" to
  *						Van Emmerik style "result is void*" for sigma and delta functions
+ * 17 Oct 26 - Worklist (sparse) solver instead of round robin over all statements; per statement iteration limit
+ * 17 Oct 26 - dfaTypeAnalysis is a phase (-M, -gt)
+ * 17 Oct 26 - With -j, union members are named per union (newMemberName), not from a count shared by all threads
+ * 17 Oct 26 - LOG statements are in the LCAT_TYPES log category
  */
 
+#define LOG_CATEGORY LCAT_TYPES		// The category of this file's LOG statements (see boomerang.h)
+
 #include "gc.h"
 #include "type.h"
 #include "boomerang.h"
@@ -30,21 +36,34 @@
 #include "visitor.h"
 #include "log.h"
 #include "proc.h"
+#include "threads.h"
+#include "phase.h"
 #include <sstream>
 #include <cstring>
+#include <deque>
 #if defined(_MSC_VER) && _MSC_VER >= 1400
 #pragma warning(disable:4996)		// Warnings about e.g. _strdup deprecated in VS 2005
 #endif
 
 static int nextUnionNumber = 0;
 
+// A name for a new member of u. With -j, unions are created on several threads in no particular order, so the
+// members are numbered per union; otherwise from a count over the whole program, as always
+static std::string unionMemberName(UnionType* u) {
+	if (Boomerang::get()->numThreads > 1)
+		return u->newMemberName();
+	char name[20];
+	sprintf(name, "x%d", ++nextUnionNumber);
+	return name;
+}
+
 #ifndef max
 int max(int a, int b) {		// Faster to write than to find the #include for
 	return a>b ? a : b;
 }
 #endif
 
-#define DFA_ITER_LIMIT 20
+#define DFA_ITER_LIMIT 20			// Maximum number of visits to any one statement
 
 // m[idx*K1 + K2]; leave idx wild
 static Exp* scaledArrayPat = Location::memOf(
@@ -70,42 +89,120 @@ void init_dfa() {
 }
 
 
-static int progress = 0;
+// The worklist for UserProc::dfaTypeAnalysis(). When the type of a definition changes, only the statements that use
+// it (following the SSA references, including phi operands) need to be visited again
+class DfaWorklist {
+		std::map<Statement*, std::vector<Statement*> > users;	// The statements using each definition
+		std::set<Statement*> members;			// The statements being analysed
+		std::deque<Statement*> work;
+		std::set<Statement*> inWork;			// The statements in work
+		std::map<Statement*, int> visits;		// Number of visits to each statement
+public:
+		std::list<Statement*> touched;			// Definitions changed by meetWithFor() during a visit
+		int			numAtLimit;					// Number of times a statement was due a visit, but was at its limit
+
+					DfaWorklist(StatementList& stmts);
+		void		add(Statement* s) {
+						if (members.find(s) != members.end() && inWork.insert(s).second) work.push_back(s);}
+		void		changed(Statement* s);
+		bool		empty() {return work.empty();}
+		Statement*	next() {Statement* s = work.front(); work.pop_front(); inWork.erase(s); return s;}
+		bool		visit(Statement* s, int& numVisits, int& numChanges, bool due);
+};
+
+DfaWorklist::DfaWorklist(StatementList& stmts) : numAtLimit(0) {
+	StatementList::iterator it;
+	for (it = stmts.begin(); it != stmts.end(); it++) {
+		members.insert(*it);
+		LocationSet refs;
+		(*it)->addUsedLocs(refs);
+		LocationSet::iterator rr;
+		for (rr = refs.begin(); rr != refs.end(); rr++) {
+			if (!(*rr)->isSubscript()) continue;
+			Statement* def = ((RefExp*)*rr)->getDef();
+			if (def && def != *it)
+				users[def].push_back(*it);
+		}
+	}
+	// Initially, all statements in order (the same as the first round robin iteration)
+	for (it = stmts.begin(); it != stmts.end(); it++)
+		add(*it);
+}
+
+// The type(s) defined by s have changed: visit s again, and the statements that use it
+void DfaWorklist::changed(Statement* s) {
+	add(s);
+	std::map<Statement*, std::vector<Statement*> >::iterator uu = users.find(s);
+	if (uu == users.end()) return;
+	for (unsigned i=0; i < uu->second.size(); i++)
+		add(uu->second[i]);
+}
+
+static volatile int progress = 0;			// Shared by all threads; only for the progress dots
+
+// Visit s (unless it has reached its visit limit), queueing whatever its changes affect. due is true if s is known to
+// have changed inputs. Returns true if there was a change
+bool DfaWorklist::visit(Statement* s, int& numVisits, int& numChanges, bool due) {
+	int& n = visits[s];
+	if (n >= DFA_ITER_LIMIT) {
+		if (due) numAtLimit++;
+		return false;
+	}
+	n++;
+	numVisits++;
+	if (atomicIncrement(&progress) % 2000 == 0)
+		std::cerr << "t" << std::flush;
+	bool thisCh = false;
+	touched.clear();
+	s->dfaTypeAnalysis(thisCh);
+	if (!thisCh) return false;
+	numChanges++;
+	if (DEBUG_TA)
+		LOG << " caused change: " << s << "\n";
+	changed(s);
+	std::list<Statement*>::iterator tt;
+	for (tt = touched.begin(); tt != touched.end(); tt++)
+		changed(*tt);
+	return true;
+}
+
 void UserProc::dfaTypeAnalysis() {
+	Phase ph("dfaTypeAnalysis", this);
 	Boomerang::get()->alert_decompile_debug_point(this, "before dfa type analysis");
 
+	dfaVisits = dfaMeets = dfaChanges = 0;
 	// First use the type information from the signature. Sometimes needed to split variables (e.g. argc as a
 	// int and char* in sparc/switch_gcc)
-	bool ch = signature->dfaTypeAnalysis(cfg);
+	signature->dfaTypeAnalysis(cfg);
 	StatementList stmts;
 	getStatements(stmts);
 	StatementList::iterator it;
-	int iter;
-	for (iter = 1; iter <= DFA_ITER_LIMIT; iter++) {
-		ch = false;
-		for (it = stmts.begin(); it != stmts.end(); it++) {
-			if (++progress >= 2000) {
-				progress = 0;
-				std::cerr << "t" << std::flush;
-			}
-			bool thisCh = false;
-			(*it)->dfaTypeAnalysis(thisCh);
-			if (thisCh) {
-				ch = true;
-				if (DEBUG_TA)
-					LOG << " caused change: " << *it << "\n";
-			}
-		}
+	DfaWorklist wl(stmts);
+	dfaTouched = &wl.touched;
+	int passes = 0;
+	for (;;) {
+		while (!wl.empty())
+			wl.visit(wl.next(), dfaVisits, dfaChanges, true);
+		// A checking pass over all statements, in case of a change that did not come through meetWithFor() (e.g. a
+		// Type object shared by two statements). Usually there is no change, and this is the final pass the round
+		// robin algorithm needed anyway
+		passes++;
+		bool ch = false;
+		for (it = stmts.begin(); it != stmts.end(); it++)
+			ch |= wl.visit(*it, dfaVisits, dfaChanges, false);
 		if (!ch)
-			// No more changes: round robin algorithm terminates
 			break;
 	}
-	if (ch)
-		LOG << "### WARNING: iteration limit exceeded for dfaTypeAnalysis of procedure " << getName() << " ###\n";
+	dfaTouched = NULL;
+	if (wl.numAtLimit)
+		LOG << "### WARNING: iteration limit reached " << wl.numAtLimit << " times in dfaTypeAnalysis of procedure " <<
+			getName() << " ###\n";
+	if (VERBOSE || DEBUG_TA)
+		LOG << "dfa type analysis of " << getName() << ": " << (int)stmts.size() << " statements, " << dfaVisits <<
+			" visits, " << dfaMeets << " meets, " << dfaChanges << " changes, " << passes << " checking passes\n";
 
 	if (DEBUG_TA) {
 		LOG << "\n ### results for data flow based type analysis for " << getName() << " ###\n";
-		LOG << iter << " iterations\n";
 		for (it = stmts.begin(); it != stmts.end(); it++) {
 			Statement* s = *it;
 			LOG << s << "\n";			// Print the statement; has dest type
@@ -604,14 +701,12 @@ Type* UnionType::meetWith(Type* other, bool& ch, bool bHighestPtr) {
 	}
 
 	// Other is not compatible with any of my component types. Add a new type
-	char name[20];
 #if PRINT_UNION											// Set above
 	if (unionCount == 999)								// Adjust the count to catch the one you want
 		std::cerr << "createUnion breakpokint\n";		// Note: you need two breakpoints (also in Type::createUnion)
 	std::cerr << "  " << ++unionCount << " Created union from " << getCtype() << " and " << other->getCtype();
 #endif
-	sprintf(name, "x%d", ++nextUnionNumber);
-	addType(other->clone(), name);
+	addType(other->clone(), unionMemberName(this).c_str());
 #if PRINT_UNION
 	std::cerr << ", result is " << getCtype() << "\n";
 #endif
@@ -681,6 +776,8 @@ Type* Statement::meetWithFor(Type* ty, Exp* e, bool& ch) {
 		ch = true;
 		setTypeFor(e, newType->clone());
 	}
+	if (proc)
+		proc->dfaNoteMeet(this, thisCh);		// So the worklist revisits this statement and its uses
 	return newType;
 }
 
@@ -706,16 +803,13 @@ Type* Type::createUnion(Type* other, bool& ch, bool bHighestPtr /* = false */) {
 			return other->clone();
 	}
 
-	char name[20];
 #if PRINT_UNION
 	if (unionCount == 999)								// Adjust the count to catch the one you want
 		std::cerr << "createUnion breakpokint\n";		// Note: you need two breakpoints (also in UnionType::meetWith)
 #endif
-	sprintf(name, "x%d", ++nextUnionNumber);
 	UnionType* u = new UnionType;
-	u->addType(this->clone(), name);
-	sprintf(name, "x%d", ++nextUnionNumber);
-	u->addType(other->clone(), name);
+	u->addType(this->clone(), unionMemberName(u).c_str());
+	u->addType(other->clone(), unionMemberName(u).c_str());
 	ch = true;
 #if PRINT_UNION
 	std::cerr << "  " << ++unionCount << " Created union from " << getCtype() << " and " << other->getCtype() <<
@@ -1491,14 +1585,12 @@ Type* Type::dereference() {
 // (note: should probably be bottom)
 Type* UnionType::dereferenceUnion() {
 	UnionType* ret = new UnionType;
-	char name[20];
 	std::list<UnionElement>::iterator it;
 	for (it = li.begin(); it != li.end(); it++) {
 		Type* elem = it->type->dereference();
 		if (elem->resolvesToVoid())
 			return elem;			// Return void for the whole thing
-		sprintf(name, "x%d", ++nextUnionNumber);
-		ret->addType(elem->clone(), name);
+		ret->addType(elem->clone(), unionMemberName(ret).c_str());
 	}
 	return ret;
 }
@@ -22,8 +22,14 @@
  * 17 Jul 04 - Mike: Fixed some functions that were returning the buffers
  *			   of std::strings allocated on the stack (affected Windows)
  * 23 Jul 04 - Mike: Implement SizeType
+ * 17 Oct 26 - UnionType::newMemberName; with -j, the members of a union added to another are renamed if their names
+ *			   clash
+ * 17 Oct 26 - The nesting of PointerType::operator== is counted per thread
+ * 17 Oct 26 - LOG statements are in the LCAT_TYPES log category
  */
 
+#define LOG_CATEGORY LCAT_TYPES		// The category of this file's LOG statements (see boomerang.h)
+
 #include <assert.h>
 #include <cstring>
 
@@ -36,6 +42,7 @@
 #include "signature.h"
 #include "boomerang.h"
 #include "log.h"
+#include "threads.h"
 #if defined(_MSC_VER) && _MSC_VER >= 1400
 #pragma warning(disable:4996)		// Warnings about e.g. _strdup deprecated in VS 2005
 #endif
@@ -457,16 +464,18 @@ bool FuncType::operator==(const Type& other) const {
 	return *signature == *((FuncType&)other).signature;
 }
 
-static int pointerCompareNest = 0;
+static ThreadLocal<void> pointerCompareNest;		// Per thread: types are compared on several threads with -j
 bool PointerType::operator==(const Type& other) const {
 //	return other.isPointer() && (*points_to == *((PointerType&)other).points_to);
 	if (!other.isPointer()) return false;
-	if (++pointerCompareNest >= 20) {
+	size_t nest = (size_t)pointerCompareNest.get();
+	if (nest + 1 >= 20) {
 		std::cerr << "PointerType operator== nesting depth exceeded!\n";
 		return true;
 	}
+	pointerCompareNest.set((void*)(nest + 1));
 	bool ret = (*points_to == *((PointerType&)other).points_to);
-	pointerCompareNest--;
+	pointerCompareNest.set((void*)nest);
 	return ret;
 }
 
@@ -1500,8 +1509,21 @@ ComplexTypeCompList& Type::compForAddress(ADDRESS addr, DataIntervalMap& dim) {
 void UnionType::addType(Type *n, const char *str) {
 	if (n->isUnion()) {
 		UnionType* utp = (UnionType*)n;
-		// Note: need to check for name clashes eventually
-		li.insert(li.end(), utp->li.begin(), utp->li.end());
+		if (Boomerang::get()->numThreads > 1) {
+			// Members are named per union (newMemberName), so rename those whose names clash
+			std::list<UnionElement>::iterator it, jt;
+			for (it = utp->li.begin(); it != utp->li.end(); it++) {
+				UnionElement ue = *it;
+				for (jt = li.begin(); jt != li.end(); jt++)
+					if (jt->name == ue.name)
+						break;
+				if (jt != li.end())
+					ue.name = newMemberName();
+				li.push_back(ue);
+			}
+		} else
+			// Note: need to check for name clashes eventually
+			li.insert(li.end(), utp->li.begin(), utp->li.end());
 	} else {
 		if (n->isPointer() && n->asPointer()->getPointsTo() == this) {		// Note: pointer comparison
 			n = new PointerType(new VoidType);
@@ -1515,6 +1537,19 @@ void UnionType::addType(Type *n, const char *str) {
 	}
 }
 
+std::string UnionType::newMemberName() {
+	for (unsigned n = li.size() + 1; ; n++) {
+		std::ostringstream ost;
+		ost << "x" << n;
+		std::list<UnionElement>::iterator it;
+		for (it = li.begin(); it != li.end(); it++)
+			if (it->name == ost.str())
+				break;
+		if (it == li.end())
+			return ost.str();
+	}
+}
+
 // Update this compound to use the fact that offset off has type ty
 void CompoundType::updateGenericMember(int off, Type* ty, bool& ch) {
 	assert(generic);
@@ -20,6 +20,7 @@
  *
  * 05 Sep 00 - Mike: moved getCodeInfo here from translate2c.cc
  * 10 Apr 02 - Mike: Mods for boomerang; put expSimplify here
+ * 17 Oct 26 - wallClock (was in phase.cpp)
  */
 
 #include <assert.h>
@@ -40,9 +41,11 @@
 
 #ifndef _WIN32
 #include <unistd.h>
+#include <sys/time.h>
 #define _FLOCK_
 #else
 #include <io.h>
+#include <windows.h>
 #endif
 
 #include <fcntl.h>
@@ -246,4 +249,15 @@ char* escapeStr(char* str) {
     return ret;
 }
 
-
+double wallClock() {
+#ifdef _WIN32
+	LARGE_INTEGER f, c;
+	QueryPerformanceFrequency(&f);
+	QueryPerformanceCounter(&c);
+	return (double)c.QuadPart * 1e6 / (double)f.QuadPart;
+#else
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1e6 + tv.tv_usec;
+#endif
+}